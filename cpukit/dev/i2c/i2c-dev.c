@@ -117,7 +117,9 @@ static const rtems_filesystem_file_handlers_r i2c_dev_handler = {
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .munmap_h = rtems_filesystem_default_munmap
 };
 
 static void i2c_dev_node_destroy(IMFS_jnode_t *node)
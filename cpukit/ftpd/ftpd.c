@@ -813,10 +813,18 @@ command_retrieve(FTPD_SessionInfo_t  *info, char const *filename)
 
     if(info->xfer_mode == TYPE_I)
     {
-      while ((n = read(fd, buf, FTPD_DATASIZE)) > 0)
+      off_t sent = 0;
+
+      /* Send the file without a copy through the data buffer */
+      if (sendfile(fd, s, 0, 0, NULL, &sent, 0) == 0)
+        n = 0;
+      else if (lseek(fd, sent, SEEK_SET) == sent)
       {
-        if(send(s, buf, n, 0) != n)
-          break;
+        while ((n = read(fd, buf, FTPD_DATASIZE)) > 0)
+        {
+          if(send(s, buf, n, 0) != n)
+            break;
+        }
       }
     }
     else if (info->xfer_mode == TYPE_A)
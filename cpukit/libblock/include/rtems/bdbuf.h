@@ -157,6 +157,14 @@ extern "C" {
  * most-resent read-ahead transfer.  The read-ahead works per disk, but all
  * transfers are issued by the read-ahead task.
  *
+ * Each disk tracks several read streams, so that parallel sequential reads of
+ * different files on one disk do not cancel each others read-ahead.  A read
+ * miss which continues no stream replaces the least recently used stream.
+ * The read-ahead window of a stream starts with a quarter of the maximum
+ * read-ahead blocks.  It doubles with each trigger hit up to the maximum and
+ * is halved in case a block within the most recent read-ahead range misses,
+ * since this indicates that read-ahead blocks were recycled before use.
+ *
  * The cache has the following lists of buffers:
  *  - LRU: Accessed or transfered buffers released in least recently used
  *  order.  Empty buffers will be placed to the front.
@@ -171,6 +179,23 @@ extern "C" {
  * issue with this design.  The reallocation of a group may forced recently
  * accessed buffers out of the cache when they should not.  The design should be
  * change to have groups on a LRU list if they have no buffers in use.
+ *
+ * The cache may be split into shards to reduce the lock contention on SMP
+ * configurations with parallel file system activity.  Each shard has its own
+ * lock, AVL tree, LRU, modified and synchronization lists and an equal part of
+ * the groups.  A buffer belongs to the shard of its group.  The shard of a
+ * block is selected by a hash of the disk device and the block stripe of the
+ * block.  A stripe is a range of consecutive media blocks, so that multiple
+ * block transfers usually stay within one shard.  A transfer never crosses a
+ * shard boundary.  The swap out task visits all shards, so the modified and
+ * synchronization semantics are the same as for a single shard cache.
+ *
+ * Instead of the AVL tree an open addressing hash index may be used to look
+ * up the buffers.  Each shard has a hash table with at least twice as many
+ * entries as buffers, so that the load factor never exceeds one half.  A
+ * look-up usually touches one or two table entries while a look-up in the AVL
+ * tree visits about log2 of the buffer count nodes.  The hash index needs one
+ * pointer per table entry in addition to the buffer descriptors.
  */
 /**@{**/
 
@@ -337,6 +362,8 @@ typedef struct rtems_bdbuf_buffer
                                   * part of. */
   uint32_t hold_timer;           /**< Timer to indicate how long a buffer
                                   * has been held in the cache modified. */
+  bool     read_ahead;           /**< The block was read by a read-ahead
+                                  * transfer and was not accessed since. */
 
   int   references;              /**< Allow reference counting by owner. */
   void* user;                    /**< User data. */
@@ -358,6 +385,8 @@ struct rtems_bdbuf_group
                                       * 2. */
   uint32_t            users;         /**< How many users the block has. */
   rtems_bdbuf_buffer* bdbuf;         /**< First BD this block covers. */
+  size_t              shard;         /**< Index of the cache shard owning
+                                      * this group. */
 };
 
 /**
@@ -389,6 +418,12 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority;     /**< Priority of the read-ahead
                                                 * task. */
+  size_t              shards;                  /**< Count of cache shards.  A
+                                                * value of zero is treated
+                                                * as one. */
+  bool                hash_index;              /**< Use a hash index instead
+                                                * of the AVL tree to look up
+                                                * buffers. */
 } rtems_bdbuf_config;
 
 /**
@@ -461,6 +496,12 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT (4096)
 
+/**
+ * Default count of cache shards.  A single shard uses one lock for the whole
+ * cache.
+ */
+#define RTEMS_BDBUF_CACHE_SHARDS_DEFAULT (1)
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
@@ -172,6 +172,36 @@ static inline void rtems_blkdev_request_done(
  */
 #define RTEMS_BLKDEV_START_BLOCK(req) (req->bufs[0].block)
 
+struct rtems_bdbuf_buffer;
+
+/**
+ * @brief Block device buffer read request.
+ *
+ * @see RTEMS_BLKIO_READBUFFER.
+ */
+typedef struct {
+  /**
+   * @brief The block to read.
+   */
+  rtems_blkdev_bnum block;
+
+  /**
+   * @brief The buffer of the block in case the read was successful.
+   *
+   * The buffer is in the access state, like a buffer obtained by
+   * rtems_bdbuf_read().
+   */
+  struct rtems_bdbuf_buffer *bd;
+
+  /**
+   * @brief Releases the buffer.
+   *
+   * A call of this function instead of rtems_bdbuf_release() avoids a link
+   * time dependency on the block device buffer cache.
+   */
+  rtems_status_code (*release)(struct rtems_bdbuf_buffer *bd);
+} rtems_blkdev_buffer_read;
+
 /**
  * @name IO Control Request Codes
  */
@@ -189,6 +219,8 @@ static inline void rtems_blkdev_request_done(
 #define RTEMS_BLKIO_PURGEDEV        _IO('B', 10)
 #define RTEMS_BLKIO_GETDEVSTATS     _IOR('B', 11, rtems_blkdev_stats *)
 #define RTEMS_BLKIO_RESETDEVSTATS   _IO('B', 12)
+#define RTEMS_BLKIO_GETWEARSTATS    _IOR('B', 13, rtems_blkdev_wear_stats *)
+#define RTEMS_BLKIO_READBUFFER      _IOWR('B', 14, rtems_blkdev_buffer_read)
 
 /** @} */
 
@@ -249,6 +281,27 @@ static inline int rtems_disk_fd_reset_device_stats(int fd)
   return ioctl(fd, RTEMS_BLKIO_RESETDEVSTATS);
 }
 
+static inline int rtems_disk_fd_get_wear_stats(
+  int fd,
+  rtems_blkdev_wear_stats *stats
+)
+{
+  return ioctl(fd, RTEMS_BLKIO_GETWEARSTATS, stats);
+}
+
+/**
+ * @brief Reads a block into a buffer of the block device buffer cache.
+ *
+ * The buffer must be released with the release function of the request.
+ */
+static inline int rtems_disk_fd_read_buffer(
+  int fd,
+  rtems_blkdev_buffer_read *req
+)
+{
+  return ioctl(fd, RTEMS_BLKIO_READBUFFER, req);
+}
+
 /**
  * @name Block Device Driver Capabilities
  */
@@ -351,6 +404,14 @@ void rtems_blkdev_print_stats(
   const rtems_printer* printer
 );
 
+/**
+ * @brief Prints the block device wear statistics.
+ */
+void rtems_blkdev_print_wear_stats(
+  const rtems_blkdev_wear_stats *stats,
+  const rtems_printer* printer
+);
+
 /**
  * @brief Block device statistics command.
  */
@@ -59,7 +59,14 @@ typedef int (*rtems_block_device_ioctl)(
 #define RTEMS_DISK_READ_AHEAD_NO_TRIGGER ((rtems_blkdev_bnum) -1)
 
 /**
- * @brief Block device read-ahead control.
+ * @brief Count of sequential read streams tracked per disk device.
+ */
+#define RTEMS_DISK_READ_AHEAD_STREAMS 4
+
+/**
+ * @brief Block device read-ahead stream control.
+ *
+ * A stream is a sequence of reads of ascending consecutive blocks.
  */
 typedef struct {
   /**
@@ -67,6 +74,11 @@ typedef struct {
    */
   rtems_chain_node node;
 
+  /**
+   * @brief The disk device of this stream.
+   */
+  rtems_disk_device *dd;
+
   /**
    * @brief Block value to trigger the read-ahead request.
    *
@@ -82,6 +94,46 @@ typedef struct {
    * be arbitrary.
    */
   rtems_blkdev_bnum next;
+
+  /**
+   * @brief Start block of the most recent read-ahead request.
+   *
+   * The blocks from this value up to the next value were read ahead.  A read
+   * miss within this range indicates that read-ahead blocks were recycled
+   * before use.
+   */
+  rtems_blkdev_bnum begin;
+
+  /**
+   * @brief Block count of the next read-ahead request.
+   *
+   * The window doubles with each trigger hit up to the configured maximum
+   * read-ahead blocks and is halved by a read miss within the read-ahead
+   * range.
+   */
+  uint32_t window;
+
+  /**
+   * @brief Value of the use counter at the most recent use of this stream.
+   *
+   * The least recently used stream is replaced by a new stream.
+   */
+  uint32_t last_use;
+} rtems_blkdev_read_ahead_stream;
+
+/**
+ * @brief Block device read-ahead control.
+ */
+typedef struct {
+  /**
+   * @brief The read-ahead streams of this disk.
+   */
+  rtems_blkdev_read_ahead_stream streams [RTEMS_DISK_READ_AHEAD_STREAMS];
+
+  /**
+   * @brief Use counter of the streams.
+   */
+  uint32_t use_counter;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -144,8 +196,88 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Read-ahead hit count.
+   *
+   * A read-ahead hit occurs in the rtems_bdbuf_read() function in case the
+   * block was read by a read-ahead transfer and is accessed for the first
+   * time.
+   */
+  uint32_t read_ahead_hits;
+
+  /**
+   * @brief Count of read-ahead blocks which were never read.
+   *
+   * A block read by a read-ahead transfer is wasted in case it is recycled,
+   * purged or obtained by rtems_bdbuf_get() before it is read.
+   */
+  uint32_t read_ahead_wasted;
 } rtems_blkdev_stats;
 
+/**
+ * @brief Block device wear statistics.
+ *
+ * These statistics are provided by drivers which translate blocks to pages of
+ * an erasable media, e.g. the flash disk driver.  The write amplification is
+ * the ratio of media page writes to host page writes.
+ *
+ * @see RTEMS_BLKIO_GETWEARSTATS.
+ */
+typedef struct {
+  /**
+   * @brief Count of erase blocks (segments) of the media.
+   */
+  uint32_t erase_blocks;
+
+  /**
+   * @brief Sum of the erase counts of all erase blocks.
+   */
+  uint32_t erase_count;
+
+  /**
+   * @brief Lowest erase count of an erase block.
+   */
+  uint32_t erase_count_min;
+
+  /**
+   * @brief Highest erase count of an erase block.
+   */
+  uint32_t erase_count_max;
+
+  /**
+   * @brief Count of compaction passes.
+   */
+  uint32_t compactions;
+
+  /**
+   * @brief Count of compaction passes carried out by a background task.
+   */
+  uint32_t background_compactions;
+
+  /**
+   * @brief Accumulated compaction time in microseconds.
+   */
+  uint64_t compaction_time;
+
+  /**
+   * @brief Longest compaction pass in microseconds.
+   */
+  uint32_t compaction_time_max;
+
+  /**
+   * @brief Count of pages written on behalf of block write requests.
+   */
+  uint64_t host_writes;
+
+  /**
+   * @brief Count of pages written to the media.
+   *
+   * This includes the host writes and the pages moved by compaction.
+   */
+  uint64_t media_writes;
+} rtems_blkdev_wear_stats;
+
 /**
  * @brief Description of a disk device (logical and physical disks).
  *
@@ -133,6 +133,12 @@
 #define RTEMS_FDISK_IOCTL_INFO_LEVEL   _IO('B', 132)
 #define RTEMS_FDISK_IOCTL_PRINT_STATUS _IO('B', 133)
 
+/*
+ * The wear statistics (erase counts, compaction time and write amplification)
+ * are available through the RTEMS_BLKIO_GETWEARSTATS block device IO control
+ * and the blkstats shell command.
+ */
+
 /**
  * @brief Flash Disk Monitoring Data allows a user to obtain
  * the current status of the disk.
@@ -398,6 +404,20 @@ typedef struct rtems_flashdisk_config
    */
   uint32_t                       avail_compact_segs;
   uint32_t                       info_level;     /**< Default info level. */
+  /**
+   * The number of segments when the background task is woken. In case the
+   * number of segments in the available queue is less than or equal to this
+   * number the background task compacts the disk. It is only used with the
+   * RTEMS_FDISK_BACKGROUND_COMPACT flag. Zero selects the available
+   * compacting segment count plus one, so the background task starts before
+   * the writes have to compact.
+   */
+  uint32_t                       compact_watermark;
+  /**
+   * The priority of the background task. Zero selects
+   * RTEMS_FDISK_BACKGROUND_PRIORITY.
+   */
+  rtems_task_priority            background_priority;
 } rtems_flashdisk_config;
 
 /*
@@ -405,12 +425,15 @@ typedef struct rtems_flashdisk_config
  */
 
 /**
- * Leave the erasing of used segment to the background handler.
+ * Leave the erasing of used segment to the background task.
  */
 #define RTEMS_FDISK_BACKGROUND_ERASE (1 << 0)
 
 /**
- * Leave the compacting of of used segment to the background handler.
+ * Leave the compacting of of used segment to the background task. The task
+ * is woken when the number of available segments drops to the compaction
+ * watermark. Writes still compact if the available compacting segment count
+ * is reached.
  */
 #define RTEMS_FDISK_BACKGROUND_COMPACT (1 << 1)
 
@@ -427,6 +450,19 @@ typedef struct rtems_flashdisk_config
  */
 #define RTEMS_FDISK_BLANK_CHECK_BEFORE_WRITE (1 << 3)
 
+/**
+ * Separate hot from cold data. Blocks written more than once are hot and are
+ * written to other segments than blocks written for the first time or moved
+ * by the compaction. Segments then tend to hold pages which become used
+ * together which reduces the pages to move and the write amplification.
+ */
+#define RTEMS_FDISK_HOT_COLD_SEPARATION (1 << 4)
+
+/**
+ * The default priority of the background task.
+ */
+#define RTEMS_FDISK_BACKGROUND_PRIORITY 100
+
 /**
  * Flash disk device driver initialization. Place in a table as the
  * initialisation entry and remainder of the entries are the
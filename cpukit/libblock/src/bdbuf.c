@@ -95,6 +95,38 @@ typedef struct rtems_bdbuf_waiters {
 #endif
 } rtems_bdbuf_waiters;
 
+/**
+ * A shard of the BD buffer cache.  Each shard covers a part of the groups and
+ * is protected by its own lock.
+ */
+typedef struct rtems_bdbuf_shard
+{
+  rtems_bdbuf_lock_type lock;            /**< The shard lock. It locks all
+                                          * shard data, BD and lists. */
+  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
+                                          * root of this shard. */
+  rtems_bdbuf_buffer** hash_table;       /**< Buffer descriptor lookup hash
+                                          * table of this shard.  It is only
+                                          * used if the hash index is
+                                          * enabled. */
+  size_t              hash_mask;         /**< The hash table size minus one.
+                                          * The size is a power of two. */
+  uint32_t            hash_shift;        /**< Shift to map a hash value to a
+                                          * hash table index. */
+  rtems_chain_control lru;               /**< Least recently used list */
+  rtems_chain_control modified;          /**< Modified buffers list */
+  rtems_chain_control sync;              /**< Buffers to sync list */
+
+  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
+                                          * ACCESS_CACHED, ACCESS_MODIFIED or
+                                          * ACCESS_EMPTY
+                                          * state. */
+  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
+                                          * state. */
+  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
+                                          * available. */
+} rtems_bdbuf_shard;
+
 /**
  * The BD buffer cache.
  */
@@ -116,8 +148,12 @@ typedef struct rtems_bdbuf_cache
                                           * buffer size that fit in a group. */
   uint32_t            flags;             /**< Configuration flags. */
 
-  rtems_bdbuf_lock_type lock;            /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+  /**
+   * The cache lock.  It protects the cache state not covered by a shard lock:
+   * the read-ahead state and statistics of the devices, the read-ahead chain
+   * and the free swapout workers.  It is held only for short sections.
+   */
+  RTEMS_INTERRUPT_LOCK_MEMBER (lock)
   rtems_bdbuf_lock_type sync_lock;       /**< Sync calls block writes. */
   bool                sync_active;       /**< True if a sync is active. */
   rtems_id            sync_requester;    /**< The sync requester. */
@@ -125,20 +161,14 @@ typedef struct rtems_bdbuf_cache
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
-  rtems_chain_control lru;               /**< Least recently used list */
-  rtems_chain_control modified;          /**< Modified buffers list */
-  rtems_chain_control sync;              /**< Buffers to sync list */
-
-  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
-                                          * ACCESS_CACHED, ACCESS_MODIFIED or
-                                          * ACCESS_EMPTY
-                                          * state. */
-  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
-                                          * state. */
-  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
-                                          * available. */
+  bool                hash_index;        /**< Use the hash index instead of
+                                          * the AVL tree to look up
+                                          * buffers. */
+  size_t              shard_count;       /**< The number of shards. */
+  rtems_bdbuf_shard*  shards;            /**< The shards.  To change the
+                                          * synchronization state all shards
+                                          * must be locked.  A single locked
+                                          * shard is sufficient to read it. */
 
   rtems_bdbuf_swapout_transfer *swapout_transfer;
   rtems_bdbuf_swapout_worker *swapout_workers;
@@ -270,18 +300,26 @@ rtems_bdbuf_show_usage (void)
   uint32_t total = 0;
   uint32_t val;
 
+  size_t   shard;
+
   for (group = 0; group < bdbuf_cache.group_count; group++)
     total += bdbuf_cache.groups[group].users;
   printf ("bdbuf:group users=%lu", total);
-  val = rtems_bdbuf_list_count (&bdbuf_cache.lru);
-  printf (", lru=%lu", val);
-  total = val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.modified);
-  printf (", mod=%lu", val);
-  total += val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.sync);
-  printf (", sync=%lu", val);
-  total += val;
+  total = 0;
+  for (shard = 0; shard < bdbuf_cache.shard_count; shard++)
+  {
+    rtems_bdbuf_shard* s = &bdbuf_cache.shards[shard];
+    printf (", [%zu]", shard);
+    val = rtems_bdbuf_list_count (&s->lru);
+    printf (" lru=%lu", val);
+    total += val;
+    val = rtems_bdbuf_list_count (&s->modified);
+    printf (" mod=%lu", val);
+    total += val;
+    val = rtems_bdbuf_list_count (&s->sync);
+    printf (" sync=%lu", val);
+    total += val;
+  }
   printf (", total=%lu\n", total);
 }
 
@@ -297,9 +335,10 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
   const char* states[] =
     { "FR", "EM", "CH", "AC", "AM", "AE", "AP", "MD", "SY", "TR", "TP" };
 
-  printf ("bdbuf:users: %15s: [%" PRIu32 " (%s)] %td:%td = %" PRIu32 " %s\n",
+  printf ("bdbuf:users: %15s: [%" PRIu32 " (%s)] %zu:%td:%td = %" PRIu32 " %s\n",
           where,
           bd->block, states[bd->state],
+          bd->group->shard,
           bd->group - bdbuf_cache.groups,
           bd - bdbuf_cache.bds,
           bd->group->users,
@@ -898,6 +937,216 @@ rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
   return 0;
 }
 
+/**
+ * Minimum size of the hash table of a shard.
+ */
+#define RTEMS_BDBUF_HASH_MIN_SIZE (16)
+
+/**
+ * Returns the home index of the dd/block key in the hash table of the shard.
+ * The multiplicative hash spreads consecutive block numbers over the table.
+ *
+ * @param shard The shard owning the hash table.
+ * @param dd disk device key
+ * @param block block key
+ * @return The index of the first table entry to probe.
+ */
+static size_t
+rtems_bdbuf_hash_home (const rtems_bdbuf_shard *shard,
+                       const rtems_disk_device *dd,
+                       rtems_blkdev_bnum        block)
+{
+  uint32_t hash = (uint32_t) ((uintptr_t) dd >> 3);
+
+  hash = (hash * 0x85ebca6bU) ^ block;
+  hash *= 0x9e3779b1U;
+
+  return hash >> shard->hash_shift;
+}
+
+/**
+ * Searches for the buffer with specified dd/block in the hash table.
+ *
+ * @param shard The shard owning the hash table.
+ * @param dd disk device search key
+ * @param block block search key
+ * @retval NULL buffer with the specified dd/block is not found
+ * @return pointer to the buffer with specified dd/block
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_hash_search (const rtems_bdbuf_shard *shard,
+                         const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
+{
+  size_t              i = rtems_bdbuf_hash_home (shard, dd, block);
+  rtems_bdbuf_buffer* p;
+
+  while ((p = shard->hash_table [i]) != NULL)
+  {
+    if ((p->dd == dd) && (p->block == block))
+      break;
+
+    i = (i + 1) & shard->hash_mask;
+  }
+
+  return p;
+}
+
+/**
+ * Inserts the specified buffer into the hash table.  The table is never full
+ * since it has more entries than the shard has buffers.
+ *
+ * @param shard The shard owning the hash table.
+ * @param node Pointer to the buffer to add.
+ * @retval 0 The buffer added successfully
+ * @retval -1 A buffer with the same dd/block is already present
+ */
+static int
+rtems_bdbuf_hash_insert (rtems_bdbuf_shard  *shard,
+                         rtems_bdbuf_buffer *node)
+{
+  size_t              i = rtems_bdbuf_hash_home (shard, node->dd, node->block);
+  rtems_bdbuf_buffer* p;
+
+  while ((p = shard->hash_table [i]) != NULL)
+  {
+    if ((p->dd == node->dd) && (p->block == node->block))
+      return -1;
+
+    i = (i + 1) & shard->hash_mask;
+  }
+
+  shard->hash_table [i] = node;
+
+  return 0;
+}
+
+/**
+ * Removes the buffer from the hash table.  The following entries of the probe
+ * sequence are moved back into the gap, so no deleted markers are necessary
+ * and the look-up time does not degrade over time.
+ *
+ * @param shard The shard owning the hash table.
+ * @param node Pointer to the buffer to remove
+ * @retval 0 Item removed
+ * @retval -1 No such item found
+ */
+static int
+rtems_bdbuf_hash_remove (rtems_bdbuf_shard        *shard,
+                         const rtems_bdbuf_buffer *node)
+{
+  size_t              mask = shard->hash_mask;
+  size_t              i = rtems_bdbuf_hash_home (shard, node->dd, node->block);
+  size_t              j;
+  rtems_bdbuf_buffer* p;
+
+  while ((p = shard->hash_table [i]) != node)
+  {
+    if (p == NULL)
+      return -1;
+
+    i = (i + 1) & mask;
+  }
+
+  j = i;
+
+  while (true)
+  {
+    size_t home;
+
+    j = (j + 1) & mask;
+    p = shard->hash_table [j];
+
+    if (p == NULL)
+      break;
+
+    /*
+     * The entry may move into the gap only if its home index is not
+     * cyclically within (i, j].
+     */
+    home = rtems_bdbuf_hash_home (shard, p->dd, p->block);
+    if (((j - home) & mask) >= ((j - i) & mask))
+    {
+      shard->hash_table [i] = p;
+      i = j;
+    }
+  }
+
+  shard->hash_table [i] = NULL;
+
+  return 0;
+}
+
+/**
+ * Allocates the hash table of a shard for the specified count of buffers.
+ *
+ * @param shard The shard.
+ * @param bd_count The maximum count of buffers in the shard.
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_NO_MEMORY Not enough memory.
+ */
+static rtems_status_code
+rtems_bdbuf_hash_create (rtems_bdbuf_shard *shard, size_t bd_count)
+{
+  size_t   size = RTEMS_BDBUF_HASH_MIN_SIZE;
+  uint32_t shift = 32 - 4;
+
+  while (size < 2 * bd_count)
+  {
+    size <<= 1;
+    --shift;
+  }
+
+  shard->hash_table = calloc (sizeof (rtems_bdbuf_buffer*), size);
+  if (shard->hash_table == NULL)
+    return RTEMS_NO_MEMORY;
+
+  shard->hash_mask = size - 1;
+  shard->hash_shift = shift;
+
+  return RTEMS_SUCCESSFUL;
+}
+
+/**
+ * Searches for the buffer with specified dd/block in the look-up index of the
+ * shard.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_index_search (rtems_bdbuf_shard       *shard,
+                          const rtems_disk_device *dd,
+                          rtems_blkdev_bnum        block)
+{
+  if (bdbuf_cache.hash_index)
+    return rtems_bdbuf_hash_search (shard, dd, block);
+  else
+    return rtems_bdbuf_avl_search (&shard->tree, dd, block);
+}
+
+/**
+ * Inserts the buffer into the look-up index of the shard.
+ */
+static int
+rtems_bdbuf_index_insert (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
+{
+  if (bdbuf_cache.hash_index)
+    return rtems_bdbuf_hash_insert (shard, bd);
+  else
+    return rtems_bdbuf_avl_insert (&shard->tree, bd);
+}
+
+/**
+ * Removes the buffer from the look-up index of the shard.
+ */
+static int
+rtems_bdbuf_index_remove (rtems_bdbuf_shard        *shard,
+                          const rtems_bdbuf_buffer *bd)
+{
+  if (bdbuf_cache.hash_index)
+    return rtems_bdbuf_hash_remove (shard, bd);
+  else
+    return rtems_bdbuf_avl_remove (&shard->tree, bd);
+}
+
 static void
 rtems_bdbuf_set_state (rtems_bdbuf_buffer *bd, rtems_bdbuf_buf_state state)
 {
@@ -961,21 +1210,106 @@ rtems_bdbuf_unlock (rtems_bdbuf_lock_type *lock, uint32_t fatal_error_code)
 }
 
 /**
- * Lock the cache. A single task can nest calls.
+ * The count of media blocks of a stripe as a power of two.  Consecutive media
+ * blocks of a stripe belong to the same shard.
+ */
+#define RTEMS_BDBUF_SHARD_STRIPE_SHIFT 8
+
+/**
+ * Get the shard of a block of a device.
+ *
+ * @param dd The disk device.
+ * @param block The media block number.
+ * @return The shard responsible for the block.
+ */
+static rtems_bdbuf_shard *
+rtems_bdbuf_get_shard (const rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  uint32_t hash;
+
+  if (bdbuf_cache.shard_count == 1)
+    return &bdbuf_cache.shards [0];
+
+  hash = (uint32_t) ((uintptr_t) dd >> 3);
+  hash ^= block >> RTEMS_BDBUF_SHARD_STRIPE_SHIFT;
+  hash *= 0x9e3779b1U;
+  hash ^= hash >> 16;
+
+  return &bdbuf_cache.shards [hash % bdbuf_cache.shard_count];
+}
+
+/**
+ * Get the shard of a buffer.  This is the shard of its group.
+ */
+static rtems_bdbuf_shard *
+rtems_bdbuf_get_shard_of_buffer (const rtems_bdbuf_buffer *bd)
+{
+  return &bdbuf_cache.shards [bd->group->shard];
+}
+
+/**
+ * Lock a shard of the cache. A single task can nest calls.
+ *
+ * @param shard The shard to lock.
  */
 static void
-rtems_bdbuf_lock_cache (void)
+rtems_bdbuf_lock_shard (rtems_bdbuf_shard *shard)
 {
-  rtems_bdbuf_lock (&bdbuf_cache.lock, RTEMS_BDBUF_FATAL_CACHE_LOCK);
+  rtems_bdbuf_lock (&shard->lock, RTEMS_BDBUF_FATAL_CACHE_LOCK);
 }
 
 /**
- * Unlock the cache.
+ * Unlock a shard of the cache.
+ *
+ * @param shard The shard to unlock.
  */
 static void
-rtems_bdbuf_unlock_cache (void)
+rtems_bdbuf_unlock_shard (rtems_bdbuf_shard *shard)
 {
-  rtems_bdbuf_unlock (&bdbuf_cache.lock, RTEMS_BDBUF_FATAL_CACHE_UNLOCK);
+  rtems_bdbuf_unlock (&shard->lock, RTEMS_BDBUF_FATAL_CACHE_UNLOCK);
+}
+
+/**
+ * Lock all shards of the cache. The shards are locked in index order. This is
+ * the only place where a task holds more than one shard lock.
+ */
+static void
+rtems_bdbuf_lock_all_shards (void)
+{
+  size_t s;
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+    rtems_bdbuf_lock_shard (&bdbuf_cache.shards [s]);
+}
+
+/**
+ * Unlock all shards of the cache.
+ */
+static void
+rtems_bdbuf_unlock_all_shards (void)
+{
+  size_t s = bdbuf_cache.shard_count;
+
+  while (s > 0)
+    rtems_bdbuf_unlock_shard (&bdbuf_cache.shards [--s]);
+}
+
+/**
+ * Acquire the cache interrupt lock.
+ */
+static void
+rtems_bdbuf_acquire_cache_lock (rtems_interrupt_lock_context *lock_context)
+{
+  rtems_interrupt_lock_acquire (&bdbuf_cache.lock, lock_context);
+}
+
+/**
+ * Release the cache interrupt lock.
+ */
+static void
+rtems_bdbuf_release_cache_lock (rtems_interrupt_lock_context *lock_context)
+{
+  rtems_interrupt_lock_release (&bdbuf_cache.lock, lock_context);
 }
 
 /**
@@ -1046,11 +1380,12 @@ rtems_bdbuf_restore_preemption (rtems_mode prev_mode)
  *
  * A counter is used to save the release call when no one is waiting.
  *
- * The function assumes the cache is locked on entry and it will be locked on
+ * The function assumes the shard is locked on entry and it will be locked on
  * exit.
  */
 static void
-rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_anonymous_wait (rtems_bdbuf_shard   *shard,
+                            rtems_bdbuf_waiters *waiters)
 {
   /*
    * Indicate we are waiting.
@@ -1059,7 +1394,7 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
 
 #if defined(RTEMS_BDBUF_USE_PTHREAD)
   {
-    int eno = pthread_cond_wait (&waiters->cond_var, &bdbuf_cache.lock);
+    int eno = pthread_cond_wait (&waiters->cond_var, &shard->lock);
     if (eno != 0)
       rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_CV_WAIT);
   }
@@ -1081,9 +1416,9 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
     prev_mode = rtems_bdbuf_disable_preemption();
 
     /*
-     * Unlock the cache, wait, and lock the cache when we return.
+     * Unlock the shard, wait, and lock the shard when we return.
      */
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
 
     sc = rtems_semaphore_obtain (waiters->sema, RTEMS_WAIT, RTEMS_BDBUF_WAIT_TIMEOUT);
 
@@ -1093,7 +1428,7 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
     if (sc != RTEMS_UNSATISFIED)
       rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_CACHE_WAIT_2);
 
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_shard (shard);
 
     rtems_bdbuf_restore_preemption (prev_mode);
   }
@@ -1103,11 +1438,13 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
 }
 
 static void
-rtems_bdbuf_wait (rtems_bdbuf_buffer *bd, rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_wait (rtems_bdbuf_shard   *shard,
+                  rtems_bdbuf_buffer  *bd,
+                  rtems_bdbuf_waiters *waiters)
 {
   rtems_bdbuf_group_obtain (bd);
   ++bd->waiters;
-  rtems_bdbuf_anonymous_wait (waiters);
+  rtems_bdbuf_anonymous_wait (shard, waiters);
   --bd->waiters;
   rtems_bdbuf_group_release (bd);
 }
@@ -1143,27 +1480,48 @@ rtems_bdbuf_wake_swapper (void)
 }
 
 static bool
-rtems_bdbuf_has_buffer_waiters (void)
+rtems_bdbuf_has_buffer_waiters (const rtems_bdbuf_shard *shard)
 {
-  return bdbuf_cache.buffer_waiters.count;
+  return shard->buffer_waiters.count;
 }
 
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_tree (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_index_remove (shard, bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
+/**
+ * Account a block which was read ahead and never accessed.  The shard of the
+ * buffer must be locked.
+ */
+static void
+rtems_bdbuf_read_ahead_wasted (rtems_bdbuf_buffer *bd)
+{
+  if (bd->read_ahead)
+  {
+    rtems_interrupt_lock_context lock_context;
+
+    bd->read_ahead = false;
+
+    rtems_bdbuf_acquire_cache_lock (&lock_context);
+    ++bd->dd->stats.read_ahead_wasted;
+    rtems_bdbuf_release_cache_lock (&lock_context);
+  }
+}
+
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_shard  *shard,
+                                           rtems_bdbuf_buffer *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_read_ahead_wasted (bd);
+      rtems_bdbuf_remove_from_tree (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
@@ -1173,10 +1531,11 @@ rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_shard  *shard,
+                                           rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
-  rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_prepend_unprotected (&shard->lru, &bd->link);
 }
 
 static void
@@ -1186,30 +1545,33 @@ rtems_bdbuf_make_empty (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_shard  *shard,
+                                             rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
-  rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_append_unprotected (&shard->lru, &bd->link);
 }
 
 static void
-rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_read_ahead_wasted (bd);
   rtems_bdbuf_make_empty (bd);
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
-    rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+    rtems_bdbuf_remove_from_tree (shard, bd);
+    rtems_bdbuf_make_free_and_add_to_lru_list (shard, bd);
   }
 }
 
 static void
-rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_shard  *shard,
+                                               rtems_bdbuf_buffer *bd)
 {
   if (bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd)
   {
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
 
     /*
      * Wait for the sync lock.
@@ -1217,7 +1579,7 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     rtems_bdbuf_lock_sync ();
 
     rtems_bdbuf_unlock_sync ();
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_shard (shard);
   }
 
   /*
@@ -1236,24 +1598,25 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     bd->hold_timer = bdbuf_config.swap_block_hold;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_MODIFIED);
-  rtems_chain_append_unprotected (&bdbuf_cache.modified, &bd->link);
+  rtems_chain_append_unprotected (&shard->modified, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
-  else if (rtems_bdbuf_has_buffer_waiters ())
+    rtems_bdbuf_wake (&shard->access_waiters);
+  else if (rtems_bdbuf_has_buffer_waiters (shard))
     rtems_bdbuf_wake_swapper ();
 }
 
 static void
-rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_shard  *shard,
+                                          rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_group_release (bd);
-  rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
+  rtems_bdbuf_make_cached_and_add_to_lru_list (shard, bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
@@ -1281,28 +1644,32 @@ rtems_bdbuf_bds_per_group (size_t size)
 }
 
 static void
-rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_shard  *shard,
+                                         rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_group_release (bd);
-  rtems_bdbuf_discard_buffer (bd);
+  rtems_bdbuf_discard_buffer (shard, bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
  * from the ALV tree and any lists then the new BD's are prepended to the ready
- * list of the cache.
+ * list of the shard.
  *
+ * @param shard The shard owning the group.
  * @param group The group to reallocate.
  * @param new_bds_per_group The new count of BDs per group.
  * @return A buffer of this group.
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
+rtems_bdbuf_group_realloc (rtems_bdbuf_shard *shard,
+                           rtems_bdbuf_group *group,
+                           size_t             new_bds_per_group)
 {
   rtems_bdbuf_buffer* bd;
   size_t              b;
@@ -1318,7 +1685,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_tree_and_lru_list (shard, bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1326,16 +1693,17 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 1, bd = group->bdbuf + bufs_per_bd;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+    rtems_bdbuf_make_free_and_add_to_lru_list (shard, bd);
 
   if (b > 1)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 
   return group->bdbuf;
 }
 
 static void
-rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
+rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_shard  *shard,
+                                rtems_bdbuf_buffer *bd,
                                 rtems_disk_device  *dd,
                                 rtems_blkdev_bnum   block)
 {
@@ -1344,20 +1712,22 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
   bd->avl.left  = NULL;
   bd->avl.right = NULL;
   bd->waiters   = 0;
+  bd->read_ahead = false;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_index_insert (shard, bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_from_lru_list (rtems_bdbuf_shard *shard,
+                                      rtems_disk_device *dd,
                                       rtems_blkdev_bnum  block)
 {
-  rtems_chain_node *node = rtems_chain_first (&bdbuf_cache.lru);
+  rtems_chain_node *node = rtems_chain_first (&shard->lru);
 
-  while (!rtems_chain_is_tail (&bdbuf_cache.lru, node))
+  while (!rtems_chain_is_tail (&shard->lru, node))
   {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
@@ -1375,17 +1745,18 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_remove_from_tree_and_lru_list (shard, bd);
 
         empty_bd = bd;
       }
       else if (bd->group->users == 0)
-        empty_bd = rtems_bdbuf_group_realloc (bd->group, dd->bds_per_group);
+        empty_bd = rtems_bdbuf_group_realloc (shard, bd->group,
+                                              dd->bds_per_group);
     }
 
     if (empty_bd != NULL)
     {
-      rtems_bdbuf_setup_empty_buffer (empty_bd, dd, block);
+      rtems_bdbuf_setup_empty_buffer (shard, empty_bd, dd, block);
 
       return empty_bd;
     }
@@ -1506,6 +1877,62 @@ rtems_bdbuf_read_request_size (uint32_t transfer_count)
     + sizeof (rtems_blkdev_sg_buffer) * transfer_count;
 }
 
+static rtems_status_code
+rtems_bdbuf_shard_create (rtems_bdbuf_shard *shard)
+{
+  rtems_status_code sc;
+
+  rtems_chain_initialize_empty (&shard->lru);
+  rtems_chain_initialize_empty (&shard->modified);
+  rtems_chain_initialize_empty (&shard->sync);
+
+  sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'C', 'l'),
+                                &shard->lock);
+  if (sc != RTEMS_SUCCESSFUL)
+    return sc;
+
+  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'a'),
+                                  &shard->access_waiters);
+  if (sc != RTEMS_SUCCESSFUL)
+    goto error_access;
+
+  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 't'),
+                                  &shard->transfer_waiters);
+  if (sc != RTEMS_SUCCESSFUL)
+    goto error_transfer;
+
+  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'b'),
+                                  &shard->buffer_waiters);
+  if (sc != RTEMS_SUCCESSFUL)
+    goto error_buffer;
+
+  return RTEMS_SUCCESSFUL;
+
+error_buffer:
+
+  rtems_bdbuf_waiter_delete (&shard->transfer_waiters);
+
+error_transfer:
+
+  rtems_bdbuf_waiter_delete (&shard->access_waiters);
+
+error_access:
+
+  rtems_bdbuf_lock_delete (&shard->lock);
+
+  return sc;
+}
+
+static void
+rtems_bdbuf_shard_delete (rtems_bdbuf_shard *shard)
+{
+  free (shard->hash_table);
+  rtems_bdbuf_waiter_delete (&shard->buffer_waiters);
+  rtems_bdbuf_waiter_delete (&shard->transfer_waiters);
+  rtems_bdbuf_waiter_delete (&shard->access_waiters);
+  rtems_bdbuf_lock_delete (&shard->lock);
+}
+
 static rtems_status_code
 rtems_bdbuf_do_init (void)
 {
@@ -1513,6 +1940,8 @@ rtems_bdbuf_do_init (void)
   rtems_bdbuf_buffer* bd;
   uint8_t*            buffer;
   size_t              b;
+  size_t              shards_created = 0;
+  size_t              groups_per_shard;
   rtems_status_code   sc;
 
   if (rtems_bdbuf_tracer)
@@ -1535,52 +1964,51 @@ rtems_bdbuf_do_init (void)
   bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
 
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
-  rtems_chain_initialize_empty (&bdbuf_cache.lru);
-  rtems_chain_initialize_empty (&bdbuf_cache.modified);
-  rtems_chain_initialize_empty (&bdbuf_cache.sync);
   rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
+  rtems_interrupt_lock_initialize (&bdbuf_cache.lock, "bdbuf");
 
   /*
-   * Create the locks for the cache.
+   * Compute the various number of elements in the cache.
    */
+  bdbuf_cache.buffer_min_count =
+    bdbuf_config.size / bdbuf_config.buffer_min;
+  bdbuf_cache.max_bds_per_group =
+    bdbuf_config.buffer_max / bdbuf_config.buffer_min;
+  bdbuf_cache.group_count =
+    bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
 
-  sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'C', 'l'),
-                                &bdbuf_cache.lock);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
-
-  rtems_bdbuf_lock_cache ();
+  /*
+   * Each shard needs at least one group.
+   */
+  bdbuf_cache.shard_count = bdbuf_config.shards;
+  if (bdbuf_cache.shard_count == 0)
+    bdbuf_cache.shard_count = 1;
+  if (bdbuf_cache.shard_count > bdbuf_cache.group_count
+      && bdbuf_cache.group_count > 0)
+    bdbuf_cache.shard_count = bdbuf_cache.group_count;
 
-  sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'C', 's'),
-                                &bdbuf_cache.sync_lock);
-  if (sc != RTEMS_SUCCESSFUL)
+  /*
+   * Create the shards with their locks.
+   */
+  bdbuf_cache.shards = calloc (sizeof (rtems_bdbuf_shard),
+                               bdbuf_cache.shard_count);
+  if (!bdbuf_cache.shards)
     goto error;
 
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'a'),
-                                  &bdbuf_cache.access_waiters);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
+  while (shards_created < bdbuf_cache.shard_count)
+  {
+    sc = rtems_bdbuf_shard_create (&bdbuf_cache.shards [shards_created]);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
 
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 't'),
-                                  &bdbuf_cache.transfer_waiters);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
+    ++shards_created;
+  }
 
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'b'),
-                                  &bdbuf_cache.buffer_waiters);
+  sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'C', 's'),
+                                &bdbuf_cache.sync_lock);
   if (sc != RTEMS_SUCCESSFUL)
     goto error;
 
-  /*
-   * Compute the various number of elements in the cache.
-   */
-  bdbuf_cache.buffer_min_count =
-    bdbuf_config.size / bdbuf_config.buffer_min;
-  bdbuf_cache.max_bds_per_group =
-    bdbuf_config.buffer_max / bdbuf_config.buffer_min;
-  bdbuf_cache.group_count =
-    bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
-
   /*
    * Allocate the memory for the buffer descriptors.
    */
@@ -1607,38 +2035,72 @@ rtems_bdbuf_do_init (void)
   if (bdbuf_cache.buffers == NULL)
     goto error;
 
+  /*
+   * The groups are divided evenly among the shards.  The last shard takes the
+   * remainder.
+   */
+  groups_per_shard = bdbuf_cache.group_count / bdbuf_cache.shard_count;
+
+  for (b = 0,
+         group = bdbuf_cache.groups,
+         bd = bdbuf_cache.bds;
+       b < bdbuf_cache.group_count;
+       b++,
+         group++,
+         bd += bdbuf_cache.max_bds_per_group)
+  {
+    size_t shard = b / groups_per_shard;
+
+    if (shard >= bdbuf_cache.shard_count)
+      shard = bdbuf_cache.shard_count - 1;
+
+    group->bds_per_group = bdbuf_cache.max_bds_per_group;
+    group->bdbuf = bd;
+    group->shard = shard;
+  }
+
+  /*
+   * Allocate the hash tables sized for the buffers of each shard.
+   */
+  bdbuf_cache.hash_index = bdbuf_config.hash_index;
+
+  if (bdbuf_cache.hash_index)
+  {
+    for (b = 0; b < bdbuf_cache.shard_count; b++)
+    {
+      size_t groups = groups_per_shard;
+
+      if (b == bdbuf_cache.shard_count - 1)
+        groups = bdbuf_cache.group_count - b * groups_per_shard;
+
+      sc = rtems_bdbuf_hash_create (&bdbuf_cache.shards [b],
+                                    groups * bdbuf_cache.max_bds_per_group);
+      if (sc != RTEMS_SUCCESSFUL)
+        goto error;
+    }
+  }
+
   /*
    * The cache is empty after opening so we need to add all the buffers to it
-   * and initialise the groups.
+   * and initialise the groups.  Only buffers covered by a group are usable.
    */
   for (b = 0, group = bdbuf_cache.groups,
          bd = bdbuf_cache.bds, buffer = bdbuf_cache.buffers;
-       b < bdbuf_cache.buffer_min_count;
+       b < bdbuf_cache.group_count * bdbuf_cache.max_bds_per_group;
        b++, bd++, buffer += bdbuf_config.buffer_min)
   {
     bd->dd    = BDBUF_INVALID_DEV;
     bd->group  = group;
     bd->buffer = buffer;
 
-    rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+    rtems_chain_append_unprotected (&bdbuf_cache.shards [group->shard].lru,
+                                    &bd->link);
 
     if ((b % bdbuf_cache.max_bds_per_group) ==
         (bdbuf_cache.max_bds_per_group - 1))
       group++;
   }
 
-  for (b = 0,
-         group = bdbuf_cache.groups,
-         bd = bdbuf_cache.bds;
-       b < bdbuf_cache.group_count;
-       b++,
-         group++,
-         bd += bdbuf_cache.max_bds_per_group)
-  {
-    group->bds_per_group = bdbuf_cache.max_bds_per_group;
-    group->bdbuf = bd;
-  }
-
   /*
    * Create and start swapout task.
    */
@@ -1688,8 +2150,6 @@ rtems_bdbuf_do_init (void)
       goto error;
   }
 
-  rtems_bdbuf_unlock_cache ();
-
   return RTEMS_SUCCESSFUL;
 
 error:
@@ -1724,16 +2184,14 @@ error:
   free (bdbuf_cache.swapout_transfer);
   free (bdbuf_cache.swapout_workers);
 
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.buffer_waiters);
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.access_waiters);
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.transfer_waiters);
   rtems_bdbuf_lock_delete (&bdbuf_cache.sync_lock);
 
-  if (bdbuf_cache.lock != 0)
-  {
-    rtems_bdbuf_unlock_cache ();
-    rtems_bdbuf_lock_delete (&bdbuf_cache.lock);
-  }
+  while (shards_created > 0)
+    rtems_bdbuf_shard_delete (&bdbuf_cache.shards [--shards_created]);
+
+  free (bdbuf_cache.shards);
+
+  rtems_interrupt_lock_destroy (&bdbuf_cache.lock);
 
   return RTEMS_UNSATISFIED;
 }
@@ -1781,7 +2239,7 @@ rtems_bdbuf_wait_for_transient_event (void)
 }
 
 static void
-rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_access (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1799,12 +2257,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_7);
@@ -1813,11 +2271,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_shard  *shard,
+                                              rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
   rtems_chain_extract_unprotected (&bd->link);
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&shard->sync, &bd->link);
   rtems_bdbuf_wake_swapper ();
 }
 
@@ -1828,7 +2287,7 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
  * @retval @c false Buffer is invalid and has to searched again.
  */
 static bool
-rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_recycle (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1837,7 +2296,7 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_FREE:
         return true;
       case RTEMS_BDBUF_STATE_MODIFIED:
-        rtems_bdbuf_request_sync_for_modified_buffer (bd);
+        rtems_bdbuf_request_sync_for_modified_buffer (shard, bd);
         break;
       case RTEMS_BDBUF_STATE_CACHED:
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -1851,19 +2310,19 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
            * pong with another recycle waiter.  The state of the buffer is
            * arbitrary afterwards.
            */
-          rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
           return false;
         }
       case RTEMS_BDBUF_STATE_ACCESS_CACHED:
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_8);
@@ -1872,7 +2331,8 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_shard  *shard,
+                                rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1889,7 +2349,7 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_9);
@@ -1898,26 +2358,27 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_buffer (void)
+rtems_bdbuf_wait_for_buffer (rtems_bdbuf_shard *shard)
 {
-  if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+  if (!rtems_chain_is_empty (&shard->modified))
     rtems_bdbuf_wake_swapper ();
 
-  rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+  rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_sync_after_access (rtems_bdbuf_shard  *shard,
+                               rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
 
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&shard->sync, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
 
   rtems_bdbuf_wake_swapper ();
-  rtems_bdbuf_wait_for_sync_done (bd);
+  rtems_bdbuf_wait_for_sync_done (shard, bd);
 
   /*
    * We may have created a cached or empty buffer which may be recycled.
@@ -1928,27 +2389,31 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
-      rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+      rtems_bdbuf_remove_from_tree (shard, bd);
+      rtems_bdbuf_make_free_and_add_to_lru_list (shard, bd);
     }
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
   }
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_read_ahead (rtems_bdbuf_shard *shard,
+                                       rtems_disk_device *dd,
                                        rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_index_search (shard, dd, block);
 
   if (bd == NULL)
   {
-    bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+    bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
     if (bd != NULL)
+    {
       rtems_bdbuf_group_obtain (bd);
+      bd->read_ahead = true;
+    }
   }
   else
     /*
@@ -1961,39 +2426,40 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_access (rtems_bdbuf_shard *shard,
+                                   rtems_disk_device *dd,
                                    rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_index_search (shard, dd, block);
 
     if (bd != NULL)
     {
       if (bd->group->bds_per_group != dd->bds_per_group)
       {
-        if (rtems_bdbuf_wait_for_recycle (bd))
+        if (rtems_bdbuf_wait_for_recycle (shard, bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
-          rtems_bdbuf_make_free_and_add_to_lru_list (bd);
-          rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_remove_from_tree_and_lru_list (shard, bd);
+          rtems_bdbuf_make_free_and_add_to_lru_list (shard, bd);
+          rtems_bdbuf_wake (&shard->buffer_waiters);
         }
         bd = NULL;
       }
     }
     else
     {
-      bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+      bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
       if (bd == NULL)
-        rtems_bdbuf_wait_for_buffer ();
+        rtems_bdbuf_wait_for_buffer (shard);
     }
   }
   while (bd == NULL);
 
-  rtems_bdbuf_wait_for_access (bd);
+  rtems_bdbuf_wait_for_access (shard, bd);
   rtems_bdbuf_group_obtain (bd);
 
   return bd;
@@ -2032,11 +2498,13 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
   rtems_bdbuf_buffer *bd = NULL;
   rtems_blkdev_bnum   media_block;
 
-  rtems_bdbuf_lock_cache ();
-
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
   {
+    rtems_bdbuf_shard *shard = rtems_bdbuf_get_shard (dd, media_block);
+
+    rtems_bdbuf_lock_shard (shard);
+
     /*
      * Print the block index relative to the physical disk.
      */
@@ -2044,11 +2512,15 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       printf ("bdbuf:get: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
 
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
+        /*
+         * The block will be overwritten, so the data read ahead is not used.
+         */
+        rtems_bdbuf_read_ahead_wasted (bd);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -2074,9 +2546,9 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       rtems_bdbuf_show_users ("get", bd);
       rtems_bdbuf_show_usage ();
     }
-  }
 
-  rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   *bd_ptr = bd;
 
@@ -2100,18 +2572,43 @@ rtems_bdbuf_transfer_done (rtems_blkdev_request* req, rtems_status_code status)
   rtems_event_transient_send (req->io_task);
 }
 
+static void
+rtems_bdbuf_wake_after_transfer (rtems_bdbuf_shard *shard,
+                                 bool               wake_transfer_waiters,
+                                 bool               wake_buffer_waiters)
+{
+  if (wake_transfer_waiters)
+    rtems_bdbuf_wake (&shard->transfer_waiters);
+
+  if (wake_buffer_waiters)
+    rtems_bdbuf_wake (&shard->buffer_waiters);
+}
+
+/**
+ * Execute a transfer request and wait for its completion.
+ *
+ * @param dd The disk device.
+ * @param req The transfer request.
+ * @param locked_shard The shard locked by the caller or NULL if the caller
+ * holds no shard lock.  All buffers of the request must belong to this shard
+ * in case it is not NULL.  The shard is unlocked during the transfer and
+ * locked again on return.  A request without a locked shard may contain
+ * buffers of several shards.
+ */
 static rtems_status_code
 rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
                                       rtems_blkdev_request *req,
-                                      bool                  cache_locked)
+                                      rtems_bdbuf_shard    *locked_shard)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
   uint32_t transfer_index = 0;
+  rtems_bdbuf_shard *shard = NULL;
   bool wake_transfer_waiters = false;
   bool wake_buffer_waiters = false;
+  rtems_interrupt_lock_context lock_context;
 
-  if (cache_locked)
-    rtems_bdbuf_unlock_cache ();
+  if (locked_shard != NULL)
+    rtems_bdbuf_unlock_shard (locked_shard);
 
   /* The return value will be ignored for transfer requests */
   dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
@@ -2120,9 +2617,8 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
   rtems_bdbuf_wait_for_transient_event ();
   sc = req->status;
 
-  rtems_bdbuf_lock_cache ();
-
   /* Statistics */
+  rtems_bdbuf_acquire_cache_lock (&lock_context);
   if (req->req == RTEMS_BLKDEV_REQ_READ)
   {
     dd->stats.read_blocks += req->bufnum;
@@ -2136,12 +2632,34 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     if (sc != RTEMS_SUCCESSFUL)
       ++dd->stats.write_errors;
   }
+  rtems_bdbuf_release_cache_lock (&lock_context);
 
   for (transfer_index = 0; transfer_index < req->bufnum; ++transfer_index)
   {
     rtems_bdbuf_buffer *bd = req->bufs [transfer_index].user;
+    rtems_bdbuf_shard *bd_shard = rtems_bdbuf_get_shard_of_buffer (bd);
     bool waiters = bd->waiters;
 
+    /*
+     * Only one shard is locked at a time.  Write requests are sorted by block
+     * number, so a shard change happens at most once per stripe.
+     */
+    if (bd_shard != shard)
+    {
+      if (shard != NULL)
+      {
+        rtems_bdbuf_wake_after_transfer (shard,
+                                         wake_transfer_waiters,
+                                         wake_buffer_waiters);
+        rtems_bdbuf_unlock_shard (shard);
+      }
+
+      shard = bd_shard;
+      wake_transfer_waiters = false;
+      wake_buffer_waiters = false;
+      rtems_bdbuf_lock_shard (shard);
+    }
+
     if (waiters)
       wake_transfer_waiters = true;
     else
@@ -2150,22 +2668,26 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     rtems_bdbuf_group_release (bd);
 
     if (sc == RTEMS_SUCCESSFUL && bd->state == RTEMS_BDBUF_STATE_TRANSFER)
-      rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
+      rtems_bdbuf_make_cached_and_add_to_lru_list (shard, bd);
     else
-      rtems_bdbuf_discard_buffer (bd);
+      rtems_bdbuf_discard_buffer (shard, bd);
 
     if (rtems_bdbuf_tracer)
       rtems_bdbuf_show_users ("transfer", bd);
   }
 
-  if (wake_transfer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+  if (shard != NULL)
+  {
+    rtems_bdbuf_wake_after_transfer (shard,
+                                     wake_transfer_waiters,
+                                     wake_buffer_waiters);
 
-  if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    if (shard != locked_shard)
+      rtems_bdbuf_unlock_shard (shard);
+  }
 
-  if (!cache_locked)
-    rtems_bdbuf_unlock_cache ();
+  if (locked_shard != NULL && shard != locked_shard)
+    rtems_bdbuf_lock_shard (locked_shard);
 
   if (sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED)
     return sc;
@@ -2173,8 +2695,13 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     return RTEMS_IO_ERROR;
 }
 
+/**
+ * Read a buffer and optionally the following blocks.  The following blocks are
+ * only read if they are not already in the cache and belong to the same shard.
+ */
 static rtems_status_code
-rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
+rtems_bdbuf_execute_read_request (rtems_bdbuf_shard  *shard,
+                                  rtems_disk_device  *dd,
                                   rtems_bdbuf_buffer *bd,
                                   uint32_t            transfer_count)
 {
@@ -2210,7 +2737,10 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
   {
     media_block += media_blocks_per_block;
 
-    bd = rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+    if (rtems_bdbuf_get_shard (dd, media_block) != shard)
+      break;
+
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
 
     if (bd == NULL)
       break;
@@ -2230,52 +2760,187 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
 
   req->bufnum = transfer_index;
 
-  return rtems_bdbuf_execute_transfer_request (dd, req, true);
+  return rtems_bdbuf_execute_transfer_request (dd, req, shard);
+}
+
+/**
+ * Returns the read-ahead window of a new stream.  It is a quarter of the
+ * maximum read-ahead blocks and at least one block.
+ */
+static uint32_t
+rtems_bdbuf_read_ahead_initial_window (void)
+{
+  return (bdbuf_config.max_read_ahead_blocks + 3) / 4;
 }
 
 static bool
-rtems_bdbuf_is_read_ahead_active (const rtems_disk_device *dd)
+rtems_bdbuf_is_read_ahead_active (const rtems_blkdev_read_ahead_stream *stream)
 {
-  return !rtems_chain_is_node_off_chain (&dd->read_ahead.node);
+  return !rtems_chain_is_node_off_chain (&stream->node);
 }
 
+/**
+ * Cancel the read-ahead request of the stream.  The cache interrupt lock must
+ * be acquired.
+ */
 static void
-rtems_bdbuf_read_ahead_cancel (rtems_disk_device *dd)
+rtems_bdbuf_read_ahead_cancel (rtems_blkdev_read_ahead_stream *stream)
 {
-  if (rtems_bdbuf_is_read_ahead_active (dd))
+  if (rtems_bdbuf_is_read_ahead_active (stream))
   {
-    rtems_chain_extract_unprotected (&dd->read_ahead.node);
-    rtems_chain_set_off_chain (&dd->read_ahead.node);
+    rtems_chain_extract_unprotected (&stream->node);
+    rtems_chain_set_off_chain (&stream->node);
   }
 }
 
 static void
 rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
 {
-  rtems_bdbuf_read_ahead_cancel (dd);
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  rtems_interrupt_lock_context lock_context;
+  size_t                       i;
+
+  rtems_bdbuf_acquire_cache_lock (&lock_context);
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i)
+  {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    rtems_bdbuf_read_ahead_cancel (stream);
+    stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  }
+
+  rtems_bdbuf_release_cache_lock (&lock_context);
+}
+
+/**
+ * Mark the stream as the most recently used stream of its device.  The cache
+ * interrupt lock must be acquired.
+ */
+static void
+rtems_bdbuf_read_ahead_use (rtems_disk_device              *dd,
+                            rtems_blkdev_read_ahead_stream *stream)
+{
+  stream->last_use = ++dd->read_ahead.use_counter;
+}
+
+/**
+ * Returns the stream of the device waiting for a read of the block or NULL.
+ * The cache interrupt lock must be acquired.
+ */
+static rtems_blkdev_read_ahead_stream *
+rtems_bdbuf_read_ahead_find (rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i)
+  {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    if (stream->trigger == block)
+      return stream;
+  }
+
+  return NULL;
+}
+
+/**
+ * Returns the stream of the device with the block in its most recent
+ * read-ahead range or NULL.  The cache interrupt lock must be acquired.
+ */
+static rtems_blkdev_read_ahead_stream *
+rtems_bdbuf_read_ahead_find_range (rtems_disk_device *dd,
+                                   rtems_blkdev_bnum  block)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i)
+  {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    if (stream->trigger != RTEMS_DISK_READ_AHEAD_NO_TRIGGER
+        && stream->begin <= block
+        && block < stream->next)
+      return stream;
+  }
+
+  return NULL;
+}
+
+/**
+ * Returns the stream of the device to be replaced by a new stream.  This is
+ * the first idle stream or the least recently used stream.  The cache
+ * interrupt lock must be acquired.
+ */
+static rtems_blkdev_read_ahead_stream *
+rtems_bdbuf_read_ahead_victim (rtems_disk_device *dd)
+{
+  rtems_blkdev_read_ahead_stream *victim = &dd->read_ahead.streams [0];
+  size_t                          i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i)
+  {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    if (stream->trigger == RTEMS_DISK_READ_AHEAD_NO_TRIGGER
+        && !rtems_bdbuf_is_read_ahead_active (stream))
+      return stream;
+
+    if ((int32_t) (stream->last_use - victim->last_use) < 0)
+      victim = stream;
+  }
+
+  return victim;
+}
+
+/**
+ * Start the stream with a read miss of the block.  The read-ahead is
+ * triggered by a read of the following block.  The cache interrupt lock must
+ * be acquired.
+ */
+static void
+rtems_bdbuf_read_ahead_start (rtems_disk_device              *dd,
+                              rtems_blkdev_read_ahead_stream *stream,
+                              rtems_blkdev_bnum               block)
+{
+  rtems_bdbuf_read_ahead_cancel (stream);
+  stream->trigger = block + 1;
+  stream->next = block + 2;
+  stream->begin = stream->next;
+  rtems_bdbuf_read_ahead_use (dd, stream);
 }
 
 static void
 rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
                                       rtems_blkdev_bnum  block)
 {
-  if (bdbuf_cache.read_ahead_task != 0
-      && dd->read_ahead.trigger == block
-      && !rtems_bdbuf_is_read_ahead_active (dd))
+  rtems_interrupt_lock_context    lock_context;
+  rtems_blkdev_read_ahead_stream *stream;
+  bool                            wake_up = false;
+
+  if (bdbuf_cache.read_ahead_task == 0)
+    return;
+
+  rtems_bdbuf_acquire_cache_lock (&lock_context);
+
+  stream = rtems_bdbuf_read_ahead_find (dd, block);
+
+  if (stream != NULL && !rtems_bdbuf_is_read_ahead_active (stream))
   {
-    rtems_status_code sc;
     rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
 
-    if (rtems_chain_is_empty (chain))
-    {
-      sc = rtems_event_send (bdbuf_cache.read_ahead_task,
-                             RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-      if (sc != RTEMS_SUCCESSFUL)
-        rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
-    }
+    rtems_bdbuf_read_ahead_use (dd, stream);
+    wake_up = rtems_chain_is_empty (chain);
+    rtems_chain_append_unprotected (chain, &stream->node);
+  }
 
-    rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
+  rtems_bdbuf_release_cache_lock (&lock_context);
+
+  if (wake_up)
+  {
+    rtems_status_code sc = rtems_event_send (bdbuf_cache.read_ahead_task,
+                                             RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
+    if (sc != RTEMS_SUCCESSFUL)
+      rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
   }
 }
 
@@ -2283,12 +2948,46 @@ static void
 rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
                                     rtems_blkdev_bnum  block)
 {
-  if (dd->read_ahead.trigger != block)
+  rtems_interrupt_lock_context    lock_context;
+  rtems_blkdev_read_ahead_stream *stream;
+
+  if (bdbuf_cache.read_ahead_task == 0)
+    return;
+
+  rtems_bdbuf_acquire_cache_lock (&lock_context);
+
+  stream = rtems_bdbuf_read_ahead_find (dd, block);
+
+  if (stream != NULL)
+  {
+    /*
+     * A sequential miss.  The read of the block triggers the read-ahead.
+     */
+    rtems_bdbuf_read_ahead_use (dd, stream);
+  }
+  else
   {
-    rtems_bdbuf_read_ahead_cancel (dd);
-    dd->read_ahead.trigger = block + 1;
-    dd->read_ahead.next = block + 2;
+    stream = rtems_bdbuf_read_ahead_find_range (dd, block);
+
+    if (stream != NULL)
+    {
+      /*
+       * The block was read ahead but got recycled before use.  Shrink the
+       * window and continue the stream with this block.
+       */
+      if (stream->window > 1)
+        stream->window /= 2;
+    }
+    else
+    {
+      stream = rtems_bdbuf_read_ahead_victim (dd);
+      stream->window = rtems_bdbuf_read_ahead_initial_window ();
+    }
+
+    rtems_bdbuf_read_ahead_start (dd, stream, block);
   }
+
+  rtems_bdbuf_release_cache_lock (&lock_context);
 }
 
 rtems_status_code
@@ -2300,30 +2999,42 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
   rtems_bdbuf_buffer   *bd = NULL;
   rtems_blkdev_bnum     media_block;
 
-  rtems_bdbuf_lock_cache ();
-
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
   {
+    rtems_bdbuf_shard           *shard = rtems_bdbuf_get_shard (dd, media_block);
+    rtems_interrupt_lock_context lock_context;
+
+    rtems_bdbuf_lock_shard (shard);
+
     if (rtems_bdbuf_tracer)
       printf ("bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
+        rtems_bdbuf_acquire_cache_lock (&lock_context);
         ++dd->stats.read_hits;
+        if (bd->read_ahead)
+          ++dd->stats.read_ahead_hits;
+        rtems_bdbuf_release_cache_lock (&lock_context);
+        bd->read_ahead = false;
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
+        rtems_bdbuf_acquire_cache_lock (&lock_context);
         ++dd->stats.read_hits;
+        rtems_bdbuf_release_cache_lock (&lock_context);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
+        rtems_bdbuf_acquire_cache_lock (&lock_context);
         ++dd->stats.read_misses;
+        rtems_bdbuf_release_cache_lock (&lock_context);
         rtems_bdbuf_set_read_ahead_trigger (dd, block);
-        sc = rtems_bdbuf_execute_read_request (dd, bd, 1);
+        sc = rtems_bdbuf_execute_read_request (shard, dd, bd, 1);
         if (sc == RTEMS_SUCCESSFUL)
         {
           rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
@@ -2340,18 +3051,20 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         break;
     }
 
+    rtems_bdbuf_unlock_shard (shard);
+
     rtems_bdbuf_check_read_ahead_trigger (dd, block);
   }
 
-  rtems_bdbuf_unlock_cache ();
-
   *bd_ptr = bd;
 
   return sc;
 }
 
 static rtems_status_code
-rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
+rtems_bdbuf_check_bd_and_lock_shard (rtems_bdbuf_buffer  *bd,
+                                     const char          *kind,
+                                     rtems_bdbuf_shard  **shard_ptr)
 {
   if (bd == NULL)
     return RTEMS_INVALID_ADDRESS;
@@ -2360,7 +3073,8 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
     printf ("bdbuf:%s: %" PRIu32 "\n", kind, bd->block);
     rtems_bdbuf_show_users (kind, bd);
   }
-  rtems_bdbuf_lock_cache();
+  *shard_ptr = rtems_bdbuf_get_shard_of_buffer (bd);
+  rtems_bdbuf_lock_shard (*shard_ptr);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2368,23 +3082,24 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
 rtems_status_code
 rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code  sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "release", &shard);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-      rtems_bdbuf_add_to_lru_list_after_access (bd);
+      rtems_bdbuf_add_to_lru_list_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_0);
@@ -2394,7 +3109,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2402,9 +3117,10 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 rtems_status_code
 rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code  sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release modified");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "release modified", &shard);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2413,10 +3129,10 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_6);
@@ -2426,7 +3142,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2434,9 +3150,10 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 rtems_status_code
 rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code  sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "sync");
+  sc = rtems_bdbuf_check_bd_and_lock_shard (bd, "sync", &shard);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2445,10 +3162,10 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_sync_after_access (bd);
+      rtems_bdbuf_sync_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_5);
@@ -2458,7 +3175,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2470,13 +3187,13 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd)
     printf ("bdbuf:syncdev: %08x\n", (unsigned) dd->dev);
 
   /*
-   * Take the sync lock before locking the cache. Once we have the sync lock we
-   * can lock the cache. If another thread has the sync lock it will cause this
-   * thread to block until it owns the sync lock then it can own the cache. The
-   * sync lock can only be obtained with the cache unlocked.
+   * Take the sync lock before locking the shards. Once we have the sync lock
+   * we can lock the shards. If another thread has the sync lock it will cause
+   * this thread to block until it owns the sync lock then it can own the
+   * shards. The sync lock can only be obtained with no shard locked.
    */
   rtems_bdbuf_lock_sync ();
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_shards ();
 
   /*
    * Set the cache to have a sync active for a specific device and let the swap
@@ -2490,7 +3207,7 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd)
   bdbuf_cache.sync_device    = dd;
 
   rtems_bdbuf_wake_swapper ();
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_shards ();
   rtems_bdbuf_wait_for_transient_event ();
   rtems_bdbuf_unlock_sync ();
 
@@ -2586,7 +3303,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
 
       if (write)
       {
-        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, false);
+        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, NULL);
 
         transfer->write_req.status = RTEMS_RESOURCE_IN_USE;
         transfer->write_req.bufnum = 0;
@@ -2610,6 +3327,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  * Process the modified list of buffers. There is a sync or modified list that
  * needs to be handled so we have a common function to do the work.
  *
+ * @param shard The locked shard of the chain.
  * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
  * device is selected so select the device of the first buffer to be written to
  * disk.
@@ -2621,7 +3339,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  *                    amount.
  */
 static void
-rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
+rtems_bdbuf_swapout_modified_processing (rtems_bdbuf_shard   *shard,
+                                         rtems_disk_device  **dd_ptr,
                                          rtems_chain_control* chain,
                                          rtems_chain_control* transfer,
                                          bool                 sync_active,
@@ -2655,7 +3374,7 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
        *       on TOD to be accurate. Does it matter ?
        */
       if (sync_all || (sync_active && (*dd_ptr == bd->dd))
-          || rtems_bdbuf_has_buffer_waiters ())
+          || rtems_bdbuf_has_buffer_waiters (shard))
         bd->hold_timer = 0;
 
       if (bd->hold_timer)
@@ -2728,12 +3447,12 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
 }
 
 /**
- * Process the cache's modified buffers. Check the sync list first then the
- * modified list extracting the buffers suitable to be written to disk. We have
- * a device at a time. The task level loop will repeat this operation while
- * there are buffers to be written. If the transfer fails place the buffers
- * back on the modified list and try again later. The cache is unlocked while
- * the buffers are being written to disk.
+ * Process the cache's modified buffers. Check the sync lists of all shards
+ * first then the modified lists extracting the buffers suitable to be written
+ * to disk. We have a device at a time. The task level loop will repeat this
+ * operation while there are buffers to be written. If the transfer fails place
+ * the buffers back on the modified list and try again later. The shards are
+ * unlocked while the buffers are being written to disk.
  *
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
@@ -2748,16 +3467,23 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
                                 bool                          update_timers,
                                 rtems_bdbuf_swapout_transfer* transfer)
 {
-  rtems_bdbuf_swapout_worker* worker;
-  bool                        transfered_buffers = false;
-  bool                        sync_active;
-
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_swapout_worker*  worker;
+  bool                         transfered_buffers = false;
+  bool                         sync_active;
+  rtems_disk_device*           sync_device;
+  rtems_bdbuf_shard*           shard;
+  size_t                       s;
+  rtems_interrupt_lock_context lock_context;
 
   /*
-   * To set this to true you need the cache and the sync lock.
+   * To set this to true you need all shard locks and the sync lock.  One
+   * shard lock is enough to read it.
    */
+  shard = &bdbuf_cache.shards [0];
+  rtems_bdbuf_lock_shard (shard);
   sync_active = bdbuf_cache.sync_active;
+  sync_device = bdbuf_cache.sync_device;
+  rtems_bdbuf_unlock_shard (shard);
 
   /*
    * If a sync is active do not use a worker because the current code does not
@@ -2772,8 +3498,10 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
     worker = NULL;
   else
   {
+    rtems_bdbuf_acquire_cache_lock (&lock_context);
     worker = (rtems_bdbuf_swapout_worker*)
       rtems_chain_get_unprotected (&bdbuf_cache.swapout_free_workers);
+    rtems_bdbuf_release_cache_lock (&lock_context);
     if (worker)
       transfer = &worker->transfer;
   }
@@ -2788,34 +3516,43 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
    * list. This means the dev is BDBUF_INVALID_DEV.
    */
   if (sync_active)
-    transfer->dd = bdbuf_cache.sync_device;
+    transfer->dd = sync_device;
 
   /*
-   * If we have any buffers in the sync queue move them to the modified
+   * If we have any buffers in the sync queues move them to the modified
    * list. The first sync buffer will select the device we use.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.sync,
-                                           &transfer->bds,
-                                           true, false,
-                                           timer_delta);
-
-  /*
-   * Process the cache's modified list.
-   */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.modified,
-                                           &transfer->bds,
-                                           sync_active,
-                                           update_timers,
-                                           timer_delta);
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    shard = &bdbuf_cache.shards [s];
+    rtems_bdbuf_lock_shard (shard);
+    rtems_bdbuf_swapout_modified_processing (shard,
+                                             &transfer->dd,
+                                             &shard->sync,
+                                             &transfer->bds,
+                                             true, false,
+                                             timer_delta);
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   /*
-   * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
-   * TRANSFER.
+   * Process the modified lists of the shards.  We have all the buffers that
+   * have been modified for this device in a shard so the shard can be
+   * unlocked because the state of each buffer has been set to TRANSFER.
    */
-  rtems_bdbuf_unlock_cache ();
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    shard = &bdbuf_cache.shards [s];
+    rtems_bdbuf_lock_shard (shard);
+    rtems_bdbuf_swapout_modified_processing (shard,
+                                             &transfer->dd,
+                                             &shard->modified,
+                                             &transfer->bds,
+                                             sync_active,
+                                             update_timers,
+                                             timer_delta);
+    rtems_bdbuf_unlock_shard (shard);
+  }
 
   /*
    * If there are buffers to transfer to the media transfer them.
@@ -2840,11 +3577,11 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   if (sync_active && !transfered_buffers)
   {
     rtems_id sync_requester;
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_all_shards ();
     sync_requester = bdbuf_cache.sync_requester;
     bdbuf_cache.sync_active = false;
     bdbuf_cache.sync_requester = 0;
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_all_shards ();
     if (sync_requester)
       rtems_event_transient_send (sync_requester);
   }
@@ -2865,18 +3602,18 @@ rtems_bdbuf_swapout_worker_task (rtems_task_argument arg)
 
   while (worker->enabled)
   {
+    rtems_interrupt_lock_context lock_context;
+
     rtems_bdbuf_wait_for_event (RTEMS_BDBUF_SWAPOUT_SYNC);
 
     rtems_bdbuf_swapout_write (&worker->transfer);
 
-    rtems_bdbuf_lock_cache ();
-
     rtems_chain_initialize_empty (&worker->transfer.bds);
     worker->transfer.dd = BDBUF_INVALID_DEV;
 
+    rtems_bdbuf_acquire_cache_lock (&lock_context);
     rtems_chain_append_unprotected (&bdbuf_cache.swapout_free_workers, &worker->link);
-
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_release_cache_lock (&lock_context);
   }
 
   free (worker);
@@ -2890,20 +3627,26 @@ rtems_bdbuf_swapout_worker_task (rtems_task_argument arg)
 static void
 rtems_bdbuf_swapout_workers_close (void)
 {
-  rtems_chain_node* node;
+  while (true)
+  {
+    rtems_interrupt_lock_context lock_context;
+    rtems_bdbuf_swapout_worker*  worker;
+
+    /*
+     * The events cannot be sent with the interrupt lock acquired, so take the
+     * workers off the chain one by one.
+     */
+    rtems_bdbuf_acquire_cache_lock (&lock_context);
+    worker = (rtems_bdbuf_swapout_worker*)
+      rtems_chain_get_unprotected (&bdbuf_cache.swapout_free_workers);
+    rtems_bdbuf_release_cache_lock (&lock_context);
 
-  rtems_bdbuf_lock_cache ();
+    if (worker == NULL)
+      break;
 
-  node = rtems_chain_first (&bdbuf_cache.swapout_free_workers);
-  while (!rtems_chain_is_tail (&bdbuf_cache.swapout_free_workers, node))
-  {
-    rtems_bdbuf_swapout_worker* worker = (rtems_bdbuf_swapout_worker*) node;
     worker->enabled = false;
     rtems_event_send (worker->id, RTEMS_BDBUF_SWAPOUT_SYNC);
-    node = rtems_chain_next (node);
   }
-
-  rtems_bdbuf_unlock_cache ();
 }
 
 /**
@@ -2988,7 +3731,8 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
 }
 
 static void
-rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
+rtems_bdbuf_purge_list (rtems_bdbuf_shard   *shard,
+                        rtems_chain_control *purge_list)
 {
   bool wake_buffer_waiters = false;
   rtems_chain_node *node = NULL;
@@ -3000,56 +3744,89 @@ rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
     if (bd->waiters == 0)
       wake_buffer_waiters = true;
 
-    rtems_bdbuf_discard_buffer (bd);
+    rtems_bdbuf_discard_buffer (shard, bd);
   }
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
+}
+
+static void
+rtems_bdbuf_gather_buffer_for_purge (rtems_bdbuf_shard   *shard,
+                                     rtems_chain_control *purge_list,
+                                     rtems_bdbuf_buffer  *bd)
+{
+  switch (bd->state)
+  {
+    case RTEMS_BDBUF_STATE_FREE:
+    case RTEMS_BDBUF_STATE_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+    case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+      break;
+    case RTEMS_BDBUF_STATE_SYNC:
+      rtems_bdbuf_wake (&shard->transfer_waiters);
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_MODIFIED:
+      rtems_bdbuf_group_release (bd);
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_CACHED:
+      rtems_chain_extract_unprotected (&bd->link);
+      rtems_chain_append_unprotected (purge_list, &bd->link);
+      break;
+    case RTEMS_BDBUF_STATE_TRANSFER:
+      rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
+      break;
+    case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+    case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+      rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_PURGED);
+      break;
+    default:
+      rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
+  }
+}
+
+static void
+rtems_bdbuf_gather_for_purge_in_hash (rtems_bdbuf_shard       *shard,
+                                      rtems_chain_control     *purge_list,
+                                      const rtems_disk_device *dd)
+{
+  size_t i;
+
+  /*
+   * Gathering does not change the hash table, the buffers are removed later
+   * by the purge of the list.
+   */
+  for (i = 0; i <= shard->hash_mask; ++i)
+  {
+    rtems_bdbuf_buffer *bd = shard->hash_table [i];
+
+    if (bd != NULL && bd->dd == dd)
+      rtems_bdbuf_gather_buffer_for_purge (shard, purge_list, bd);
+  }
 }
 
 static void
-rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
+rtems_bdbuf_gather_for_purge (rtems_bdbuf_shard       *shard,
+                              rtems_chain_control     *purge_list,
                               const rtems_disk_device *dd)
 {
   rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
   rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  rtems_bdbuf_buffer *cur = shard->tree;
+
+  if (bdbuf_cache.hash_index)
+  {
+    rtems_bdbuf_gather_for_purge_in_hash (shard, purge_list, dd);
+    return;
+  }
 
   *prev = NULL;
 
   while (cur != NULL)
   {
     if (cur->dd == dd)
-    {
-      switch (cur->state)
-      {
-        case RTEMS_BDBUF_STATE_FREE:
-        case RTEMS_BDBUF_STATE_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-          break;
-        case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_MODIFIED:
-          rtems_bdbuf_group_release (cur);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_CACHED:
-          rtems_chain_extract_unprotected (&cur->link);
-          rtems_chain_append_unprotected (purge_list, &cur->link);
-          break;
-        case RTEMS_BDBUF_STATE_TRANSFER:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
-          break;
-        case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-        case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
-          break;
-        default:
-          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
-      }
-    }
+      rtems_bdbuf_gather_buffer_for_purge (shard, purge_list, cur);
 
     if (cur->avl.left != NULL)
     {
@@ -3084,23 +3861,33 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
   }
 }
 
+/**
+ * Purge all buffers of the device.  All shards must be locked.
+ */
 static void
 rtems_bdbuf_do_purge_dev (rtems_disk_device *dd)
 {
-  rtems_chain_control purge_list;
+  size_t s;
 
-  rtems_chain_initialize_empty (&purge_list);
   rtems_bdbuf_read_ahead_reset (dd);
-  rtems_bdbuf_gather_for_purge (&purge_list, dd);
-  rtems_bdbuf_purge_list (&purge_list);
+
+  for (s = 0; s < bdbuf_cache.shard_count; ++s)
+  {
+    rtems_bdbuf_shard   *shard = &bdbuf_cache.shards [s];
+    rtems_chain_control  purge_list;
+
+    rtems_chain_initialize_empty (&purge_list);
+    rtems_bdbuf_gather_for_purge (shard, &purge_list, dd);
+    rtems_bdbuf_purge_list (shard, &purge_list);
+  }
 }
 
 void
 rtems_bdbuf_purge_dev (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_shards ();
   rtems_bdbuf_do_purge_dev (dd);
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_shards ();
 }
 
 rtems_status_code
@@ -3117,7 +3904,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
   if (sync)
     rtems_bdbuf_syncdev (dd);
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_shards ();
 
   if (block_size > 0)
   {
@@ -3155,7 +3942,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
     sc = RTEMS_INVALID_NUMBER;
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_shards ();
 
   return sc;
 }
@@ -3170,51 +3957,105 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
     rtems_chain_node *node;
 
     rtems_bdbuf_wait_for_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-    rtems_bdbuf_lock_cache ();
 
-    while ((node = rtems_chain_get_unprotected (chain)) != NULL)
+    while (true)
     {
-      rtems_disk_device *dd =
-        RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
-      rtems_blkdev_bnum block = dd->read_ahead.next;
+      rtems_interrupt_lock_context lock_context;
+      rtems_blkdev_read_ahead_stream *stream;
+      rtems_disk_device *dd;
+      rtems_blkdev_bnum block;
       rtems_blkdev_bnum media_block = 0;
-      rtems_status_code sc =
-        rtems_bdbuf_get_media_block (dd, block, &media_block);
+      rtems_status_code sc;
+
+      rtems_bdbuf_acquire_cache_lock (&lock_context);
+
+      node = rtems_chain_get_unprotected (chain);
+      if (node == NULL)
+      {
+        rtems_bdbuf_release_cache_lock (&lock_context);
+        break;
+      }
+
+      rtems_chain_set_off_chain (node);
+      stream = RTEMS_CONTAINER_OF (node, rtems_blkdev_read_ahead_stream, node);
+      dd = stream->dd;
+      block = stream->next;
 
-      rtems_chain_set_off_chain (&dd->read_ahead.node);
+      rtems_bdbuf_release_cache_lock (&lock_context);
+
+      sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
 
       if (sc == RTEMS_SUCCESSFUL)
       {
-        rtems_bdbuf_buffer *bd =
-          rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+        rtems_bdbuf_shard *shard = rtems_bdbuf_get_shard (dd, media_block);
+        rtems_bdbuf_buffer *bd;
+
+        rtems_bdbuf_lock_shard (shard);
+
+        bd = rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
 
         if (bd != NULL)
         {
           uint32_t transfer_count = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+          uint32_t max_transfer_count;
+
+          rtems_bdbuf_acquire_cache_lock (&lock_context);
 
-          if (transfer_count >= max_transfer_count)
+          /*
+           * A reader may have started a new read-ahead sequence in the
+           * meantime.  Do not overwrite its trigger in this case.
+           */
+          if (stream->next == block)
           {
-            transfer_count = max_transfer_count;
-            dd->read_ahead.trigger = block + transfer_count / 2;
-            dd->read_ahead.next = block + transfer_count;
+            /*
+             * The reader consumed the previous read-ahead range up to its
+             * trigger, so the stream is sequential.  Grow the window.
+             */
+            if (stream->begin < stream->next)
+            {
+              stream->window *= 2;
+              if (stream->window > bdbuf_config.max_read_ahead_blocks)
+                stream->window = bdbuf_config.max_read_ahead_blocks;
+            }
+
+            max_transfer_count = stream->window;
+
+            if (transfer_count >= max_transfer_count)
+            {
+              transfer_count = max_transfer_count;
+              stream->trigger = block + transfer_count / 2;
+              stream->begin = block;
+              stream->next = block + transfer_count;
+            }
+            else
+            {
+              stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+            }
           }
           else
           {
-            dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+            max_transfer_count = stream->window;
+
+            if (transfer_count > max_transfer_count)
+              transfer_count = max_transfer_count;
           }
 
           ++dd->stats.read_ahead_transfers;
-          rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
+
+          rtems_bdbuf_release_cache_lock (&lock_context);
+
+          rtems_bdbuf_execute_read_request (shard, dd, bd, transfer_count);
         }
+
+        rtems_bdbuf_unlock_shard (shard);
       }
       else
       {
-        dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        rtems_bdbuf_acquire_cache_lock (&lock_context);
+        stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        rtems_bdbuf_release_cache_lock (&lock_context);
       }
     }
-
-    rtems_bdbuf_unlock_cache ();
   }
 
   rtems_task_delete (RTEMS_SELF);
@@ -3223,14 +4064,18 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 void rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
                                    rtems_blkdev_stats      *stats)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_bdbuf_acquire_cache_lock (&lock_context);
   *stats = dd->stats;
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_release_cache_lock (&lock_context);
 }
 
 void rtems_bdbuf_reset_device_stats (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_bdbuf_acquire_cache_lock (&lock_context);
   memset (&dd->stats, 0, sizeof(dd->stats));
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_release_cache_lock (&lock_context);
 }
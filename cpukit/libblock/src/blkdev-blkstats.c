@@ -52,6 +52,7 @@ void rtems_blkstats(const rtems_printer* printer, const char *device, bool reset
           uint32_t media_block_count = 0;
           uint32_t block_size = 0;
           rtems_blkdev_stats stats;
+          rtems_blkdev_wear_stats wear_stats;
 
           rtems_disk_fd_get_media_block_size(fd, &media_block_size);
           rtems_disk_fd_get_block_count(fd, &media_block_count);
@@ -66,6 +67,11 @@ void rtems_blkstats(const rtems_printer* printer, const char *device, bool reset
               block_size,
               printer
             );
+
+            rv = rtems_disk_fd_get_wear_stats(fd, &wear_stats);
+            if (rv == 0) {
+              rtems_blkdev_print_wear_stats(&wear_stats, printer);
+            }
           } else {
             rtems_printf(printer, "error: get stats: %s\n", strerror(errno));
           }
@@ -224,7 +224,9 @@ static const rtems_filesystem_file_handlers_r rtems_blkdev_imfs_node = {
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .munmap_h = rtems_filesystem_default_munmap
 };
 
 static IMFS_jnode_t *rtems_blkdev_imfs_initialize(
@@ -71,6 +71,20 @@ rtems_blkdev_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
             rtems_bdbuf_reset_device_stats(dd);
             break;
 
+        case RTEMS_BLKIO_READBUFFER:
+        {
+            rtems_blkdev_buffer_read *read = argp;
+
+            sc = rtems_bdbuf_read(dd, read->block, &read->bd);
+            if (sc == RTEMS_SUCCESSFUL) {
+                read->release = rtems_bdbuf_release;
+            } else {
+                errno = EIO;
+                rc = -1;
+            }
+            break;
+        }
+
         default:
             errno = EINVAL;
             rc = -1;
@@ -46,6 +46,8 @@ void rtems_blkdev_print_stats(
      " READ HITS            | %" PRIu32 "\n"
      " READ MISSES          | %" PRIu32 "\n"
      " READ AHEAD TRANSFERS | %" PRIu32 "\n"
+     " READ AHEAD HITS      | %" PRIu32 "\n"
+     " READ AHEAD WASTED    | %" PRIu32 "\n"
      " READ BLOCKS          | %" PRIu32 "\n"
      " READ ERRORS          | %" PRIu32 "\n"
      " WRITE TRANSFERS      | %" PRIu32 "\n"
@@ -58,6 +60,8 @@ void rtems_blkdev_print_stats(
      stats->read_hits,
      stats->read_misses,
      stats->read_ahead_transfers,
+     stats->read_ahead_hits,
+     stats->read_ahead_wasted,
      stats->read_blocks,
      stats->read_errors,
      stats->write_transfers,
@@ -65,3 +69,42 @@ void rtems_blkdev_print_stats(
      stats->write_errors
   );
 }
+
+void rtems_blkdev_print_wear_stats(
+  const rtems_blkdev_wear_stats *stats,
+  const rtems_printer* printer
+)
+{
+  uint64_t write_amplification = 0;
+
+  if (stats->host_writes != 0) {
+    write_amplification = (100 * stats->media_writes) / stats->host_writes;
+  }
+
+  rtems_printf(
+     printer,
+     " ERASE BLOCKS         | %" PRIu32 "\n"
+     " ERASE COUNT          | %" PRIu32 "\n"
+     " ERASE COUNT MIN/MAX  | %" PRIu32 "/%" PRIu32 "\n"
+     " COMPACTIONS          | %" PRIu32 "\n"
+     " BG COMPACTIONS       | %" PRIu32 "\n"
+     " COMPACTION TIME      | %" PRIu64 " us\n"
+     " COMPACTION TIME MAX  | %" PRIu32 " us\n"
+     " HOST PAGE WRITES     | %" PRIu64 "\n"
+     " MEDIA PAGE WRITES    | %" PRIu64 "\n"
+     " WRITE AMPLIFICATION  | %" PRIu64 ".%02" PRIu64 "\n"
+     "----------------------+--------------------------------------------------------\n",
+     stats->erase_blocks,
+     stats->erase_count,
+     stats->erase_count_min,
+     stats->erase_count_max,
+     stats->compactions,
+     stats->background_compactions,
+     stats->compaction_time,
+     stats->compaction_time_max,
+     stats->host_writes,
+     stats->media_writes,
+     write_amplification / 100,
+     write_amplification % 100
+  );
+}
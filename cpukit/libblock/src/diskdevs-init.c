@@ -28,6 +28,18 @@
 
 #include <string.h>
 
+static void rtems_disk_init_read_ahead(rtems_disk_device *dd)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i) {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams[i];
+
+    stream->dd = dd;
+    stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  }
+}
+
 rtems_status_code rtems_disk_init_phys(
   rtems_disk_device *dd,
   uint32_t block_size,
@@ -45,7 +57,7 @@ rtems_status_code rtems_disk_init_phys(
   dd->media_block_size = block_size;
   dd->ioctl = handler;
   dd->driver_data = driver_data;
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  rtems_disk_init_read_ahead(dd);
 
   if (block_count > 0) {
     if ((*handler)(dd, RTEMS_BLKIO_CAPABILITIES, &dd->capabilities) != 0) {
@@ -77,7 +89,7 @@ rtems_status_code rtems_disk_init_log(
   dd->media_block_size = phys_dd->media_block_size;
   dd->ioctl = phys_dd->ioctl;
   dd->driver_data = phys_dd->driver_data;
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  rtems_disk_init_read_ahead(dd);
 
   if (phys_dd->phys_dev == phys_dd) {
     rtems_blkdev_bnum phys_block_count = phys_dd->size;
@@ -349,6 +349,12 @@ rtems_status_code rtems_disk_create_log(
 static void
 free_disk_device(rtems_disk_device *dd)
 {
+  /*
+   * The buffers of the disk device refer to it, for example to account read
+   * ahead blocks which were never used.
+   */
+  rtems_bdbuf_purge_dev(dd);
+
   if (is_physical_disk(dd)) {
     (*dd->ioctl)(dd, RTEMS_BLKIO_DELETED, NULL);
   }
@@ -55,6 +55,16 @@
 #define RTEMS_FDISK_TRACE 1
 #endif
 
+/**
+ * The event used to wake up the background task.
+ */
+#define RTEMS_FDISK_BACKGROUND_EVENT RTEMS_EVENT_0
+
+/**
+ * The stack size of the background task.
+ */
+#define RTEMS_FDISK_BACKGROUND_STACK_SIZE (2 * RTEMS_MINIMUM_STACK_SIZE)
+
 /**
  * The start of a segment has a segment control table. This hold the CRC and
  * block number for the page.
@@ -127,6 +137,13 @@ typedef struct rtems_fdisk_segment_ctl
 
   uint32_t failed;        /**< The segment has failed. */
 
+  /**
+   * The segment holds hot data, e.g. blocks which have been written more
+   * than once. Set when the first page of an erased segment is written and
+   * only used for the hot/cold data separation.
+   */
+  bool hot;
+
   uint32_t erased;        /**< Counter to debugging. Wear support would
                                remove this. */
 } rtems_fdisk_segment_ctl;
@@ -174,6 +191,8 @@ typedef struct rtems_flashdisk
   uint32_t compact_segs;                   /**< Max segs to compact at once. */
   uint32_t avail_compact_segs;             /**< The number of segments when
                                                 compaction occurs when writing. */
+  uint32_t compact_watermark;              /**< The number of segments when
+                                                the background task is woken. */
 
   uint32_t               block_size;       /**< The block size for this disk. */
   rtems_fdisk_block_ctl* blocks;           /**< The block to segment-page
@@ -202,6 +221,20 @@ typedef struct rtems_flashdisk
   uint32_t info_level;                     /**< The info trace level. */
 
   uint32_t starvations;                    /**< Erased blocks starvations counter. */
+
+  rtems_id background_task;                /**< The background compaction and
+                                                erase task, if configured. */
+
+  /*
+   * Wear statistics.
+   */
+  uint32_t erases;                         /**< Segment erase counter. */
+  uint32_t compactions;                    /**< Compaction pass counter. */
+  uint32_t background_compactions;         /**< Background compaction passes. */
+  uint64_t compaction_time;                /**< Total compaction time in us. */
+  uint32_t compaction_time_max;            /**< Longest compaction in us. */
+  uint64_t host_writes;                    /**< Pages written by requests. */
+  uint64_t media_writes;                   /**< Pages written to the flash. */
 } rtems_flashdisk;
 
 /**
@@ -733,6 +766,78 @@ rtems_fdisk_seg_most_available (const rtems_fdisk_segment_ctl_queue* queue)
   return biggest;
 }
 
+/**
+ * Is the segment erased, that is no page has been written since the last
+ * erase ?
+ */
+static bool
+rtems_fdisk_seg_is_erased (const rtems_fdisk_segment_ctl* sc)
+{
+  return (sc->pages_active == 0) && (sc->pages_used == 0);
+}
+
+/**
+ * Find the segment on the available queue the next block write goes to and
+ * remove it from the queue. The queue is sorted from the least to the most
+ * available pages so partially filled segments are used first. With hot/cold
+ * separation segments holding data of the other temperature are skipped
+ * unless there is no other segment.
+ */
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_seg_select (rtems_flashdisk* fd, bool hot)
+{
+  rtems_fdisk_segment_ctl* sc = fd->available.head;
+
+  if ((fd->flags & RTEMS_FDISK_HOT_COLD_SEPARATION))
+  {
+    while (sc)
+    {
+      if (rtems_fdisk_seg_is_erased (sc) || (sc->hot == hot))
+        break;
+      sc = sc->next;
+    }
+
+    if (!sc)
+      sc = fd->available.head;
+  }
+
+  if (sc)
+    rtems_fdisk_segment_queue_remove (&fd->available, sc);
+
+  return sc;
+}
+
+/**
+ * Find the segment compaction moves the active pages to. This is the segment
+ * with the most free pages. With hot/cold separation segments holding hot
+ * data are skipped unless there is no other segment. The moved pages
+ * survived at least one compaction so they are considered cold.
+ */
+static rtems_fdisk_segment_ctl*
+rtems_fdisk_seg_compact_dst (const rtems_flashdisk* fd)
+{
+  rtems_fdisk_segment_ctl* sc      = fd->available.head;
+  rtems_fdisk_segment_ctl* biggest = NULL;
+
+  if ((fd->flags & RTEMS_FDISK_HOT_COLD_SEPARATION) == 0)
+    return rtems_fdisk_seg_most_available (&fd->available);
+
+  while (sc)
+  {
+    if ((!sc->hot || rtems_fdisk_seg_is_erased (sc)) &&
+        (!biggest ||
+         (rtems_fdisk_seg_pages_available (sc) >
+          rtems_fdisk_seg_pages_available (biggest))))
+      biggest = sc;
+    sc = sc->next;
+  }
+
+  if (!biggest)
+    biggest = rtems_fdisk_seg_most_available (&fd->available);
+
+  return biggest;
+}
+
 /**
  * Is the segment all used ?
  */
@@ -912,6 +1017,7 @@ rtems_fdisk_seg_write_page (rtems_flashdisk*         fd,
       return ret;
   }
   --fd->erased_blocks;
+  ++fd->media_writes;
   return rtems_fdisk_seg_write (fd, sc,
                                 page * fd->block_size, buffer, fd->block_size);
 }
@@ -1090,6 +1196,7 @@ rtems_fdisk_erase_segment (rtems_flashdisk* fd, rtems_fdisk_segment_ctl* sc)
   }
 
   fd->erased_blocks += sc->pages;
+  fd->erases++;
   sc->erased++;
 
   memset (sc->page_descriptors, 0xff, sc->pages_desc * fd->block_size);
@@ -1295,6 +1402,9 @@ rtems_fdisk_recycle_segment (rtems_flashdisk*         fd,
                         ssc->device, ssc->segment, spage,
                         dsc->device, dsc->segment, dpage);
 #endif
+      if (rtems_fdisk_seg_is_erased (dsc))
+        dsc->hot = false;
+
       ret = rtems_fdisk_seg_copy_page (fd, ssc,
                                        spage + ssc->pages_desc,
                                        dsc,
@@ -1356,7 +1466,7 @@ rtems_fdisk_recycle_segment (rtems_flashdisk*         fd,
       dst_pages = rtems_fdisk_seg_pages_available (dsc);
       if (dst_pages == 0)
       {
-        dsc = rtems_fdisk_seg_most_available (&fd->available);
+        dsc = rtems_fdisk_seg_compact_dst (fd);
         if (!dsc)
         {
           if (ssc->pages_active == 0)
@@ -1408,7 +1518,7 @@ rtems_fdisk_recycle_segment (rtems_flashdisk*         fd,
  * number of active pages.
  */
 static int
-rtems_fdisk_compact (rtems_flashdisk* fd)
+rtems_fdisk_compact_segments (rtems_flashdisk* fd)
 {
   int ret;
   rtems_fdisk_segment_ctl* dsc;
@@ -1428,7 +1538,7 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
 
     if (ssc)
     {
-      dsc = rtems_fdisk_seg_most_available (&fd->available);
+      dsc = rtems_fdisk_seg_compact_dst (fd);
       if (dsc)
       {
         ret = rtems_fdisk_recycle_segment (fd, ssc, dsc, &pages);
@@ -1457,7 +1567,7 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
     rtems_fdisk_printf (fd, " compacting");
 #endif
 
-    dsc = rtems_fdisk_seg_most_available (&fd->available);
+    dsc = rtems_fdisk_seg_compact_dst (fd);
 
     if (dsc == 0)
     {
@@ -1536,6 +1646,116 @@ rtems_fdisk_compact (rtems_flashdisk* fd)
   return 0;
 }
 
+/**
+ * Compact the segments and account the pass in the wear statistics if
+ * pages have been moved or segments erased.
+ */
+static int
+rtems_fdisk_compact (rtems_flashdisk* fd)
+{
+  uint64_t start = rtems_clock_get_uptime_nanoseconds ();
+  uint64_t media_writes = fd->media_writes;
+  uint32_t erases = fd->erases;
+  int      ret;
+
+  ret = rtems_fdisk_compact_segments (fd);
+
+  if ((fd->media_writes != media_writes) || (fd->erases != erases))
+  {
+    uint32_t time;
+
+    time = (uint32_t) ((rtems_clock_get_uptime_nanoseconds () - start) / 1000);
+
+    fd->compactions++;
+    fd->compaction_time += time;
+    if (time > fd->compaction_time_max)
+      fd->compaction_time_max = time;
+  }
+
+  return ret;
+}
+
+/**
+ * Wake up the background task if there are segments to erase or the number
+ * of available segments dropped to the compaction watermark.
+ */
+static void
+rtems_fdisk_background_wakeup (rtems_flashdisk* fd)
+{
+  bool wakeup = false;
+
+  if (fd->background_task == 0)
+    return;
+
+  if ((fd->flags & RTEMS_FDISK_BACKGROUND_ERASE) && fd->erase.head)
+    wakeup = true;
+
+  if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT) && fd->used.head &&
+      (rtems_fdisk_segment_count_queue (&fd->available) <=
+       fd->compact_watermark))
+    wakeup = true;
+
+  if (wakeup)
+    rtems_event_send (fd->background_task, RTEMS_FDISK_BACKGROUND_EVENT);
+}
+
+/**
+ * The background task erases the used segments and compacts the disk until
+ * the number of available segments is above the compaction watermark. The
+ * disk lock is released between the compaction passes to let block requests
+ * through.
+ */
+static rtems_task
+rtems_fdisk_background (rtems_task_argument arg)
+{
+  rtems_flashdisk* fd = (rtems_flashdisk*) arg;
+
+  while (true)
+  {
+    rtems_event_set events;
+    bool            again = true;
+
+    rtems_event_receive (RTEMS_FDISK_BACKGROUND_EVENT,
+                         RTEMS_EVENT_ALL | RTEMS_WAIT,
+                         RTEMS_NO_TIMEOUT,
+                         &events);
+
+    while (again)
+    {
+      rtems_status_code sc;
+      uint32_t          compactions;
+      int               ret = 0;
+
+      sc = rtems_semaphore_obtain (fd->lock, RTEMS_WAIT, 0);
+      if (sc != RTEMS_SUCCESSFUL)
+        break;
+
+      if ((fd->flags & RTEMS_FDISK_BACKGROUND_ERASE))
+        rtems_fdisk_erase_used (fd);
+
+      compactions = fd->compactions;
+      again = false;
+
+      if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT) &&
+          (rtems_fdisk_segment_count_queue (&fd->available) <=
+           fd->compact_watermark))
+      {
+        ret = rtems_fdisk_compact (fd);
+
+        if (fd->compactions != compactions)
+        {
+          fd->background_compactions++;
+          again = (ret == 0) &&
+            (rtems_fdisk_segment_count_queue (&fd->available) <=
+             fd->compact_watermark);
+        }
+      }
+
+      rtems_semaphore_release (fd->lock);
+    }
+  }
+}
+
 /**
  * Recover the block mappings from the devices.
  */
@@ -1861,6 +2081,7 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
   rtems_fdisk_segment_ctl* sc;
   rtems_fdisk_page_desc*   pd;
   uint32_t                 page;
+  bool                     hot;
   int                      ret;
 
 #if RTEMS_FDISK_TRACE
@@ -1879,6 +2100,12 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
 
   bc = &fd->blocks[block];
 
+  /*
+   * A block written again is considered hot. This is used to separate the
+   * hot from the cold data if configured.
+   */
+  hot = bc->segment != NULL;
+
   /*
    * Does the page exist in flash ?
    */
@@ -1959,7 +2186,7 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
   /*
    * Get the next avaliable segment.
    */
-  sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
+  sc = rtems_fdisk_seg_select (fd, hot);
 
   /*
    * Is the flash disk full ?
@@ -1970,13 +2197,16 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
      * If compacting is configured for the background do it now
      * to see if we can get some space back.
      */
+    if ((fd->flags & RTEMS_FDISK_BACKGROUND_ERASE))
+      rtems_fdisk_erase_used (fd);
+
     if ((fd->flags & RTEMS_FDISK_BACKGROUND_COMPACT))
       rtems_fdisk_compact (fd);
 
     /*
      * Try again for some free space.
      */
-    sc = rtems_fdisk_segment_queue_pop_head (&fd->available);
+    sc = rtems_fdisk_seg_select (fd, hot);
 
     if (!sc)
     {
@@ -1995,6 +2225,9 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
   }
 #endif
 
+  if (rtems_fdisk_seg_is_erased (sc))
+    sc->hot = hot;
+
   /*
    * Find the next avaliable page in the segment.
    */
@@ -2050,6 +2283,7 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
         else
         {
           sc->pages_active++;
+          fd->host_writes++;
         }
       }
 
@@ -2058,6 +2292,8 @@ rtems_fdisk_write_block (rtems_flashdisk* fd,
       if (rtems_fdisk_is_erased_blocks_starvation (fd))
         rtems_fdisk_compact (fd);
 
+      rtems_fdisk_background_wakeup (fd);
+
       return ret;
     }
   }
@@ -2229,6 +2465,65 @@ rtems_fdisk_monitoring_data (rtems_flashdisk*          fd,
   return 0;
 }
 
+/**
+ * Flash Disk wear statistics are returned in the block device wear
+ * statistics structure.
+ */
+static int
+rtems_fdisk_wear_stats (const rtems_flashdisk*   fd,
+                        rtems_blkdev_wear_stats* stats)
+{
+  uint32_t i;
+  uint32_t j;
+
+  stats->erase_blocks    = 0;
+  stats->erase_count     = 0;
+  stats->erase_count_min = UINT32_MAX;
+  stats->erase_count_max = 0;
+
+  for (i = 0; i < fd->device_count; i++)
+  {
+    for (j = 0; j < fd->devices[i].segment_count; j++)
+    {
+      const rtems_fdisk_segment_ctl* sc = &fd->devices[i].segments[j];
+
+      stats->erase_blocks++;
+      stats->erase_count += sc->erased;
+      if (sc->erased < stats->erase_count_min)
+        stats->erase_count_min = sc->erased;
+      if (sc->erased > stats->erase_count_max)
+        stats->erase_count_max = sc->erased;
+    }
+  }
+
+  if (stats->erase_blocks == 0)
+    stats->erase_count_min = 0;
+
+  stats->compactions            = fd->compactions;
+  stats->background_compactions = fd->background_compactions;
+  stats->compaction_time        = fd->compaction_time;
+  stats->compaction_time_max    = fd->compaction_time_max;
+  stats->host_writes            = fd->host_writes;
+  stats->media_writes           = fd->media_writes;
+
+  return 0;
+}
+
+/**
+ * Reset the wear statistics. The erase counts of the segments are kept since
+ * they track the wear of the flash.
+ */
+static void
+rtems_fdisk_reset_wear_stats (rtems_flashdisk* fd)
+{
+  fd->compactions            = 0;
+  fd->background_compactions = 0;
+  fd->compaction_time        = 0;
+  fd->compaction_time_max    = 0;
+  fd->host_writes            = 0;
+  fd->media_writes           = 0;
+}
+
 /**
  * Print to stdout the status of the driver. This is a debugging aid.
  */
@@ -2438,6 +2733,16 @@ rtems_fdisk_ioctl (rtems_disk_device *dd, uint32_t req, void* argp)
         errno = rtems_fdisk_print_status (&rtems_flashdisks[minor]);
         break;
 
+      case RTEMS_BLKIO_GETWEARSTATS:
+        errno = rtems_fdisk_wear_stats (&rtems_flashdisks[minor],
+                                        (rtems_blkdev_wear_stats*) argp);
+        break;
+
+      case RTEMS_BLKIO_RESETDEVSTATS:
+        rtems_fdisk_reset_wear_stats (&rtems_flashdisks[minor]);
+        rtems_blkdev_ioctl (dd, req, argp);
+        break;
+
       default:
         rtems_blkdev_ioctl (dd, req, argp);
         break;
@@ -2500,10 +2805,14 @@ rtems_fdisk_initialize (rtems_device_major_number major,
     fd->flags              = c->flags;
     fd->compact_segs       = c->compact_segs;
     fd->avail_compact_segs = c->avail_compact_segs;
+    fd->compact_watermark  = c->compact_watermark;
     fd->block_size         = c->block_size;
     fd->unavail_blocks     = c->unavail_blocks;
     fd->info_level         = c->info_level;
 
+    if (fd->compact_watermark == 0)
+      fd->compact_watermark = fd->avail_compact_segs + 1;
+
     for (device = 0; device < c->device_count; device++)
       blocks += rtems_fdisk_blocks_in_device (&c->devices[device],
                                               c->block_size);
@@ -2620,6 +2929,38 @@ rtems_fdisk_initialize (rtems_device_major_number major,
                          strerror (ret), ret);
       return ret;
     }
+
+    if ((fd->flags & (RTEMS_FDISK_BACKGROUND_ERASE |
+                      RTEMS_FDISK_BACKGROUND_COMPACT)))
+    {
+      rtems_task_priority priority = c->background_priority;
+
+      if (priority == 0)
+        priority = RTEMS_FDISK_BACKGROUND_PRIORITY;
+
+      sc = rtems_task_create (rtems_build_name ('F', 'D', 'B', 'G'), priority,
+                              RTEMS_FDISK_BACKGROUND_STACK_SIZE,
+                              RTEMS_DEFAULT_MODES, RTEMS_LOCAL,
+                              &fd->background_task);
+      if (sc == RTEMS_SUCCESSFUL)
+      {
+        sc = rtems_task_start (fd->background_task, rtems_fdisk_background,
+                               (rtems_task_argument) fd);
+        if (sc != RTEMS_SUCCESSFUL)
+          rtems_task_delete (fd->background_task);
+      }
+
+      if (sc != RTEMS_SUCCESSFUL)
+      {
+        rtems_disk_delete (dev);
+        rtems_semaphore_delete (fd->lock);
+        free (fd->copy_buffer);
+        free (fd->blocks);
+        free (fd->devices);
+        rtems_fdisk_error ("background task create failed");
+        return sc;
+      }
+    }
   }
 
   rtems_flashdisk_count = rtems_flashdisk_configuration_size;
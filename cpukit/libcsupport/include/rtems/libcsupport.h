@@ -117,6 +117,7 @@ typedef struct {
   uint32_t active_mutexes;
   uint32_t active_rwlocks;
   uint32_t active_semaphores;
+  uint32_t active_shms;
   uint32_t active_spinlocks;
   uint32_t active_threads;
   uint32_t active_timers;
@@ -976,6 +976,51 @@ typedef int (*rtems_filesystem_kqfilter_t)(
   struct knote *kn
 );
 
+/**
+ * @brief Maps a part of a node into the address space.
+ *
+ * This handler is used by mmap() for shared mappings.  It must return the
+ * address of the contiguous memory which backs the requested part of the
+ * node.  Changes to this memory are visible to all users of the node.
+ *
+ * @param[in, out] iop The IO pointer.
+ * @param[out] addr The start address of the mapping.
+ * @param[in] len The length of the mapping in bytes.
+ * @param[in] prot The desired memory protection.
+ * @param[in] off The offset of the mapping within the node.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ *
+ * @see rtems_filesystem_default_mmap().
+ */
+typedef int (*rtems_filesystem_mmap_t)(
+  rtems_libio_t *iop,
+  void **addr,
+  size_t len,
+  int prot,
+  off_t off
+);
+
+/**
+ * @brief Removes a shared mapping of a node.
+ *
+ * This handler is used by munmap() for mappings established by the mmap
+ * handler.  The file descriptor used to create the mapping may be closed at
+ * this time, so the location held by the mapping is passed.
+ *
+ * @param[in] loc The location of the node.
+ * @param[in] addr The start address of the mapping.
+ * @param[in] len The length of the mapping in bytes.
+ *
+ * @see rtems_filesystem_default_munmap().
+ */
+typedef void (*rtems_filesystem_munmap_t)(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+);
+
 /**
  * @brief File system node operations table.
  */
@@ -995,6 +1040,8 @@ struct _rtems_filesystem_file_handlers_r {
   rtems_filesystem_kqfilter_t kqfilter_h;
   rtems_filesystem_readv_t readv_h;
   rtems_filesystem_writev_t writev_h;
+  rtems_filesystem_mmap_t mmap_h;
+  rtems_filesystem_munmap_t munmap_h;
 };
 
 /**
@@ -1216,6 +1263,30 @@ int rtems_filesystem_default_kqfilter(
   struct knote *kn
 );
 
+/**
+ * @retval -1 Always.  The errno is set to ENOTSUP.
+ *
+ * @see rtems_filesystem_mmap_t.
+ */
+int rtems_filesystem_default_mmap(
+  rtems_libio_t *iop,
+  void **addr,
+  size_t len,
+  int prot,
+  off_t off
+);
+
+/**
+ * @brief Does nothing.
+ *
+ * @see rtems_filesystem_munmap_t.
+ */
+void rtems_filesystem_default_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+);
+
 /** @} */
 
 /**
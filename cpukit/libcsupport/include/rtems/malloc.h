@@ -194,6 +194,116 @@ void *rtems_heap_greedy_allocate_all_except_largest(
  */
 void rtems_heap_greedy_free( void *opaque );
 
+/**
+ * @brief Size of the smallest malloc cache size class in bytes.
+ */
+#define RTEMS_MALLOC_CACHE_MINIMUM_SIZE 16
+
+/**
+ * @brief Count of malloc cache size classes.
+ *
+ * The size classes are powers of two starting with
+ * RTEMS_MALLOC_CACHE_MINIMUM_SIZE, so the largest cached allocation size is
+ * 256 bytes.
+ */
+#define RTEMS_MALLOC_CACHE_CLASS_COUNT 5
+
+/**
+ * @brief Maximum high watermark of a malloc cache.
+ */
+#define RTEMS_MALLOC_CACHE_MAXIMUM_HIGH_WATERMARK 64
+
+/**
+ * @brief Malloc cache of one size class on one processor.
+ *
+ * A malloc cache is a magazine of free memory areas of one size class in
+ * front of the C program heap.  The areas are allocated blocks from the
+ * point of view of the heap.  Each processor has its own cache for each size
+ * class, so malloc() and free() on the fast path do not obtain the allocator
+ * mutex.
+ *
+ * @see CONFIGURE_MALLOC_PER_CPU_CACHE.
+ */
+typedef struct {
+  /**
+   * @brief Count of memory areas currently held by this cache.
+   */
+  uint32_t count;
+
+  /**
+   * @brief Count of allocations satisfied by this cache.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief Count of allocations which had to refill this cache from the heap.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief Count of memory areas put into this cache by free().
+   */
+  uint32_t frees;
+
+  /**
+   * @brief Count of memory areas returned to the heap since the high
+   * watermark was crossed.
+   */
+  uint32_t flushes;
+} rtems_malloc_cache;
+
+/**
+ * @brief Malloc cache configuration.
+ *
+ * Defined by <rtems/confdefs.h>.
+ */
+typedef struct {
+  /**
+   * @brief Table of caches with RTEMS_MALLOC_CACHE_CLASS_COUNT entries for
+   * each processor, or @c NULL if the malloc caches are disabled.
+   */
+  rtems_malloc_cache *caches;
+
+  /**
+   * @brief Storage for the memory areas with @a high_watermark entries for
+   * each cache.
+   */
+  void **objects;
+
+  /**
+   * @brief Count of processors covered by the cache table.
+   */
+  uint32_t processor_count;
+
+  /**
+   * @brief Maximum count of memory areas held by one cache.
+   *
+   * In case free() crosses this watermark, then one half of the areas is
+   * returned to the heap.  An empty cache is refilled with one half of this
+   * watermark.
+   */
+  uint32_t high_watermark;
+} rtems_malloc_cache_configuration;
+
+extern const rtems_malloc_cache_configuration
+  rtems_malloc_cache_config;
+
+/**
+ * @brief Returns the malloc cache statistics summed up over all processors.
+ *
+ * The entry of index @c i in @a statistics covers the size class of
+ * RTEMS_MALLOC_CACHE_MINIMUM_SIZE shifted left by @c i bytes.  The hit rate
+ * of a size class is hits / ( hits + misses ).
+ *
+ * @param[out] statistics The statistics of each size class.
+ *
+ * @retval true Successful operation.
+ * @retval false The malloc caches are disabled.
+ */
+bool rtems_malloc_cache_get_statistics(
+  rtems_malloc_cache statistics[ RTEMS_MALLOC_CACHE_CLASS_COUNT ]
+);
+
 #ifdef __cplusplus
 }
 #endif
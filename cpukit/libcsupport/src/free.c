@@ -37,6 +37,10 @@ void free(
       return;
   }
 
+  if ( _Malloc_Cache_free( ptr ) ) {
+    return;
+  }
+
   if ( !_Protected_heap_Free( RTEMS_Malloc_Heap, ptr ) ) {
     printk( "Program heap: free of bad pointer %p -- range %p - %p \n",
       ptr,
@@ -36,7 +36,25 @@ void *malloc(
   if ( !size )
     return (void *) 0;
 
-  return_this = rtems_heap_allocate_aligned_with_boundary( size, 0, 0 );
+  return_this = _Malloc_Cache_allocate( size );
+  if ( !return_this ) {
+    return_this = rtems_heap_allocate_aligned_with_boundary( size, 0, 0 );
+  }
+
+  /*
+   * The heap may be exhausted only because the free areas are held by the
+   * caches of the processors.  The caches can only be drained in the normal
+   * system state, since this needs the allocator mutex and the other
+   * processors.
+   */
+  if (
+    !return_this
+      && _Malloc_System_state() == MALLOC_SYSTEM_STATE_NORMAL
+      && _Malloc_Cache_drain()
+  ) {
+    return_this = rtems_heap_allocate_aligned_with_boundary( size, 0, 0 );
+  }
+
   if ( !return_this ) {
     errno = ENOMEM;
     return (void *) 0;
@@ -0,0 +1,402 @@
+/**
+ * @file
+ *
+ * @brief Malloc Per-Processor Caches
+ * @ingroup MallocSupport
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include <string.h>
+
+#include "malloc_p.h"
+
+#include <rtems/score/apimutex.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
+
+#define MALLOC_CACHE_BATCH_MAXIMUM \
+  ( RTEMS_MALLOC_CACHE_MAXIMUM_HIGH_WATERMARK / 2 )
+
+/*
+ * Interrupts must be disabled on the current processor, otherwise the
+ * executing thread may migrate to another processor.
+ */
+static rtems_malloc_cache *_Malloc_Cache_get(
+  const rtems_malloc_cache_configuration *config,
+  size_t                                  class_index,
+  void                                 ***objects
+)
+{
+  uint32_t cpu_index;
+  size_t   index;
+
+  cpu_index = _Per_CPU_Get_index( _Per_CPU_Get() );
+  _Assert( cpu_index < config->processor_count );
+
+  index = cpu_index * RTEMS_MALLOC_CACHE_CLASS_COUNT + class_index;
+  *objects = &config->objects[ index * config->high_watermark ];
+
+  return &config->caches[ index ];
+}
+
+static void _Malloc_Cache_return_to_heap( void **batch, uint32_t count )
+{
+  Heap_Control *heap = RTEMS_Malloc_Heap;
+  uint32_t      i;
+
+  _RTEMS_Lock_allocator();
+
+  for ( i = 0; i < count; ++i ) {
+    bool ok = _Heap_Free( heap, batch[ i ] );
+
+    _Assert( ok );
+    (void) ok;
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+static void *_Malloc_Cache_refill(
+  const rtems_malloc_cache_configuration *config,
+  size_t                                  class_index,
+  uintptr_t                               class_size
+)
+{
+  Heap_Control          *heap = RTEMS_Malloc_Heap;
+  void                  *batch[ MALLOC_CACHE_BATCH_MAXIMUM ];
+  uint32_t               batch_count;
+  uint32_t               i;
+  rtems_interrupt_level  level;
+  rtems_malloc_cache    *cache;
+  void                 **objects;
+
+  /*
+   * Obtain the allocator mutex once for a batch of areas to amortize the
+   * lock cost over several allocations.
+   */
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  batch_count = 0;
+
+  while ( batch_count < config->high_watermark / 2 ) {
+    void *p = _Heap_Allocate( heap, class_size );
+
+    if ( p == NULL ) {
+      break;
+    }
+
+    batch[ batch_count ] = p;
+    ++batch_count;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( batch_count == 0 ) {
+    return NULL;
+  }
+
+  /*
+   * The executing thread may run now on another processor, so use the cache
+   * of the current processor.
+   */
+  i = 1;
+  rtems_interrupt_local_disable( level );
+  cache = _Malloc_Cache_get( config, class_index, &objects );
+
+  while ( i < batch_count && cache->count < config->high_watermark ) {
+    objects[ cache->count ] = batch[ i ];
+    ++cache->count;
+    ++i;
+  }
+
+  rtems_interrupt_local_enable( level );
+
+  if ( i < batch_count ) {
+    _Malloc_Cache_return_to_heap( &batch[ i ], batch_count - i );
+  }
+
+  return batch[ 0 ];
+}
+
+void *_Malloc_Cache_allocate( size_t size )
+{
+  const rtems_malloc_cache_configuration *config;
+  size_t                                  class_index;
+  uintptr_t                               class_size;
+  rtems_interrupt_level                   level;
+  rtems_malloc_cache                     *cache;
+  void                                  **objects;
+  void                                   *p;
+
+  config = &rtems_malloc_cache_config;
+
+  if (
+    config->caches == NULL
+      || _Malloc_System_state() != MALLOC_SYSTEM_STATE_NORMAL
+  ) {
+    return NULL;
+  }
+
+  class_index = 0;
+  class_size = RTEMS_MALLOC_CACHE_MINIMUM_SIZE;
+
+  while ( class_size < size ) {
+    if ( class_index == RTEMS_MALLOC_CACHE_CLASS_COUNT - 1 ) {
+      return NULL;
+    }
+
+    ++class_index;
+    class_size <<= 1;
+  }
+
+  rtems_interrupt_local_disable( level );
+  cache = _Malloc_Cache_get( config, class_index, &objects );
+
+  if ( cache->count > 0 ) {
+    ++cache->hits;
+    --cache->count;
+    p = objects[ cache->count ];
+    rtems_interrupt_local_enable( level );
+  } else {
+    ++cache->misses;
+    rtems_interrupt_local_enable( level );
+    p = _Malloc_Cache_refill( config, class_index, class_size );
+  }
+
+  if ( p != NULL && rtems_malloc_dirty_helper != NULL ) {
+    (*rtems_malloc_dirty_helper)( p, size );
+  }
+
+  return p;
+}
+
+bool _Malloc_Cache_free( void *ptr )
+{
+  const rtems_malloc_cache_configuration *config;
+  uintptr_t                               size;
+  size_t                                  class_index;
+  rtems_interrupt_level                   level;
+  rtems_malloc_cache                     *cache;
+  void                                  **objects;
+  void                                   *batch[ MALLOC_CACHE_BATCH_MAXIMUM ];
+  uint32_t                                batch_count;
+  uint32_t                                keep;
+  uint32_t                                i;
+
+  config = &rtems_malloc_cache_config;
+
+  if ( config->caches == NULL ) {
+    return false;
+  }
+
+  /*
+   * The area is an allocated block owned by the caller, so its size is
+   * stable without the allocator mutex.
+   */
+  if (
+    !_Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, ptr, &size )
+      || size < RTEMS_MALLOC_CACHE_MINIMUM_SIZE
+  ) {
+    return false;
+  }
+
+  class_index = 0;
+
+  while (
+    ( (uintptr_t) RTEMS_MALLOC_CACHE_MINIMUM_SIZE << ( class_index + 1 ) )
+      <= size
+  ) {
+    ++class_index;
+
+    if ( class_index == RTEMS_MALLOC_CACHE_CLASS_COUNT ) {
+      return false;
+    }
+  }
+
+  rtems_interrupt_local_disable( level );
+  cache = _Malloc_Cache_get( config, class_index, &objects );
+
+  /*
+   * The heap cannot detect a double free of a cached area, since the area is
+   * still allocated from its point of view.  Look for the area in this cache,
+   * which is bounded by the high watermark.  A double free through the caches
+   * of different processors is not detected.
+   */
+  for ( i = 0; i < cache->count; ++i ) {
+    if ( objects[ i ] == ptr ) {
+      rtems_interrupt_local_enable( level );
+      printk( "Program heap: free of cached pointer %p\n", ptr );
+      return true;
+    }
+  }
+
+  ++cache->frees;
+
+  if ( cache->count < config->high_watermark ) {
+    objects[ cache->count ] = ptr;
+    ++cache->count;
+    rtems_interrupt_local_enable( level );
+  } else {
+    /*
+     * The high watermark is crossed, so return the upper half of the cached
+     * areas to the heap.
+     */
+    keep = config->high_watermark / 2;
+    batch_count = cache->count - keep;
+    cache->flushes += batch_count;
+    memcpy( batch, &objects[ keep ], batch_count * sizeof( batch[ 0 ] ) );
+    objects[ keep ] = ptr;
+    cache->count = keep + 1;
+    rtems_interrupt_local_enable( level );
+
+    _Malloc_Cache_return_to_heap( batch, batch_count );
+  }
+
+  return true;
+}
+
+typedef struct {
+  ISR_LOCK_MEMBER( Lock )
+  Chain_Control Areas;
+} Malloc_Cache_drain_context;
+
+/*
+ * Each processor empties its own caches, since the owner accesses them with
+ * only local interrupts disabled.  The cached areas are free, so they serve
+ * as chain nodes.
+ */
+static void _Malloc_Cache_drain_action( void *arg )
+{
+  const rtems_malloc_cache_configuration *config;
+  Malloc_Cache_drain_context             *ctx;
+  ISR_lock_Context                        lock_context;
+  size_t                                  class_index;
+
+  config = &rtems_malloc_cache_config;
+  ctx = arg;
+
+  _ISR_lock_ISR_disable_and_acquire( &ctx->Lock, &lock_context );
+
+  for (
+    class_index = 0;
+    class_index < RTEMS_MALLOC_CACHE_CLASS_COUNT;
+    ++class_index
+  ) {
+    rtems_malloc_cache  *cache;
+    void               **objects;
+
+    cache = _Malloc_Cache_get( config, class_index, &objects );
+    cache->flushes += cache->count;
+
+    while ( cache->count > 0 ) {
+      Chain_Node *node;
+
+      --cache->count;
+      node = objects[ cache->count ];
+      _Chain_Initialize_node( node );
+      _Chain_Append_unprotected( &ctx->Areas, node );
+    }
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &ctx->Lock, &lock_context );
+}
+
+bool _Malloc_Cache_drain( void )
+{
+  Malloc_Cache_drain_context  ctx;
+  Heap_Control               *heap;
+  Chain_Node                 *node;
+  bool                        drained;
+
+  if ( rtems_malloc_cache_config.caches == NULL ) {
+    return false;
+  }
+
+  _ISR_lock_Initialize( &ctx.Lock, "Malloc Cache Drain" );
+  _Chain_Initialize_empty( &ctx.Areas );
+
+#if defined(RTEMS_SMP)
+  _SMP_Multicast_action( 0, NULL, _Malloc_Cache_drain_action, &ctx );
+#else
+  _Malloc_Cache_drain_action( &ctx );
+#endif
+
+  drained = !_Chain_Is_empty( &ctx.Areas );
+  heap = RTEMS_Malloc_Heap;
+
+  _RTEMS_Lock_allocator();
+
+  while ( ( node = _Chain_Get_unprotected( &ctx.Areas ) ) != NULL ) {
+    bool ok = _Heap_Free( heap, node );
+
+    _Assert( ok );
+    (void) ok;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  _ISR_lock_Destroy( &ctx.Lock );
+
+  return drained;
+}
+
+bool rtems_malloc_cache_get_statistics(
+  rtems_malloc_cache statistics[ RTEMS_MALLOC_CACHE_CLASS_COUNT ]
+)
+{
+  const rtems_malloc_cache_configuration *config;
+  uint32_t                                cpu_index;
+  size_t                                  class_index;
+
+  config = &rtems_malloc_cache_config;
+
+  if ( config->caches == NULL ) {
+    return false;
+  }
+
+  memset(
+    statistics,
+    0,
+    RTEMS_MALLOC_CACHE_CLASS_COUNT * sizeof( statistics[ 0 ] )
+  );
+
+  for ( cpu_index = 0; cpu_index < config->processor_count; ++cpu_index ) {
+    for (
+      class_index = 0;
+      class_index < RTEMS_MALLOC_CACHE_CLASS_COUNT;
+      ++class_index
+    ) {
+      const rtems_malloc_cache *cache;
+
+      cache = &config->caches[
+        cpu_index * RTEMS_MALLOC_CACHE_CLASS_COUNT + class_index
+      ];
+
+      statistics[ class_index ].count += cache->count;
+      statistics[ class_index ].hits += cache->hits;
+      statistics[ class_index ].misses += cache->misses;
+      statistics[ class_index ].frees += cache->frees;
+      statistics[ class_index ].flushes += cache->flushes;
+    }
+  }
+
+  return true;
+}
+#endif
@@ -29,6 +29,35 @@ void _Malloc_Deferred_free( void * );
 
 void _Malloc_Process_deferred_frees( void );
 
+/**
+ * @brief Allocates a memory area from the cache of the current processor.
+ *
+ * @return The allocated memory area, or @c NULL if the malloc caches are
+ * disabled, @a size is too large for a cache size class, or the heap is
+ * exhausted.
+ */
+void *_Malloc_Cache_allocate( size_t size );
+
+/**
+ * @brief Puts a memory area into the cache of the current processor.
+ *
+ * A memory area which is already in the cache of the current processor is
+ * reported as a bad free and not put into the cache again.  A double free
+ * through the caches of different processors is not detected.
+ *
+ * @retval true The memory area is now owned by a cache.
+ * @retval false Otherwise.  The caller has to free the memory area.
+ */
+bool _Malloc_Cache_free( void *ptr );
+
+/**
+ * @brief Returns the areas of all malloc caches to the heap.
+ *
+ * @retval true At least one area was returned to the heap.
+ * @retval false Otherwise.
+ */
+bool _Malloc_Cache_drain( void );
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
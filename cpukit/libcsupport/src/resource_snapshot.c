@@ -49,6 +49,7 @@
   #include <rtems/posix/pthreadimpl.h>
   #include <rtems/posix/rwlockimpl.h>
   #include <rtems/posix/semaphoreimpl.h>
+  #include <rtems/posix/shmimpl.h>
   #include <rtems/posix/spinlockimpl.h>
   #include <rtems/posix/timerimpl.h>
 #endif
@@ -73,6 +74,7 @@ static const Objects_Information *const objects_info_table[] = {
     &_POSIX_Mutex_Information,
     &_POSIX_RWLock_Information,
     &_POSIX_Semaphore_Information,
+    &_POSIX_Shm_Information,
     &_POSIX_Spinlock_Information,
     &_POSIX_Threads_Information.Objects,
     &_POSIX_Timer_Information
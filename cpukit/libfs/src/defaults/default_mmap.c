@@ -0,0 +1,33 @@
+/**
+ * @file
+ *
+ * @brief Default MMAP Handler
+ *
+ * @ingroup LibIOFSHandler
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/libio_.h>
+#include <rtems/seterr.h>
+
+int rtems_filesystem_default_mmap(
+  rtems_libio_t *iop,
+  void **addr,
+  size_t len,
+  int prot,
+  off_t off
+)
+{
+  rtems_set_errno_and_return_minus_one( ENOTSUP );
+}
@@ -0,0 +1,30 @@
+/**
+ * @file
+ *
+ * @brief Default MUNMAP Handler
+ *
+ * @ingroup LibIOFSHandler
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/libio_.h>
+
+void rtems_filesystem_default_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+)
+{
+  /* Do nothing */
+}
@@ -26,6 +26,7 @@
 
 #include "fat.h"
 #include "fat_fat_operations.h"
+#include "fat_file.h"
 
 static int
  _fat_block_release(fat_fs_info_t *fs_info);
@@ -48,79 +49,111 @@ fat_cluster_num_to_block_num (const fat_fs_info_t *fs_info,
     return blk;
 }
 
-int
-fat_buf_access(fat_fs_info_t   *fs_info,
-               const uint32_t   sec_num,
-               const int        op_type,
-               uint8_t        **sec_buf)
+static bool
+fat_sector_is_fat(const fat_fs_info_t *fs_info, uint32_t sec_num)
 {
-    rtems_status_code sc = RTEMS_SUCCESSFUL;
-    uint32_t          blk = fat_sector_num_to_block_num (fs_info,
-                                                         sec_num);
-    uint32_t          blk_ofs = fat_sector_offset_to_block_offset (fs_info,
-                                                                   sec_num,
-                                                                   0);
+    return (sec_num >= fs_info->vol.fat_loc) &&
+           (sec_num < fs_info->vol.rdir_loc);
+}
 
-    if (fs_info->c.state == FAT_CACHE_EMPTY || fs_info->c.blk_num != sec_num)
+static fat_cache_t *
+fat_buf_lookup(fat_fs_info_t *fs_info, uint32_t blk)
+{
+    uint32_t i;
+
+    for (i = 0; i < fs_info->c_count; i++)
     {
-        fat_buf_release(fs_info);
+        fat_cache_t *c = &fs_info->c[i];
 
-        if (op_type == FAT_OP_TYPE_READ)
-            sc = rtems_bdbuf_read(fs_info->vol.dd, blk, &fs_info->c.buf);
-        else
-            sc = rtems_bdbuf_get(fs_info->vol.dd, blk, &fs_info->c.buf);
-        if (sc != RTEMS_SUCCESSFUL)
-            rtems_set_errno_and_return_minus_one(EIO);
-        fs_info->c.blk_num = sec_num;
-        fs_info->c.modified = 0;
-        fs_info->c.state = FAT_CACHE_ACTUAL;
+        if (c->state == FAT_CACHE_ACTUAL && c->blk_num == blk)
+            return c;
     }
-    *sec_buf = &fs_info->c.buf->buffer[blk_ofs];
-    return RC_OK;
+
+    return NULL;
 }
 
-int
-fat_buf_release(fat_fs_info_t *fs_info)
+/*
+ * Sectors of the File Allocation Table go to the LRU pool, everything else
+ * uses the first entry.  This way a cluster chain walk interleaved with data
+ * access does not evict the FAT sectors.
+ */
+static fat_cache_t *
+fat_buf_victim(fat_fs_info_t *fs_info, uint32_t sec_num)
+{
+    fat_cache_t *victim = &fs_info->c[0];
+    uint32_t     i;
+
+    if (fs_info->c_count == 1 || !fat_sector_is_fat(fs_info, sec_num))
+        return victim;
+
+    victim = &fs_info->c[1];
+    for (i = 1; i < fs_info->c_count; i++)
+    {
+        fat_cache_t *c = &fs_info->c[i];
+
+        if (c->state == FAT_CACHE_EMPTY)
+            return c;
+
+        if (c->last_use < victim->last_use)
+            victim = c;
+    }
+
+    return victim;
+}
+
+/*
+ * Copy the modified sectors of the first FAT in this block to the other
+ * FATs.  A destination block may be the block itself or held by another
+ * cache entry, so it must not be obtained from the bdbuf a second time.
+ */
+static int
+fat_buf_mirror(fat_fs_info_t *fs_info, fat_cache_t *c)
 {
     rtems_status_code sc = RTEMS_SUCCESSFUL;
+    uint32_t          sec_num = fat_block_num_to_sector_num(fs_info,
+                                                            c->blk_num);
+    uint32_t          sec_end = sec_num + fs_info->vol.sectors_per_block;
+    uint32_t          fat_end = fs_info->vol.fat_loc +
+                                fs_info->vol.fat_length;
 
-    if (fs_info->c.state == FAT_CACHE_EMPTY)
-        return RC_OK;
+    if (sec_num < fs_info->vol.fat_loc)
+        sec_num = fs_info->vol.fat_loc;
 
-    if (fs_info->c.modified)
+    if (sec_end > fat_end)
+        sec_end = fat_end;
+
+    for (; sec_num < sec_end; sec_num++)
     {
-        uint32_t sec_num = fs_info->c.blk_num;
-        bool     sec_of_fat = ((sec_num >= fs_info->vol.fat_loc) &&
-                              (sec_num < fs_info->vol.rdir_loc));
-        uint32_t blk = fat_sector_num_to_block_num(fs_info, sec_num);
-        uint32_t blk_ofs = fat_sector_offset_to_block_offset(fs_info,
-                                                             sec_num,
-                                                             0);
-
-        if (sec_of_fat && !fs_info->vol.mirror)
-            memcpy(fs_info->sec_buf,
-                   fs_info->c.buf->buffer + blk_ofs,
-                   fs_info->vol.bps);
-
-        sc = rtems_bdbuf_release_modified(fs_info->c.buf);
-        if (sc != RTEMS_SUCCESSFUL)
-            rtems_set_errno_and_return_minus_one(EIO);
-        fs_info->c.modified = 0;
+        const uint8_t *src = c->buf->buffer +
+            fat_sector_offset_to_block_offset(fs_info, sec_num, 0);
+        uint8_t        i;
 
-        if (sec_of_fat && !fs_info->vol.mirror)
+        for (i = 1; i < fs_info->vol.fats; i++)
         {
-            uint8_t i;
+            uint32_t     mirror_sec = sec_num + fs_info->vol.fat_length * i;
+            uint32_t     blk = fat_sector_num_to_block_num(fs_info,
+                                                           mirror_sec);
+            uint32_t     blk_ofs = fat_sector_offset_to_block_offset(fs_info,
+                                                                     mirror_sec,
+                                                                     0);
+            fat_cache_t *mirror_c;
+
+            if (blk == c->blk_num)
+            {
+                memcpy(c->buf->buffer + blk_ofs, src, fs_info->vol.bps);
+                continue;
+            }
 
-            for (i = 1; i < fs_info->vol.fats; i++)
+            mirror_c = fat_buf_lookup(fs_info, blk);
+            if (mirror_c != NULL)
+            {
+                memcpy(mirror_c->buf->buffer + blk_ofs, src, fs_info->vol.bps);
+                mirror_c->modified = true;
+            }
+            else
             {
                 rtems_bdbuf_buffer *bd;
 
-                sec_num = fs_info->c.blk_num + fs_info->vol.fat_length * i,
-                blk = fat_sector_num_to_block_num(fs_info, sec_num);
-                blk_ofs = fat_sector_offset_to_block_offset(fs_info,
-                                                            sec_num,
-                                                            0);
-
                 if (blk_ofs == 0
                     && fs_info->vol.bps == fs_info->vol.bytes_per_block)
                 {
@@ -132,23 +165,121 @@ fat_buf_release(fat_fs_info_t *fs_info)
                 }
                 if ( sc != RTEMS_SUCCESSFUL)
                     rtems_set_errno_and_return_minus_one(ENOMEM);
-                memcpy(bd->buffer + blk_ofs, fs_info->sec_buf, fs_info->vol.bps);
+                memcpy(bd->buffer + blk_ofs, src, fs_info->vol.bps);
                 sc = rtems_bdbuf_release_modified(bd);
                 if ( sc != RTEMS_SUCCESSFUL)
                     rtems_set_errno_and_return_minus_one(ENOMEM);
             }
         }
     }
+
+    return RC_OK;
+}
+
+static int
+fat_buf_release_entry(fat_fs_info_t *fs_info, fat_cache_t *c)
+{
+    rtems_status_code sc = RTEMS_SUCCESSFUL;
+    int               rc = RC_OK;
+
+    if (c->state == FAT_CACHE_EMPTY)
+        return RC_OK;
+
+    if (c->modified)
+    {
+        if (!fs_info->vol.mirror)
+            rc = fat_buf_mirror(fs_info, c);
+
+        sc = rtems_bdbuf_release_modified(c->buf);
+        c->modified = false;
+    }
     else
     {
-        sc = rtems_bdbuf_release(fs_info->c.buf);
+        sc = rtems_bdbuf_release(c->buf);
+    }
+    c->state = FAT_CACHE_EMPTY;
+
+    if (sc != RTEMS_SUCCESSFUL)
+        rtems_set_errno_and_return_minus_one(EIO);
+
+    return rc;
+}
+
+int
+fat_buf_access(fat_fs_info_t   *fs_info,
+               const uint32_t   sec_num,
+               const int        op_type,
+               uint8_t        **sec_buf)
+{
+    rtems_status_code sc = RTEMS_SUCCESSFUL;
+    uint32_t          blk = fat_sector_num_to_block_num (fs_info,
+                                                         sec_num);
+    uint32_t          blk_ofs = fat_sector_offset_to_block_offset (fs_info,
+                                                                   sec_num,
+                                                                   0);
+    fat_cache_t      *c = fat_buf_lookup(fs_info, blk);
+
+    if (c == NULL)
+    {
+        c = fat_buf_victim(fs_info, sec_num);
+        fat_buf_release_entry(fs_info, c);
+
+        if (op_type == FAT_OP_TYPE_READ)
+            sc = rtems_bdbuf_read(fs_info->vol.dd, blk, &c->buf);
+        else
+            sc = rtems_bdbuf_get(fs_info->vol.dd, blk, &c->buf);
         if (sc != RTEMS_SUCCESSFUL)
             rtems_set_errno_and_return_minus_one(EIO);
+        c->blk_num = blk;
+        c->modified = 0;
+        c->state = FAT_CACHE_ACTUAL;
     }
-    fs_info->c.state = FAT_CACHE_EMPTY;
+    c->last_use = ++fs_info->c_use;
+    fs_info->c_cur = c;
+    *sec_buf = &c->buf->buffer[blk_ofs];
     return RC_OK;
 }
 
+int
+fat_buf_release(fat_fs_info_t *fs_info)
+{
+    int      rc = RC_OK;
+    uint32_t i;
+
+    for (i = 0; i < fs_info->c_count; i++)
+    {
+        int ret = fat_buf_release_entry(fs_info, &fs_info->c[i]);
+
+        if (ret != RC_OK)
+            rc = ret;
+    }
+
+    return rc;
+}
+
+/*
+ * Release the LRU pool of FAT sectors, so that no bdbuf block stays in the
+ * access state and the modified FAT sectors are handed to the swapout task
+ * once a file system operation is done.  The first entry keeps the usual
+ * single-block cache behaviour.
+ */
+int
+fat_buf_release_pool(fat_fs_info_t *fs_info)
+{
+    int      rc = RC_OK;
+    uint32_t i;
+
+    for (i = 1; i < fs_info->c_count; i++)
+    {
+        int ret = fat_buf_release_entry(fs_info, &fs_info->c[i]);
+
+        if (ret != RC_OK)
+            rc = ret;
+    }
+
+    return rc;
+}
+
 /* _fat_block_read --
  *     This function reads 'count' bytes from device filesystem is mounted on,
  *     starts at 'start+offset' position where 'start' computed in sectors
@@ -483,6 +614,9 @@ fat_init_volume_info(fat_fs_info_t *fs_info, const char *device)
     int                 i = 0;
     rtems_bdbuf_buffer *block = NULL;
 
+    fs_info->c_count = 1;
+    fs_info->c_cur = &fs_info->c[0];
+
     vol->fd = open(device, O_RDWR);
     if (vol->fd < 0)
     {
@@ -742,15 +876,6 @@ fat_init_volume_info(fat_fs_info_t *fs_info, const char *device)
         free(fs_info->rhash);
         rtems_set_errno_and_return_minus_one( ENOMEM );
     }
-    fs_info->sec_buf = (uint8_t *)calloc(vol->bps, sizeof(uint8_t));
-    if (fs_info->sec_buf == NULL)
-    {
-        close(vol->fd);
-        free(fs_info->vhash);
-        free(fs_info->rhash);
-        free(fs_info->uino);
-        rtems_set_errno_and_return_minus_one( ENOMEM );
-    }
 
     /*
      * If possible we will use the cluster size as bdbuf block size for faster
@@ -769,6 +894,16 @@ fat_init_volume_info(fat_fs_info_t *fs_info, const char *device)
         }
     }
 
+    /*
+     * The FAT cache entries hold their bdbuf blocks, so use at most a quarter
+     * of the bdbuf cache for them.
+     */
+    fs_info->c_count = (rtems_bdbuf_configuration.size / vol->bytes_per_block) / 4;
+    if (fs_info->c_count > FAT_CACHE_ENTRIES)
+        fs_info->c_count = FAT_CACHE_ENTRIES;
+    else if (fs_info->c_count == 0)
+        fs_info->c_count = 1;
+
     return RC_OK;
 }
 
@@ -867,7 +1002,7 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->vhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
-            free(node);
+            fat_file_free((fat_file_fd_t *) node);
     }
 
     for (i = 0; i < FAT_HASH_SIZE; i++)
@@ -876,14 +1011,13 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->rhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
-            free(node);
+            fat_file_free((fat_file_fd_t *) node);
     }
 
     free(fs_info->vhash);
     free(fs_info->rhash);
 
     free(fs_info->uino);
-    free(fs_info->sec_buf);
     close(fs_info->vol.fd);
 
     if (rc)
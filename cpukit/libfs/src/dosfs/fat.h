@@ -343,11 +343,23 @@ typedef struct fat_vol_s
 } fat_vol_t;
 
 
+/*
+ * Maximum count of bdbuf blocks held by the FAT buffer cache.  The first
+ * entry is used for directory and file data, the others form a LRU pool for
+ * the sectors of the File Allocation Table.  The count actually used depends
+ * on the bdbuf cache size (see fat_init_volume_info()).  The pool is released
+ * at the end of each file system operation (see fat_buf_release_pool()), so
+ * it holds no bdbuf block between operations and the modified FAT sectors
+ * are written like any other modified block.
+ */
+#define FAT_CACHE_ENTRIES 8
+
 typedef struct fat_cache_s
 {
     uint32_t            blk_num;
     bool                modified;
     uint8_t             state;
+    uint32_t            last_use;
     rtems_bdbuf_buffer *buf;
 } fat_cache_t;
 
@@ -364,8 +376,10 @@ typedef struct fat_fs_info_s
     uint32_t             index;
     uint32_t             uino_pool_size; /* size */
     uint32_t             uino_base;
-    fat_cache_t          c;             /* cache */
-    uint8_t             *sec_buf; /* just placeholder for anything */
+    fat_cache_t          c[FAT_CACHE_ENTRIES]; /* cache of bdbuf blocks */
+    fat_cache_t         *c_cur;         /* most recently accessed entry */
+    uint32_t             c_count;       /* count of usable cache entries */
+    uint32_t             c_use;         /* LRU counter of the cache */
 } fat_fs_info_t;
 
 /*
@@ -487,7 +501,7 @@ static inline uint32_t
 static inline void
 fat_buf_mark_modified(fat_fs_info_t *fs_info)
 {
-    fs_info->c.modified = true;
+    fs_info->c_cur->modified = true;
 }
 
 int
@@ -499,6 +513,9 @@ fat_buf_access(fat_fs_info_t  *fs_info,
 int
 fat_buf_release(fat_fs_info_t *fs_info);
 
+int
+fat_buf_release_pool(fat_fs_info_t *fs_info);
+
 ssize_t
 _fat_block_read(fat_fs_info_t                        *fs_info,
                 uint32_t                              start,
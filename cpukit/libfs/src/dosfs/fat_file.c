@@ -58,6 +58,30 @@ fat_file_lseek(
     uint32_t                              *disk_cln
 );
 
+static int
+fat_file_extent_map_build(
+    fat_fs_info_t                         *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln
+);
+
+static uint32_t
+fat_file_extent_map_run(
+    const fat_file_fd_t                   *fat_fd,
+    uint32_t                               file_cln
+);
+
+static void
+fat_file_extent_map_trim(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               cln_count
+);
+
+static void
+fat_file_extent_map_free(
+    fat_file_fd_t                         *fat_fd
+);
+
 /* fat_file_open --
  *     Open fat-file. Two hash tables are accessed by key
  *     constructed from cluster num and offset of the node (i.e.
@@ -148,6 +172,22 @@ fat_file_open(
     return RC_OK;
 }
 
+/* fat_file_free --
+ *     Free fat-file descriptor and its extent map
+ *
+ * PARAMETERS:
+ *     fat_fd - fat-file descriptor
+ *
+ * RETURNS:
+ *     None
+ */
+void
+fat_file_free(fat_file_fd_t *fat_fd)
+{
+    fat_file_extent_map_free(fat_fd);
+    free(fat_fd);
+}
+
 
 /* fat_file_reopen --
  *     Increment by 1 number of links
@@ -245,7 +285,7 @@ fat_file_close(
                 if (fat_ino_is_unique(fs_info, fat_fd->ino))
                     fat_free_unique_ino(fs_info, fat_fd->ino);
 
-                free(fat_fd);
+                fat_file_free(fat_fd);
             }
         }
         else
@@ -253,11 +293,12 @@ fat_file_close(
             if (fat_ino_is_unique(fs_info, fat_fd->ino))
             {
                 fat_fd->links_num = 0;
+                fat_file_extent_map_free(fat_fd);
             }
             else
             {
                 _hash_delete(fs_info->vhash, key, fat_fd->ino, fat_fd);
-                free(fat_fd);
+                fat_file_free(fat_fd);
             }
         }
     }
@@ -300,6 +341,7 @@ fat_file_read(
     uint32_t       cmpltd = 0;
     uint32_t       cur_cln = 0;
     uint32_t       cl_start = 0;
+    uint32_t       file_cln = 0;
     uint32_t       save_cln = 0;
     uint32_t       ofs = 0;
     uint32_t       save_ofs;
@@ -336,16 +378,27 @@ fat_file_read(
         return ret;
     }
 
-    cl_start = start >> fs_info->vol.bpc_log2;
+    file_cln = cl_start = start >> fs_info->vol.bpc_log2;
     save_ofs = ofs = start & (fs_info->vol.bpc - 1);
 
+    /*
+     * Map the whole range up front, so that it can be read in runs of
+     * contiguous clusters.
+     */
+    rc = fat_file_extent_map_build(fs_info, fat_fd,
+                                   (start + count - 1) >> fs_info->vol.bpc_log2);
+    if (rc != RC_OK)
+        return rc;
+
     rc = fat_file_lseek(fs_info, fat_fd, cl_start, &cur_cln);
     if (rc != RC_OK)
         return rc;
 
     while (count > 0)
     {
-        c = MIN(count, (fs_info->vol.bpc - ofs));
+        uint64_t run = fat_file_extent_map_run(fat_fd, file_cln);
+
+        c = MIN(count, (run << fs_info->vol.bpc_log2) - ofs);
 
         sec = fat_cluster_num_to_sector_num(fs_info, cur_cln);
         sec += (ofs >> fs_info->vol.sec_log2);
@@ -357,10 +410,15 @@ fat_file_read(
 
         count -= c;
         cmpltd += c;
-        save_cln = cur_cln;
-        rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
-        if ( rc != RC_OK )
-            return rc;
+        save_cln = cur_cln + ((ofs + c - 1) >> fs_info->vol.bpc_log2);
+        file_cln += (ofs + c) >> fs_info->vol.bpc_log2;
+
+        if (count > 0)
+        {
+            rc = fat_file_lseek(fs_info, fat_fd, file_cln, &cur_cln);
+            if ( rc != RC_OK )
+                return rc;
+        }
 
         ofs = 0;
     }
@@ -772,6 +830,8 @@ fat_file_truncate(
     if (rc != RC_OK)
         return rc;
 
+    fat_file_extent_map_trim(fat_fd, cl_start);
+
     rc = fat_free_fat_clusters_chain(fs_info, cur_cln);
     if (rc != RC_OK)
         return rc;
@@ -1019,6 +1079,213 @@ _hash_search(
     return -1;
 }
 
+/* extent map support routines */
+
+/* fat_file_extent_map_free --
+ *     Free the extent map of the fat-file
+ *
+ * PARAMETERS:
+ *     fat_fd - fat-file descriptor
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extent_map_free(fat_file_fd_t *fat_fd)
+{
+    fat_file_extent_map_t *map = &fat_fd->extent_map;
+
+    free(map->extents);
+    memset(map, 0, sizeof(*map));
+}
+
+/* fat_file_extent_map_trim --
+ *     Shorten the extent map to cover at most 'cln_count' file clusters
+ *
+ * PARAMETERS:
+ *     fat_fd    - fat-file descriptor
+ *     cln_count - count of file clusters which remain valid
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extent_map_trim(fat_file_fd_t *fat_fd, uint32_t cln_count)
+{
+    fat_file_extent_map_t *map = &fat_fd->extent_map;
+
+    if (cln_count >= map->cln_count)
+        return;
+
+    while (map->count > 0 && map->extents[map->count - 1].file_cln >= cln_count)
+        map->count--;
+
+    if (map->count > 0)
+    {
+        fat_file_extent_t *e = &map->extents[map->count - 1];
+
+        e->count = cln_count - e->file_cln;
+    }
+
+    map->cln_count = cln_count;
+}
+
+/* fat_file_extent_map_append --
+ *     Append the disk cluster of the next file cluster to the extent map
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     disk_cln - disk cluster of file cluster 'cln_count'
+ *
+ * RETURNS:
+ *     true on success, false if the map cannot grow any more
+ */
+static bool
+fat_file_extent_map_append(fat_file_fd_t *fat_fd, uint32_t disk_cln)
+{
+    fat_file_extent_map_t *map = &fat_fd->extent_map;
+    fat_file_extent_t     *e;
+
+    if (map->count > 0)
+    {
+        e = &map->extents[map->count - 1];
+        if (e->disk_cln + e->count == disk_cln)
+        {
+            e->count++;
+            map->cln_count++;
+            return true;
+        }
+    }
+
+    if (map->count == map->size)
+    {
+        uint32_t size = map->size > 0 ? 2 * map->size : 4;
+
+        if (size > FAT_FILE_EXTENTS_MAX)
+            return false;
+
+        e = realloc(map->extents, size * sizeof(*e));
+        if (e == NULL)
+            return false;
+
+        map->extents = e;
+        map->size = size;
+    }
+
+    e = &map->extents[map->count];
+    e->file_cln = map->cln_count;
+    e->disk_cln = disk_cln;
+    e->count = 1;
+    map->count++;
+    map->cln_count++;
+    return true;
+}
+
+/* fat_file_extent_map_build --
+ *     Walk the clusters chain of the fat-file until the extent map covers
+ *     file cluster 'file_cln' or cannot grow any more
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - file cluster which should be covered
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured (errno set appropriately)
+ */
+static int
+fat_file_extent_map_build(
+    fat_fs_info_t                         *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln
+    )
+{
+    fat_file_extent_map_t   *map = &fat_fd->extent_map;
+    const fat_file_extent_t *e;
+    uint32_t                 cur_cln;
+
+    /* the map belongs to a different clusters chain */
+    if (map->count > 0 && map->extents[0].disk_cln != fat_fd->cln)
+        fat_file_extent_map_trim(fat_fd, 0);
+
+    if (file_cln < map->cln_count || fat_fd->cln < FAT_RSRVD_CLN)
+        return RC_OK;
+
+    if (map->count == 0 && !fat_file_extent_map_append(fat_fd, fat_fd->cln))
+        return RC_OK;
+
+    e = &map->extents[map->count - 1];
+    cur_cln = e->disk_cln + e->count - 1;
+
+    while (map->cln_count <= file_cln)
+    {
+        int rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+        if ( rc != RC_OK )
+            return rc;
+
+        if ((cur_cln < FAT_RSRVD_CLN) ||
+            ((cur_cln & fs_info->vol.mask) >= fs_info->vol.eoc_val) ||
+            !fat_file_extent_map_append(fat_fd, cur_cln))
+            break;
+    }
+
+    return RC_OK;
+}
+
+/* fat_file_extent_map_find --
+ *     Find the extent which contains file cluster 'file_cln'
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - file cluster
+ *
+ * RETURNS:
+ *     the extent, or NULL if the file cluster is not covered by the map
+ */
+static const fat_file_extent_t *
+fat_file_extent_map_find(const fat_file_fd_t *fat_fd, uint32_t file_cln)
+{
+    const fat_file_extent_map_t *map = &fat_fd->extent_map;
+    uint32_t                     lo = 0;
+    uint32_t                     hi = map->count;
+
+    if (file_cln >= map->cln_count)
+        return NULL;
+
+    while (hi - lo > 1)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+
+        if (map->extents[mid].file_cln <= file_cln)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    return &map->extents[lo];
+}
+
+/* fat_file_extent_map_run --
+ *     Count of contiguous clusters starting at file cluster 'file_cln'
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - file cluster
+ *
+ * RETURNS:
+ *     count of contiguous clusters known from the extent map, at least 1
+ */
+static uint32_t
+fat_file_extent_map_run(const fat_file_fd_t *fat_fd, uint32_t file_cln)
+{
+    const fat_file_extent_t *e = fat_file_extent_map_find(fat_fd, file_cln);
+
+    if (e == NULL)
+        return 1;
+
+    return e->file_cln + e->count - file_cln;
+}
+
 static off_t
 fat_file_lseek(
     fat_fs_info_t                         *fs_info,
@@ -1033,27 +1300,49 @@ fat_file_lseek(
         *disk_cln = fat_fd->map.disk_cln;
     else
     {
+        const fat_file_extent_map_t *map = &fat_fd->extent_map;
+        const fat_file_extent_t     *e;
         uint32_t   cur_cln;
         uint32_t   count;
         uint32_t   i;
 
-        if (file_cln > fat_fd->map.file_cln)
+        rc = fat_file_extent_map_build(fs_info, fat_fd, file_cln);
+        if ( rc != RC_OK )
+            return rc;
+
+        e = fat_file_extent_map_find(fat_fd, file_cln);
+        if (e != NULL)
         {
-            cur_cln = fat_fd->map.disk_cln;
-            count = file_cln - fat_fd->map.file_cln;
+            cur_cln = e->disk_cln + (file_cln - e->file_cln);
         }
         else
         {
-            cur_cln = fat_fd->cln;
-            count = file_cln;
-        }
+            if (file_cln > fat_fd->map.file_cln)
+            {
+                cur_cln = fat_fd->map.disk_cln;
+                count = file_cln - fat_fd->map.file_cln;
+            }
+            else
+            {
+                cur_cln = fat_fd->cln;
+                count = file_cln;
+            }
 
-        /* skip over the clusters */
-        for (i = 0; i < count; i++)
-        {
-            rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
-            if ( rc != RC_OK )
-                return rc;
+            /* continue from the end of the extent map if this is closer */
+            if (map->cln_count > 0 && file_cln - (map->cln_count - 1) < count)
+            {
+                e = &map->extents[map->count - 1];
+                cur_cln = e->disk_cln + e->count - 1;
+                count = file_cln - (map->cln_count - 1);
+            }
+
+            /* skip over the clusters */
+            for (i = 0; i < count; i++)
+            {
+                rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+                if ( rc != RC_OK )
+                    return rc;
+            }
         }
 
         /* update cache */
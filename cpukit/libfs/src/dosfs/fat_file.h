@@ -65,6 +65,34 @@ typedef struct fat_file_map_s
     uint32_t   last_cln;
 } fat_file_map_t;
 
+/*
+ * A run of contiguous clusters of a fat-file: file clusters
+ * [file_cln, file_cln + count) are located at disk clusters
+ * [disk_cln, disk_cln + count).
+ */
+typedef struct fat_file_extent_s
+{
+    uint32_t   file_cln;
+    uint32_t   disk_cln;
+    uint32_t   count;
+} fat_file_extent_t;
+
+/*
+ * Extent map of the clusters chain.  It covers the first 'cln_count' clusters
+ * of the fat-file and is built lazily while the chain is walked, so seeking
+ * inside the covered part needs no access to the File Allocation Table.
+ */
+typedef struct fat_file_extent_map_s
+{
+    fat_file_extent_t *extents;
+    uint32_t           count;     /* count of used extents */
+    uint32_t           size;      /* count of allocated extents */
+    uint32_t           cln_count; /* count of covered file clusters */
+} fat_file_extent_map_t;
+
+/* maximum count of extents per fat-file */
+#define FAT_FILE_EXTENTS_MAX 128
+
 /**
  * @brief Descriptor of a fat-file.
  *
@@ -89,6 +117,7 @@ typedef struct fat_file_fd_s
     fat_dir_pos_t    dir_pos;
     uint8_t          flags;
     fat_file_map_t   map;
+    fat_file_extent_map_t extent_map;
     time_t           ctime;
     time_t           mtime;
 
@@ -191,6 +220,9 @@ fat_file_open(fat_fs_info_t                         *fs_info,
 int
 fat_file_reopen(fat_file_fd_t *fat_fd);
 
+void
+fat_file_free(fat_file_fd_t *fat_fd);
+
 int
 fat_file_close(fat_fs_info_t                        *fs_info,
                fat_file_fd_t                        *fat_fd);
@@ -353,6 +353,7 @@ msdos_dir_read(rtems_libio_t *iop, void *buffer, size_t count)
         j++;
     }
 
+    fat_buf_release_pool(&fs_info->fat);
     rtems_semaphore_release(fs_info->vol_sema);
     return cmpltd;
 }
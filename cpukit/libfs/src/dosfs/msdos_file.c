@@ -61,6 +61,7 @@ msdos_file_read(rtems_libio_t *iop, void *buffer, size_t count)
     if (ret > 0)
         iop->offset += ret;
 
+    fat_buf_release_pool(&fs_info->fat);
     rtems_semaphore_release(fs_info->vol_sema);
     return ret;
 }
@@ -98,6 +99,7 @@ msdos_file_write(rtems_libio_t *iop,const void *buffer, size_t count)
                          buffer);
     if (ret < 0)
     {
+        fat_buf_release_pool(&fs_info->fat);
         rtems_semaphore_release(fs_info->vol_sema);
         return -1;
     }
@@ -113,6 +115,7 @@ msdos_file_write(rtems_libio_t *iop,const void *buffer, size_t count)
     if (ret > 0)
         fat_file_set_ctime_mtime(fat_fd, time(NULL));
 
+    fat_buf_release_pool(&fs_info->fat);
     rtems_semaphore_release(fs_info->vol_sema);
     return ret;
 }
@@ -206,6 +209,7 @@ msdos_file_ftruncate(rtems_libio_t *iop, off_t length)
         fat_file_set_ctime_mtime(fat_fd, time(NULL));
     }
 
+    fat_buf_release_pool(&fs_info->fat);
     rtems_semaphore_release(fs_info->vol_sema);
 
     return rc;
@@ -89,7 +89,11 @@ void msdos_lock(const rtems_filesystem_mount_table_entry_t *mt_entry)
 void msdos_unlock(const rtems_filesystem_mount_table_entry_t *mt_entry)
 {
   msdos_fs_info_t *fs_info = mt_entry->fs_info;
-  rtems_status_code sc = rtems_semaphore_release(fs_info->vol_sema);
+  rtems_status_code sc;
+
+  fat_buf_release_pool(&fs_info->fat);
+
+  sc = rtems_semaphore_release(fs_info->vol_sema);
   if (sc != RTEMS_SUCCESSFUL) {
     rtems_fatal_error_occurred(0xdeadbeef);
   }
@@ -94,6 +94,20 @@ typedef block_p *block_ptr;
 #define IMFS_MEMFILE_MAXIMUM_SIZE \
   (LAST_TRIPLY_INDIRECT * IMFS_MEMFILE_BYTES_PER_BLOCK)
 
+/**
+ *  IMFS "extfile" information
+ *
+ *  The data of an extent file is stored in contiguous extents.  The first
+ *  extent has imfs_extfile_bytes_per_extent bytes, each following extent
+ *  doubles in size up to 2^IMFS_EXTFILE_MAXIMUM_SHIFT times the first one.
+ *  All further extents have this maximum size.  The extent of a file offset
+ *  is computed directly, there are no indirect tables.
+ */
+#define IMFS_EXTFILE_DEFAULT_BYTES_PER_EXTENT    512
+  extern const size_t imfs_extfile_bytes_per_extent;
+
+#define IMFS_EXTFILE_MAXIMUM_SHIFT 10
+
 /** @} */
 
 /**
@@ -140,6 +154,24 @@ IMFS_jnode_t *IMFS_node_initialize_directory(
   void *arg
 );
 
+/**
+ * @brief Initializes a directory node with a name index.
+ *
+ * The name index is built once the directory contains
+ * IMFS_DIRECTORY_INDEX_THRESHOLD entries.
+ *
+ * @param[in] node The IMFS node.
+ * @param[in] arg The user provided argument pointer.  It is not used.
+ *
+ * @retval node Returns always the node passed as parameter.
+ *
+ * @see IMFS_node_control and IMFS_mknod_control_dir_indexed.
+ */
+IMFS_jnode_t *IMFS_node_initialize_directory_indexed(
+  IMFS_jnode_t *node,
+  void *arg
+);
+
 /**
  * @brief Returns the node and sets the generic node context.
  *
@@ -186,6 +218,15 @@ IMFS_jnode_t *IMFS_node_remove_default(
 
 IMFS_jnode_t *IMFS_node_remove_directory( IMFS_jnode_t *node );
 
+/**
+ * @brief Frees the name index of the directory and the node.
+ *
+ * @param[in] node The IMFS node.
+ *
+ * @see IMFS_node_control and IMFS_node_destroy_default().
+ */
+void IMFS_node_destroy_directory_indexed( IMFS_jnode_t *node );
+
 /**
  * @brief Destroys an IMFS node.
  *
@@ -258,10 +299,22 @@ struct IMFS_jnode_tt {
 
 #define IMFS_NODE_FLAG_NAME_ALLOCATED 0x1
 
+#define IMFS_NODE_FLAG_DIR_INDEXED 0x2
+
+/*
+ *  Count of entries at which a directory with the IMFS_NODE_FLAG_DIR_INDEXED
+ *  flag builds its name index.  The index is dropped again once the directory
+ *  shrinks below half of this count.
+ */
+#define IMFS_DIRECTORY_INDEX_THRESHOLD 32
+
 typedef struct {
   IMFS_jnode_t                          Node;
   rtems_chain_control                   Entries;
   rtems_filesystem_mount_table_entry_t *mt_fs;
+  IMFS_jnode_t                        **index;       /* name hash table */
+  uint32_t                              index_mask;  /* table size - 1 */
+  uint32_t                              entry_count; /* only if indexed */
 } IMFS_directory_t;
 
 typedef struct {
@@ -297,6 +350,13 @@ typedef struct {
   block_p         direct;           /* pointer to file image */
 } IMFS_linearfile_t;
 
+typedef struct {
+  IMFS_filebase_t File;
+  block_p        *extents;          /* array of extent_count extents */
+  uint32_t        extent_count;
+  uint32_t        mmap_count;       /* number of shared mappings */
+} IMFS_extfile_t;
+
 /* Support copy on write for linear files */
 typedef union {
   IMFS_jnode_t      Node;
@@ -398,8 +458,10 @@ typedef struct {
 
 extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
+extern const IMFS_mknod_control IMFS_mknod_control_dir_indexed;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_extfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -866,6 +928,43 @@ static inline void IMFS_Set_handlers( rtems_filesystem_location_info_t *loc )
   loc->handlers = node->control->handlers;
 }
 
+/**
+ * @brief Adds the entry to the name index of the directory.
+ *
+ * The entry must be already on the entries chain of the directory.
+ */
+void IMFS_directory_index_insert(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+);
+
+/**
+ * @brief Removes the entry from the name index of the directory.
+ */
+void IMFS_directory_index_remove(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+);
+
+/**
+ * @brief Searches the entry with the name in the name index of the directory.
+ *
+ * @retval NULL No such entry.
+ * @retval entry The entry with this name.
+ *
+ * @see IMFS_directory_has_index().
+ */
+IMFS_jnode_t *IMFS_directory_index_search(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+);
+
+static inline bool IMFS_directory_has_index( const IMFS_directory_t *dir )
+{
+  return dir->index != NULL;
+}
+
 static inline void IMFS_add_to_directory(
   IMFS_jnode_t *dir_node,
   IMFS_jnode_t *entry_node
@@ -875,13 +974,23 @@ static inline void IMFS_add_to_directory(
 
   entry_node->Parent = dir_node;
   rtems_chain_append_unprotected( &dir->Entries, &entry_node->Node );
+
+  if ( ( dir_node->flags & IMFS_NODE_FLAG_DIR_INDEXED ) != 0 ) {
+    IMFS_directory_index_insert( dir, entry_node );
+  }
 }
 
 static inline void IMFS_remove_from_directory( IMFS_jnode_t *node )
 {
-  IMFS_assert( node->Parent != NULL );
+  IMFS_jnode_t *dir_node = node->Parent;
+
+  IMFS_assert( dir_node != NULL );
   node->Parent = NULL;
   rtems_chain_extract_unprotected( &node->Node );
+
+  if ( ( dir_node->flags & IMFS_NODE_FLAG_DIR_INDEXED ) != 0 ) {
+    IMFS_directory_index_remove( (IMFS_directory_t *) dir_node, node );
+  }
 }
 
 static inline bool IMFS_is_directory( const IMFS_jnode_t *node )
@@ -132,7 +132,9 @@ static const rtems_filesystem_file_handlers_r IMFS_dir_default_handlers = {
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .munmap_h = rtems_filesystem_default_munmap
 };
 
 const IMFS_mknod_control IMFS_mknod_control_dir_default = {
@@ -144,3 +146,13 @@ const IMFS_mknod_control IMFS_mknod_control_dir_default = {
   },
   .node_size = sizeof( IMFS_directory_t )
 };
+
+const IMFS_mknod_control IMFS_mknod_control_dir_indexed = {
+  {
+    .handlers = &IMFS_dir_default_handlers,
+    .node_initialize = IMFS_node_initialize_directory_indexed,
+    .node_remove = IMFS_node_remove_directory,
+    .node_destroy = IMFS_node_destroy_directory_indexed
+  },
+  .node_size = sizeof( IMFS_directory_t )
+};
@@ -0,0 +1,214 @@
+/**
+ * @file
+ *
+ * @brief IMFS Directory Name Index
+ * @ingroup IMFS
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "imfs.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ *  The name index is an open addressing hash table with linear probing.  It
+ *  contains only pointers to the entries, the entries chain of the directory
+ *  stays the authoritative list and defines the order for readdir().
+ */
+
+static uint32_t IMFS_directory_index_hash( const char *name, size_t namelen )
+{
+  uint32_t hash = 2166136261U;
+  size_t i;
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash = ( hash ^ (uint8_t) name[ i ] ) * 16777619U;
+  }
+
+  return hash;
+}
+
+static uint32_t IMFS_directory_index_home(
+  const IMFS_directory_t *dir,
+  const IMFS_jnode_t     *entry
+)
+{
+  return IMFS_directory_index_hash( entry->name, entry->namelen )
+    & dir->index_mask;
+}
+
+static void IMFS_directory_index_put(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+)
+{
+  uint32_t i = IMFS_directory_index_home( dir, entry );
+
+  while ( dir->index[ i ] != NULL ) {
+    i = ( i + 1 ) & dir->index_mask;
+  }
+
+  dir->index[ i ] = entry;
+}
+
+static void IMFS_directory_index_drop( IMFS_directory_t *dir )
+{
+  free( dir->index );
+  dir->index = NULL;
+  dir->index_mask = 0;
+}
+
+/*
+ *  Rebuilds the index with room for twice the current entry count at a load
+ *  factor of one half.  In case there is not enough memory the directory
+ *  falls back to the linear search.
+ */
+static void IMFS_directory_index_build( IMFS_directory_t *dir )
+{
+  const rtems_chain_control *entries = &dir->Entries;
+  const rtems_chain_node *current = rtems_chain_immutable_first( entries );
+  const rtems_chain_node *tail = rtems_chain_immutable_tail( entries );
+  uint32_t size = 2 * IMFS_DIRECTORY_INDEX_THRESHOLD;
+  IMFS_jnode_t **index;
+
+  while ( size < 4 * dir->entry_count ) {
+    size *= 2;
+  }
+
+  index = calloc( size, sizeof( *index ) );
+
+  IMFS_directory_index_drop( dir );
+
+  if ( index == NULL ) {
+    return;
+  }
+
+  dir->index = index;
+  dir->index_mask = size - 1;
+
+  while ( current != tail ) {
+    IMFS_directory_index_put( dir, (IMFS_jnode_t *) current );
+    current = rtems_chain_immutable_next( current );
+  }
+}
+
+void IMFS_directory_index_insert(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+)
+{
+  ++dir->entry_count;
+
+  if ( dir->index == NULL ) {
+    if ( dir->entry_count >= IMFS_DIRECTORY_INDEX_THRESHOLD ) {
+      IMFS_directory_index_build( dir );
+    }
+  } else if ( 2 * dir->entry_count > dir->index_mask + 1 ) {
+    IMFS_directory_index_build( dir );
+  } else {
+    IMFS_directory_index_put( dir, entry );
+  }
+}
+
+void IMFS_directory_index_remove(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+)
+{
+  uint32_t mask = dir->index_mask;
+  uint32_t i;
+  uint32_t j;
+
+  --dir->entry_count;
+
+  if ( dir->index == NULL ) {
+    return;
+  }
+
+  if ( dir->entry_count < IMFS_DIRECTORY_INDEX_THRESHOLD / 2 ) {
+    IMFS_directory_index_drop( dir );
+    return;
+  }
+
+  i = IMFS_directory_index_home( dir, entry );
+  while ( dir->index[ i ] != entry ) {
+    if ( dir->index[ i ] == NULL ) {
+      return;
+    }
+
+    i = ( i + 1 ) & mask;
+  }
+
+  /* Move back entries of the probe sequence to close the gap */
+  j = i;
+  while ( true ) {
+    IMFS_jnode_t *other;
+    uint32_t home;
+
+    j = ( j + 1 ) & mask;
+    other = dir->index[ j ];
+    if ( other == NULL ) {
+      break;
+    }
+
+    home = IMFS_directory_index_home( dir, other );
+    if ( ( ( j - home ) & mask ) >= ( ( j - i ) & mask ) ) {
+      dir->index[ i ] = other;
+      i = j;
+    }
+  }
+
+  dir->index[ i ] = NULL;
+}
+
+IMFS_jnode_t *IMFS_directory_index_search(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+)
+{
+  uint32_t i = IMFS_directory_index_hash( name, namelen ) & dir->index_mask;
+  IMFS_jnode_t *entry;
+
+  while ( ( entry = dir->index[ i ] ) != NULL ) {
+    if (
+      entry->namelen == namelen
+        && memcmp( entry->name, name, namelen ) == 0
+    ) {
+      return entry;
+    }
+
+    i = ( i + 1 ) & dir->index_mask;
+  }
+
+  return NULL;
+}
+
+IMFS_jnode_t *IMFS_node_initialize_directory_indexed(
+  IMFS_jnode_t *node,
+  void *arg
+)
+{
+  node = IMFS_node_initialize_directory( node, arg );
+  node->flags |= IMFS_NODE_FLAG_DIR_INDEXED;
+
+  return node;
+}
+
+void IMFS_node_destroy_directory_indexed( IMFS_jnode_t *node )
+{
+  IMFS_directory_index_drop( (IMFS_directory_t *) node );
+  IMFS_node_destroy_default( node );
+}
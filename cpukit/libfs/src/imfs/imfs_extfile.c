@@ -0,0 +1,419 @@
+/**
+ * @file
+ *
+ * @brief IMFS Extent File Handlers
+ * @ingroup IMFS
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "imfs.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ *  Count of extents which grow geometrically.
+ */
+#define IMFS_EXTFILE_GROWING_EXTENTS ( IMFS_EXTFILE_MAXIMUM_SHIFT + 1 )
+
+static size_t IMFS_extfile_extent_size( uint32_t extent )
+{
+  if ( extent > IMFS_EXTFILE_MAXIMUM_SHIFT ) {
+    extent = IMFS_EXTFILE_MAXIMUM_SHIFT;
+  }
+
+  return imfs_extfile_bytes_per_extent << extent;
+}
+
+static off_t IMFS_extfile_extent_begin( uint32_t extent )
+{
+  off_t base = (off_t) imfs_extfile_bytes_per_extent;
+
+  if ( extent < IMFS_EXTFILE_GROWING_EXTENTS ) {
+    return base * ( ( (off_t) 1 << extent ) - 1 );
+  }
+
+  return base * ( ( (off_t) 1 << IMFS_EXTFILE_GROWING_EXTENTS ) - 1 )
+    + (off_t) ( extent - IMFS_EXTFILE_GROWING_EXTENTS )
+      * ( base << IMFS_EXTFILE_MAXIMUM_SHIFT );
+}
+
+static uint32_t IMFS_extfile_extent_of_offset( off_t offset )
+{
+  off_t base = (off_t) imfs_extfile_bytes_per_extent;
+  off_t growing_end = IMFS_extfile_extent_begin( IMFS_EXTFILE_GROWING_EXTENTS );
+  uint32_t extent;
+
+  if ( offset < growing_end ) {
+    uint32_t q = (uint32_t) ( offset / base ) + 1;
+
+    extent = 0;
+    while ( ( q >> ( extent + 1 ) ) != 0 ) {
+      ++extent;
+    }
+  } else {
+    extent = IMFS_EXTFILE_GROWING_EXTENTS
+      + (uint32_t) ( ( offset - growing_end )
+        / ( base << IMFS_EXTFILE_MAXIMUM_SHIFT ) );
+  }
+
+  return extent;
+}
+
+static off_t IMFS_extfile_capacity( const IMFS_extfile_t *extfile )
+{
+  return IMFS_extfile_extent_begin( extfile->extent_count );
+}
+
+/*
+ *  Frees the extents which contain no data of the first length bytes.
+ */
+static void IMFS_extfile_free_extents( IMFS_extfile_t *extfile, off_t length )
+{
+  while (
+    extfile->extent_count > 0
+      && IMFS_extfile_extent_begin( extfile->extent_count - 1 ) >= length
+  ) {
+    --extfile->extent_count;
+    free( extfile->extents[ extfile->extent_count ] );
+  }
+
+  if ( extfile->extent_count == 0 ) {
+    free( extfile->extents );
+    extfile->extents = NULL;
+  }
+}
+
+static int IMFS_extfile_add_extent( IMFS_extfile_t *extfile )
+{
+  uint32_t extent = extfile->extent_count;
+  block_p *extents;
+  block_p data;
+
+  extents = realloc( extfile->extents, ( extent + 1 ) * sizeof( *extents ) );
+  if ( extents == NULL ) {
+    return -1;
+  }
+
+  extfile->extents = extents;
+
+  data = malloc( IMFS_extfile_extent_size( extent ) );
+  if ( data == NULL ) {
+    return -1;
+  }
+
+  extents[ extent ] = data;
+  extfile->extent_count = extent + 1;
+
+  return 0;
+}
+
+/*
+ *  Calls the visitor for each contiguous part of the file range.
+ */
+typedef void ( *IMFS_extfile_visitor )(
+  block_p data,
+  unsigned char *buffer,
+  size_t count
+);
+
+static void IMFS_extfile_visit(
+  const IMFS_extfile_t *extfile,
+  off_t start,
+  unsigned char *buffer,
+  size_t count,
+  IMFS_extfile_visitor visitor
+)
+{
+  uint32_t extent = IMFS_extfile_extent_of_offset( start );
+  size_t offset = (size_t) ( start - IMFS_extfile_extent_begin( extent ) );
+
+  while ( count > 0 ) {
+    size_t n = IMFS_extfile_extent_size( extent ) - offset;
+
+    if ( n > count ) {
+      n = count;
+    }
+
+    ( *visitor )( &extfile->extents[ extent ][ offset ], buffer, n );
+
+    if ( buffer != NULL ) {
+      buffer += n;
+    }
+
+    count -= n;
+    offset = 0;
+    ++extent;
+  }
+}
+
+static void IMFS_extfile_zero( block_p data, unsigned char *buffer, size_t n )
+{
+  memset( data, 0, n );
+}
+
+static void IMFS_extfile_copy_out(
+  block_p data,
+  unsigned char *buffer,
+  size_t n
+)
+{
+  memcpy( buffer, data, n );
+}
+
+static void IMFS_extfile_copy_in(
+  block_p data,
+  unsigned char *buffer,
+  size_t n
+)
+{
+  memcpy( data, buffer, n );
+}
+
+static int IMFS_extfile_extend(
+  IMFS_extfile_t *extfile,
+  bool            zero_fill,
+  off_t           new_length
+)
+{
+  uint32_t old_extent_count;
+  off_t old_size;
+
+  if ( new_length > SSIZE_MAX ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  old_size = extfile->File.size;
+  if ( new_length <= old_size ) {
+    return 0;
+  }
+
+  old_extent_count = extfile->extent_count;
+
+  while ( IMFS_extfile_capacity( extfile ) < new_length ) {
+    if ( IMFS_extfile_add_extent( extfile ) != 0 ) {
+      IMFS_extfile_free_extents(
+        extfile,
+        IMFS_extfile_extent_begin( old_extent_count )
+      );
+      rtems_set_errno_and_return_minus_one( ENOSPC );
+    }
+  }
+
+  if ( zero_fill ) {
+    IMFS_extfile_visit(
+      extfile,
+      old_size,
+      NULL,
+      (size_t) ( new_length - old_size ),
+      IMFS_extfile_zero
+    );
+  }
+
+  extfile->File.size = (size_t) new_length;
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+static ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile = iop->pathinfo.node_access;
+  off_t start = iop->offset;
+  off_t size = extfile->File.size;
+
+  if ( start >= size ) {
+    return 0;
+  }
+
+  if ( count > size - start ) {
+    count = (size_t) ( size - start );
+  }
+
+  /* Copy directly from the extents to the caller buffer */
+  IMFS_extfile_visit(
+    extfile,
+    start,
+    buffer,
+    count,
+    IMFS_extfile_copy_out
+  );
+
+  IMFS_update_atime( &extfile->File.Node );
+  iop->offset = start + count;
+
+  return (ssize_t) count;
+}
+
+static ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile = iop->pathinfo.node_access;
+  off_t start;
+  off_t last_byte;
+
+  if ( ( iop->flags & LIBIO_FLAGS_APPEND ) != 0 ) {
+    iop->offset = extfile->File.size;
+  }
+
+  if ( count == 0 ) {
+    return 0;
+  }
+
+  start = iop->offset;
+  last_byte = start + count;
+
+  if ( last_byte > extfile->File.size ) {
+    bool zero_fill = start > extfile->File.size;
+    int rv = IMFS_extfile_extend( extfile, zero_fill, last_byte );
+
+    if ( rv != 0 ) {
+      return rv;
+    }
+  }
+
+  IMFS_extfile_visit(
+    extfile,
+    start,
+    RTEMS_DECONST( void *, buffer ),
+    count,
+    IMFS_extfile_copy_in
+  );
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+  iop->offset = last_byte;
+
+  return (ssize_t) count;
+}
+
+static int IMFS_extfile_ftruncate(
+  rtems_libio_t *iop,
+  off_t          length
+)
+{
+  IMFS_extfile_t *extfile = iop->pathinfo.node_access;
+
+  if ( length > extfile->File.size ) {
+    return IMFS_extfile_extend( extfile, true, length );
+  }
+
+  /* Shared mappings point into the extents */
+  if ( length < extfile->File.size && extfile->mmap_count > 0 ) {
+    rtems_set_errno_and_return_minus_one( EBUSY );
+  }
+
+  /* In contrast to the memfile the memory is reclaimed, extent by extent */
+  IMFS_extfile_free_extents( extfile, length );
+  extfile->File.size = (size_t) length;
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+/*
+ *  Only a range within a single extent has contiguous backing and can be
+ *  mapped directly.
+ */
+static int IMFS_extfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_extfile_t *extfile = iop->pathinfo.node_access;
+  uint32_t extent;
+  size_t offset;
+
+  if (
+    off < 0
+      || off > extfile->File.size
+      || len == 0
+      || len > extfile->File.size - off
+  ) {
+    rtems_set_errno_and_return_minus_one( ENXIO );
+  }
+
+  extent = IMFS_extfile_extent_of_offset( off );
+  if ( extent != IMFS_extfile_extent_of_offset( off + (off_t) len - 1 ) ) {
+    rtems_set_errno_and_return_minus_one( ENXIO );
+  }
+
+  offset = (size_t) ( off - IMFS_extfile_extent_begin( extent ) );
+  *addr = &extfile->extents[ extent ][ offset ];
+  ++extfile->mmap_count;
+
+  return 0;
+}
+
+static void IMFS_extfile_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void                                   *addr,
+  size_t                                  len
+)
+{
+  IMFS_extfile_t *extfile = loc->node_access;
+
+  _Assert( extfile->mmap_count > 0 );
+  --extfile->mmap_count;
+}
+
+static void IMFS_extfile_destroy( IMFS_jnode_t *node )
+{
+  IMFS_extfile_t *extfile = (IMFS_extfile_t *) node;
+
+  IMFS_extfile_free_extents( extfile, 0 );
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_extfile_read,
+  .write_h = IMFS_extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_file,
+  .ftruncate_h = IMFS_extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev,
+  .mmap_h = IMFS_extfile_mmap,
+  .munmap_h = IMFS_extfile_munmap
+};
+
+const IMFS_mknod_control IMFS_mknod_control_extfile = {
+  {
+    .handlers = &IMFS_extfile_handlers,
+    .node_initialize = IMFS_node_initialize_default,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_extfile_destroy
+  },
+  .node_size = sizeof( IMFS_extfile_t )
+};
@@ -74,6 +74,28 @@ static int IMFS_linfile_open(
   return 0;
 }
 
+/*
+ *  The file image is contiguous, so each part of it may be mapped directly.
+ */
+static int IMFS_linfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+
+  if ( off < 0 || off > file->File.size || len > file->File.size - off ) {
+    rtems_set_errno_and_return_minus_one( ENXIO );
+  }
+
+  *addr = &file->Linearfile.direct[ off ];
+
+  return 0;
+}
+
 static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .open_h = IMFS_linfile_open,
   .close_h = rtems_filesystem_default_close,
@@ -89,7 +111,9 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
-  .writev_h = rtems_filesystem_default_writev
+  .writev_h = rtems_filesystem_default_writev,
+  .mmap_h = IMFS_linfile_mmap,
+  .munmap_h = rtems_filesystem_default_munmap
 };
 
 const IMFS_node_control IMFS_node_control_linfile = {
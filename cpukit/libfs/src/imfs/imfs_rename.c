@@ -55,6 +55,9 @@ int IMFS_rename(
 
   memcpy( allocated_name, name, namelen );
 
+  /* The name index of the old parent needs the old name */
+  IMFS_remove_from_directory( node );
+
   if ( ( node->flags & IMFS_NODE_FLAG_NAME_ALLOCATED ) != 0 ) {
     free( RTEMS_DECONST( char *, node->name ) );
   }
@@ -63,7 +66,6 @@ int IMFS_rename(
   node->namelen = namelen;
   node->flags |= IMFS_NODE_FLAG_NAME_ALLOCATED;
 
-  IMFS_remove_from_directory( node );
   IMFS_add_to_directory( new_parent, node );
   IMFS_update_ctime( node );
 
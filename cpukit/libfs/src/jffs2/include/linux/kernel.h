@@ -66,6 +66,7 @@ static inline int no_printk(const char *fmt, ...)
 #define min(x,y) (x<y?x:y)
 #define max(x,y) (x<y?y:x)
 #define min_t(t, x,y) ((t)x<(t)y?(t)x:(t)y)
+#define max_t(t, x,y) ((t)x>(t)y?(t)x:(t)y)
 
 #define capable(x) 0
 
@@ -15,8 +15,10 @@
 #ifndef RTEMS_JFFS2_H
 #define RTEMS_JFFS2_H
 
+#include <rtems.h>
 #include <rtems/fs.h>
 #include <sys/param.h>
+#include <sys/ioccom.h>
 #include <zlib.h>
 
 #ifdef __cplusplus
@@ -435,8 +437,213 @@ typedef struct {
    * The compressor is optional and this pointer may be @c NULL.
    */
   rtems_jffs2_compressor_control *compressor_control;
+
+  /**
+   * @brief Enables the erase block summary support.
+   *
+   * In case the summary support is enabled, then a summary node is written to
+   * the end of each erase block once it is full.  The summary node contains
+   * the node information of the erase block, so that the mount needs to read
+   * only one summary node per erase block instead of scanning all nodes.  The
+   * summary nodes use the format of the Linux JFFS2_SUMMARY support.  They
+   * are ignored by the mount if the summary support is disabled.
+   */
+  bool enable_summary;
+
+  /**
+   * @brief Priority of the background garbage collection task.
+   *
+   * In case this value is zero, then no background garbage collection task is
+   * created and the garbage collection is done on demand by the writers once
+   * the free space runs low.  Otherwise, a task is created for this file
+   * system instance.  It must be accounted for in the maximum task count of
+   * the application configuration.  The task is triggered by the file system
+   * and wakes up at least once per second.  It collects garbage until the
+   * free erase block reserve is reached and flushes the write buffer.
+   */
+  rtems_task_priority gc_task_priority;
+
+  /**
+   * @brief Count of free erase blocks which the background garbage
+   * collection task keeps in reserve.
+   *
+   * In case this value is zero, then the garbage collection trigger level
+   * of the file system is used.
+   */
+  uint32_t gc_free_block_reserve;
+
+  /**
+   * @brief Size of the write buffer in bytes.
+   *
+   * The write buffer coalesces small node writes into page-sized flash
+   * program operations.  Flash program operations never cross a page
+   * boundary.  In case this value is zero, then every node write is passed
+   * directly to the flash.  Otherwise, the value must be a power of two which
+   * divides the flash block size.  The write buffer is flushed before every
+   * flash erase and every write which does not append to the buffered data,
+   * so that the order of flash operations is preserved.  It is also flushed by
+   * fsync(), fdatasync(), unmount() and the background garbage collection
+   * task.
+   */
+  uint32_t write_buffer_size;
 } rtems_jffs2_mount_data;
 
+/**
+ * @brief JFFS2 file system information.
+ *
+ * @see RTEMS_JFFS2_GET_INFO.
+ */
+typedef struct {
+  /**
+   * @brief Flash size in bytes.
+   */
+  uint32_t flash_size;
+
+  /**
+   * @brief Count of flash blocks (erase units).
+   */
+  uint32_t flash_blocks;
+
+  /**
+   * @brief Size of a flash block in bytes.
+   */
+  uint32_t flash_block_size;
+
+  /**
+   * @brief Used size in bytes.
+   *
+   * Used areas contain valid data.
+   */
+  uint32_t used_size;
+
+  /**
+   * @brief Dirty size in bytes.
+   *
+   * Dirty areas contain no longer used data.
+   */
+  uint32_t dirty_size;
+
+  /**
+   * @brief Wasted size in bytes.
+   *
+   * Wasted areas are unusable.
+   */
+  uint32_t wasted_size;
+
+  /**
+   * @brief Free size in bytes.
+   *
+   * Free areas may be used to store data.
+   */
+  uint32_t free_size;
+
+  /**
+   * @brief Bad size in bytes.
+   *
+   * Bad areas indicate damaged flash blocks.
+   */
+  uint32_t bad_size;
+
+  /**
+   * @brief Count of clean blocks.
+   *
+   * Clean blocks contain only used areas.
+   */
+  uint32_t clean_blocks;
+
+  /**
+   * @brief Count of dirty blocks.
+   *
+   * Dirty blocks contain dirty and used areas.
+   */
+  uint32_t dirty_blocks;
+
+  /**
+   * @brief Count of erasable blocks.
+   *
+   * These blocks must be erased before they can be used.
+   */
+  uint32_t erasable_blocks;
+
+  /**
+   * @brief Count of free blocks.
+   */
+  uint32_t free_blocks;
+
+  /**
+   * @brief Count of bad blocks.
+   */
+  uint32_t bad_blocks;
+
+  /**
+   * @brief Count of garbage collection passes.
+   *
+   * This includes the passes of the background garbage collection task.
+   */
+  uint32_t gc_passes;
+
+  /**
+   * @brief Count of garbage collection passes done by the background garbage
+   * collection task.
+   */
+  uint32_t background_gc_passes;
+
+  /**
+   * @brief Count of flash block erase operations.
+   */
+  uint32_t flash_erases;
+
+  /**
+   * @brief Count of flash program operations.
+   */
+  uint32_t flash_programs;
+
+  /**
+   * @brief Count of bytes written to the flash.
+   */
+  uint64_t flash_bytes_written;
+
+  /**
+   * @brief Count of file data bytes written by the file system users.
+   *
+   * The write amplification is the ratio of the flash bytes written to the
+   * user bytes written.
+   */
+  uint64_t user_bytes_written;
+} rtems_jffs2_info;
+
+/**
+ * @brief IO control to get the JFFS2 file system information.
+ *
+ * The IO control may be applied to every file descriptor of a JFFS2 file
+ * system instance.
+ *
+ * @code
+ * #include <sys/ioctl.h>
+ * #include <fcntl.h>
+ * #include <unistd.h>
+ *
+ * #include <rtems/jffs2.h>
+ *
+ * int get_info(const char *path, rtems_jffs2_info *info)
+ * {
+ *   int fd;
+ *   int rv;
+ *
+ *   fd = open(path, O_RDONLY);
+ *   if (fd < 0) {
+ *     return -1;
+ *   }
+ *
+ *   rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, info);
+ *   close(fd);
+ *
+ *   return rv;
+ * }
+ * @endcode
+ */
+#define RTEMS_JFFS2_GET_INFO _IOR('F', 1, rtems_jffs2_info)
+
 /**
  * @brief Initialization handler of the JFFS2 file system.
  *
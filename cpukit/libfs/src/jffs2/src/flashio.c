@@ -21,22 +21,112 @@ int jffs2_flash_read(struct jffs2_sb_info * c,
 {
 	const struct super_block *sb = OFNI_BS_2SFFJ(c);
 	rtems_jffs2_flash_control *fc = sb->s_flash_control;
+	int ret;
 
 	*return_size = size;
 
-	return (*fc->read)(fc, read_buffer_offset, write_buffer, size);
+	ret = (*fc->read)(fc, read_buffer_offset, write_buffer, size);
+
+	// the buffered data is not yet on the flash, so overlay it
+	if (ret == 0 && sb->s_wbuf_len > 0) {
+		uint32_t begin = max_t(uint32_t, read_buffer_offset,
+				       sb->s_wbuf_ofs);
+		uint32_t end = min_t(uint32_t, read_buffer_offset + size,
+				     sb->s_wbuf_ofs + sb->s_wbuf_len);
+
+		if (begin < end)
+			memcpy(write_buffer + (begin - read_buffer_offset),
+			       sb->s_wbuf + (begin - sb->s_wbuf_ofs),
+			       end - begin);
+	}
+
+	return ret;
+}
+
+static int jffs2_flash_program(struct jffs2_sb_info * c,
+			   uint32_t offset, const unsigned char *buffer,
+			   uint32_t size)
+{
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+	rtems_jffs2_flash_control *fc = sb->s_flash_control;
+
+	++sb->s_flash_programs;
+	sb->s_flash_bytes_written += size;
+
+	return (*fc->write)(fc, offset, buffer, size);
+}
+
+int jffs2_flush_write_buffer(struct jffs2_sb_info * c)
+{
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+	uint32_t len = sb->s_wbuf_len;
+
+	int ret;
+
+	if (len == 0)
+		return 0;
+
+	ret = jffs2_flash_program(c, sb->s_wbuf_ofs, sb->s_wbuf, len);
+
+	// keep the buffered data for a retry if the program operation failed
+	if (ret == 0)
+		sb->s_wbuf_len = 0;
+
+	return ret;
 }
 
 int jffs2_flash_write(struct jffs2_sb_info * c,
 			   cyg_uint32 write_buffer_offset, const size_t size,
 			   size_t * return_size, unsigned char *read_buffer)
 {
-	const struct super_block *sb = OFNI_BS_2SFFJ(c);
-	rtems_jffs2_flash_control *fc = sb->s_flash_control;
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+	uint32_t wbuf_size = sb->s_wbuf_size;
+	uint32_t ofs = write_buffer_offset;
+	uint32_t remaining = size;
+	int ret;
 
 	*return_size = size;
 
-	return (*fc->write)(fc, write_buffer_offset, read_buffer, size);
+	if (sb->s_wbuf == NULL)
+		return jffs2_flash_program(c, ofs, read_buffer, remaining);
+
+	// only appends to the buffered data are coalesced, everything else
+	// must reach the flash in order
+	if (sb->s_wbuf_len > 0 && sb->s_wbuf_ofs + sb->s_wbuf_len != ofs) {
+		ret = jffs2_flush_write_buffer(c);
+		if (ret)
+			return ret;
+	}
+
+	while (remaining > 0) {
+		uint32_t page_end = (ofs & ~(wbuf_size - 1)) + wbuf_size;
+		uint32_t chunk = min_t(uint32_t, remaining, page_end - ofs);
+
+		if (sb->s_wbuf_len == 0 && chunk == wbuf_size) {
+			// a full page needs no buffering
+			ret = jffs2_flash_program(c, ofs, read_buffer, chunk);
+		} else {
+			if (sb->s_wbuf_len == 0)
+				sb->s_wbuf_ofs = ofs;
+
+			memcpy(sb->s_wbuf + sb->s_wbuf_len, read_buffer, chunk);
+			sb->s_wbuf_len += chunk;
+
+			if (ofs + chunk == page_end)
+				ret = jffs2_flush_write_buffer(c);
+			else
+				ret = 0;
+		}
+
+		if (ret)
+			return ret;
+
+		ofs += chunk;
+		read_buffer += chunk;
+		remaining -= chunk;
+	}
+
+	return 0;
 }
 
 int
@@ -47,6 +137,12 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 	size_t totlen = 0, thislen;
 	int ret = 0;
 
+	if (jffs2_sum_active(c)) {
+		ret = jffs2_sum_add_kvec(c, vecs, count, (uint32_t) to);
+		if (ret)
+			goto writev_out;
+	}
+
 	for (i = 0; i < count; i++) {
 		// writes need to be aligned but the data we're passed may not be
 		// Observation suggests most unaligned writes are small, so we
@@ -125,8 +221,20 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 int jffs2_flash_erase(struct jffs2_sb_info * c,
 			   struct jffs2_eraseblock * jeb)
 {
-	const struct super_block *sb = OFNI_BS_2SFFJ(c);
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
 	rtems_jffs2_flash_control *fc = sb->s_flash_control;
+	int ret;
+
+	ret = jffs2_flush_write_buffer(c);
+	if (ret) {
+		// the block was not erased, so this is no erase failure and the
+		// block must not be marked bad, the caller refiles it instead
+		pr_warn("Flush of write buffer before erase at 0x%08x failed: errno %d\n",
+			jeb->offset, ret);
+		return -EAGAIN;
+	}
+
+	++sb->s_flash_erases;
 
 	return (*fc->erase)(fc, jeb->offset);
 }
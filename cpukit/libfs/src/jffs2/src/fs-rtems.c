@@ -329,6 +329,161 @@ static void rtems_jffs2_do_unlock(const struct super_block *sb)
 	(void) sc; /* avoid unused variable warning */
 }
 
+#define RTEMS_JFFS2_GC_EVENT RTEMS_EVENT_0
+
+#define RTEMS_JFFS2_GC_STOP_EVENT RTEMS_EVENT_1
+
+static bool rtems_jffs2_is_gc_needed(struct super_block *sb)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	uint32_t dirty;
+
+	if (jffs2_thread_should_wake(c)) {
+		return true;
+	}
+
+	/* Keep the free block reserve ahead of the writers */
+	dirty = c->dirty_size + c->erasing_size - c->nr_erasing_blocks * c->sector_size;
+
+	return c->nr_free_blocks + c->nr_erasing_blocks < sb->s_gc_free_block_reserve
+		&& dirty > c->nospc_dirty_size;
+}
+
+void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
+{
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+
+	if (sb->s_gc_task != 0 && rtems_jffs2_is_gc_needed(sb)) {
+		(void) rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_EVENT);
+	}
+}
+
+static bool rtems_jffs2_is_gc_stop_requested(void)
+{
+	rtems_event_set events = 0;
+
+	(void) rtems_event_receive(
+		RTEMS_JFFS2_GC_STOP_EVENT,
+		RTEMS_EVENT_ALL | RTEMS_NO_WAIT,
+		RTEMS_NO_TIMEOUT,
+		&events
+	);
+
+	return events != 0;
+}
+
+static rtems_task rtems_jffs2_gc_task(rtems_task_argument arg)
+{
+	struct super_block *sb = (struct super_block *) arg;
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	rtems_interval interval = rtems_clock_get_ticks_per_second();
+	bool stop = false;
+
+	while (!stop) {
+		rtems_event_set events = 0;
+
+		rtems_jffs2_do_lock(sb);
+
+		while (rtems_jffs2_is_gc_needed(sb)) {
+			int ret;
+
+			if (!list_empty(&c->erase_complete_list) ||
+			    !list_empty(&c->erase_pending_list)) {
+				jffs2_erase_pending_blocks(c, 1);
+				ret = 0;
+			} else {
+				++sb->s_background_gc_passes;
+				ret = jffs2_garbage_collect_pass(c);
+			}
+
+			if (ret != 0) {
+				break;
+			}
+
+			/* Let the writers and the unmount make progress between the passes */
+			rtems_jffs2_do_unlock(sb);
+			stop = rtems_jffs2_is_gc_stop_requested();
+			rtems_jffs2_do_lock(sb);
+
+			if (stop) {
+				break;
+			}
+		}
+
+		jffs2_flush_write_buffer(c);
+
+		rtems_jffs2_do_unlock(sb);
+
+		if (!stop) {
+			(void) rtems_event_receive(
+				RTEMS_JFFS2_GC_EVENT | RTEMS_JFFS2_GC_STOP_EVENT,
+				RTEMS_EVENT_ANY | RTEMS_WAIT,
+				interval,
+				&events
+			);
+			stop = (events & RTEMS_JFFS2_GC_STOP_EVENT) != 0;
+		}
+	}
+
+	rtems_event_transient_send(sb->s_gc_task_stopper);
+	rtems_task_delete(RTEMS_SELF);
+}
+
+static int rtems_jffs2_start_gc_task(
+	struct super_block *sb,
+	const rtems_jffs2_mount_data *jffs2_mount_data
+)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	rtems_status_code sc;
+	rtems_id id;
+
+	sb->s_gc_free_block_reserve = jffs2_mount_data->gc_free_block_reserve;
+	if (sb->s_gc_free_block_reserve == 0) {
+		sb->s_gc_free_block_reserve = c->resv_blocks_gctrigger;
+	}
+
+	if (sb->s_gc_free_block_reserve > c->nr_blocks) {
+		sb->s_gc_free_block_reserve = c->nr_blocks;
+	}
+
+	sc = rtems_task_create(
+		rtems_build_name('J', 'F', 'G', 'C'),
+		jffs2_mount_data->gc_task_priority,
+		4 * RTEMS_MINIMUM_STACK_SIZE,
+		RTEMS_DEFAULT_MODES,
+		RTEMS_DEFAULT_ATTRIBUTES,
+		&id
+	);
+	if (sc != RTEMS_SUCCESSFUL) {
+		return -ENOMEM;
+	}
+
+	sb->s_gc_task = id;
+
+	sc = rtems_task_start(id, rtems_jffs2_gc_task, (rtems_task_argument) sb);
+	assert(sc == RTEMS_SUCCESSFUL);
+	(void) sc; /* avoid unused variable warning */
+
+	return 0;
+}
+
+static void rtems_jffs2_stop_gc_task(struct super_block *sb)
+{
+	rtems_status_code sc;
+
+	sb->s_gc_task_stopper = rtems_task_self();
+
+	sc = rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_STOP_EVENT);
+	assert(sc == RTEMS_SUCCESSFUL);
+
+	sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+	assert(sc == RTEMS_SUCCESSFUL);
+	(void) sc; /* avoid unused variable warning */
+
+	sb->s_gc_task = 0;
+}
+
 static void rtems_jffs2_free_directory_entries(struct _inode *inode)
 {
         struct jffs2_full_dirent *current = inode->jffs2_i.dents;
@@ -360,7 +515,14 @@ static void rtems_jffs2_free_fs_info(rtems_jffs2_fs_info *fs_info, bool do_mount
 	struct super_block *sb = &fs_info->sb;
 	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
 
+	if (sb->s_gc_task != 0) {
+		rtems_jffs2_stop_gc_task(sb);
+	}
+
+	jffs2_sum_exit(c);
+
 	if (do_mount_fs_was_successful) {
+		jffs2_flush_write_buffer(c);
 		jffs2_free_ino_caches(c);
 		jffs2_free_raw_node_refs(c);
 		free(c->blocks);
@@ -375,6 +537,7 @@ static void rtems_jffs2_free_fs_info(rtems_jffs2_fs_info *fs_info, bool do_mount
 	rtems_jffs2_flash_control_destroy(fs_info->sb.s_flash_control);
 	rtems_jffs2_compressor_control_destroy(fs_info->sb.s_compressor_control);
 
+	free(sb->s_wbuf);
 	free(fs_info);
 }
 
@@ -512,22 +675,102 @@ static ssize_t rtems_jffs2_dir_read(rtems_libio_t *iop, void *buf, size_t len)
 	}
 }
 
+static uint32_t rtems_jffs2_count_blocks(struct list_head *list)
+{
+	struct list_head *node;
+	uint32_t count = 0;
+
+	list_for_each(node, list) {
+		++count;
+	}
+
+	return count;
+}
+
+static void rtems_jffs2_get_info(struct super_block *sb, rtems_jffs2_info *info)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+
+	info->flash_size = c->flash_size;
+	info->flash_blocks = c->nr_blocks;
+	info->flash_block_size = c->sector_size;
+	info->used_size = c->used_size;
+	info->dirty_size = c->dirty_size;
+	info->wasted_size = c->wasted_size;
+	info->free_size = c->free_size;
+	info->bad_size = c->bad_size;
+	info->clean_blocks = rtems_jffs2_count_blocks(&c->clean_list);
+	info->dirty_blocks = rtems_jffs2_count_blocks(&c->dirty_list)
+		+ rtems_jffs2_count_blocks(&c->very_dirty_list);
+	info->erasable_blocks = rtems_jffs2_count_blocks(&c->erasable_list)
+		+ rtems_jffs2_count_blocks(&c->erase_pending_list);
+	info->free_blocks = rtems_jffs2_count_blocks(&c->free_list);
+	info->bad_blocks = rtems_jffs2_count_blocks(&c->bad_list);
+	info->gc_passes = sb->s_gc_passes;
+	info->background_gc_passes = sb->s_background_gc_passes;
+	info->flash_erases = sb->s_flash_erases;
+	info->flash_programs = sb->s_flash_programs;
+	info->flash_bytes_written = sb->s_flash_bytes_written;
+	info->user_bytes_written = sb->s_user_bytes_written;
+}
+
+static int rtems_jffs2_ioctl(
+	rtems_libio_t   *iop,
+	ioctl_command_t  request,
+	void            *buffer
+)
+{
+	struct _inode *inode = rtems_jffs2_get_inode_by_iop(iop);
+	int eno;
+
+	rtems_jffs2_do_lock(inode->i_sb);
+
+	switch (request) {
+		case RTEMS_JFFS2_GET_INFO:
+			rtems_jffs2_get_info(inode->i_sb, buffer);
+			eno = 0;
+			break;
+		default:
+			eno = EINVAL;
+			break;
+	}
+
+	rtems_jffs2_do_unlock(inode->i_sb);
+
+	return rtems_jffs2_eno_to_rv_and_errno(eno);
+}
+
+static int rtems_jffs2_fsync_or_fdatasync(rtems_libio_t *iop)
+{
+	struct _inode *inode = rtems_jffs2_get_inode_by_iop(iop);
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(inode->i_sb);
+	int eno;
+
+	rtems_jffs2_do_lock(inode->i_sb);
+	eno = -jffs2_flush_write_buffer(c);
+	rtems_jffs2_do_unlock(inode->i_sb);
+
+	return rtems_jffs2_eno_to_rv_and_errno(eno);
+}
+
 static const rtems_filesystem_file_handlers_r rtems_jffs2_directory_handlers = {
 	.open_h = rtems_filesystem_default_open,
 	.close_h = rtems_filesystem_default_close,
 	.read_h = rtems_jffs2_dir_read,
 	.write_h = rtems_filesystem_default_write,
-	.ioctl_h = rtems_filesystem_default_ioctl,
+	.ioctl_h = rtems_jffs2_ioctl,
 	.lseek_h = rtems_filesystem_default_lseek_directory,
 	.fstat_h = rtems_jffs2_fstat,
 	.ftruncate_h = rtems_filesystem_default_ftruncate_directory,
-	.fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
-	.fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+	.fsync_h = rtems_jffs2_fsync_or_fdatasync,
+	.fdatasync_h = rtems_jffs2_fsync_or_fdatasync,
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap
 };
 
 static ssize_t rtems_jffs2_file_read(rtems_libio_t *iop, void *buf, size_t len)
@@ -609,6 +852,7 @@ static ssize_t rtems_jffs2_file_write(rtems_libio_t *iop, const void *buf, size_
 
 	if (eno == 0) {
 		pos += writtenlen;
+		inode->i_sb->s_user_bytes_written += writtenlen;
 
 		inode->i_mtime = inode->i_ctime = je32_to_cpu(ri.mtime);
 
@@ -659,17 +903,19 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_file_handlers = {
 	.close_h = rtems_filesystem_default_close,
 	.read_h = rtems_jffs2_file_read,
 	.write_h = rtems_jffs2_file_write,
-	.ioctl_h = rtems_filesystem_default_ioctl,
+	.ioctl_h = rtems_jffs2_ioctl,
 	.lseek_h = rtems_filesystem_default_lseek_file,
 	.fstat_h = rtems_jffs2_fstat,
 	.ftruncate_h = rtems_jffs2_file_ftruncate,
-	.fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
-	.fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+	.fsync_h = rtems_jffs2_fsync_or_fdatasync,
+	.fdatasync_h = rtems_jffs2_fsync_or_fdatasync,
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap
 };
 
 static const rtems_filesystem_file_handlers_r rtems_jffs2_link_handlers = {
@@ -687,7 +933,9 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_link_handlers = {
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap
 };
 
 static void rtems_jffs2_set_location(rtems_filesystem_location_info_t *loc, struct _inode *inode)
@@ -973,8 +1221,16 @@ static void rtems_jffs2_freenode(const rtems_filesystem_location_info_t *loc)
 static void rtems_jffs2_fsunmount(rtems_filesystem_mount_table_entry_t *mt_entry)
 {
 	rtems_jffs2_fs_info *fs_info = mt_entry->fs_info;
+	struct super_block *sb = &fs_info->sb;
 	struct _inode *root_i = mt_entry->mt_fs_root->location.node_access;
 
+	/* The GC task may use the inodes, so stop it before they are freed */
+	if (sb->s_gc_task != 0) {
+		rtems_jffs2_stop_gc_task(sb);
+	}
+
+	jffs2_flush_write_buffer(JFFS2_SB_INFO(sb));
+
 	icache_evict(root_i, NULL);
 	assert(root_i->i_cache_next == NULL);
 	assert(root_i->i_count == 1);
@@ -1190,6 +1446,7 @@ int rtems_jffs2_initialize(
 
 	if (err == 0) {
 		sb->s_is_readonly = !mt_entry->writeable;
+		sb->s_is_summary_enabled = jffs2_mount_data->enable_summary;
 		sb->s_flash_control = fc;
 		sb->s_compressor_control = jffs2_mount_data->compressor_control;
 
@@ -1199,6 +1456,23 @@ int rtems_jffs2_initialize(
 		c->flash_size = fc->flash_size;
 		c->cleanmarker_size = sizeof(struct jffs2_unknown_node);
 
+		if (jffs2_mount_data->write_buffer_size != 0) {
+			uint32_t size = jffs2_mount_data->write_buffer_size;
+
+			if ((size & (size - 1)) != 0 || (fc->block_size % size) != 0) {
+				err = -EINVAL;
+			} else {
+				sb->s_wbuf = malloc(size);
+				if (sb->s_wbuf != NULL) {
+					sb->s_wbuf_size = size;
+				} else {
+					err = -ENOMEM;
+				}
+			}
+		}
+	}
+
+	if (err == 0) {
 		err = jffs2_do_mount_fs(c);
 	}
 
@@ -1216,8 +1490,14 @@ int rtems_jffs2_initialize(
 
 		if (!jffs2_is_readonly(c)) {
 			jffs2_erase_pending_blocks(c, 0);
+
+			if (jffs2_mount_data->gc_task_priority != 0) {
+				err = rtems_jffs2_start_gc_task(sb, jffs2_mount_data);
+			}
 		}
+	}
 
+	if (err == 0) {
 		mt_entry->fs_info = fs_info;
 		mt_entry->ops = &rtems_jffs2_ops;
 		mt_entry->mt_fs_root->location.node_access = sb->s_root;
@@ -131,6 +131,8 @@ int jffs2_garbage_collect_pass(struct jffs2_sb_info *c)
 	int ret = 0, inum, nlink;
 	int xattr = 0;
 
+	jffs2_count_garbage_collect_pass(c);
+
 	if (mutex_lock_interruptible(&c->alloc_sem))
 		return -EINTR;
 
@@ -573,6 +575,7 @@ static int jffs2_garbage_collect_pristine(struct jffs2_sb_info *c,
 					  struct jffs2_raw_node_ref *raw)
 {
 	union jffs2_node_union *node;
+	struct kvec vec;
 	size_t retlen;
 	int ret;
 	uint32_t phys_ofs, alloclen;
@@ -677,7 +680,10 @@ static int jffs2_garbage_collect_pristine(struct jffs2_sb_info *c,
  retry:
 	phys_ofs = write_ofs(c);
 
-	ret = jffs2_flash_write(c, phys_ofs, rawlen, &retlen, (char *)node);
+	/* Use the vector write, so that the node is added to the summary */
+	vec.iov_base = node;
+	vec.iov_len = rawlen;
+	ret = jffs2_flash_writev(c, &vec, 1, phys_ofs, &retlen, 0);
 
 	if (ret || (retlen != rawlen)) {
 		pr_notice("Write of %d bytes at 0x%08x failed. returned %d, retlen %zd\n",
@@ -19,7 +19,6 @@
 #include "jffs2_fs_i.h"
 #include "xattr.h"
 #include "acl.h"
-#include "summary.h"
 
 #ifdef __rtems__
 #include "os-rtems.h"
@@ -27,6 +26,9 @@
 #include "os-linux.h"
 #endif
 
+/* Include after the OS header which defines the CONFIG_JFFS2_SUMMARY option */
+#include "summary.h"
+
 #define JFFS2_NATIVE_ENDIAN
 
 /* Note we handle mode bits conversion from JFFS2 (i.e. Linux) to/from
@@ -355,7 +355,7 @@ static int jffs2_do_reserve_space(struct jffs2_sb_info *c, uint32_t minsize,
  restart:
 	reserved_size = 0;
 
-	if (jffs2_sum_active() && (sumsize != JFFS2_SUMMARY_NOSUM_SIZE)) {
+	if (jffs2_sum_active(c) && (sumsize != JFFS2_SUMMARY_NOSUM_SIZE)) {
 							/* NOSUM_SIZE means not to generate summary */
 
 		if (jeb) {
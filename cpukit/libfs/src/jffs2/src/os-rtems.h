@@ -37,6 +37,8 @@
 
 #define CONFIG_JFFS2_ZLIB
 
+#define CONFIG_JFFS2_SUMMARY
+
 struct _inode;
 struct super_block;
 
@@ -103,9 +105,23 @@ struct super_block {
 	rtems_jffs2_flash_control	*s_flash_control;
 	rtems_jffs2_compressor_control	*s_compressor_control;
 	bool			s_is_readonly;
+	bool			s_is_summary_enabled;
 	unsigned char		s_gc_buffer[PAGE_CACHE_SIZE]; // Avoids malloc when user may be under memory pressure
 	rtems_id		s_mutex;
 	char			s_name_buf[JFFS2_MAX_NAME_LEN];
+	rtems_id		s_gc_task;
+	rtems_id		s_gc_task_stopper;
+	uint32_t		s_gc_free_block_reserve;
+	unsigned char		*s_wbuf; // Write buffer, NULL if disabled
+	uint32_t		s_wbuf_size;
+	uint32_t		s_wbuf_ofs;
+	uint32_t		s_wbuf_len;
+	uint32_t		s_gc_passes;
+	uint32_t		s_background_gc_passes;
+	uint32_t		s_flash_erases;
+	uint32_t		s_flash_programs;
+	uint64_t		s_flash_bytes_written;
+	uint64_t		s_user_bytes_written;
 };
 
 #define sleep_on_spinunlock(wq, sl) spin_unlock(sl)
@@ -118,12 +134,22 @@ static inline bool jffs2_is_readonly(struct jffs2_sb_info *c)
 	return sb->s_is_readonly;
 }
 
-static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
+static inline bool jffs2_is_summary_enabled(struct jffs2_sb_info *c)
+{
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+
+	return sb->s_is_summary_enabled;
+}
+
+static inline void jffs2_count_garbage_collect_pass(struct jffs2_sb_info *c)
 {
-       /* We don't have a GC thread in RTEMS (yet) */
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+
+	++sb->s_gc_passes;
 }
 
 /* fs-rtems.c */
+void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c);
 struct _inode *jffs2_new_inode (struct _inode *dir_i, int mode, struct jffs2_raw_inode *ri);
 struct _inode *jffs2_iget(struct super_block *sb, cyg_uint32 ino);
 void jffs2_iput(struct _inode * i);
@@ -154,6 +180,7 @@ int jffs2_flash_write(struct jffs2_sb_info *c, cyg_uint32 write_buffer_offset,
 int jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 			      unsigned long count, loff_t to, size_t *retlen);
 int jffs2_flash_erase(struct jffs2_sb_info *c, struct jffs2_eraseblock *jeb);
+int jffs2_flush_write_buffer(struct jffs2_sb_info *c);
 
 // dir-rtems.c
 struct _inode *jffs2_lookup(struct _inode *dir_i, const unsigned char *name, size_t namelen);
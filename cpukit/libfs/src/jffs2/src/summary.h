@@ -171,7 +171,8 @@ struct jffs2_sum_marker
 
 #ifdef CONFIG_JFFS2_SUMMARY	/* SUMMARY SUPPORT ENABLED */
 
-#define jffs2_sum_active() (1)
+/* On RTEMS the summary support is a mount option */
+#define jffs2_sum_active(c) ((c)->summary != NULL)
 int jffs2_sum_init(struct jffs2_sb_info *c);
 void jffs2_sum_exit(struct jffs2_sb_info *c);
 void jffs2_sum_disable_collecting(struct jffs2_summary *s);
@@ -192,7 +193,7 @@ int jffs2_sum_scan_sumnode(struct jffs2_sb_info *c, struct jffs2_eraseblock *jeb
 
 #else				/* SUMMARY DISABLED */
 
-#define jffs2_sum_active() (0)
+#define jffs2_sum_active(c) (0)
 #define jffs2_sum_init(a) (0)
 #define jffs2_sum_exit(a)
 #define jffs2_sum_disable_collecting(a)
@@ -226,6 +226,21 @@ nfsSetTimeout(uint32_t timeout_ms);
 uint32_t
 nfsGetTimeout(void);
 
+/**
+ * @brief Number of READ or WRITE calls an open file may have in flight
+ * (initial default: 4, at most 8).
+ *
+ * Regular files opened while this is nonzero get a read-ahead and a
+ * write-behind buffer of nfsPipelineDepth * 8k bytes each.  A sequential
+ * read refills the read-ahead buffer with concurrent READ calls.  Writes to
+ * consecutive offsets are collected in the write-behind buffer which is sent
+ * with concurrent WRITE calls once it is full, on a non-sequential write, a
+ * read, fstat(), fsync(), fdatasync(), ftruncate() or close().  An error of a
+ * deferred write is reported by the call which flushes the buffer.  Set this
+ * to zero to get one synchronous call per read() or write().
+ */
+extern int nfsPipelineDepth;
+
 #ifdef __cplusplus
 }
 #endif
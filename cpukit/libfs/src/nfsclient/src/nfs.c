@@ -712,6 +712,17 @@ static struct nfsstats {
 #endif
 int nfsStBlksize = DEFAULT_NFS_ST_BLKSIZE;
 
+/*
+ * Global variable to tune the number of READ/WRITE
+ * RPCs an open file may have in flight (see librtemsNfs.h).
+ * Zero disables read-ahead and write-behind.
+ */
+#ifndef DEFAULT_NFS_PIPELINE_DEPTH
+#define DEFAULT_NFS_PIPELINE_DEPTH	4
+#endif
+#define NFS_PIPELINE_DEPTH_MAX		8
+int nfsPipelineDepth = DEFAULT_NFS_PIPELINE_DEPTH;
+
 
 /*****************************************
 	Implementation
@@ -1154,6 +1165,47 @@ int			refuse;
 	return 0;
 }
 
+/* Pick the transaction pool for a NFSPROC_xx;
+ * only requests with bulk arguments need big buffers.
+ */
+static RpcUdpXactPool
+nfsXactPool(int proc)
+{
+	switch (proc) {
+		case NFSPROC_SYMLINK:
+		case NFSPROC_WRITE:
+					return nfsGlob.bigPool;
+		default:	return nfsGlob.smallPool;
+	}
+}
+
+/* Report a failed RPC on stderr and
+ * set errno accordingly (always nonzero).
+ */
+static void
+nfsRpcError(int proc, enum clnt_stat stat)
+{
+	fprintf(stderr,
+			"NFS (proc %i) - %s\n",
+			proc,
+			clnt_sperrno(stat));
+
+	switch (stat) {
+		/* TODO: this is probably not complete and/or fully accurate */
+		case RPC_CANTENCODEARGS : errno = EINVAL;	break;
+		case RPC_AUTHERROR  	: errno = EPERM;	break;
+
+		case RPC_CANTSEND		:
+		case RPC_CANTRECV		: /* hope they have errno set */
+		case RPC_SYSTEMERROR	: break;
+
+		default             	: errno = EIO;		break;
+	}
+
+	if (!errno)
+		errno = EIO;
+}
+
 /* NFS RPC wrapper.
  *
  * ARGS:	srvr	the NFS server we want to call
@@ -1183,18 +1235,9 @@ nfscall(
 {
 RpcUdpXact		xact;
 enum clnt_stat	stat;
-RpcUdpXactPool	pool;
 int				rval = -1;
 
-
-	switch (proc) {
-		case NFSPROC_SYMLINK:
-		case NFSPROC_WRITE:
-					pool = nfsGlob.bigPool;		break;
-		default:	pool = nfsGlob.smallPool;	break;
-	}
-
-	xact = rpcUdpXactPoolGet(pool, XactGetCreate);
+	xact = rpcUdpXactPoolGet(nfsXactPool(proc), XactGetCreate);
 
 	if ( !xact ) {
 		errno = ENOMEM;
@@ -1212,23 +1255,7 @@ int				rval = -1;
 								pargs,
 								0)) ||
 	     RPC_SUCCESS != (stat=rpcUdpRcv(xact)) ) {
-
-		fprintf(stderr,
-				"NFS (proc %i) - %s\n",
-				proc,
-				clnt_sperrno(stat));
-
-		switch (stat) {
-			/* TODO: this is probably not complete and/or fully accurate */
-			case RPC_CANTENCODEARGS : errno = EINVAL;	break;
-			case RPC_AUTHERROR  	: errno = EPERM;	break;
-
-			case RPC_CANTSEND		:
-			case RPC_CANTRECV		: /* hope they have errno set */
-			case RPC_SYSTEMERROR	: break;
-
-			default             	: errno = EIO;		break;
-		}
+		nfsRpcError(proc, stat);
 	} else {
 		rval = 0;
 	}
@@ -1236,9 +1263,6 @@ int				rval = -1;
 	/* release the transaction back into the pool */
 	rpcUdpXactPoolPut(xact);
 
-	if (rval && !errno)
-		errno = EIO;
-
 	return rval;
 }
 
@@ -1505,6 +1529,11 @@ static void nfs_eval_set_handlers(
 	rtems_filesystem_location_info_t *currentloc =
 		rtems_filesystem_eval_path_get_currentloc(ctx);
 
+	/* the open handlers attach the I/O buffers or directory state;
+	 * until then there is none (see nfs_file_fstat)
+	 */
+	currentloc->node_access_2 = NULL;
+
 	switch (type) {
 		case NFDIR:
 			currentloc->handlers = &nfs_dir_file_handlers;
@@ -1752,7 +1781,9 @@ static int nfs_clonenode(rtems_filesystem_location_info_t *loc)
 	node = nfsNodeClone(node);
 	UNLOCK(nfsGlob.lock);
 
-	loc->node_access = node;
+	loc->node_access   = node;
+	/* the I/O buffers of an open file are not shared */
+	loc->node_access_2 = NULL;
 
 	return node != NULL ? 0 : -1;
 }
@@ -2329,7 +2360,207 @@ const struct _rtems_filesystem_operations_table nfs_fs_ops = {
 		  'nfs_xxx'.
  *****************************************/
 
-/* stateless NFS protocol makes this trivial */
+/* Regular files opened while 'nfsPipelineDepth' is
+ * nonzero get a FileIoRec attached to the
+ * pathinfo.node_access_2. It buffers data read ahead
+ * or written behind so that sequential I/O is done with
+ * several READ/WRITE transactions in flight instead of
+ * a single synchronous RPC per NFS_MAXDATA bytes.
+ */
+typedef struct FileIoRec_ {
+	int			depth;		/* max. number of RPCs in flight             */
+	uint32_t	size;		/* size of each buffer (depth * NFS_MAXDATA) */
+	/* read-ahead buffer holding [raOffset, raOffset + raLen) */
+	char		*raBuf;
+	uint32_t	raOffset;
+	uint32_t	raLen;
+	uint32_t	raNext;		/* offset where a sequential read continues  */
+	/* write-behind buffer holding [wbOffset, wbOffset + wbLen) */
+	char		*wbBuf;
+	uint32_t	wbOffset;
+	uint32_t	wbLen;
+	/* transactions in flight and their results */
+	RpcUdpXact	xact[NFS_PIPELINE_DEPTH_MAX];
+	uint32_t	len[NFS_PIPELINE_DEPTH_MAX];
+	union {
+		readres		rd;
+		attrstat	wr;
+	}			res[NFS_PIPELINE_DEPTH_MAX];
+} FileIoRec, *FileIo;
+
+/* Transfer 'count' bytes at file 'offset' from/to 'buf'
+ * in chunks of NFS_MAXDATA with up to 'fio->depth'
+ * READ or WRITE transactions in flight.
+ *
+ * ARGS:	proc	NFSPROC_READ or NFSPROC_WRITE
+ *
+ * RETURNS:	number of bytes transferred (a read stops
+ *			at the first short chunk, i.e., the end of
+ *			file), -1 on error with errno set.
+ */
+static ssize_t
+nfs_file_pipeline(
+	NfsNode node,
+	FileIo fio,
+	int proc,
+	uint32_t offset,
+	char *buf,
+	uint32_t count
+)
+{
+Nfs				nfs  = node->nfs;
+RpcUdpXactPool	pool = nfsXactPool(proc);
+RpcUdpXact		xact;
+enum clnt_stat	stat;
+uint32_t		sent = 0;	/* bytes requested so far   */
+uint32_t		done = 0;	/* bytes transferred so far */
+int				head = 0;	/* next slot to send        */
+int				tail = 0;	/* next slot to collect     */
+int				busy = 0;
+int				eof  = 0;
+int				err  = 0;
+
+	do {
+		/* fill the pipeline */
+		while ( busy < fio->depth && sent < count && !eof && !err ) {
+			uint32_t	chunk = count - sent;
+			xdrproc_t	xargs, xres;
+
+			if ( chunk > NFS_MAXDATA )
+				chunk = NFS_MAXDATA;
+
+			xact = rpcUdpXactPoolGet(pool, XactGetCreate);
+			if ( !xact ) {
+				err = ENOMEM;
+				break;
+			}
+
+			if ( NFSPROC_WRITE == proc ) {
+				SERP_ARGS(node).writearg.beginoffset   = UINT32_C(0xdeadbeef);
+				SERP_ARGS(node).writearg.offset        = offset + sent;
+				SERP_ARGS(node).writearg.totalcount    = UINT32_C(0xdeadbeef);
+				SERP_ARGS(node).writearg.data.data_len = chunk;
+				SERP_ARGS(node).writearg.data.data_val = buf + sent;
+				xargs = (xdrproc_t)xdr_writeargs;
+				xres  = (xdrproc_t)xdr_attrstat;
+			} else {
+				SERP_ARGS(node).readarg.offset         = offset + sent;
+				SERP_ARGS(node).readarg.count          = chunk;
+				SERP_ARGS(node).readarg.totalcount     = UINT32_C(0xdeadbeef);
+				fio->res[head].rd.readres_u.reply.data.data_val = buf + sent;
+				xargs = (xdrproc_t)xdr_readargs;
+				xres  = (xdrproc_t)xdr_readres;
+			}
+
+			/* the arguments are encoded right away; hence the
+			 * node's argument area may be reused for the next chunk
+			 */
+			stat = rpcUdpSend(
+						xact,
+						nfs->server,
+						NFSCALL_TIMEOUT,
+						proc,
+						xres,
+						(caddr_t)&fio->res[head],
+						xargs,
+						(caddr_t)&SERP_FILE(node),
+						0);
+
+			if ( RPC_SUCCESS != stat ) {
+				nfsRpcError(proc, stat);
+				err = errno;
+				rpcUdpXactPoolPut(xact);
+				break;
+			}
+
+			fio->xact[head] = xact;
+			fio->len[head]  = chunk;
+			head            = (head + 1) % fio->depth;
+			sent           += chunk;
+			busy++;
+		}
+
+		if ( 0 == busy )
+			break;
+
+		/* collect the oldest transaction; later ones
+		 * may already be complete - they are picked up
+		 * without blocking
+		 */
+		xact = fio->xact[tail];
+		stat = rpcUdpRcv(xact);
+		rpcUdpXactPoolPut(xact);
+
+		if ( RPC_SUCCESS != stat ) {
+			if ( !err ) {
+				nfsRpcError(proc, stat);
+				err = errno;
+			}
+		} else if ( !err && !eof ) {
+			if ( NFSPROC_WRITE == proc ) {
+				if ( nfsEvaluateStatus(fio->res[tail].wr.status) ) {
+					err = errno;
+				} else {
+					SERP_ATTR(node) = fio->res[tail].wr.attrstat_u.attributes;
+					node->age       = nowSeconds();
+					done           += fio->len[tail];
+				}
+			} else {
+				if ( nfsEvaluateStatus(fio->res[tail].rd.status) ) {
+					err = errno;
+				} else {
+					uint32_t got = fio->res[tail].rd.readres_u.reply.data.data_len;
+
+					done += got;
+					if ( got < fio->len[tail] )
+						eof = 1;
+				}
+			}
+		}
+
+		tail = (tail + 1) % fio->depth;
+		busy--;
+	} while ( busy > 0 || (sent < count && !eof && !err) );
+
+	if ( err ) {
+		errno = err;
+		return -1;
+	}
+
+	return done;
+}
+
+/* Send the data collected in the write-behind buffer.
+ *
+ * RETURNS:	0 on success, -1 on error with errno set;
+ *			the buffer is empty in either case.
+ */
+static int
+nfs_file_flush(NfsNode node, FileIo fio)
+{
+uint32_t	len = fio->wbLen;
+
+	if ( 0 == len )
+		return 0;
+
+	fio->wbLen = 0;
+	fio->raLen = 0;
+
+	if ( nfs_file_pipeline(node, fio, NFSPROC_WRITE, fio->wbOffset, fio->wbBuf, len) < 0 ) {
+		int err = errno;
+
+		/* try at least to recover the current attributes */
+		updateAttr(node, 1 /* force */);
+		errno = err;
+		return -1;
+	}
+
+	return 0;
+}
+
+/* the NFS protocol is stateless; we only
+ * set up buffers for pipelined I/O
+ */
 static int nfs_file_open(
 	rtems_libio_t *iop,
 	const char    *pathname,
@@ -2337,6 +2568,25 @@ static int nfs_file_open(
 	mode_t        mode
 )
 {
+FileIo	fio   = NULL;
+int		depth = nfsPipelineDepth;
+
+	if ( depth > 0 ) {
+		if ( depth > NFS_PIPELINE_DEPTH_MAX )
+			depth = NFS_PIPELINE_DEPTH_MAX;
+
+		fio = calloc(1, sizeof(*fio));
+		if ( !fio ) {
+			errno = ENOMEM;
+			return -1;
+		}
+
+		fio->depth = depth;
+		fio->size  = depth * NFS_MAXDATA;
+	}
+
+	iop->pathinfo.node_access_2 = fio;
+
 	return 0;
 }
 
@@ -2385,7 +2635,29 @@ static int nfs_file_close(
 	rtems_libio_t *iop
 )
 {
-	return 0;
+FileIo	fio = iop->pathinfo.node_access_2;
+int		rv  = 0;
+
+	if ( fio ) {
+		rv = nfs_file_flush(iop->pathinfo.node_access, fio);
+
+		free(fio->raBuf);
+		free(fio->wbBuf);
+		free(fio);
+		iop->pathinfo.node_access_2 = 0;
+	}
+
+	return rv;
+}
+
+static int nfs_file_fsync(
+	rtems_libio_t *iop
+)
+{
+FileIo	fio = iop->pathinfo.node_access_2;
+
+	/* NFSv2 servers commit WRITEs before replying */
+	return fio ? nfs_file_flush(iop->pathinfo.node_access, fio) : 0;
 }
 
 static int nfs_dir_close(
@@ -2441,6 +2713,98 @@ Nfs		nfs  = node->nfs;
 	return rv;
 }
 
+/* Read through the read-ahead buffer. A miss refills
+ * the whole buffer if the access is sequential and
+ * just what the caller asked for otherwise. Requests
+ * at least as big as the buffer bypass it.
+ */
+static ssize_t nfs_file_read_ahead(
+	rtems_libio_t *iop,
+	NfsNode node,
+	FileIo fio,
+	char *in,
+	size_t count
+)
+{
+	ssize_t rv = 0;
+	uint32_t offset = iop->offset;
+
+	/* make sure we read back what was written */
+	if (nfs_file_flush(node, fio) != 0) {
+		return -1;
+	}
+
+	while (count > 0) {
+		ssize_t done;
+		uint32_t want;
+
+		if (offset - fio->raOffset < fio->raLen) {
+			uint32_t skip = offset - fio->raOffset;
+			uint32_t n = fio->raLen - skip;
+
+			if (n > count) {
+				n = count;
+			}
+
+			memcpy(in, fio->raBuf + skip, n);
+			offset += n;
+			in += n;
+			count -= n;
+			rv += n;
+			continue;
+		}
+
+		if (count >= fio->size) {
+			done = nfs_file_pipeline(node, fio, NFSPROC_READ, offset, in, count);
+			if (done > 0) {
+				offset += (uint32_t) done;
+				rv += done;
+			} else if (done < 0 && rv == 0) {
+				rv = -1;
+			}
+			break;
+		}
+
+		if (fio->raBuf == NULL) {
+			fio->raBuf = malloc(fio->size);
+			if (fio->raBuf == NULL) {
+				errno = ENOMEM;
+				rv = rv > 0 ? rv : -1;
+				break;
+			}
+		}
+
+		if (offset == fio->raNext) {
+			want = fio->size;
+		} else {
+			want = (count + NFS_MAXDATA - 1) & ~(uint32_t) (NFS_MAXDATA - 1);
+		}
+		if (want > UINT32_MAX - offset) {
+			want = UINT32_MAX - offset;
+		}
+
+		fio->raLen = 0;
+		done = nfs_file_pipeline(node, fio, NFSPROC_READ, offset, fio->raBuf, want);
+		if (done <= 0) {
+			if (done < 0 && rv == 0) {
+				rv = -1;
+			}
+			break;
+		}
+
+		fio->raOffset = offset;
+		fio->raLen = (uint32_t) done;
+	}
+
+	fio->raNext = offset;
+
+	if (rv > 0) {
+		iop->offset = offset;
+	}
+
+	return rv;
+}
+
 static ssize_t nfs_file_read(
 	rtems_libio_t *iop,
 	void *buffer,
@@ -2449,6 +2813,7 @@ static ssize_t nfs_file_read(
 {
 	ssize_t rv = 0;
 	NfsNode node = iop->pathinfo.node_access;
+	FileIo fio = iop->pathinfo.node_access_2;
 	uint32_t offset = iop->offset;
 	char *in = buffer;
 
@@ -2466,6 +2831,10 @@ static ssize_t nfs_file_read(
 		count = UINT32_MAX - offset;
 	}
 
+	if (fio != NULL) {
+		return nfs_file_read_ahead(iop, node, fio, buffer, count);
+	}
+
 	do {
 		size_t chunk = count <= NFS_MAXDATA ? count : NFS_MAXDATA;
 		ssize_t done = nfs_file_read_chunk(node, offset, in, chunk);
@@ -2551,6 +2920,95 @@ RpcUdpServer	server = ((Nfs)iop->pathinfo.mt_entry->fs_info)->server;
 	return rv;
 }
 
+/* Collect sequential writes in the write-behind buffer
+ * and send it once it is full. Requests at least as
+ * big as the buffer bypass it.
+ */
+static ssize_t nfs_file_write_behind(
+	rtems_libio_t *iop,
+	NfsNode node,
+	FileIo fio,
+	const char *out,
+	size_t count
+)
+{
+	ssize_t rv = 0;
+	uint32_t offset;
+
+	if (iop->offset < 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((uintmax_t) iop->offset >= UINT32_MAX) {
+		errno = EFBIG;
+		return -1;
+	}
+
+	offset = iop->offset;
+
+	if (count > UINT32_MAX - offset) {
+		count = UINT32_MAX - offset;
+	}
+
+	fio->raLen = 0;
+
+	if (fio->wbLen > 0 && offset != fio->wbOffset + fio->wbLen) {
+		if (nfs_file_flush(node, fio) != 0) {
+			return -1;
+		}
+	}
+
+	if (fio->wbLen == 0 && count >= fio->size) {
+		rv = nfs_file_pipeline(node, fio, NFSPROC_WRITE, offset, (char *) out, count);
+		if (rv < 0) {
+			int err = errno;
+
+			updateAttr(node, 1 /* force */);
+			errno = err;
+			return -1;
+		}
+
+		iop->offset += rv;
+		return rv;
+	}
+
+	if (fio->wbBuf == NULL) {
+		fio->wbBuf = malloc(fio->size);
+		if (fio->wbBuf == NULL) {
+			errno = ENOMEM;
+			return -1;
+		}
+	}
+
+	while (count > 0) {
+		uint32_t n = fio->size - fio->wbLen;
+
+		if (n > count) {
+			n = count;
+		}
+
+		if (fio->wbLen == 0) {
+			fio->wbOffset = offset;
+		}
+
+		memcpy(fio->wbBuf + fio->wbLen, out, n);
+		fio->wbLen += n;
+		offset += n;
+		out += n;
+		count -= n;
+		rv += n;
+
+		if (fio->wbLen == fio->size && nfs_file_flush(node, fio) != 0) {
+			return -1;
+		}
+	}
+
+	iop->offset = offset;
+
+	return rv;
+}
+
 static ssize_t nfs_file_write(
 	rtems_libio_t *iop,
 	const void    *buffer,
@@ -2560,6 +3018,17 @@ static ssize_t nfs_file_write(
 ssize_t rv;
 NfsNode 	node = iop->pathinfo.node_access;
 Nfs			nfs  = node->nfs;
+FileIo		fio  = iop->pathinfo.node_access_2;
+
+	if ( fio ) {
+		if ( !(LIBIO_FLAGS_APPEND & iop->flags) )
+			return nfs_file_write_behind(iop, node, fio, buffer, count);
+
+		/* appending needs the current size from the server */
+		if ( nfs_file_flush(node, fio) )
+			return -1;
+		fio->raLen = 0;
+	}
 
 	if (count > NFS_MAXDATA)
 		count = NFS_MAXDATA;
@@ -2750,6 +3219,22 @@ fattr	*fa  = &SERP_ATTR(node);
 	return 0;
 }
 
+/* flush the write-behind buffer so that the size
+ * (also used by lseek(SEEK_END)) reflects all writes
+ */
+static int nfs_file_fstat(
+	const rtems_filesystem_location_info_t *loc,
+	struct stat *buf
+)
+{
+FileIo	fio = loc->node_access_2;
+
+	if ( fio && nfs_file_flush(loc->node_access, fio) )
+		return -1;
+
+	return nfs_fstat(loc, buf);
+}
+
 /* a helper which does the real work for
  * a couple of handlers (such as chmod,
  * ftruncate or utime)
@@ -2848,6 +3333,13 @@ static int nfs_file_ftruncate(
 )
 {
 sattr					arg;
+FileIo					fio = iop->pathinfo.node_access_2;
+
+	if ( fio ) {
+		if ( nfs_file_flush(iop->pathinfo.node_access, fio) )
+			return -1;
+		fio->raLen = 0;
+	}
 
 	if (length < 0) {
 		errno = EINVAL;
@@ -2878,15 +3370,17 @@ struct _rtems_filesystem_file_handlers_r nfs_file_file_handlers = {
 	.write_h     = nfs_file_write,
 	.ioctl_h     = rtems_filesystem_default_ioctl,
 	.lseek_h     = rtems_filesystem_default_lseek_file,
-	.fstat_h     = nfs_fstat,
+	.fstat_h     = nfs_file_fstat,
 	.ftruncate_h = nfs_file_ftruncate,
-	.fsync_h     = rtems_filesystem_default_fsync_or_fdatasync,
-	.fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+	.fsync_h     = nfs_file_fsync,
+	.fdatasync_h = nfs_file_fsync,
 	.fcntl_h     = rtems_filesystem_default_fcntl,
 	.kqfilter_h  = rtems_filesystem_default_kqfilter,
 	.poll_h      = rtems_filesystem_default_poll,
 	.readv_h     = rtems_filesystem_default_readv,
-	.writev_h    = rtems_filesystem_default_writev
+	.writev_h    = rtems_filesystem_default_writev,
+	.mmap_h      = rtems_filesystem_default_mmap,
+	.munmap_h    = rtems_filesystem_default_munmap
 };
 
 /* the directory handlers table */
@@ -2906,7 +3400,9 @@ struct _rtems_filesystem_file_handlers_r nfs_dir_file_handlers = {
 	.kqfilter_h  = rtems_filesystem_default_kqfilter,
 	.poll_h      = rtems_filesystem_default_poll,
 	.readv_h     = rtems_filesystem_default_readv,
-	.writev_h    = rtems_filesystem_default_writev
+	.writev_h    = rtems_filesystem_default_writev,
+	.mmap_h      = rtems_filesystem_default_mmap,
+	.munmap_h    = rtems_filesystem_default_munmap
 };
 
 /* the link handlers table */
@@ -2926,7 +3422,9 @@ struct _rtems_filesystem_file_handlers_r nfs_link_file_handlers = {
 	.kqfilter_h  = rtems_filesystem_default_kqfilter,
 	.poll_h      = rtems_filesystem_default_poll,
 	.readv_h     = rtems_filesystem_default_readv,
-	.writev_h    = rtems_filesystem_default_writev
+	.writev_h    = rtems_filesystem_default_writev,
+	.mmap_h      = rtems_filesystem_default_mmap,
+	.munmap_h    = rtems_filesystem_default_munmap
 };
 
 /* we need a dummy driver entry table to get a
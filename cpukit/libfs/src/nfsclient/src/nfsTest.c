@@ -48,6 +48,16 @@
  *    pipeline 'reader' and 'cruncher' threads.
  *  - read is not completely asynchronous; synchronization is still
  *    performed at 'big block' boundaries (num_readers * chunk_size).
+ *
+ * int
+ * nfsTestPipeline(char *file_name, int chunk_size, unsigned size, int depth);
+ *
+ * compares the client's own read-ahead / write-behind (see
+ * 'nfsPipelineDepth' in librtemsNfs.h) against synchronous I/O:
+ * 'file_name' is written with 'size' bytes and read back in
+ * chunks of 'chunk_size' bytes, once with 'nfsPipelineDepth'
+ * set to zero and once with 'depth' RPCs in flight. The
+ * throughput of each run is printed to stdout.
  */
 
 
@@ -109,6 +119,10 @@
 #include <fcntl.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "librtemsNfs.h"
 
 unsigned nfsTestReaderPri = 80;
 
@@ -359,7 +373,7 @@ char	          *buf=0;
 
         now = rtems_clock_get_ticks_since_boot();
 	now = (now-then)*1000;
-	ticksspec = rtems_clock_get_ticks_per_second();
+	tickspsec = rtems_clock_get_ticks_per_second();
 	now /= tickspsec; /* time in ms */
 
 cleanup:
@@ -384,3 +398,110 @@ cleanup:
 	free(buf);
 	return now;
 }
+
+/* Write 'size' bytes to 'fnam' in chunks of 'sz' and
+ * read them back.
+ *
+ * RETURNS: 0 on success, -1 on error; the elapsed write and
+ *          read times in ms are stored in *pwr and *prd.
+ */
+static int
+nfsTestWriteRead(char *fnam, char *buf, int sz, unsigned size, rtems_interval *pwr, rtems_interval *prd)
+{
+rtems_interval    then, tickspsec = rtems_clock_get_ticks_per_second();
+unsigned          off;
+int               fd, n;
+
+	if ( (fd=open(fnam, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0 ) {
+		perror("opening file for writing");
+		return -1;
+	}
+
+	then = rtems_clock_get_ticks_since_boot();
+	for ( off = 0; off < size; off += n ) {
+		n = size - off < sz ? size - off : sz;
+		if ( write(fd, buf, n) != n ) {
+			perror("writing");
+			close(fd);
+			return -1;
+		}
+	}
+	/* the write-behind buffer is flushed here */
+	if ( close(fd) ) {
+		perror("closing");
+		return -1;
+	}
+	*pwr = (rtems_clock_get_ticks_since_boot() - then) * 1000 / tickspsec;
+
+	if ( (fd=open(fnam, O_RDONLY)) < 0 ) {
+		perror("opening file for reading");
+		return -1;
+	}
+
+	then = rtems_clock_get_ticks_since_boot();
+	off  = 0;
+	while ( (n = read(fd, buf, sz)) > 0 )
+		off += n;
+	*prd = (rtems_clock_get_ticks_since_boot() - then) * 1000 / tickspsec;
+	close(fd);
+
+	if ( n < 0 || off != size ) {
+		fprintf(stderr, "read back %u of %u bytes\n", off, size);
+		return -1;
+	}
+
+	return 0;
+}
+
+static void
+nfsTestPrintRate(const char *what, int depth, unsigned size, rtems_interval ms)
+{
+	printf("%-5s depth %i: %8lu ms, %8lu kB/s\n",
+		what,
+		depth,
+		(unsigned long)ms,
+		(unsigned long)(ms ? size / ms : 0));
+}
+
+/* Benchmark the pipelined read-ahead / write-behind
+ * against synchronous NFS I/O (one RPC per chunk).
+ *
+ * RETURNS: 0 on success, -1 on error.
+ */
+int
+nfsTestPipeline(char *fnam, int sz, unsigned size, int depth)
+{
+int               saved = nfsPipelineDepth;
+int               i, rval = 0;
+int               depths[2];
+rtems_interval    wr, rd;
+char              *buf;
+
+	if ( sz <= 0 || depth <= 0 ) {
+		fprintf(stderr,"Usage: nfsTestPipeline(file_name, chunk_size, size, depth)\n");
+		return -1;
+	}
+
+	if ( ! (buf=malloc(sz)) ) {
+		perror("allocating buffer");
+		return -1;
+	}
+	memset(buf, 0xa5, sz);
+
+	depths[0] = 0;
+	depths[1] = depth;
+
+	for ( i=0; i<2 && 0 == rval; i++ ) {
+		nfsPipelineDepth = depths[i];
+		rval = nfsTestWriteRead(fnam, buf, sz, size, &wr, &rd);
+		if ( 0 == rval ) {
+			nfsTestPrintRate("write", depths[i], size, wr);
+			nfsTestPrintRate("read",  depths[i], size, rd);
+		}
+	}
+
+	nfsPipelineDepth = saved;
+	unlink(fnam);
+	free(buf);
+	return rval;
+}
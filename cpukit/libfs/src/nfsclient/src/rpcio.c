@@ -329,6 +329,7 @@ typedef struct RpcUdpXactRec_ {
 		long				age;		/* age info; needed to manage retransmission    */
 		long				trip;		/* record round trip time in ticks              */
 		rtems_id			requestor;	/* the task waiting for this XACT to complete   */
+		volatile int		done;		/* set by the daemon when the XACT is complete  */
 		RpcUdpXactPool		pool;		/* if this XACT belong to a pool, this is it    */
 		XDR					xdrs;		/* argument encoder stream                      */
 		int					xdrpos;     /* stream position after the (permanent) header */
@@ -823,6 +824,8 @@ va_list			ap;
 
 	va_end(ap);
 
+	xact->done      = 0;
+
 	rtems_task_ident(RTEMS_SELF, RTEMS_WHO_AM_I, &xact->requestor);
 	if ( rtems_message_queue_send( msgQ, &xact, sizeof(xact)) ) {
 		return RPC_CANTSEND;
@@ -837,6 +840,12 @@ va_list			ap;
  * transaction.
  * The caller is woken by the RPC daemon either
  * upon reception of the reply or on timeout.
+ *
+ * A task may have several transactions outstanding
+ * at once (they all share the same RTEMS_RPC_EVENT);
+ * they may be collected in any order since the
+ * daemon flags each transaction individually when
+ * it is complete.
  */
 enum clnt_stat
 rpcUdpRcv(RpcUdpXact xact)
@@ -851,13 +860,17 @@ rtems_event_set		gotEvents;
 
 	do {
 
-	/* block for the reply */
-	status = rtems_event_receive(
-		RTEMS_RPC_EVENT,
-		RTEMS_WAIT | RTEMS_EVENT_ANY,
-		RTEMS_NO_TIMEOUT,
-		&gotEvents);
-	ASSERT( status == RTEMS_SUCCESSFUL );
+	/* block for the reply; the event may have been
+	 * sent on behalf of another transaction of ours
+	 */
+	while ( !xact->done ) {
+		status = rtems_event_receive(
+			RTEMS_RPC_EVENT,
+			RTEMS_WAIT | RTEMS_EVENT_ANY,
+			RTEMS_NO_TIMEOUT,
+			&gotEvents);
+		ASSERT( status == RTEMS_SUCCESSFUL );
+	}
 
 	if (xact->status.re_status) {
 #ifdef MBUF_RX
@@ -912,6 +925,7 @@ rtems_event_set		gotEvents;
 #endif
 
 	if (refresh && locked_refresh(xact->server)) {
+		xact->done = 0;
 		rtems_task_ident(RTEMS_SELF, RTEMS_WHO_AM_I, &xact->requestor);
 		if ( rtems_message_queue_send(msgQ, &xact, sizeof(xact)) ) {
 			return RPC_CANTSEND;
@@ -1292,6 +1306,7 @@ rtems_status_code	status;
 				}
 
 				/* wakeup requestor */
+				xact->done = 1;
 				rtems_event_send(xact->requestor, RTEMS_RPC_EVENT);
 			}
 		}
@@ -1347,6 +1362,7 @@ rtems_status_code	status;
 #if (DEBUG) & DEBUG_TIMEOUT
 					fprintf(stderr,"RPCIO XACT timed out; waking up requestor\n");
 #endif
+					xact->done = 1;
 					if ( rtems_event_send(xact->requestor, RTEMS_RPC_EVENT) ) {
 						rtems_panic("RPCIO PANIC: requestor id was 0x%08x",
 									xact->requestor);
@@ -1379,6 +1395,7 @@ rtems_status_code	status;
 
 						/* wakeup requestor */
 						fprintf(stderr,"RPCIO: SEND failure\n");
+						xact->done = 1;
 						status = rtems_event_send(xact->requestor, RTEMS_RPC_EVENT);
 						assert( status == RTEMS_SUCCESSFUL );
 
@@ -1516,6 +1533,7 @@ rtems_status_code	status;
 
 	for (xact=((RpcUdpXact)listHead.next); xact; xact=((RpcUdpXact)xact->node.next)) {
 			xact->status.re_status = RPC_TIMEDOUT;
+			xact->done = 1;
 			rtems_event_send(xact->requestor, RTEMS_RPC_EVENT);
 	}
 #endif
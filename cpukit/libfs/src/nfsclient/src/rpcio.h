@@ -159,6 +159,9 @@ rpcUdpSend(
 
 /**
  * @brief Wait for a transaction to complete.
+ *
+ * A task may have several transactions outstanding; they may be
+ * collected in any order.
  */
 enum clnt_stat
 rpcUdpRcv(RpcUdpXact xact);
@@ -166,5 +166,7 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_dir_handlers = {
   .kqfilter_h  = rtems_filesystem_default_kqfilter,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
-  .writev_h    = rtems_filesystem_default_writev
+  .writev_h    = rtems_filesystem_default_writev,
+  .mmap_h      = rtems_filesystem_default_mmap,
+  .munmap_h    = rtems_filesystem_default_munmap
 };
@@ -33,6 +33,7 @@
 
 #include <rtems.h>
 #include <rtems/capture-cli.h>
+#include <rtems/capture-ctf.h>
 #include <rtems/captureimpl.h>
 #include <rtems/monitor.h>
 #include <rtems/cpuuse.h>
@@ -1069,6 +1070,38 @@ rtems_capture_cli_flush (int                                argc,
            prime ? "primed" : "not primed");
 }
 
+/*
+ * rtems_capture_cli_ctf
+ *
+ * This function is a monitor command that exports the trace records to a
+ * Common Trace Format trace directory.
+ */
+
+static void
+rtems_capture_cli_ctf (int                                argc,
+                       char**                             argv,
+                       const rtems_monitor_command_arg_t* command_arg RC_UNUSED,
+                       bool                               verbose RC_UNUSED)
+{
+  rtems_status_code sc;
+
+  if (argc != 2)
+  {
+    fprintf (stdout, "error: enter the trace directory\n");
+    return;
+  }
+
+  sc = rtems_capture_ctf_export (argv[1]);
+
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    fprintf (stdout, "error: CTF export failed: %s\n", rtems_status_text (sc));
+    return;
+  }
+
+  fprintf (stdout, "trace exported to %s.\n", argv[1]);
+}
+
 static rtems_monitor_command_entry_t rtems_capture_cli_cmds[] =
 {
   {
@@ -1198,6 +1231,14 @@ static rtems_monitor_command_entry_t rtems_capture_cli_cmds[] =
     rtems_capture_cli_flush,
     { 0 },
     0
+  },
+  {
+    "cctf",
+    "usage: cctf directory\n",
+    0,
+    rtems_capture_cli_ctf,
+    { 0 },
+    0
   }
 };
 
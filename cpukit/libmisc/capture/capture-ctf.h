@@ -0,0 +1,89 @@
+/**
+ * @file rtems/capture-ctf.h
+ *
+ * @brief Capture Engine Common Trace Format Exporter
+ *
+ * This is a streaming exporter of the capture records to the Common
+ * Trace Format (CTF) readable by Trace Compass or babeltrace.
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef __CAPTURE_CTF_H_
+#define __CAPTURE_CTF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <rtems/capture.h>
+
+/**
+ * @brief The size of the CTF packets in bytes.
+ */
+#define RTEMS_CAPTURE_CTF_PACKET_SIZE 4096
+
+/**
+ * rtems_capture_ctf_write_metadata
+ *
+ * This function writes the CTF metadata of the capture records to a file
+ * descriptor.  The metadata describes one stream per processor.  The
+ * clock frequency is 1GHz, so a user provided timestamp handler must
+ * return nanoseconds.
+ *
+ * @param[in] fd The file descriptor of a file or socket.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_IO_ERROR The write failed.
+ */
+rtems_status_code
+rtems_capture_ctf_write_metadata (int fd);
+
+/**
+ * rtems_capture_ctf_write_stream
+ *
+ * This function drains the records currently available in the capture
+ * buffer of a processor and writes them as CTF packets of the stream of
+ * this processor to a file descriptor.  The capture engine may be on, so
+ * call this function periodically to stream a trace of a running system.
+ * The records are encoded directly from the capture buffer.
+ *
+ * @param[in] fd The file descriptor of a file or socket.
+ * @param[in] cpu The processor of the stream.
+ * @param[out] exported The count of exported records, may be NULL.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_NO_MEMORY Not enough memory for the packet buffer.
+ * @retval RTEMS_RESOURCE_IN_USE Another reader is active on this processor.
+ * @retval RTEMS_IO_ERROR The write failed.
+ */
+rtems_status_code
+rtems_capture_ctf_write_stream (int fd, uint32_t cpu, uint32_t* exported);
+
+/**
+ * rtems_capture_ctf_export
+ *
+ * This function creates a CTF trace directory with the metadata file and
+ * a stream_<cpu> file for each processor and writes the records currently
+ * available in the capture buffers into it.
+ *
+ * @param[in] path The path of the trace directory.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_IO_ERROR The directory or a file could not be created or
+ * written.
+ */
+rtems_status_code
+rtems_capture_ctf_export (const char* path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
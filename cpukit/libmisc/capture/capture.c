@@ -56,9 +56,14 @@
 #define RTEMS_CAPTURE_RECORD_EVENTS  (0)
 #endif
 
+/*
+ * The records are written by the owning processor without a lock.  The lock
+ * serializes the readers.
+ */
 typedef struct {
   rtems_capture_buffer_t   records;
-  uint32_t                 count;
+  Atomic_Uint              count;
+  Atomic_Uint              lost;
   rtems_id                 reader;
   rtems_interrupt_lock     lock;
   uint32_t                 flags;
@@ -88,6 +93,7 @@ static rtems_capture_global_data capture_global = {
 
 #define capture_records_on_cpu( _cpu ) capture_per_cpu[ _cpu ].records
 #define capture_count_on_cpu( _cpu )   capture_per_cpu[ _cpu ].count
+#define capture_lost_on_cpu( _cpu )    capture_per_cpu[ _cpu ].lost
 #define capture_flags_on_cpu( _cpu )   capture_per_cpu[ _cpu ].flags
 #define capture_reader_on_cpu( _cpu )  capture_per_cpu[ _cpu ].reader
 #define capture_lock_on_cpu( _cpu )    capture_per_cpu[ _cpu ].lock
@@ -449,16 +455,19 @@ rtems_capture_record_open (rtems_tcb*                      tcb,
   uint8_t*                    ptr;
   rtems_capture_record_t*     capture_in;
 
-  rtems_interrupt_lock_interrupt_disable (&context->lock_context);
-  per_cpu = capture_per_cpu_get (rtems_get_current_processor ());
-  context->lock = &per_cpu->lock;
-  rtems_interrupt_lock_acquire_isr (&per_cpu->lock, &context->lock_context);
+  /*
+   * With interrupts disabled this processor is the only producer of its
+   * buffer until the record is closed.
+   */
+  rtems_interrupt_local_disable (context->level);
+  context->cpu = rtems_get_current_processor ();
+  per_cpu = capture_per_cpu_get (context->cpu);
 
   ptr = rtems_capture_buffer_allocate (&per_cpu->records, size);
   capture_in = (rtems_capture_record_t *) ptr;
   if ( capture_in )
   {
-    ++per_cpu->count;
+    _Atomic_Fetch_add_uint (&per_cpu->count, 1, ATOMIC_ORDER_RELAXED);
     capture_in->size    = size;
     capture_in->task_id = tcb->Object.id;
     capture_in->events  = (events |
@@ -473,14 +482,27 @@ rtems_capture_record_open (rtems_tcb*                      tcb,
     ptr = ptr + sizeof(*capture_in);
   }
   else
+  {
+    rtems_interrupt_lock_context lock_context;
+
+    _Atomic_Fetch_add_uint (&per_cpu->lost, 1, ATOMIC_ORDER_RELAXED);
+
+    /* The readers change the flags, so use the lock on this rare path */
+    rtems_interrupt_lock_acquire_isr (&per_cpu->lock, &lock_context);
     per_cpu->flags |= RTEMS_CAPTURE_OVERFLOW;
+    rtems_interrupt_lock_release_isr (&per_cpu->lock, &lock_context);
+  }
 
   return ptr;
 }
 
 void rtems_capture_record_close( void *rec, rtems_capture_record_context_t* context)
 {
-  rtems_interrupt_lock_release (context->lock, &context->lock_context);
+  rtems_capture_per_cpu_data* per_cpu;
+
+  per_cpu = capture_per_cpu_get (context->cpu);
+  rtems_capture_buffer_commit (&per_cpu->records);
+  rtems_interrupt_local_enable (context->level);
 }
 
 /*
@@ -585,6 +607,8 @@ rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp RTEMS_UNU
       break;
     }
 
+    _Atomic_Init_uint( &capture_count_on_cpu( i ), 0 );
+    _Atomic_Init_uint( &capture_lost_on_cpu( i ), 0 );
     rtems_interrupt_lock_initialize(
       &capture_lock_on_cpu( i ),
       "Capture Per-CPU"
@@ -740,7 +764,10 @@ rtems_status_code
 rtems_capture_flush (bool prime)
 {
   rtems_interrupt_lock_context lock_context_global;
+  rtems_interrupt_lock_context lock_context;
+  uint32_t                     cpu_count = rtems_get_processor_count();
   uint32_t                     cpu;
+  uint32_t                     reserved;
 
   rtems_interrupt_lock_acquire (&capture_lock_global, &lock_context_global);
 
@@ -750,27 +777,57 @@ rtems_capture_flush (bool prime)
     return RTEMS_UNSATISFIED;
   }
 
-  rtems_iterate_over_all_threads (rtems_capture_flush_tcb);
+  /*
+   * The producers are stopped.  A span reader owns the tail of a buffer, so
+   * flush either all buffers or none of them.  Take the reader role of each
+   * processor one at a time, so that no span reader can start until the
+   * flush is done.
+   */
+  for (reserved = 0; reserved < cpu_count; reserved++) {
+    RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( reserved )) )
+    bool active;
+
+    rtems_interrupt_lock_acquire (lock, &lock_context);
+    active = (capture_flags_on_cpu(reserved) & RTEMS_CAPTURE_READER_ACTIVE) != 0;
+    if (!active)
+      capture_flags_on_cpu(reserved) |= RTEMS_CAPTURE_READER_ACTIVE;
+    rtems_interrupt_lock_release (lock, &lock_context);
 
-  if (prime)
-    capture_flags_global &= ~(RTEMS_CAPTURE_TRIGGERED | RTEMS_CAPTURE_OVERFLOW);
-  else
-    capture_flags_global &= ~RTEMS_CAPTURE_OVERFLOW;
+    if (active)
+      break;
+  }
 
-  for (cpu=0; cpu < rtems_get_processor_count(); cpu++) {
+  if (reserved == cpu_count) {
+    rtems_iterate_over_all_threads (rtems_capture_flush_tcb);
+
+    if (prime)
+      capture_flags_global &= ~(RTEMS_CAPTURE_TRIGGERED | RTEMS_CAPTURE_OVERFLOW);
+    else
+      capture_flags_global &= ~RTEMS_CAPTURE_OVERFLOW;
+  }
+
+  for (cpu = 0; cpu < reserved; cpu++) {
     RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
-    rtems_interrupt_lock_context lock_context_per_cpu;
 
-    rtems_interrupt_lock_acquire (lock, &lock_context_per_cpu);
-    capture_count_on_cpu(cpu) = 0;
-    if (capture_records_on_cpu(cpu).buffer)
-      rtems_capture_buffer_flush( &capture_records_on_cpu(cpu) );
-    rtems_interrupt_lock_release (lock, &lock_context_per_cpu);
+    rtems_interrupt_lock_acquire (lock, &lock_context);
+
+    if (reserved == cpu_count) {
+      capture_flags_on_cpu(cpu) &= ~RTEMS_CAPTURE_OVERFLOW;
+      _Atomic_Store_uint (&capture_lost_on_cpu(cpu), 0, ATOMIC_ORDER_RELAXED);
+
+      if (capture_records_on_cpu(cpu).buffer) {
+        _Atomic_Store_uint (&capture_count_on_cpu(cpu), 0, ATOMIC_ORDER_RELAXED);
+        rtems_capture_buffer_discard( &capture_records_on_cpu(cpu) );
+      }
+    }
+
+    capture_flags_on_cpu(cpu) &= ~RTEMS_CAPTURE_READER_ACTIVE;
+    rtems_interrupt_lock_release (lock, &lock_context);
   }
 
   rtems_interrupt_lock_release (&capture_lock_global, &lock_context_global);
 
-  return RTEMS_SUCCESSFUL;
+  return reserved == cpu_count ? RTEMS_SUCCESSFUL : RTEMS_RESOURCE_IN_USE;
 }
 
 /*
@@ -1258,12 +1315,14 @@ rtems_capture_release (uint32_t cpu, uint32_t count)
   RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
   rtems_capture_buffer_t*      records = &(capture_records_on_cpu( cpu ));
   uint32_t*                    flags = &(capture_flags_on_cpu( cpu ));
-  uint32_t*                    total = &(capture_count_on_cpu( cpu ));
+  Atomic_Uint*                 total = &(capture_count_on_cpu( cpu ));
+  uint32_t                     available;
 
   rtems_interrupt_lock_acquire (lock, &lock_context);
 
-  if (count > *total) {
-    count = *total;
+  available = _Atomic_Load_uint (total, ATOMIC_ORDER_RELAXED);
+  if (count > available) {
+    count = available;
   }
 
   if ( (capture_flags_global & RTEMS_CAPTURE_ON) != 0 ) {
@@ -1289,7 +1348,7 @@ rtems_capture_release (uint32_t cpu, uint32_t count)
     rel_size = ptr_size;
   }
 
-  *total -= count;
+  _Atomic_Fetch_sub_uint (total, count, ATOMIC_ORDER_RELAXED);
 
   if (count) {
     rtems_capture_buffer_free( records, rel_size );
@@ -1302,6 +1361,78 @@ rtems_capture_release (uint32_t cpu, uint32_t count)
   return ret_val;
 }
 
+/*
+ * This function hands out the contiguous span of records at the tail of
+ * the buffer of a processor.  Other than rtems_capture_read the capture
+ * engine may be on, the producers are not blocked by the reader.
+ */
+rtems_status_code
+rtems_capture_read_span (uint32_t                     cpu,
+                         rtems_capture_record_span_t* span)
+{
+  rtems_interrupt_lock_context lock_context;
+  RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
+  rtems_capture_buffer_t*      records = &(capture_records_on_cpu( cpu ));
+  uint32_t*                    flags = &(capture_flags_on_cpu( cpu ));
+
+  span->records = NULL;
+  span->size = 0;
+  span->count = 0;
+
+  rtems_interrupt_lock_acquire (lock, &lock_context);
+
+  if (*flags & RTEMS_CAPTURE_READER_ACTIVE)
+  {
+    rtems_interrupt_lock_release (lock, &lock_context);
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  *flags |= RTEMS_CAPTURE_READER_ACTIVE;
+
+  rtems_interrupt_lock_release (lock, &lock_context);
+
+  /*
+   * The reader active flag makes this the only consumer, so the records can
+   * be counted without the lock.
+   */
+  span->records = rtems_capture_buffer_peek (records, &span->size);
+  span->count = rtems_capture_count_records (span->records, span->size);
+  span->lost = _Atomic_Load_uint (&capture_lost_on_cpu (cpu),
+                                  ATOMIC_ORDER_RELAXED);
+
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ * This function gives the records of a span back to the capture engine.
+ */
+rtems_status_code
+rtems_capture_release_span (uint32_t                           cpu,
+                            const rtems_capture_record_span_t* span)
+{
+  rtems_interrupt_lock_context lock_context;
+  RTEMS_INTERRUPT_LOCK_REFERENCE( lock, &(capture_lock_on_cpu( cpu )) )
+  rtems_capture_buffer_t*      records = &(capture_records_on_cpu( cpu ));
+  uint32_t*                    flags = &(capture_flags_on_cpu( cpu ));
+
+  if ((*flags & RTEMS_CAPTURE_READER_ACTIVE) == 0)
+    return RTEMS_INCORRECT_STATE;
+
+  if (span->size != 0)
+  {
+    rtems_capture_buffer_free (records, span->size);
+    _Atomic_Fetch_sub_uint (&capture_count_on_cpu (cpu),
+                            span->count,
+                            ATOMIC_ORDER_RELAXED);
+  }
+
+  rtems_interrupt_lock_acquire (lock, &lock_context);
+  *flags &= ~RTEMS_CAPTURE_READER_ACTIVE;
+  rtems_interrupt_lock_release (lock, &lock_context);
+
+  return RTEMS_SUCCESSFUL;
+}
+
 /*
  * This function returns the current time. If a handler is provided
  * by the user get the time from that.
@@ -305,13 +305,15 @@ rtems_capture_monitor (bool enable);
  * @brief Capture flush trace buffer.
  *
  * This function flushes the trace buffer. The prime parameter allows the
- * capture engine to also be primed again.
+ * capture engine to also be primed again.  The lost record counts and the
+ * overflow indication are reset.  Nothing is flushed while a span reader is
+ * active on any processor.
  *
  * @param[in]  prime The prime after flush flag.
  *
- * @retval This method returns RTEMS_SUCCESSFUL if there was not an
- *         error. Otherwise, a status code is returned indicating the
- *         source of the error.
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_UNSATISFIED The capture engine is on.
+ * @retval RTEMS_RESOURCE_IN_USE A span reader is active.
  */
 rtems_status_code
 rtems_capture_flush (bool prime);
@@ -561,6 +563,65 @@ rtems_capture_read (uint32_t                 cpu,
 rtems_status_code
 rtems_capture_release (uint32_t cpu, uint32_t count);
 
+/**
+ * @brief Capture record span.
+ *
+ * This is a contiguous block of records in the capture buffer
+ * of a processor handed out by rtems_capture_read_span.
+ */
+typedef struct rtems_capture_record_span_s
+{
+  rtems_capture_record_t* records;
+  size_t                  size;
+  uint32_t                count;
+  uint32_t                lost;
+} rtems_capture_record_span_t;
+
+/**
+ * @brief Capture read a span of records.
+ *
+ * This function hands out the contiguous block of records at the
+ * tail of the capture buffer of a processor without copying them.
+ * In contrast to rtems_capture_read the capture engine may be on.
+ * The producers record events without a lock, so a reader can
+ * drain the buffers while the system runs at full rate.  Iterate
+ * the records with the size member of each record.
+ *
+ * The user must release the span with rtems_capture_release_span
+ * before the next span of this processor can be read.  No span can
+ * be read while rtems_capture_flush is in progress.
+ *
+ * @param[in]  cpu The cpu number that the records were recorded on
+ * @param[out] span The span of records.  The size is zero if no
+ *             records are available.  The lost member contains the
+ *             count of records lost since the capture engine was
+ *             opened or last flushed due to a full buffer.
+ *
+ * @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code
+rtems_capture_read_span (uint32_t                     cpu,
+                         rtems_capture_record_span_t* span);
+
+/**
+ * @brief Capture release a span of records.
+ *
+ * This function releases the records of a span read by
+ * rtems_capture_read_span back to the capture engine.
+ *
+ * @param[in] cpu The cpu number of the span
+ * @param[in] span The span to release
+ *
+ * @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code
+rtems_capture_release_span (uint32_t                           cpu,
+                            const rtems_capture_record_span_t* span);
+
 /*
  * @brief Capture nano-second time period.
  *
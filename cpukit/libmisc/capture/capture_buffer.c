@@ -26,92 +26,146 @@
 #include <rtems/score/assert.h>
 #include "capture_buffer.h"
 
-void * rtems_capture_buffer_allocate( rtems_capture_buffer_t* buffer, size_t size )
+/*
+ * Returns the position of the first byte of the lap of the position.
+ */
+static inline uintptr_t
+rtems_capture_buffer_lap( const rtems_capture_buffer_t* buffer, uintptr_t pos )
 {
-  size_t  end;
-  void   *ptr;
+  return pos < buffer->size ? 0 : buffer->size;
+}
 
-  if ( rtems_capture_buffer_is_full( buffer ) )
-    return NULL;
+/*
+ * Returns the position advanced by the count of bytes.
+ */
+static inline uintptr_t
+rtems_capture_buffer_advance( const rtems_capture_buffer_t* buffer,
+                              uintptr_t                     pos,
+                              size_t                        count )
+{
+  pos += count;
 
-  if ( (buffer->count + size) > buffer->end )
-    return NULL;
+  if (pos >= 2 * buffer->size)
+    pos -= 2 * buffer->size;
+
+  return pos;
+}
+
+void * rtems_capture_buffer_allocate( rtems_capture_buffer_t* buffer, size_t size )
+{
+  uintptr_t head;
+  uintptr_t tail;
+  uintptr_t lap;
+  size_t    offset;
+  size_t    used;
+  size_t    need;
+
+  head = buffer->reserve;
+  tail = _Atomic_Load_uintptr( &buffer->tail, ATOMIC_ORDER_ACQUIRE );
+  lap = rtems_capture_buffer_lap( buffer, head );
+  offset = head - lap;
+
+  if (head >= tail)
+    used = head - tail;
+  else
+    used = head + 2 * buffer->size - tail;
 
   /*
-   *  Determine if the end of free space is marked with
-   *  the end of buffer space, or the head of allocated
-   *  space.
-   *
-   *  |...|head| freespace |tail| ...| end
-   *
-   *  tail|.....|head| freespace| end
+   *  Determine if the record fits into the rest of this lap or if it must
+   *  start at the begin of the next lap.
    *
+   *  lap|...|tail| records |head| freespace | size
    */
-  if (buffer->tail > buffer->head) {
-    end = buffer->tail;
-  } else {
-    end = buffer->end;
-  }
+  if ((offset + size) <= buffer->size)
+    need = size;
+  else
+    need = buffer->size - offset + size;
+
+  if ((used + need) > buffer->size)
+    return NULL;
 
   /*
-   *  Can we allocate it easily?
+   * The consumer reads the end only after it observed a head in the next
+   * lap.  The store of the head in rtems_capture_buffer_commit() orders
+   * the store of the end.
    */
-  if ((buffer->head + size) <= end) {
-    ptr = &buffer->buffer[ buffer->head ];
-    buffer->head += size;
-    buffer->count = buffer->count + size;
-    return ptr;
+  if ((offset + size) >= buffer->size) {
+    if ((offset + size) == buffer->size) {
+      _Atomic_Store_uintptr(
+        &buffer->end,
+        buffer->size,
+        ATOMIC_ORDER_RELAXED
+      );
+    } else {
+      _Atomic_Store_uintptr( &buffer->end, offset, ATOMIC_ORDER_RELAXED );
+      head = rtems_capture_buffer_advance( buffer, head, buffer->size - offset );
+      offset = 0;
+    }
   }
 
-  /*
-   * We have to consider wrapping around to the front of the buffer
-   */
+  buffer->reserve = rtems_capture_buffer_advance( buffer, head, size );
 
-  /* If there is not room at the end of the buffer         */
-  /* and we have we already wrapped then we can't allocate */
-  if ( end == buffer->tail )
-    return NULL;
+  return &buffer->buffer[ offset ];
+}
 
-  /* Is there no room at the front of the buffer */
-  if ( (buffer->tail  < size ))
-    return NULL;
+void *rtems_capture_buffer_peek( rtems_capture_buffer_t* buffer, size_t *size )
+{
+  uintptr_t head;
+  uintptr_t tail;
+  uintptr_t lap;
+  size_t    end;
+
+  head = _Atomic_Load_uintptr( &buffer->head, ATOMIC_ORDER_ACQUIRE );
+  tail = _Atomic_Load_uintptr( &buffer->tail, ATOMIC_ORDER_RELAXED );
+  lap = rtems_capture_buffer_lap( buffer, tail );
+
+  if (lap != rtems_capture_buffer_lap( buffer, head )) {
+    end = _Atomic_Load_uintptr( &buffer->end, ATOMIC_ORDER_RELAXED );
 
-  /* change the end pointer to the last used byte, so a read will wrap when out of data */
-  buffer->end = buffer->head;
+    if ((tail - lap) < end) {
+      *size = end - (tail - lap);
+      return &buffer->buffer[ tail - lap ];
+    }
+
+    /*
+     * All records of this lap are consumed, so skip the unused rest of the
+     * lap.
+     */
+    tail = rtems_capture_buffer_advance( buffer, lap, buffer->size );
+    _Atomic_Store_uintptr( &buffer->tail, tail, ATOMIC_ORDER_RELEASE );
+    lap = tail;
+  }
 
-  /* now return the buffer */
-  ptr = buffer->buffer;
-  buffer->head = size;
-  buffer->count = buffer->count + size;
+  *size = head - tail;
+
+  if (*size == 0)
+    return NULL;
 
-  return ptr;
+  return &buffer->buffer[ tail - lap ];
 }
 
 void *rtems_capture_buffer_free( rtems_capture_buffer_t* buffer, size_t size )
 {
     void   *ptr;
-    size_t  next;
     size_t  buff_size;
 
     if (size == 0)
       return NULL;
 
     ptr = rtems_capture_buffer_peek(buffer, &buff_size);
-    next = buffer->tail + size;
 
-   /* Check if we are freeing space past the end of the buffer */
-    _Assert( ! rtems_capture_buffer_is_empty( buffer ) );
-    _Assert( !((buffer->tail > buffer->head) && (next > buffer->end)) );
-    _Assert( !((buffer->tail < buffer->head) && (next > buffer->head)) );
-
-    buffer->count = buffer->count - size;
-
-    if (next == buffer->end) {
-      buffer->end = buffer->size;
-      buffer->tail = 0;
-    } else {
-      buffer->tail = next;
-    }
+   /* Check if we are freeing space past the end of the span */
+    _Assert( size <= buff_size );
+
+    _Atomic_Store_uintptr(
+      &buffer->tail,
+      rtems_capture_buffer_advance(
+        buffer,
+        _Atomic_Load_uintptr( &buffer->tail, ATOMIC_ORDER_RELAXED ),
+        size
+      ),
+      ATOMIC_ORDER_RELEASE
+    );
 
     return ptr;
 }
@@ -25,26 +25,43 @@
 
 #include <stdlib.h>
 
+#include <rtems/score/atomic.h>
 
 /**@{*/
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * The capture buffer is a single producer, single consumer ring of
+ * variable length records.  The producer is the processor owning the
+ * buffer with interrupts disabled, the consumer is the reader of the
+ * records.  Neither side needs a lock.
+ *
+ * The head and tail positions run through two laps of the buffer, so a
+ * position is in the range [0, 2 * size).  This distinguishes a full from
+ * an empty buffer.  A record which does not fit into the rest of a lap
+ * starts at the begin of the next lap.  In this case the producer stores
+ * the end of the valid data of the lap it leaves in end.
+ */
 typedef struct {
-  uint8_t *buffer;
-  size_t   size;
-  size_t   count;
-  size_t   head;
-  size_t   tail;
-  size_t   end;
+  uint8_t        *buffer;
+  size_t          size;
+  Atomic_Uintptr  head;
+  Atomic_Uintptr  tail;
+  Atomic_Uintptr  end;
+  uintptr_t       reserve;
 } rtems_capture_buffer_t;
 
+/*
+ * Must not be called while a producer or consumer uses the buffer.
+ */
 static inline void rtems_capture_buffer_flush(  rtems_capture_buffer_t* buffer )
 {
-  buffer->end = buffer->size;
-  buffer->head = buffer->tail =  0;
-  buffer->count = 0;
+  _Atomic_Init_uintptr( &buffer->head, 0 );
+  _Atomic_Init_uintptr( &buffer->tail, 0 );
+  _Atomic_Init_uintptr( &buffer->end, buffer->size );
+  buffer->reserve = 0;
 }
 
 static inline void rtems_capture_buffer_create( rtems_capture_buffer_t* buffer, size_t size )
@@ -61,41 +78,55 @@ static inline void rtems_capture_buffer_destroy( rtems_capture_buffer_t*  buffer
   buffer->buffer = NULL;
 }
 
+/*
+ * Consumer side: true if no bytes are in use.
+ */
 static inline bool rtems_capture_buffer_is_empty(  rtems_capture_buffer_t* buffer )
 {
-   return( buffer->count == 0 );
+  return _Atomic_Load_uintptr( &buffer->head, ATOMIC_ORDER_ACQUIRE ) ==
+    _Atomic_Load_uintptr( &buffer->tail, ATOMIC_ORDER_RELAXED );
 }
 
-static inline bool rtems_capture_buffer_is_full( rtems_capture_buffer_t* buffer )
+/*
+ * Consumer side: discards all records committed so far.
+ */
+static inline void rtems_capture_buffer_discard( rtems_capture_buffer_t* buffer )
 {
-   return (buffer->count == buffer->size);
+  _Atomic_Store_uintptr(
+    &buffer->tail,
+    _Atomic_Load_uintptr( &buffer->head, ATOMIC_ORDER_ACQUIRE ),
+    ATOMIC_ORDER_RELEASE
+  );
 }
 
-static inline bool rtems_capture_buffer_has_wrapped( rtems_capture_buffer_t* buffer )
+/*
+ * Producer side: publishes the record of the last successful allocation.
+ */
+static inline void rtems_capture_buffer_commit( rtems_capture_buffer_t* buffer )
 {
-  if ( buffer->tail > buffer->head)
-    return true;
-
-  return false;
+  _Atomic_Store_uintptr(
+    &buffer->head,
+    buffer->reserve,
+    ATOMIC_ORDER_RELEASE
+  );
 }
 
-static inline void *rtems_capture_buffer_peek(  rtems_capture_buffer_t* buffer, size_t *size )
-{
-  if (rtems_capture_buffer_is_empty(buffer)) {
-    *size = 0;
-    return NULL;
-  }
-
-  if ( buffer->tail > buffer->head)
-    *size = buffer->end - buffer->tail;
-  else
-    *size = buffer->head - buffer->tail;
-
-  return &buffer->buffer[ buffer->tail ];
-}
+/*
+ * Consumer side: returns the contiguous span of committed records at the
+ * tail.
+ */
+void *rtems_capture_buffer_peek( rtems_capture_buffer_t* buffer, size_t *size );
 
+/*
+ * Producer side: reserves space for a record.  The record is visible to the
+ * consumer after rtems_capture_buffer_commit().
+ */
 void *rtems_capture_buffer_allocate( rtems_capture_buffer_t* buffer, size_t size );
 
+/*
+ * Consumer side: frees the size bytes at the tail of the span returned by
+ * rtems_capture_buffer_peek().
+ */
 void *rtems_capture_buffer_free( rtems_capture_buffer_t* buffer, size_t size );
 
 #ifdef __cplusplus
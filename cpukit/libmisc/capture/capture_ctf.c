@@ -0,0 +1,445 @@
+/**
+ * @file
+ *
+ * @brief Capture Engine Common Trace Format Exporter
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/capture-ctf.h>
+
+#include "captureimpl.h"
+
+#define CAPTURE_CTF_MAGIC UINT32_C (0xc1fc1fc1)
+
+#define CAPTURE_CTF_TASK_RECORD 0
+
+#define CAPTURE_CTF_CAPTURE_RECORD 1
+
+/*
+ * The packet header and context:
+ *
+ * uint32_t magic, stream_id;
+ * uint64_t timestamp_begin, timestamp_end, content_size, packet_size;
+ * uint64_t events_discarded;
+ * uint32_t cpu_id;
+ */
+#define CAPTURE_CTF_PACKET_HEADER_SIZE (2 * 4 + 5 * 8 + 4)
+
+/*
+ * The event header: uint32_t id; uint64_t timestamp;
+ */
+#define CAPTURE_CTF_EVENT_HEADER_SIZE (4 + 8)
+
+#define CAPTURE_CTF_EVENT_MAXIMUM_SIZE (CAPTURE_CTF_EVENT_HEADER_SIZE + 6 * 4)
+
+typedef struct {
+  int       fd;
+  uint32_t  cpu;
+  uint32_t  lost;
+  uint64_t  begin;
+  uint64_t  end;
+  size_t    offset;
+  bool      failed;
+  uint8_t   packet[RTEMS_CAPTURE_CTF_PACKET_SIZE];
+} capture_ctf_stream;
+
+static bool
+capture_ctf_write_all (int fd, const void* data, size_t size)
+{
+  const uint8_t* in = data;
+
+  while (size > 0)
+  {
+    ssize_t n = write (fd, in, size);
+
+    if (n < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+
+    in += n;
+    size -= (size_t) n;
+  }
+
+  return true;
+}
+
+static bool
+capture_ctf_printf (int fd, const char* format, ...)
+{
+  char    buf[128];
+  va_list ap;
+  int     n;
+
+  va_start (ap, format);
+  n = vsnprintf (buf, sizeof (buf), format, ap);
+  va_end (ap);
+
+  if (n < 0 || (size_t) n >= sizeof (buf))
+    return false;
+
+  return capture_ctf_write_all (fd, buf, (size_t) n);
+}
+
+static bool
+capture_ctf_is_big_endian (void)
+{
+  const union {
+    uint32_t u32;
+    uint8_t  u8[4];
+  } probe = { UINT32_C (1) };
+
+  return probe.u8[0] == 0;
+}
+
+static const char capture_ctf_metadata_types[] =
+  "/* CTF 1.8 */\n"
+  "typealias integer { size = 32; align = 8; signed = false; } := uint32_t;\n"
+  "typealias integer { size = 64; align = 8; signed = false; } := uint64_t;\n"
+  "\n"
+  "clock {\n"
+  "    name = capture;\n"
+  "    freq = 1000000000;\n"
+  "};\n"
+  "\n"
+  "typealias integer {\n"
+  "    size = 64; align = 8; signed = false;\n"
+  "    map = clock.capture.value;\n"
+  "} := capture_time_t;\n"
+  "\n";
+
+static const char capture_ctf_metadata_streams[] =
+  "    packet.header := struct {\n"
+  "        uint32_t magic;\n"
+  "        uint32_t stream_id;\n"
+  "    };\n"
+  "};\n"
+  "\n"
+  "stream {\n"
+  "    id = 0;\n"
+  "    packet.context := struct {\n"
+  "        capture_time_t timestamp_begin;\n"
+  "        capture_time_t timestamp_end;\n"
+  "        uint64_t content_size;\n"
+  "        uint64_t packet_size;\n"
+  "        uint64_t events_discarded;\n"
+  "        uint32_t cpu_id;\n"
+  "    };\n"
+  "    event.header := struct {\n"
+  "        uint32_t id;\n"
+  "        capture_time_t timestamp;\n"
+  "    };\n"
+  "};\n"
+  "\n"
+  "event {\n"
+  "    name = \"TASK_RECORD\";\n"
+  "    id = 0;\n"
+  "    stream_id = 0;\n"
+  "    fields := struct {\n"
+  "        uint32_t taskid;\n"
+  "        uint32_t name;\n"
+  "        uint32_t real_priority;\n"
+  "        uint32_t current_priority;\n"
+  "        uint32_t start_priority;\n"
+  "        uint32_t stack_size;\n"
+  "    };\n"
+  "};\n"
+  "\n"
+  "event {\n"
+  "    name = \"CAPTURE_RECORD\";\n"
+  "    id = 1;\n"
+  "    stream_id = 0;\n"
+  "    fields := struct {\n"
+  "        uint32_t taskid;\n"
+  "        uint32_t real_priority;\n"
+  "        uint32_t current_priority;\n"
+  "        event_enum event_name;\n"
+  "    };\n"
+  "};\n";
+
+rtems_status_code
+rtems_capture_ctf_write_metadata (int fd)
+{
+  bool ok;
+  int  e;
+
+  ok = capture_ctf_write_all (fd,
+                              capture_ctf_metadata_types,
+                              sizeof (capture_ctf_metadata_types) - 1);
+  ok = ok && capture_ctf_printf (fd,
+                                 "typedef enum events_e : uint32_t {\n");
+
+  for (e = RTEMS_CAPTURE_EVENT_START; ok && e < RTEMS_CAPTURE_EVENT_END; e++)
+    ok = capture_ctf_printf (fd, "    \"%s\" = %d,\n",
+                             rtems_capture_event_text (e), e);
+
+  ok = ok && capture_ctf_printf (fd,
+                                 "} event_enum;\n"
+                                 "\n"
+                                 "trace {\n"
+                                 "    major = 1;\n"
+                                 "    minor = 8;\n"
+                                 "    byte_order = %s;\n",
+                                 capture_ctf_is_big_endian () ? "be" : "le");
+  ok = ok && capture_ctf_write_all (fd,
+                                    capture_ctf_metadata_streams,
+                                    sizeof (capture_ctf_metadata_streams) - 1);
+
+  return ok ? RTEMS_SUCCESSFUL : RTEMS_IO_ERROR;
+}
+
+static uint8_t*
+capture_ctf_put_32 (uint8_t* out, uint32_t value)
+{
+  memcpy (out, &value, sizeof (value));
+  return out + sizeof (value);
+}
+
+static uint8_t*
+capture_ctf_put_64 (uint8_t* out, uint64_t value)
+{
+  memcpy (out, &value, sizeof (value));
+  return out + sizeof (value);
+}
+
+static void
+capture_ctf_flush_packet (capture_ctf_stream* stream)
+{
+  uint8_t* out;
+  uint64_t bits;
+
+  if (stream->offset == 0)
+    return;
+
+  bits = (uint64_t) stream->offset * 8;
+
+  out = capture_ctf_put_32 (&stream->packet[0], CAPTURE_CTF_MAGIC);
+  out = capture_ctf_put_32 (out, 0);
+  out = capture_ctf_put_64 (out, stream->begin);
+  out = capture_ctf_put_64 (out, stream->end);
+  out = capture_ctf_put_64 (out, bits);
+  out = capture_ctf_put_64 (out, bits);
+  out = capture_ctf_put_64 (out, stream->lost);
+  capture_ctf_put_32 (out, stream->cpu);
+
+  if (!stream->failed &&
+      !capture_ctf_write_all (stream->fd, stream->packet, stream->offset))
+    stream->failed = true;
+
+  stream->offset = 0;
+}
+
+static uint8_t*
+capture_ctf_begin_event (capture_ctf_stream* stream,
+                         uint32_t            id,
+                         uint64_t            time)
+{
+  if (stream->offset + CAPTURE_CTF_EVENT_MAXIMUM_SIZE >
+      RTEMS_CAPTURE_CTF_PACKET_SIZE)
+    capture_ctf_flush_packet (stream);
+
+  if (stream->offset == 0)
+  {
+    stream->offset = CAPTURE_CTF_PACKET_HEADER_SIZE;
+    stream->begin = time;
+  }
+
+  stream->end = time;
+
+  return capture_ctf_put_64 (
+    capture_ctf_put_32 (&stream->packet[stream->offset], id),
+    time
+  );
+}
+
+static void
+capture_ctf_end_event (capture_ctf_stream* stream, uint8_t* out)
+{
+  stream->offset = (size_t) (out - &stream->packet[0]);
+}
+
+static void
+capture_ctf_add_record (capture_ctf_stream* stream, rtems_capture_record_t* rec)
+{
+  uint32_t real_priority;
+  uint32_t current_priority;
+  uint32_t events;
+  uint8_t* out;
+  int      e;
+
+  real_priority = (rec->events >> RTEMS_CAPTURE_REAL_PRIORITY_EVENT) & 0xff;
+  current_priority = (rec->events >> RTEMS_CAPTURE_CURR_PRIORITY_EVENT) & 0xff;
+  events = rec->events >> RTEMS_CAPTURE_EVENT_START;
+
+  if (events == 0)
+  {
+    rtems_capture_task_record_t* task_rec = (rtems_capture_task_record_t*) rec;
+
+    out = capture_ctf_begin_event (stream, CAPTURE_CTF_TASK_RECORD, rec->time);
+    out = capture_ctf_put_32 (out, rec->task_id);
+    out = capture_ctf_put_32 (out, task_rec->name);
+    out = capture_ctf_put_32 (out, real_priority);
+    out = capture_ctf_put_32 (out, current_priority);
+    out = capture_ctf_put_32 (out, task_rec->start_priority);
+    out = capture_ctf_put_32 (out, task_rec->stack_size);
+    capture_ctf_end_event (stream, out);
+    return;
+  }
+
+  for (e = RTEMS_CAPTURE_EVENT_START; e < RTEMS_CAPTURE_EVENT_END; e++)
+  {
+    if (events & 1)
+    {
+      out = capture_ctf_begin_event (stream,
+                                     CAPTURE_CTF_CAPTURE_RECORD,
+                                     rec->time);
+      out = capture_ctf_put_32 (out, rec->task_id);
+      out = capture_ctf_put_32 (out, real_priority);
+      out = capture_ctf_put_32 (out, current_priority);
+      out = capture_ctf_put_32 (out, (uint32_t) e);
+      capture_ctf_end_event (stream, out);
+    }
+    events >>= 1;
+  }
+}
+
+rtems_status_code
+rtems_capture_ctf_write_stream (int fd, uint32_t cpu, uint32_t* exported)
+{
+  capture_ctf_stream*         stream;
+  rtems_capture_record_span_t span;
+  rtems_status_code           sc;
+  uint32_t                    count;
+  int                         pass;
+
+  count = 0;
+
+  stream = malloc (sizeof (*stream));
+  if (stream == NULL)
+    return RTEMS_NO_MEMORY;
+
+  stream->fd = fd;
+  stream->cpu = cpu;
+  stream->lost = 0;
+  stream->offset = 0;
+  stream->failed = false;
+
+  /*
+   * The records of a wrapped buffer are in at most two spans.  Records
+   * produced in the meantime are exported by the next call, so a fast
+   * producer cannot keep us here.
+   */
+  for (pass = 0; pass < 2; pass++)
+  {
+    uint8_t* ptr;
+    uint32_t i;
+
+    sc = rtems_capture_read_span (cpu, &span);
+    if (sc != RTEMS_SUCCESSFUL)
+      break;
+
+    stream->lost = span.lost;
+    ptr = (uint8_t*) span.records;
+
+    for (i = 0; i < span.count; i++)
+    {
+      rtems_capture_record_t* rec = (rtems_capture_record_t*) ptr;
+
+      capture_ctf_add_record (stream, rec);
+      ptr += rec->size;
+    }
+
+    sc = rtems_capture_release_span (cpu, &span);
+    count += span.count;
+
+    if (sc != RTEMS_SUCCESSFUL || span.count == 0)
+      break;
+  }
+
+  capture_ctf_flush_packet (stream);
+
+  if (sc == RTEMS_SUCCESSFUL && stream->failed)
+    sc = RTEMS_IO_ERROR;
+
+  free (stream);
+
+  if (exported != NULL)
+    *exported = count;
+
+  return sc;
+}
+
+static int
+capture_ctf_open (const char* path, const char* name)
+{
+  char file[PATH_MAX];
+  int  n;
+
+  n = snprintf (file, sizeof (file), "%s/%s", path, name);
+  if (n < 0 || (size_t) n >= sizeof (file))
+    return -1;
+
+  return open (file, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU | S_IRWXG | S_IRWXO);
+}
+
+rtems_status_code
+rtems_capture_ctf_export (const char* path)
+{
+  rtems_status_code sc;
+  uint32_t          cpu;
+  int               fd;
+
+  if (mkdir (path, S_IRWXU | S_IRWXG | S_IRWXO) != 0 && errno != EEXIST)
+    return RTEMS_IO_ERROR;
+
+  fd = capture_ctf_open (path, "metadata");
+  if (fd < 0)
+    return RTEMS_IO_ERROR;
+
+  sc = rtems_capture_ctf_write_metadata (fd);
+  if (close (fd) != 0 && sc == RTEMS_SUCCESSFUL)
+    sc = RTEMS_IO_ERROR;
+
+  for (cpu = 0;
+       sc == RTEMS_SUCCESSFUL && cpu < rtems_get_processor_count ();
+       cpu++)
+  {
+    char name[sizeof ("stream_4294967295")];
+
+    snprintf (name, sizeof (name), "stream_%" PRIu32, cpu);
+
+    fd = capture_ctf_open (path, name);
+    if (fd < 0)
+      return RTEMS_IO_ERROR;
+
+    sc = rtems_capture_ctf_write_stream (fd, cpu, NULL);
+    if (close (fd) != 0 && sc == RTEMS_SUCCESSFUL)
+      sc = RTEMS_IO_ERROR;
+  }
+
+  return sc;
+}
@@ -233,16 +233,16 @@ static inline void *rtems_capture_append_to_record(void*  rec,
 void rtems_capture_get_time (rtems_capture_time_t* time);
 
 typedef struct {
-  rtems_interrupt_lock_context  lock_context;
-  rtems_interrupt_lock         *lock;
+  rtems_interrupt_level  level;
+  uint32_t               cpu;
 } rtems_capture_record_context_t;
 
 /**
  * @brief Capture record open.
  *
  * This function allocates a record and fills in the
- * header information.  It does a lock acquire
- * which will remain in effect until
+ * header information.  It disables interrupts on the
+ * current processor until
  * rtems_capture_record_close is called.  This method
  * should only be used by rtems_capture_begin_add_record.
  *
@@ -261,8 +261,8 @@ void* rtems_capture_record_open (rtems_tcb*                      task,
 /**
  * @brief Capture record close.
  *
- * This function closes writing to capure record and
- * releases the lock that was held on the record. This
+ * This function closes writing to capure record, makes
+ * it visible to the readers and enables interrupts. This
  * method should only be used by rtems_capture_end_add_record.
  *
  * @param[in] rec specifies the record
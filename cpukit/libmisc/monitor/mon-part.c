@@ -9,6 +9,7 @@
 #include <rtems.h>
 #include "monitor.h"
 #include <rtems/rtems/attrimpl.h>
+#include <rtems/rtems/partimpl.h>
 #include <stdio.h>
 #include <string.h>    /* memcpy() */
 
@@ -24,7 +25,9 @@ rtems_monitor_part_canonical(
     canonical_part->start_addr = rtems_part->starting_address;
     canonical_part->length = rtems_part->length;
     canonical_part->buf_size = rtems_part->buffer_size;
-    canonical_part->used_blocks = rtems_part->number_of_used_blocks;
+    canonical_part->used_blocks = _Partition_Get_used_blocks(
+      RTEMS_DECONST( Partition_Control *, rtems_part )
+    );
 }
 
 
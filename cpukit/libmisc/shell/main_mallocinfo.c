@@ -23,6 +23,44 @@
 
 #include "internal.h"
 
+static void rtems_shell_print_malloc_cache_stats( void )
+{
+  rtems_malloc_cache stats[ RTEMS_MALLOC_CACHE_CLASS_COUNT ];
+  size_t             i;
+
+  if ( !rtems_malloc_cache_get_statistics( stats ) ) {
+    return;
+  }
+
+  printf(
+    "Per-processor cache size class statistics:\n"
+    "        SIZE      CACHED        HITS      MISSES       FREES     FLUSHES"
+    "  HIT RATE\n"
+  );
+
+  for ( i = 0; i < RTEMS_MALLOC_CACHE_CLASS_COUNT; ++i ) {
+    const rtems_malloc_cache *s = &stats[ i ];
+    uint64_t                  total = (uint64_t) s->hits + s->misses;
+    uint32_t                  rate = 0;
+
+    if ( total != 0 ) {
+      rate = (uint32_t) ( ( 100 * (uint64_t) s->hits ) / total );
+    }
+
+    printf(
+      "%12zu%12" PRIu32 "%12" PRIu32 "%12" PRIu32 "%12" PRIu32
+        "%12" PRIu32 "%9" PRIu32 "%%\n",
+      (size_t) RTEMS_MALLOC_CACHE_MINIMUM_SIZE << i,
+      s->count,
+      s->hits,
+      s->misses,
+      s->frees,
+      s->flushes,
+      rate
+    );
+  }
+}
+
 static int rtems_shell_main_malloc_info(
   int   argc,
   char *argv[]
@@ -38,6 +76,7 @@ static int rtems_shell_main_malloc_info(
     rtems_shell_print_heap_info( "free", &info.Free );
     rtems_shell_print_heap_info( "used", &info.Used );
     rtems_shell_print_heap_stats( &info.Stats );
+    rtems_shell_print_malloc_cache_stats();
   }
 
   return 0;
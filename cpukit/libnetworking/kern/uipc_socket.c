@@ -840,6 +840,8 @@ sorflush(struct socket *so)
 	sbunlock(sb);
 	asb = *sb;
 	bzero((caddr_t)sb, sizeof (*sb));
+	/* the kernel event notes stay attached until the socket is closed */
+	sb->sb_sel.si_note = asb.sb_sel.si_note;
 	splx(s);
 	if (pr->pr_flags & PR_RIGHTS && pr->pr_domain->dom_dispose)
 		(*pr->pr_domain->dom_dispose)(asb.sb_mb);
@@ -1,5 +1,7 @@
 /*
- * Trivial File Transfer Protocol (RFC 1350)
+ * Trivial File Transfer Protocol (RFC 1350) with the option extension
+ * (RFC 2347), the block size (RFC 2348), the transfer size (RFC 2349) and
+ * the window size (RFC 7440) options
  *
  * Transfer file to/from remote host
  *
@@ -23,6 +25,7 @@
 #include <errno.h>
 #include <malloc.h>
 #include <string.h>
+#include <strings.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <rtems.h>
@@ -32,6 +35,7 @@
 #include <rtems/tftp.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/filio.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <netdb.h>
@@ -61,14 +65,63 @@ int rtems_tftp_driver_debug = 1;
 #define TFTP_OPCODE_DATA    3
 #define TFTP_OPCODE_ACK     4
 #define TFTP_OPCODE_ERROR   5
+#define TFTP_OPCODE_OACK    6
 
 /*
- * Largest data transfer
+ * TFTP error codes
+ */
+#define TFTP_ERROR_UNDEFINED    0
+#define TFTP_ERROR_ILLEGAL_OP   4
+#define TFTP_ERROR_UNKNOWN_TID  5
+#define TFTP_ERROR_OPTION       8
+
+/*
+ * Largest data transfer without the block size option
  */
 #define TFTP_BUFSIZE        512
 
 /*
- * Packets transferred between machines
+ * Option limits
+ */
+#define TFTP_BLOCKSIZE_MIN      8
+#define TFTP_BLOCKSIZE_MAX      65464
+#define TFTP_WINDOWSIZE_MIN     1
+#define TFTP_WINDOWSIZE_MAX     65535
+
+/*
+ * Default option values, the block size fills an Ethernet frame
+ */
+#define TFTP_DEFAULT_BLOCKSIZE  1456
+#define TFTP_DEFAULT_WINDOWSIZE 8
+
+/*
+ * Space in the request packet reserved for the options
+ */
+#define TFTP_OPTION_SPACE   64
+
+/*
+ * Size of a packet buffer for a block size
+ */
+#define TFTP_PACKET_SIZE(blocksize) \
+    (2 * sizeof (uint16_t) + \
+        ((blocksize) > TFTP_BUFSIZE ? (blocksize) : TFTP_BUFSIZE))
+
+/*
+ * Size of a DATA packet for a block size
+ */
+#define TFTP_DATA_PACKET_SIZE(blocksize) (2 * sizeof (uint16_t) + (blocksize))
+
+/*
+ * Distance of the DATA packets in the window.  It keeps the packet headers
+ * aligned for odd block sizes.
+ */
+#define TFTP_WINDOW_PACKET_SIZE(blocksize) \
+    ((TFTP_DATA_PACKET_SIZE (blocksize) + sizeof (uint16_t) - 1) \
+        & ~(sizeof (uint16_t) - 1))
+
+/*
+ * Packets transferred between machines.  Only the space required for the
+ * negotiated block size is allocated for a packet buffer.
  */
 union tftpPacket {
     /*
@@ -85,7 +138,7 @@ union tftpPacket {
     struct tftpDATA {
         uint16_t      opcode;
         uint16_t      blocknum;
-        uint8_t       data[TFTP_BUFSIZE];
+        uint8_t       data[TFTP_BLOCKSIZE_MAX];
     } tftpDATA;
 
     /*
@@ -104,6 +157,14 @@ union tftpPacket {
         uint16_t      errorCode;
         char                errorMessage[TFTP_BUFSIZE];
     } tftpERROR;
+
+    /*
+     * OACK packet
+     */
+    struct tftpOACK {
+        uint16_t      opcode;
+        char                options[TFTP_BUFSIZE];
+    } tftpOACK;
 };
 
 /*
@@ -113,7 +174,33 @@ struct tftpStream {
     /*
      * Buffer for storing most recently-received packet
      */
-    union tftpPacket    pkbuf;
+    union tftpPacket    *pkbuf;
+    int                 pkbufsize;
+
+    /*
+     * Negotiated options, the transfer size is -1 if unknown
+     */
+    int                 blocksize;
+    int                 windowsize;
+    off_t               tsize;
+
+    /*
+     * DATA packets of the current window (writing)
+     */
+    uint8_t             *window;
+    int                 wblocks;
+
+    /*
+     * Blocks received since the last acknowledgement and a flag to
+     * acknowledge out of order blocks only once (reading)
+     */
+    int                 nreceived;
+    int                 resync;
+
+    /*
+     * Data bytes passed to the application
+     */
+    off_t               position;
 
     /*
      * Last block number transferred
@@ -144,13 +231,16 @@ struct tftpStream {
 /*
  * Flags for filesystem info.
  */
-#define TFTPFS_VERBOSE (1 << 0)
+#define TFTPFS_VERBOSE    (1 << 0)
+#define TFTPFS_NO_OPTIONS (1 << 1)
 
 /*
  * TFTP File system info.
  */
 typedef struct tftpfs_info_s {
   uint32_t flags;
+  int blocksize;
+  int windowsize;
   rtems_id tftp_mutex;
   int nStreams;
   struct tftpStream ** volatile tftpStreams;
@@ -199,8 +289,37 @@ int rtems_tftpfs_initialize(
   root_path [devicelen + 1] = '\0';
 
   fs->flags = 0;
+  fs->blocksize = TFTP_DEFAULT_BLOCKSIZE;
+  fs->windowsize = TFTP_DEFAULT_WINDOWSIZE;
   fs->nStreams = 0;
   fs->tftpStreams = 0;
+
+  if (data) {
+      char* config = (char*) data;
+      char* token;
+      char* saveptr;
+      token = strtok_r (config, " ", &saveptr);
+      while (token) {
+          if (strcmp (token, "verbose") == 0)
+              fs->flags |= TFTPFS_VERBOSE;
+          else if (strcmp (token, "rfc1350") == 0)
+              fs->flags |= TFTPFS_NO_OPTIONS;
+          else if (strncmp (token, "blocksize=", 10) == 0)
+              fs->blocksize = atoi (token + 10);
+          else if (strncmp (token, "windowsize=", 11) == 0)
+              fs->windowsize = atoi (token + 11);
+          token = strtok_r (NULL, " ", &saveptr);
+      }
+  }
+
+  if (fs->blocksize < TFTP_BLOCKSIZE_MIN
+   || fs->blocksize > TFTP_BLOCKSIZE_MAX
+   || fs->windowsize < TFTP_WINDOWSIZE_MIN
+   || fs->windowsize > TFTP_WINDOWSIZE_MAX) {
+      free (fs);
+      free (root_path);
+      rtems_set_errno_and_return_minus_one (EINVAL);
+  }
   
   mt_entry->fs_info = fs;
   mt_entry->mt_fs_root->location.node_access = root_path;
@@ -226,18 +345,6 @@ int rtems_tftpfs_initialize(
   if (sc != RTEMS_SUCCESSFUL)
       goto error;
 
-  if (data) {
-      char* config = (char*) data;
-      char* token;
-      char* saveptr;
-      token = strtok_r (config, " ", &saveptr);
-      while (token) {
-          if (strcmp (token, "verbose") == 0)
-              fs->flags |= TFTPFS_VERBOSE;
-          token = strtok_r (NULL, " ", &saveptr);
-      }
-  }
-  
   return 0;
 
 error:
@@ -257,6 +364,10 @@ releaseStream (tftpfs_info_t *fs, int s)
     if (fs->tftpStreams[s] && (fs->tftpStreams[s]->socket >= 0))
         close (fs->tftpStreams[s]->socket);
     rtems_semaphore_obtain (fs->tftp_mutex, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    if (fs->tftpStreams[s]) {
+        free (fs->tftpStreams[s]->pkbuf);
+        free (fs->tftpStreams[s]->window);
+    }
     free (fs->tftpStreams[s]);
     fs->tftpStreams[s] = NULL;
     rtems_semaphore_release (fs->tftp_mutex);
@@ -292,7 +403,7 @@ tftpErrno (struct tftpStream *tp)
         ESRCH,
     };
 
-    tftpError = ntohs (tp->pkbuf.tftpERROR.errorCode);
+    tftpError = ntohs (tp->pkbuf->tftpERROR.errorCode);
     if (tftpError < (sizeof errorMap / sizeof errorMap[0]))
         return errorMap[tftpError];
     else
@@ -300,25 +411,27 @@ tftpErrno (struct tftpStream *tp)
 }
 
 /*
- * Send a message to make the other end shut up
+ * Send an error message
  */
 static void
-sendStifle (struct tftpStream *tp, struct sockaddr_in *to)
+sendError (struct tftpStream *tp, struct sockaddr_in *to, int errorCode,
+    const char *errorMessage)
 {
     int len;
     struct {
         uint16_t      opcode;
         uint16_t      errorCode;
-        char                errorMessage[12];
+        char                errorMessage[32];
     } msg;
 
     /*
-     * Create the error packet (Unknown transfer ID).
+     * Create the error packet
      */
     msg.opcode = htons (TFTP_OPCODE_ERROR);
-    msg.errorCode = htons (5);
+    msg.errorCode = htons (errorCode);
     len = sizeof msg.opcode + sizeof msg.errorCode + 1;
-    len += sprintf (msg.errorMessage, "GO AWAY");
+    len += snprintf (msg.errorMessage, sizeof msg.errorMessage, "%s",
+        errorMessage);
 
     /*
      * Send it
@@ -326,6 +439,15 @@ sendStifle (struct tftpStream *tp, struct sockaddr_in *to)
     sendto (tp->socket, (char *)&msg, len, 0, (struct sockaddr *)to, sizeof *to);
 }
 
+/*
+ * Send a message to make the other end shut up
+ */
+static void
+sendStifle (struct tftpStream *tp, struct sockaddr_in *to)
+{
+    sendError (tp, to, TFTP_ERROR_UNKNOWN_TID, "GO AWAY");
+}
+
 /*
  * Wait for a data packet
  */
@@ -350,8 +472,8 @@ getPacket (struct tftpStream *tp, int retryCount)
             struct sockaddr_in i;
         } from;
         socklen_t fromlen = sizeof from;
-        len = recvfrom (tp->socket, &tp->pkbuf,
-                        sizeof tp->pkbuf, 0,
+        len = recvfrom (tp->socket, tp->pkbuf,
+                        tp->pkbufsize, 0,
                         &from.s, &fromlen);
         if (len < 0)
             break;
@@ -375,19 +497,19 @@ getPacket (struct tftpStream *tp, int retryCount)
     setsockopt (tp->socket, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv);
 #ifdef RTEMS_TFTP_DRIVER_DEBUG
     if (rtems_tftp_driver_debug) {
-        if (len >= (int) sizeof tp->pkbuf.tftpACK) {
-            int opcode = ntohs (tp->pkbuf.tftpDATA.opcode);
+        if (len >= (int) sizeof tp->pkbuf->tftpACK) {
+            int opcode = ntohs (tp->pkbuf->tftpDATA.opcode);
             switch (opcode) {
             default:
                 printf ("TFTP: OPCODE %d\n", opcode);
                 break;
 
             case TFTP_OPCODE_DATA:
-                printf ("TFTP: RECV %d\n", ntohs (tp->pkbuf.tftpDATA.blocknum));
+                printf ("TFTP: RECV %d\n", ntohs (tp->pkbuf->tftpDATA.blocknum));
                 break;
 
             case TFTP_OPCODE_ACK:
-                printf ("TFTP: GOT ACK %d\n", ntohs (tp->pkbuf.tftpACK.blocknum));
+                printf ("TFTP: GOT ACK %d\n", ntohs (tp->pkbuf->tftpACK.blocknum));
                 break;
             }
         }
@@ -413,13 +535,13 @@ sendAck (struct tftpStream *tp)
     /*
      * Create the acknowledgement
      */
-    tp->pkbuf.tftpACK.opcode = htons (TFTP_OPCODE_ACK);
-    tp->pkbuf.tftpACK.blocknum = htons (tp->blocknum);
+    tp->pkbuf->tftpACK.opcode = htons (TFTP_OPCODE_ACK);
+    tp->pkbuf->tftpACK.blocknum = htons (tp->blocknum);
 
     /*
      * Send it
      */
-    if (sendto (tp->socket, (char *)&tp->pkbuf, sizeof tp->pkbuf.tftpACK, 0,
+    if (sendto (tp->socket, (char *)tp->pkbuf, sizeof tp->pkbuf->tftpACK, 0,
                                     (struct sockaddr *)&tp->farAddress,
                                     sizeof tp->farAddress) < 0)
         return errno;
@@ -517,6 +639,104 @@ static void rtems_tftp_eval_path(rtems_filesystem_eval_path_context_t *self)
     }
 }
 
+/*
+ * Append a string including the terminating NUL to a request
+ */
+static char *
+appendString (char *cp, const char *s)
+{
+    while ((*cp++ = *s++) != '\0')
+        continue;
+    return cp;
+}
+
+/*
+ * Create a read or write request with the options of the stream
+ */
+static int
+buildRequest (struct tftpStream *tp, const char *remoteFilename, int options)
+{
+    char *cp;
+    char value[8];
+
+    if (tp->writing)
+        tp->pkbuf->tftpRWRQ.opcode = htons (TFTP_OPCODE_WRQ);
+    else
+        tp->pkbuf->tftpRWRQ.opcode = htons (TFTP_OPCODE_RRQ);
+    cp = tp->pkbuf->tftpRWRQ.filename_mode;
+    cp = appendString (cp, remoteFilename);
+    cp = appendString (cp, "octet");
+    if (options) {
+        snprintf (value, sizeof value, "%d", tp->blocksize);
+        cp = appendString (cp, "blksize");
+        cp = appendString (cp, value);
+        snprintf (value, sizeof value, "%d", tp->windowsize);
+        cp = appendString (cp, "windowsize");
+        cp = appendString (cp, value);
+        if (!tp->writing) {
+            cp = appendString (cp, "tsize");
+            cp = appendString (cp, "0");
+        }
+    }
+    return cp - (char *)tp->pkbuf;
+}
+
+/*
+ * Accept the options of an option acknowledgement.  The server may only
+ * lower the requested block and window sizes.  The RFC 1350 block and
+ * window sizes apply for options missing in the acknowledgement.
+ */
+static int
+parseOptionAck (struct tftpStream *tp, int len)
+{
+    char *cp = tp->pkbuf->tftpOACK.options;
+    char *end = (char *)tp->pkbuf + len;
+    int blocksize = tp->blocksize;
+    int windowsize = tp->windowsize;
+
+    /*
+     * An option not acknowledged by the server is not in effect
+     */
+    tp->blocksize = TFTP_BUFSIZE;
+    tp->windowsize = 1;
+
+    while (cp < end) {
+        char *name = cp;
+        char *value;
+        char *ep;
+        unsigned long long v;
+
+        cp = memchr (cp, '\0', end - cp);
+        if (cp == NULL)
+            return EIO;
+        value = ++cp;
+        cp = memchr (cp, '\0', end - cp);
+        if (cp == NULL)
+            return EIO;
+        ++cp;
+        v = strtoull (value, &ep, 10);
+        if ((*value == '\0') || (*ep != '\0'))
+            return EIO;
+        if (strcasecmp (name, "blksize") == 0) {
+            if ((v < TFTP_BLOCKSIZE_MIN) || (v > (unsigned) blocksize))
+                return EIO;
+            tp->blocksize = (int) v;
+        }
+        else if (strcasecmp (name, "windowsize") == 0) {
+            if ((v < TFTP_WINDOWSIZE_MIN) || (v > (unsigned) windowsize))
+                return EIO;
+            tp->windowsize = (int) v;
+        }
+        else if ((strcasecmp (name, "tsize") == 0) && !tp->writing) {
+            tp->tsize = (off_t) v;
+        }
+        else {
+            return EIO;
+        }
+    }
+    return 0;
+}
+
 /*
  * The routine which does most of the work for the IMFS open handler
  */
@@ -533,11 +753,11 @@ static int rtems_tftp_open_worker(
     int                  s;
     int                  len;
     char                 *cp1;
-    char                 *cp2;
     char                 *remoteFilename;
     rtems_interval       now;
     rtems_status_code    sc;
     char                 *hostname;
+    int                  options;
 
     /*
      * Get the file system info.
@@ -579,6 +799,8 @@ static int rtems_tftp_open_worker(
     remoteFilename = cp1;
     if (strlen (remoteFilename) > (TFTP_BUFSIZE - 10))
         return ENOENT;
+    options = (fs->flags & TFTPFS_NO_OPTIONS) == 0
+        && strlen (remoteFilename) <= (TFTP_BUFSIZE - 10 - TFTP_OPTION_SPACE);
 
     /*
      * Find a free stream
@@ -604,12 +826,28 @@ static int rtems_tftp_open_worker(
         }
         fs->tftpStreams = np;
     }
-    tp = fs->tftpStreams[s] = malloc (sizeof (struct tftpStream));
+    tp = fs->tftpStreams[s] = calloc (1, sizeof (struct tftpStream));
     rtems_semaphore_release (fs->tftp_mutex);
     if (tp == NULL)
         return ENOMEM;
     iop->data0 = s;
     iop->data1 = tp;
+    tp->socket = -1;
+
+    /*
+     * Allocate the packet buffer, a write stream receives only
+     * acknowledgements
+     */
+    tp->writing = (oflag & O_ACCMODE) != O_RDONLY;
+    if (tp->writing || !options)
+        tp->pkbufsize = TFTP_PACKET_SIZE (TFTP_BUFSIZE);
+    else
+        tp->pkbufsize = TFTP_PACKET_SIZE (fs->blocksize);
+    tp->pkbuf = malloc (tp->pkbufsize);
+    if (tp->pkbuf == NULL) {
+        releaseStream (fs, s);
+        return ENOMEM;
+    }
 
     /*
      * Create the socket
@@ -655,27 +893,21 @@ static int rtems_tftp_open_worker(
         /*
          * Create the request
          */
-        if ((oflag & O_ACCMODE) == O_RDONLY) {
-            tp->writing = 0;
-            tp->pkbuf.tftpRWRQ.opcode = htons (TFTP_OPCODE_RRQ);
+        if (options) {
+            tp->blocksize = fs->blocksize;
+            tp->windowsize = fs->windowsize;
         }
         else {
-            tp->writing = 1;
-            tp->pkbuf.tftpRWRQ.opcode = htons (TFTP_OPCODE_WRQ);
+            tp->blocksize = TFTP_BUFSIZE;
+            tp->windowsize = 1;
         }
-        cp1 = (char *) tp->pkbuf.tftpRWRQ.filename_mode;
-        cp2 = (char *) remoteFilename;
-        while ((*cp1++ = *cp2++) != '\0')
-            continue;
-        cp2 = "octet";
-        while ((*cp1++ = *cp2++) != '\0')
-            continue;
-        len = cp1 - (char *)&tp->pkbuf.tftpRWRQ;
+        tp->tsize = -1;
+        len = buildRequest (tp, remoteFilename, options);
 
         /*
          * Send the request
          */
-        if (sendto (tp->socket, (char *)&tp->pkbuf, len, 0,
+        if (sendto (tp->socket, (char *)tp->pkbuf, len, 0,
                     (struct sockaddr *)&tp->farAddress,
                     sizeof tp->farAddress) < 0) {
             releaseStream (fs, s);
@@ -686,15 +918,45 @@ static int rtems_tftp_open_worker(
          * Get reply
          */
         len = getPacket (tp, retryCount);
-        if (len >= (int) sizeof tp->pkbuf.tftpACK) {
-            int opcode = ntohs (tp->pkbuf.tftpDATA.opcode);
+        if (len >= (int) sizeof tp->pkbuf->tftpACK) {
+            int opcode = ntohs (tp->pkbuf->tftpDATA.opcode);
+            if (options && (opcode == TFTP_OPCODE_OACK)) {
+                if (parseOptionAck (tp, len) != 0) {
+                    sendError (tp, &tp->farAddress, TFTP_ERROR_OPTION,
+                        "Bad option");
+                    releaseStream (fs, s);
+                    return EIO;
+                }
+                tp->nused = 0;
+                if (tp->writing) {
+                    tp->blocknum = 1;
+                }
+                else {
+                    /*
+                     * Acknowledge the options, the first DATA packet
+                     * follows
+                     */
+                    tp->blocknum = 0;
+                    tp->nleft = 0;
+                    if (sendAck (tp) != 0) {
+                        releaseStream (fs, s);
+                        return EIO;
+                    }
+                }
+                break;
+            }
             if (!tp->writing
              && (opcode == TFTP_OPCODE_DATA)
-             && (ntohs (tp->pkbuf.tftpDATA.blocknum) == 1)) {
+             && (ntohs (tp->pkbuf->tftpDATA.blocknum) == 1)) {
+                /*
+                 * The server ignored the options
+                 */
+                tp->blocksize = TFTP_BUFSIZE;
+                tp->windowsize = 1;
                 tp->nused = 0;
                 tp->blocknum = 1;
                 tp->nleft = len - 2 * sizeof (uint16_t  );
-                tp->eof = (tp->nleft < TFTP_BUFSIZE);
+                tp->eof = (tp->nleft < tp->blocksize);
                 if (sendAck (tp) != 0) {
                     releaseStream (fs, s);
                     return EIO;
@@ -703,13 +965,34 @@ static int rtems_tftp_open_worker(
             }
             if (tp->writing
              && (opcode == TFTP_OPCODE_ACK)
-             && (ntohs (tp->pkbuf.tftpACK.blocknum) == 0)) {
+             && (ntohs (tp->pkbuf->tftpACK.blocknum) == 0)) {
+                tp->blocksize = TFTP_BUFSIZE;
+                tp->windowsize = 1;
                 tp->nused = 0;
                 tp->blocknum = 1;
                 break;
             }
             if (opcode == TFTP_OPCODE_ERROR) {
-                int e = tftpErrno (tp);
+                int code = ntohs (tp->pkbuf->tftpERROR.errorCode);
+                int e;
+
+                /*
+                 * Some servers reject requests with options, so
+                 * retry in RFC 1350 mode.  The error ended the
+                 * transfer on the server side, so the request is sent
+                 * again from the same socket and port.
+                 */
+                if (options
+                 && ((code == TFTP_ERROR_UNDEFINED)
+                  || (code == TFTP_ERROR_ILLEGAL_OP)
+                  || (code == TFTP_ERROR_OPTION))) {
+                    options = 0;
+                    tp->firstReply = 1;
+                    tp->farAddress.sin_port = htons (69);
+                    retryCount = 0;
+                    continue;
+                }
+                e = tftpErrno (tp);
                 releaseStream (fs, s);
                 return e;
             }
@@ -723,6 +1006,20 @@ static int rtems_tftp_open_worker(
             return EIO;
         }
     }
+
+    /*
+     * Allocate the window of DATA packets
+     */
+    if (tp->writing) {
+        tp->window = malloc (tp->windowsize
+            * TFTP_WINDOW_PACKET_SIZE (tp->blocksize));
+        if (tp->window == NULL) {
+            sendError (tp, &tp->farAddress, TFTP_ERROR_UNDEFINED,
+                "No memory");
+            releaseStream (fs, s);
+            return ENOMEM;
+        }
+    }
     return 0;
 }
 
@@ -788,9 +1085,10 @@ static ssize_t rtems_tftp_read(
                 ncopy = nwant;
             else
                 ncopy = tp->nleft;
-            memcpy (bp, &tp->pkbuf.tftpDATA.data[tp->nused], ncopy);
+            memcpy (bp, &tp->pkbuf->tftpDATA.data[tp->nused], ncopy);
             tp->nused += ncopy;
             tp->nleft -= ncopy;
+            tp->position += ncopy;
             bp += ncopy;
             nwant -= ncopy;
             if (nwant == 0)
@@ -805,19 +1103,41 @@ static ssize_t rtems_tftp_read(
         retryCount = 0;
         for (;;) {
             int len = getPacket (tp, retryCount);
-            if (len >= (int)sizeof tp->pkbuf.tftpACK) {
-                int opcode = ntohs (tp->pkbuf.tftpDATA.opcode);
+            if (len >= (int)sizeof tp->pkbuf->tftpACK) {
+                int opcode = ntohs (tp->pkbuf->tftpDATA.opcode);
                 uint16_t   nextBlock = tp->blocknum + 1;
                 if ((opcode == TFTP_OPCODE_DATA)
-                 && (ntohs (tp->pkbuf.tftpDATA.blocknum) == nextBlock)) {
+                 && (ntohs (tp->pkbuf->tftpDATA.blocknum) == nextBlock)) {
                     tp->nused = 0;
                     tp->nleft = len - 2 * sizeof (uint16_t);
-                    tp->eof = (tp->nleft < TFTP_BUFSIZE);
+                    tp->eof = (tp->nleft < tp->blocksize);
                     tp->blocknum++;
-                    if (sendAck (tp) != 0)
-                        rtems_set_errno_and_return_minus_one (EIO);
+                    tp->resync = 0;
+
+                    /*
+                     * Acknowledge the last block of each window
+                     */
+                    if ((++tp->nreceived >= tp->windowsize) || tp->eof) {
+                        tp->nreceived = 0;
+                        if (sendAck (tp) != 0)
+                            rtems_set_errno_and_return_minus_one (EIO);
+                    }
                     break;
                 }
+                if ((opcode == TFTP_OPCODE_DATA) && (tp->windowsize > 1)) {
+                    /*
+                     * A block of the window was lost.  Acknowledge the
+                     * last block in order once, the server continues
+                     * with the following block.
+                     */
+                    if (!tp->resync) {
+                        tp->resync = 1;
+                        tp->nreceived = 0;
+                        if (sendAck (tp) != 0)
+                            rtems_set_errno_and_return_minus_one (EIO);
+                    }
+                    continue;
+                }
                 if (opcode == TFTP_OPCODE_ERROR)
                     rtems_set_errno_and_return_minus_one (tftpErrno (tp));
             }
@@ -827,6 +1147,8 @@ static ssize_t rtems_tftp_read(
              */
             if (++retryCount == IO_RETRY_LIMIT)
                 rtems_set_errno_and_return_minus_one (EIO);
+            tp->resync = 1;
+            tp->nreceived = 0;
             if (sendAck (tp) != 0)
                 rtems_set_errno_and_return_minus_one (EIO);
         }
@@ -835,49 +1157,113 @@ static ssize_t rtems_tftp_read(
 }
 
 /*
- * Flush a write buffer and wait for acknowledgement
+ * Get a DATA packet of the window
+ */
+static struct tftpDATA *
+windowPacket (struct tftpStream *tp, int i)
+{
+    return (struct tftpDATA *)
+        (tp->window + i * TFTP_WINDOW_PACKET_SIZE (tp->blocksize));
+}
+
+/*
+ * Send the window of full blocks and wait for an acknowledgement.  The
+ * last flush includes the partially filled block which ends the transfer
+ * and waits until all blocks are acknowledged.
  */
-static int rtems_tftp_flush (struct tftpStream *tp)
+static int rtems_tftp_flush (struct tftpStream *tp, int last)
 {
-    int wlen, rlen;
+    int count, rlen;
     int retryCount = 0;
 
-    wlen = tp->nused + 2 * sizeof (uint16_t  );
-    for (;;) {
-        tp->pkbuf.tftpDATA.opcode = htons (TFTP_OPCODE_DATA);
-        tp->pkbuf.tftpDATA.blocknum = htons (tp->blocknum);
+    count = tp->wblocks + (last ? 1 : 0);
+    while (count > 0) {
+        int i;
+
+        for (i = 0; i < count; i++) {
+            struct tftpDATA *dp = windowPacket (tp, i);
+            int nused = (last && (i == count - 1)) ? tp->nused : tp->blocksize;
+            int wlen = nused + 2 * sizeof (uint16_t  );
+
+            dp->opcode = htons (TFTP_OPCODE_DATA);
+            dp->blocknum = htons ((uint16_t) (tp->blocknum + i));
 #ifdef RTEMS_TFTP_DRIVER_DEBUG
-        if (rtems_tftp_driver_debug)
-            printf ("TFTP: SEND %d (%d)\n", tp->blocknum, tp->nused);
+            if (rtems_tftp_driver_debug)
+                printf ("TFTP: SEND %d (%d)\n", tp->blocknum + i, nused);
 #endif
-        if (sendto (tp->socket, (char *)&tp->pkbuf, wlen, 0,
+            if (sendto (tp->socket, (char *)dp, wlen, 0,
                                         (struct sockaddr *)&tp->farAddress,
                                         sizeof tp->farAddress) < 0)
-            return EIO;
-        rlen = getPacket (tp, retryCount);
-        /*
-         * Our last packet won't necessarily be acknowledged!
-         */
-        if ((rlen < 0) && (tp->nused < sizeof tp->pkbuf.tftpDATA.data))
-                return 0;
-        if (rlen >= (int)sizeof tp->pkbuf.tftpACK) {
-            int opcode = ntohs (tp->pkbuf.tftpACK.opcode);
-            if ((opcode == TFTP_OPCODE_ACK)
-             && (ntohs (tp->pkbuf.tftpACK.blocknum) == tp->blocknum)) {
-                tp->nused = 0;
-                tp->blocknum++;
+                return EIO;
+        }
+        for (;;) {
+            rlen = getPacket (tp, retryCount);
+            /*
+             * Our last packet won't necessarily be acknowledged!
+             */
+            if ((rlen < 0) && last && (count == 1))
                 return 0;
+            if (rlen >= (int)sizeof tp->pkbuf->tftpACK) {
+                int opcode = ntohs (tp->pkbuf->tftpACK.opcode);
+                if (opcode == TFTP_OPCODE_ACK) {
+                    uint16_t acked = ntohs (tp->pkbuf->tftpACK.blocknum)
+                        - tp->blocknum + 1;
+
+                    /*
+                     * Move the blocks not acknowledged to the window
+                     * start.  They are sent again together with the
+                     * blocks which refill the window, or right now at
+                     * the end of the transfer.
+                     */
+                    if ((acked >= 1) && (acked <= count)) {
+                        memmove (tp->window, windowPacket (tp, acked),
+                            (count - acked)
+                            * TFTP_WINDOW_PACKET_SIZE (tp->blocksize));
+                        tp->blocknum += acked;
+                        count -= acked;
+                        retryCount = 0;
+                        if (!last) {
+                            tp->wblocks = count;
+                            return 0;
+                        }
+                        break;
+                    }
+
+                    /*
+                     * In window mode, an acknowledgement of the block
+                     * before the window tells that the first block of
+                     * the window was lost (RFC 7440), so send the window
+                     * again right now
+                     */
+                    if ((acked == 0) && (tp->windowsize > 1)) {
+                        if (++retryCount == IO_RETRY_LIMIT)
+                            return EIO;
+                        break;
+                    }
+
+                    /*
+                     * Ignore duplicate acknowledgements to avoid the
+                     * Sorcerer's Apprentice Syndrome
+                     */
+                    if (++retryCount == IO_RETRY_LIMIT)
+                        return EIO;
+                    continue;
+                }
+                if (opcode == TFTP_OPCODE_ERROR)
+                    return tftpErrno (tp);
             }
-            if (opcode == TFTP_OPCODE_ERROR)
-                return tftpErrno (tp);
-        }
 
-        /*
-         * Keep trying?
-         */
-        if (++retryCount == IO_RETRY_LIMIT)
-            return EIO;
+            /*
+             * Keep trying?
+             */
+            if (++retryCount == IO_RETRY_LIMIT)
+                return EIO;
+            break;
+        }
     }
+    tp->wblocks = 0;
+    tp->nused = 0;
+    return 0;
 }
 
 /*
@@ -900,7 +1286,7 @@ static int rtems_tftp_close(
         rtems_set_errno_and_return_minus_one (EIO);
     
     if (tp->writing)
-        e = rtems_tftp_flush (tp);
+        e = rtems_tftp_flush (tp, 1);
     if (!tp->eof && !tp->firstReply) {
         /*
          * Tell the other end to stop
@@ -942,26 +1328,53 @@ static ssize_t rtems_tftp_write(
     bp = buffer;
     nleft = count;
     while (nleft) {
-        nfree = sizeof tp->pkbuf.tftpDATA.data - tp->nused;
+        struct tftpDATA *dp = windowPacket (tp, tp->wblocks);
+        nfree = tp->blocksize - tp->nused;
         if (nleft < nfree)
             ncopy = nleft;
         else
             ncopy = nfree;
-        memcpy (&tp->pkbuf.tftpDATA.data[tp->nused], bp, ncopy);
+        memcpy (&dp->data[tp->nused], bp, ncopy);
         tp->nused += ncopy;
+        tp->position += ncopy;
         nleft -= ncopy;
         bp += ncopy;
-        if (tp->nused == sizeof tp->pkbuf.tftpDATA.data) {
-            int e = rtems_tftp_flush (tp);
-            if (e) {
-                tp->writing = 0;
-                rtems_set_errno_and_return_minus_one (e);
+        if (tp->nused == tp->blocksize) {
+            tp->nused = 0;
+            if (++tp->wblocks == tp->windowsize) {
+                int e = rtems_tftp_flush (tp, 0);
+                if (e) {
+                    tp->writing = 0;
+                    rtems_set_errno_and_return_minus_one (e);
+                }
             }
         }
     }
     return count;
 }
 
+/*
+ * Report the bytes remaining in a read stream if the server sent the
+ * transfer size
+ */
+static int rtems_tftp_ioctl(
+    rtems_libio_t   *iop,
+    ioctl_command_t  command,
+    void            *buffer
+)
+{
+    struct tftpStream *tp = iop->data1;
+
+    if ((command != FIONREAD) || (tp == NULL) || tp->writing)
+        rtems_set_errno_and_return_minus_one (EINVAL);
+
+    if (tp->tsize >= 0)
+        *(int *) buffer = (int) (tp->tsize - tp->position);
+    else
+        *(int *) buffer = tp->nleft;
+    return 0;
+}
+
 /*
  * Dummy version to let fopen(xxxx,"w") work properly.
  */
@@ -1045,7 +1458,7 @@ static const rtems_filesystem_file_handlers_r rtems_tftp_handlers = {
    .close_h = rtems_tftp_close,
    .read_h = rtems_tftp_read,
    .write_h = rtems_tftp_write,
-   .ioctl_h = rtems_filesystem_default_ioctl,
+   .ioctl_h = rtems_tftp_ioctl,
    .lseek_h = rtems_filesystem_default_lseek,
    .fstat_h = rtems_tftp_fstat,
    .ftruncate_h = rtems_tftp_ftruncate,
@@ -1055,5 +1468,7 @@ static const rtems_filesystem_file_handlers_r rtems_tftp_handlers = {
    .kqfilter_h = rtems_filesystem_default_kqfilter,
    .poll_h = rtems_filesystem_default_poll,
    .readv_h = rtems_filesystem_default_readv,
-   .writev_h = rtems_filesystem_default_writev
+   .writev_h = rtems_filesystem_default_writev,
+   .mmap_h = rtems_filesystem_default_mmap,
+   .munmap_h = rtems_filesystem_default_munmap
 };
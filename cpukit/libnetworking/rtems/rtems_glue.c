@@ -503,6 +503,9 @@ sowakeup(
 	if (sb->sb_flags & SB_WAIT) {
 		rtems_event_system_send (sb->sb_sel.si_pid, SBWAIT_EVENT);
 	}
+	if (!SLIST_EMPTY(&sb->sb_sel.si_note)) {
+		soknote (sb);
+	}
 	if (sb->sb_wakeup) {
 		(*sb->sb_wakeup) (so, sb->sb_wakeuparg);
 	}
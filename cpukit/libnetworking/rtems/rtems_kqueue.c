@@ -0,0 +1,600 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <errno.h>
+
+#include <rtems.h>
+#include <rtems/libio_.h>
+#include <rtems/rtems_bsdnet.h>
+
+#include <sys/types.h>
+#include <sys/param.h>
+#include <sys/event.h>
+#include <sys/kernel.h>
+#include <sys/malloc.h>
+#include <sys/mbuf.h>
+#include <sys/socket.h>
+#include <sys/socketvar.h>
+#include <sys/protosw.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include "rtems_syscall.h"
+
+/*
+ *********************************************************************
+ *       RTEMS implementation of kqueue() and kevent() system calls   *
+ *********************************************************************
+ */
+
+/*
+ * In contrast to select() the interest in an event is registered once with
+ * kevent() and persists until it is deleted or the file descriptor is
+ * closed.  A knote is attached to the selinfo of the socket buffer.  The
+ * socket wakeup path evaluates the filters of the attached knotes and moves
+ * the active ones to the ready queue of their kqueue.  The kevent() call
+ * collects the ready queue and does not look at idle file descriptors.
+ *
+ * Restrictions:
+ *	Only EVFILT_READ and EVFILT_WRITE filters are supported.  File
+ *		descriptors plug in through their kqfilter handler.  This
+ *		is implemented for sockets only.
+ *	A given kqueue can be in a kevent() wait by only one task at a
+ *		time.
+ *
+ * All kqueue and knote state is protected by the network semaphore.
+ */
+
+struct kqueue {
+	TAILQ_HEAD(, knote) kq_head;	/* list of pending events */
+	int		kq_count;	/* number of pending events */
+	struct klist	*kq_knlist;	/* knotes indexed by descriptor */
+	int		kq_knlistsize;	/* size of knlist */
+	rtems_id	kq_tid;		/* task waiting in kevent() */
+};
+
+#define	KQ_EXTENT	16		/* grow knlist by this amount */
+
+static const rtems_filesystem_file_handlers_r kqueue_handlers;
+
+static void
+knote_enqueue(struct knote *kn)
+{
+	struct kqueue *kq = kn->kn_kq;
+
+	TAILQ_INSERT_TAIL(&kq->kq_head, kn, kn_tqe);
+	kn->kn_status |= KN_QUEUED;
+	kq->kq_count++;
+}
+
+static void
+knote_dequeue(struct knote *kn)
+{
+	struct kqueue *kq = kn->kn_kq;
+
+	TAILQ_REMOVE(&kq->kq_head, kn, kn_tqe);
+	kn->kn_status &= ~KN_QUEUED;
+	kq->kq_count--;
+}
+
+static void
+knote_activate(struct knote *kn)
+{
+	struct kqueue *kq = kn->kn_kq;
+
+	kn->kn_status |= KN_ACTIVE;
+	if ((kn->kn_status & (KN_QUEUED | KN_DISABLED)) == 0) {
+		knote_enqueue(kn);
+		if (kq->kq_tid != 0)
+			rtems_event_system_send(kq->kq_tid, SBWAIT_EVENT);
+	}
+}
+
+static void
+knote_drop(struct knote *kn)
+{
+	struct kqueue *kq = kn->kn_kq;
+
+	(*kn->kn_fop->f_detach)(kn);
+	if (kn->kn_status & KN_QUEUED)
+		knote_dequeue(kn);
+	SLIST_REMOVE(&kq->kq_knlist[kn->kn_id], kn, knote, kn_link);
+	FREE(kn, M_SELECT);
+}
+
+/*
+ * Socket filters
+ */
+static void
+filt_sordetach(struct knote *kn)
+{
+	struct socket *so = kn->kn_hook;
+
+	SLIST_REMOVE(&so->so_rcv.sb_sel.si_note, kn, knote, kn_selnext);
+}
+
+static int
+filt_soread(struct knote *kn, long hint)
+{
+	struct socket *so = kn->kn_hook;
+
+	kn->kn_data = so->so_rcv.sb_cc;
+	if (so->so_state & SS_CANTRCVMORE) {
+		kn->kn_flags |= EV_EOF;
+		kn->kn_fflags = so->so_error;
+		return (1);
+	}
+	if (so->so_error)
+		return (1);
+	if (kn->kn_sfflags & NOTE_LOWAT)
+		return (kn->kn_data >= kn->kn_sdata);
+	return (kn->kn_data >= so->so_rcv.sb_lowat);
+}
+
+static int
+filt_solisten(struct knote *kn, long hint)
+{
+	struct socket *so = kn->kn_hook;
+
+	kn->kn_data = so->so_qlen;
+	return (so->so_comp.tqh_first != NULL);
+}
+
+static void
+filt_sowdetach(struct knote *kn)
+{
+	struct socket *so = kn->kn_hook;
+
+	SLIST_REMOVE(&so->so_snd.sb_sel.si_note, kn, knote, kn_selnext);
+}
+
+static int
+filt_sowrite(struct knote *kn, long hint)
+{
+	struct socket *so = kn->kn_hook;
+
+	kn->kn_data = sbspace(&so->so_snd);
+	if (so->so_state & SS_CANTSENDMORE) {
+		kn->kn_flags |= EV_EOF;
+		kn->kn_fflags = so->so_error;
+		return (1);
+	}
+	if (so->so_error)
+		return (1);
+	if (((so->so_state & SS_ISCONNECTED) == 0) &&
+	    (so->so_proto->pr_flags & PR_CONNREQUIRED))
+		return (0);
+	if (kn->kn_sfflags & NOTE_LOWAT)
+		return (kn->kn_data >= kn->kn_sdata);
+	return (kn->kn_data >= so->so_snd.sb_lowat);
+}
+
+static struct filterops soread_filtops =
+	{ 1, NULL, filt_sordetach, filt_soread, NULL };
+static struct filterops solisten_filtops =
+	{ 1, NULL, filt_sordetach, filt_solisten, NULL };
+static struct filterops sowrite_filtops =
+	{ 1, NULL, filt_sowdetach, filt_sowrite, NULL };
+
+int
+sokqfilter(struct socket *so, struct knote *kn)
+{
+	struct sockbuf *sb;
+
+	switch (kn->kn_filter) {
+	case EVFILT_READ:
+		if (so->so_options & SO_ACCEPTCONN)
+			kn->kn_fop = &solisten_filtops;
+		else
+			kn->kn_fop = &soread_filtops;
+		sb = &so->so_rcv;
+		break;
+	case EVFILT_WRITE:
+		kn->kn_fop = &sowrite_filtops;
+		sb = &so->so_snd;
+		break;
+	default:
+		return (EINVAL);
+	}
+
+	kn->kn_hook = so;
+	SLIST_INSERT_HEAD(&sb->sb_sel.si_note, kn, kn_selnext);
+	return (0);
+}
+
+/*
+ * Called by sowakeup() for socket buffers with attached knotes.
+ */
+void
+soknote(struct sockbuf *sb)
+{
+	struct knote *kn;
+
+	SLIST_FOREACH(kn, &sb->sb_sel.si_note, kn_selnext) {
+		if ((*kn->kn_fop->f_event)(kn, 0))
+			knote_activate(kn);
+	}
+}
+
+/*
+ * Remove all knotes of a socket before it is closed.
+ */
+void
+soknote_close(struct socket *so)
+{
+	struct knote *kn;
+
+	while ((kn = SLIST_FIRST(&so->so_rcv.sb_sel.si_note)) != NULL)
+		knote_drop(kn);
+	while ((kn = SLIST_FIRST(&so->so_snd.sb_sel.si_note)) != NULL)
+		knote_drop(kn);
+}
+
+static struct kqueue *
+kqueue_fdToKqueue(int fd)
+{
+	rtems_libio_t *iop;
+
+	if ((uint32_t)fd >= rtems_libio_number_iops)
+		return NULL;
+	iop = &rtems_libio_iops[fd];
+	if ((iop->flags & LIBIO_FLAGS_OPEN) == 0 ||
+	    iop->pathinfo.handlers != &kqueue_handlers)
+		return NULL;
+	return iop->data1;
+}
+
+static int
+kqueue_expand(struct kqueue *kq, int fd)
+{
+	struct klist *list;
+	int size;
+
+	if (fd < kq->kq_knlistsize)
+		return (0);
+
+	size = kq->kq_knlistsize;
+	while (size <= fd)
+		size += KQ_EXTENT;
+	MALLOC(list, struct klist *, size * sizeof(*list), M_SELECT,
+	    M_NOWAIT);
+	if (list == NULL)
+		return (ENOMEM);
+	memcpy(list, kq->kq_knlist, kq->kq_knlistsize * sizeof(*list));
+	memset(&list[kq->kq_knlistsize], 0,
+	    (size - kq->kq_knlistsize) * sizeof(*list));
+	if (kq->kq_knlist != NULL)
+		FREE(kq->kq_knlist, M_SELECT);
+	kq->kq_knlist = list;
+	kq->kq_knlistsize = size;
+	return (0);
+}
+
+static int
+kqueue_register(struct kqueue *kq, const struct kevent *kev)
+{
+	rtems_libio_t *iop;
+	struct knote *kn = NULL;
+	int fd;
+	int error;
+
+	switch (kev->filter) {
+	case EVFILT_READ:
+	case EVFILT_WRITE:
+		break;
+	default:
+		return (EINVAL);
+	}
+
+	if (kev->ident >= rtems_libio_number_iops)
+		return (EBADF);
+	fd = (int) kev->ident;
+	iop = &rtems_libio_iops[fd];
+	if ((iop->flags & LIBIO_FLAGS_OPEN) == 0)
+		return (EBADF);
+
+	if (fd < kq->kq_knlistsize) {
+		SLIST_FOREACH(kn, &kq->kq_knlist[fd], kn_link) {
+			if (kn->kn_filter == kev->filter)
+				break;
+		}
+	}
+
+	if (kn == NULL) {
+		if ((kev->flags & EV_ADD) == 0)
+			return (ENOENT);
+
+		error = kqueue_expand(kq, fd);
+		if (error)
+			return (error);
+
+		MALLOC(kn, struct knote *, sizeof(*kn), M_SELECT, M_NOWAIT);
+		if (kn == NULL)
+			return (ENOMEM);
+		memset(kn, 0, sizeof(*kn));
+		kn->kn_kq = kq;
+		kn->kn_kevent = *kev;
+		kn->kn_kevent.flags &= ~(EV_ADD | EV_DELETE | EV_ENABLE |
+		    EV_DISABLE | EV_RECEIPT);
+		kn->kn_sfflags = kev->fflags;
+		kn->kn_sdata = kev->data;
+		kn->kn_fflags = 0;
+		kn->kn_data = 0;
+
+		error = (*iop->pathinfo.handlers->kqfilter_h)(iop, kn);
+		if (error) {
+			FREE(kn, M_SELECT);
+			return (error);
+		}
+		SLIST_INSERT_HEAD(&kq->kq_knlist[fd], kn, kn_link);
+	} else if (kev->flags & EV_ADD) {
+		kn->kn_sfflags = kev->fflags;
+		kn->kn_sdata = kev->data;
+		kn->kn_kevent.udata = kev->udata;
+	}
+
+	if (kev->flags & EV_DELETE) {
+		knote_drop(kn);
+		return (0);
+	}
+
+	if (kev->flags & EV_DISABLE) {
+		kn->kn_status |= KN_DISABLED;
+		if (kn->kn_status & KN_QUEUED)
+			knote_dequeue(kn);
+	}
+	if (kev->flags & EV_ENABLE)
+		kn->kn_status &= ~KN_DISABLED;
+
+	/*
+	 * Evaluate the filter now, since the event may already be pending.
+	 */
+	if ((kn->kn_status & KN_DISABLED) == 0 &&
+	    (*kn->kn_fop->f_event)(kn, 0))
+		knote_activate(kn);
+
+	return (0);
+}
+
+/*
+ * Collect the ready queue.  Each knote present at entry is looked at once
+ * to avoid an endless loop on the requeued level triggered events.
+ */
+static int
+kqueue_collect(struct kqueue *kq, struct kevent *kevp, int nevents)
+{
+	struct knote *kn;
+	int n = kq->kq_count;
+	int count = 0;
+
+	while (count < nevents && n-- > 0) {
+		kn = TAILQ_FIRST(&kq->kq_head);
+		knote_dequeue(kn);
+
+		if (kn->kn_flags & EV_ONESHOT) {
+			kevp[count++] = kn->kn_kevent;
+			knote_drop(kn);
+			continue;
+		}
+
+		if ((*kn->kn_fop->f_event)(kn, 0) == 0) {
+			kn->kn_status &= ~KN_ACTIVE;
+			continue;
+		}
+
+		kevp[count++] = kn->kn_kevent;
+
+		if (kn->kn_flags & (EV_CLEAR | EV_DISPATCH)) {
+			if (kn->kn_flags & EV_CLEAR) {
+				kn->kn_data = 0;
+				kn->kn_fflags = 0;
+			}
+			if (kn->kn_flags & EV_DISPATCH)
+				kn->kn_status |= KN_DISABLED;
+			kn->kn_status &= ~KN_ACTIVE;
+		} else {
+			knote_enqueue(kn);
+		}
+	}
+
+	return (count);
+}
+
+int
+kqueue (void)
+{
+	struct kqueue *kq;
+	rtems_libio_t *iop;
+	int fd;
+
+	rtems_bsdnet_semaphore_obtain ();
+	MALLOC(kq, struct kqueue *, sizeof(*kq), M_SELECT, M_NOWAIT);
+	rtems_bsdnet_semaphore_release ();
+	if (kq == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+	memset(kq, 0, sizeof(*kq));
+	TAILQ_INIT(&kq->kq_head);
+
+	iop = rtems_libio_allocate();
+	if (iop == NULL) {
+		rtems_bsdnet_semaphore_obtain ();
+		FREE(kq, M_SELECT);
+		rtems_bsdnet_semaphore_release ();
+		errno = ENFILE;
+		return -1;
+	}
+
+	fd = rtems_libio_iop_to_descriptor(iop);
+	iop->flags |= LIBIO_FLAGS_READ;
+	iop->data0 = fd;
+	iop->data1 = kq;
+	iop->pathinfo.handlers = &kqueue_handlers;
+	iop->pathinfo.mt_entry = &rtems_filesystem_null_mt_entry;
+	rtems_filesystem_location_add_to_mt_entry(&iop->pathinfo);
+	return fd;
+}
+
+int
+kevent (int fd, const struct kevent *changelist, int nchanges,
+    struct kevent *eventlist, int nevents, const struct timespec *timeout)
+{
+	struct kqueue *kq;
+	int error = 0;
+	int count = 0;
+	int i, timo;
+	rtems_interval then = 0, now;
+	rtems_event_set in = SBWAIT_EVENT | RTEMS_EVENT_SYSTEM_NETWORK_CLOSE;
+	rtems_event_set out;
+
+	if (nchanges < 0 || nevents < 0) {
+		errno = EINVAL;
+		return -1;
+	}
+	if (timeout) {
+		if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 ||
+		    timeout->tv_nsec >= 1000000000) {
+			errno = EINVAL;
+			return -1;
+		}
+		timo = timeout->tv_sec * hz + timeout->tv_nsec / (tick * 1000);
+		if (timo == 0 && timeout->tv_nsec != 0)
+			timo = 1;
+		then = rtems_clock_get_ticks_since_boot();
+	}
+	else {
+		timo = RTEMS_NO_TIMEOUT;
+	}
+
+	rtems_bsdnet_semaphore_obtain ();
+	if ((kq = kqueue_fdToKqueue (fd)) == NULL) {
+		rtems_bsdnet_semaphore_release ();
+		errno = EBADF;
+		return -1;
+	}
+	if (kq->kq_tid != 0) {
+		rtems_bsdnet_semaphore_release ();
+		errno = EBUSY;
+		return -1;
+	}
+
+	for (i = 0; i < nchanges; i++) {
+		error = kqueue_register(kq, &changelist[i]);
+		if (error || (changelist[i].flags & EV_RECEIPT)) {
+			if (count >= nevents)
+				break;
+			eventlist[count] = changelist[i];
+			eventlist[count].flags = EV_ERROR;
+			eventlist[count].data = error;
+			count++;
+			error = 0;
+		}
+	}
+	if (error || count > 0) {
+		rtems_bsdnet_semaphore_release ();
+		if (error) {
+			errno = error;
+			return -1;
+		}
+		return count;
+	}
+
+	rtems_event_system_receive (in, RTEMS_EVENT_ANY | RTEMS_NO_WAIT, RTEMS_NO_TIMEOUT, &out);
+	for (;;) {
+		count = kqueue_collect(kq, eventlist, nevents);
+		if (count > 0 || nevents == 0 || (timeout && timo <= 0))
+			break;
+		kq->kq_tid = rtems_task_self();
+		rtems_bsdnet_semaphore_release ();
+		rtems_event_system_receive (in, RTEMS_EVENT_ANY | RTEMS_WAIT, timo, &out);
+		rtems_bsdnet_semaphore_obtain ();
+		if (kqueue_fdToKqueue (fd) != kq) {
+			error = EBADF;
+			break;
+		}
+		kq->kq_tid = 0;
+		if (timeout) {
+			now = rtems_clock_get_ticks_since_boot();
+			timo -= now - then;
+			then = now;
+		}
+	}
+	rtems_bsdnet_semaphore_release ();
+
+	if (error) {
+		errno = error;
+		return -1;
+	}
+	return count;
+}
+
+/*
+ ************************************************************************
+ *                      RTEMS I/O HANDLER ROUTINES                      *
+ ************************************************************************
+ */
+static int
+rtems_bsdnet_kqueue_close (rtems_libio_t *iop)
+{
+	struct kqueue *kq;
+	struct knote *kn;
+	int i;
+
+	rtems_bsdnet_semaphore_obtain ();
+	if ((kq = iop->data1) == NULL) {
+		rtems_bsdnet_semaphore_release ();
+		errno = EBADF;
+		return -1;
+	}
+	iop->data1 = NULL;
+	for (i = 0; i < kq->kq_knlistsize; i++) {
+		while ((kn = SLIST_FIRST(&kq->kq_knlist[i])) != NULL)
+			knote_drop(kn);
+	}
+	if (kq->kq_tid != 0)
+		rtems_event_system_send(kq->kq_tid,
+		    RTEMS_EVENT_SYSTEM_NETWORK_CLOSE);
+	if (kq->kq_knlist != NULL)
+		FREE(kq->kq_knlist, M_SELECT);
+	FREE(kq, M_SELECT);
+	rtems_bsdnet_semaphore_release ();
+	return 0;
+}
+
+static int
+rtems_bsdnet_kqueue_fstat (const rtems_filesystem_location_info_t *loc, struct stat *sp)
+{
+	sp->st_mode = S_IFIFO;
+	return 0;
+}
+
+static const rtems_filesystem_file_handlers_r kqueue_handlers = {
+	.open_h = rtems_filesystem_default_open,
+	.close_h = rtems_bsdnet_kqueue_close,
+	.read_h = rtems_filesystem_default_read,
+	.write_h = rtems_filesystem_default_write,
+	.ioctl_h = rtems_filesystem_default_ioctl,
+	.lseek_h = rtems_filesystem_default_lseek,
+	.fstat_h = rtems_bsdnet_kqueue_fstat,
+	.ftruncate_h = rtems_filesystem_default_ftruncate,
+	.fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
+	.fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+	.fcntl_h = rtems_filesystem_default_fcntl,
+	.kqfilter_h = rtems_filesystem_default_kqfilter,
+	.poll_h = rtems_filesystem_default_poll,
+	.readv_h = rtems_filesystem_default_readv,
+	.writev_h = rtems_filesystem_default_writev,
+	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap
+};
@@ -12,10 +12,12 @@
 #include <rtems/libio_.h>
 #include <rtems/error.h>
 #include <rtems/rtems_bsdnet.h>
+#include <rtems/blkdev.h>
 
 #include <errno.h>
 #include <sys/types.h>
 #include <sys/param.h>
+#include <sys/malloc.h>
 #include <sys/mbuf.h>
 #include <sys/socket.h>
 #include <sys/socketvar.h>
@@ -24,6 +26,7 @@
 #include <sys/fcntl.h>
 #include <sys/filio.h>
 #include <sys/sysctl.h>
+#include <sys/stat.h>
 
 #include <net/if.h>
 #include <net/route.h>
@@ -424,6 +427,396 @@ sendto (int s, const void *buf, size_t buflen, int flags, const struct sockaddr
 	return sendmsg (s, &msg, flags);
 }
 
+/*
+ * Send header or trailer vectors of sendfile()
+ */
+static int
+sendfile_iovec (int s, struct iovec *iov, int iovcnt, off_t *sent)
+{
+	struct msghdr msg;
+	ssize_t len = 0;
+	ssize_t n;
+	int i;
+
+	if (iov == NULL || iovcnt <= 0)
+		return 0;
+	for (i = 0; i < iovcnt; i++)
+		len += iov[i].iov_len;
+	memset (&msg, 0, sizeof (msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = iovcnt;
+	n = sendmsg (s, &msg, 0);
+	if (n < 0)
+		return errno;
+	*sent += n;
+	if (n != len)
+		return EWOULDBLOCK;
+	return 0;
+}
+
+/*
+ * Read up to len bytes of the file at offset directly into a chain of
+ * mbuf clusters.  Must be called with the network semaphore held, which
+ * is released during the file system read.  Like pread(), the reads use
+ * an explicit offset: they go through a private copy of the descriptor,
+ * so the file offset of the descriptor is neither used nor changed.
+ */
+static int
+sendfile_fill (const rtems_libio_t *iop, off_t offset, int len, struct mbuf **mp)
+{
+	struct mbuf *top = NULL;
+	struct mbuf **tail = &top;
+	struct mbuf *m;
+	struct mbuf *rest = NULL;
+	rtems_libio_t fio;
+	int total = 0;
+	int error = 0;
+	int n;
+
+	*mp = NULL;
+	while (len > 0) {
+		if (top == NULL)
+			MGETHDR (m, M_WAIT, MT_DATA);
+		else
+			MGET (m, M_WAIT, MT_DATA);
+		if (m == NULL) {
+			m_freem (top);
+			return ENOBUFS;
+		}
+		MCLGET (m, M_WAIT);
+		if ((m->m_flags & M_EXT) == 0) {
+			m_free (m);
+			m_freem (top);
+			return ENOBUFS;
+		}
+		m->m_len = len < MCLBYTES ? len : MCLBYTES;
+		len -= m->m_len;
+		*tail = m;
+		tail = &m->m_next;
+	}
+
+	fio = *iop;
+	fio.offset = offset;
+	rtems_bsdnet_semaphore_release ();
+	for (m = top; m != NULL; m = m->m_next) {
+		n = (*fio.pathinfo.handlers->read_h) (&fio, mtod (m, void *), m->m_len);
+		if (n < 0) {
+			error = errno;
+			n = 0;
+		}
+		total += n;
+		if (n < m->m_len) {
+			m->m_len = n;
+			rest = m->m_next;
+			m->m_next = NULL;
+			break;
+		}
+	}
+	rtems_bsdnet_semaphore_obtain ();
+
+	if (rest != NULL)
+		m_freem (rest);
+	if (error != 0 || total == 0) {
+		m_freem (top);
+		return error;
+	}
+	top->m_pkthdr.len = total;
+	top->m_pkthdr.rcvif = NULL;
+	*mp = top;
+	return 0;
+}
+
+/*
+ * Block device buffer used as external mbuf storage by sendfile().  The
+ * buffer is released when the last mbuf which refers to it is freed.  The
+ * list is protected by the network semaphore.
+ */
+struct sendfile_block {
+	struct sendfile_block *next;
+	rtems_blkdev_buffer_read read;
+	u_int refs;
+};
+
+static struct sendfile_block *sendfile_blocks;
+
+static struct sendfile_block **
+sendfile_block_find (caddr_t buf)
+{
+	struct sendfile_block **bp;
+
+	for (bp = &sendfile_blocks; *bp != NULL; bp = &(*bp)->next) {
+		if ((caddr_t) (*bp)->read.bd->buffer == buf)
+			return bp;
+	}
+	rtems_panic ("sendfile: unknown block buffer\n");
+}
+
+static void
+sendfile_block_ref (caddr_t buf, u_int size)
+{
+	(*sendfile_block_find (buf))->refs++;
+}
+
+static void
+sendfile_block_free (caddr_t buf, u_int size)
+{
+	struct sendfile_block **bp = sendfile_block_find (buf);
+	struct sendfile_block *b = *bp;
+
+	if (--b->refs == 0) {
+		*bp = b->next;
+		(*b->read.release) (b->read.bd);
+		free (b, M_TEMP);
+	}
+}
+
+/*
+ * Attach len bytes of the block device at offset to a chain of mbufs.  The
+ * mbufs refer to the buffers of the block device buffer cache as external
+ * storage, so the data is not copied.  Must be called with the network
+ * semaphore held, which is released during each block read.
+ */
+static int
+sendfile_fill_disk (int fd, uint32_t block_size, off_t offset, int len,
+    struct mbuf **mp)
+{
+	struct mbuf *top = NULL;
+	struct mbuf **tail = &top;
+	struct mbuf *m;
+	struct sendfile_block *b;
+	rtems_blkdev_buffer_read read;
+	uint32_t begin;
+	int total = 0;
+	int error = 0;
+	int n;
+	int rv;
+
+	*mp = NULL;
+	while (len > 0) {
+		read.block = offset / block_size;
+		begin = offset % block_size;
+		n = block_size - begin;
+		if (n > len)
+			n = len;
+
+		rtems_bsdnet_semaphore_release ();
+		rv = rtems_disk_fd_read_buffer (fd, &read);
+		rtems_bsdnet_semaphore_obtain ();
+		if (rv != 0) {
+			error = errno;
+			break;
+		}
+
+		b = malloc (sizeof (*b), M_TEMP, M_WAITOK);
+		if (top == NULL)
+			MGETHDR (m, M_WAIT, MT_DATA);
+		else
+			MGET (m, M_WAIT, MT_DATA);
+		if (b == NULL || m == NULL) {
+			if (b != NULL)
+				free (b, M_TEMP);
+			if (m != NULL)
+				m_free (m);
+			(*read.release) (read.bd);
+			error = ENOBUFS;
+			break;
+		}
+		b->read = read;
+		b->refs = 1;
+		b->next = sendfile_blocks;
+		sendfile_blocks = b;
+
+		/*
+		 * The external storage ends with the data, so that nobody
+		 * appends to the cached block.
+		 */
+		m->m_flags |= M_EXT;
+		m->m_ext.ext_buf = (caddr_t) read.bd->buffer;
+		m->m_ext.ext_size = begin + n;
+		m->m_ext.ext_free = sendfile_block_free;
+		m->m_ext.ext_ref = sendfile_block_ref;
+		m->m_data = (caddr_t) read.bd->buffer + begin;
+		m->m_len = n;
+		*tail = m;
+		tail = &m->m_next;
+
+		total += n;
+		offset += n;
+		len -= n;
+	}
+
+	if (error != 0 || total == 0) {
+		m_freem (top);
+		return error;
+	}
+	top->m_pkthdr.len = total;
+	top->m_pkthdr.rcvif = NULL;
+	*mp = top;
+	return 0;
+}
+
+/*
+ * Send a regular file or a block device over a stream socket
+ *
+ * The file data is read directly into mbuf clusters which are handed to
+ * the protocol without a copy through a user buffer.  The data of a block
+ * device is not copied at all: the mbufs refer to the buffers of the block
+ * device buffer cache.  These buffers stay in use until the protocol frees
+ * the mbufs, for TCP this is when the data is acknowledged.  The network
+ * semaphore is acquired once per socket buffer sized chunk.
+ */
+int
+sendfile (int fd, int s, off_t offset, size_t nbytes, struct sf_hdtr *hdtr,
+    off_t *sbytes, int flags)
+{
+	rtems_libio_t *iop;
+	struct socket *so;
+	struct stat st;
+	struct mbuf *top;
+	uint32_t block_size = 0;
+	rtems_blkdev_bnum block_count;
+	off_t sent = 0;
+	off_t end;
+	long space;
+	int error = 0;
+	int len;
+
+	if (offset < 0) {
+		error = EINVAL;
+		goto out;
+	}
+	if ((uint32_t)fd >= rtems_libio_number_iops) {
+		error = EBADF;
+		goto out;
+	}
+	iop = &rtems_libio_iops[fd];
+	if ((iop->flags & (LIBIO_FLAGS_OPEN | LIBIO_FLAGS_READ))
+	    != (LIBIO_FLAGS_OPEN | LIBIO_FLAGS_READ)) {
+		error = EBADF;
+		goto out;
+	}
+	if (fstat (fd, &st) != 0) {
+		error = errno;
+		goto out;
+	}
+	if (S_ISBLK (st.st_mode)) {
+		if (rtems_disk_fd_get_block_size (fd, &block_size) != 0
+		    || rtems_disk_fd_get_block_count (fd, &block_count) != 0) {
+			error = errno;
+			goto out;
+		}
+		st.st_size = (off_t)block_size * block_count;
+	} else if (!S_ISREG (st.st_mode)) {
+		error = EINVAL;
+		goto out;
+	}
+
+	rtems_bsdnet_semaphore_obtain ();
+	if ((so = rtems_bsdnet_fdToSocket (s)) == NULL)
+		error = errno;
+	else if (so->so_type != SOCK_STREAM)
+		error = EINVAL;
+	rtems_bsdnet_semaphore_release ();
+	if (error)
+		goto out;
+
+	if (hdtr != NULL) {
+		error = sendfile_iovec (s, hdtr->headers, hdtr->hdr_cnt, &sent);
+		if (error)
+			goto out;
+	}
+
+	end = st.st_size;
+	if (nbytes != 0 && (off_t)nbytes < end - offset)
+		end = offset + (off_t)nbytes;
+
+	rtems_bsdnet_semaphore_obtain ();
+	while (offset < end) {
+		if ((so = rtems_bsdnet_fdToSocket (s)) == NULL) {
+			error = errno;
+			break;
+		}
+		if (so->so_state & SS_CANTSENDMORE) {
+			error = EPIPE;
+			break;
+		}
+		if (so->so_error) {
+			error = so->so_error;
+			so->so_error = 0;
+			break;
+		}
+		if ((so->so_state & SS_ISCONNECTED) == 0) {
+			error = ENOTCONN;
+			break;
+		}
+
+		/*
+		 * sosend() only checks a prepackaged mbuf chain against the
+		 * send buffer limit.  It waits for space only when it copies
+		 * from a uio, so a chain larger than the free space would
+		 * overfill the send buffer.  Wait for space here and read no
+		 * more than is free.
+		 */
+		space = sbspace (&so->so_snd);
+		if (space <= 0 ||
+		    (space < so->so_snd.sb_lowat && space < end - offset)) {
+			if (so->so_state & SS_NBIO) {
+				error = EWOULDBLOCK;
+				break;
+			}
+			error = sbwait (&so->so_snd);
+			if (error)
+				break;
+			continue;
+		}
+		if (end - offset < space)
+			len = end - offset;
+		else
+			len = space;
+
+		/*
+		 * A block which is only partially sent stays in use until
+		 * its data is acknowledged.  End the chunk at a block
+		 * boundary, so that the next chunk does not wait for it.
+		 */
+		if (block_size != 0 && len > block_size - offset % block_size)
+			len -= (offset + len) % block_size;
+
+		if (block_size != 0)
+			error = sendfile_fill_disk (fd, block_size, offset, len,
+			    &top);
+		else
+			error = sendfile_fill (iop, offset, len, &top);
+		if (error || top == NULL)
+			break;
+		len = top->m_pkthdr.len;
+
+		if ((so = rtems_bsdnet_fdToSocket (s)) == NULL) {
+			m_freem (top);
+			error = errno;
+			break;
+		}
+		error = sosend (so, NULL, NULL, top, NULL, 0);
+		if (error)
+			break;
+		offset += len;
+		sent += len;
+	}
+	rtems_bsdnet_semaphore_release ();
+
+	if (error == 0 && hdtr != NULL)
+		error = sendfile_iovec (s, hdtr->trailers, hdtr->trl_cnt, &sent);
+
+out:
+	if (sbytes != NULL)
+		*sbytes = sent;
+	if (error) {
+		errno = error;
+		return -1;
+	}
+	return 0;
+}
+
 /*
  * All `receive' operations end up calling this routine.
  */
@@ -713,6 +1106,7 @@ rtems_bsdnet_close (rtems_libio_t *iop)
 		return -1;
 	}
 	iop->data1 = NULL;
+	soknote_close (so);
 	error = soclose (so);
 	rtems_bsdnet_semaphore_release ();
 	if (error) {
@@ -802,6 +1196,17 @@ rtems_bsdnet_fcntl (rtems_libio_t *iop, int cmd)
         return 0;
 }
 
+static int
+rtems_bsdnet_kqfilter (rtems_libio_t *iop, struct knote *kn)
+{
+	struct socket *so;
+
+	/* called by kevent() with the network semaphore obtained */
+	if ((so = iop->data1) == NULL)
+		return EBADF;
+	return sokqfilter (so, kn);
+}
+
 static int
 rtems_bsdnet_fstat (const rtems_filesystem_location_info_t *loc, struct stat *sp)
 {
@@ -821,8 +1226,10 @@ static const rtems_filesystem_file_handlers_r socket_handlers = {
 	.fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
 	.fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
 	.fcntl_h = rtems_bsdnet_fcntl,
-	.kqfilter_h = rtems_filesystem_default_kqfilter,
+	.kqfilter_h = rtems_bsdnet_kqfilter,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
-	.writev_h = rtems_filesystem_default_writev
+	.writev_h = rtems_filesystem_default_writev,
+	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap
 };
@@ -21,10 +21,16 @@
 #include <sys/socket.h>
 #include <sys/time.h>
 
+struct kevent;
+
 __BEGIN_DECLS
 
 int	select(int, fd_set *, fd_set *, fd_set *, struct timeval *);
 
+int	kqueue(void);
+
+int	kevent(int, const struct kevent *, int, struct kevent *, int, const struct timespec *);
+
 int	accept(int, struct sockaddr * __restrict, socklen_t * __restrict);
 
 int	bind(int, const struct sockaddr *, socklen_t);
@@ -51,6 +57,8 @@ ssize_t	sendto(int, const void *, size_t, int, const struct sockaddr *, socklen_
 
 ssize_t	sendmsg(int, const struct msghdr *, int);
 
+int	sendfile(int, int, off_t, size_t, struct sf_hdtr *, off_t *, int);
+
 int	setsockopt(int, int, int, const void *, socklen_t);
 
 int	shutdown(int, int);
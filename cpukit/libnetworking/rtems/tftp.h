@@ -18,6 +18,21 @@
  *
  * The 'TFTP' is the mount path and the `hostname' must be four dot-separated
  * decimal values.
+ *
+ * The mount data is a string of space-separated options:
+ *
+ *   verbose        - print the path of each opened file
+ *   blocksize=N    - request a block size of N bytes (RFC 2348), the
+ *                    default is 1456
+ *   windowsize=N   - request a window of N blocks (RFC 7440), the
+ *                    default is 8
+ *   rfc1350        - do not request options, use 512 byte blocks and
+ *                    acknowledge each block
+ *
+ * The server may lower the requested sizes.  If it ignores the options or
+ * rejects the request with an error, then the transfer falls back to
+ * RFC 1350.  For read streams the transfer size is requested (RFC 2349)
+ * and the remaining bytes are available through the FIONREAD ioctl().
  */
 
 #ifndef _RTEMS_TFTP_H
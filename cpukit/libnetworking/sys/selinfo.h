@@ -33,6 +33,7 @@
 #define	_SYS_SELINFO_H_
 
 #include <sys/types.h> /* pid_t */
+#include <sys/queue.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,9 +43,11 @@ extern "C" {
  * Used to maintain information about processes that wish to be
  * notified when I/O becomes possible.
  */
+struct knote;
 struct selinfo {
 	pid_t	si_pid;		/* process to be notified */
 	short	si_flags;	/* see below */
+	SLIST_HEAD(, knote) si_note;	/* kernel event notes */
 };
 #define	SI_COLL	0x0001		/* collision occurred */
 
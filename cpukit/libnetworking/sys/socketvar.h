@@ -265,6 +265,9 @@ int	sosetopt(struct socket *so, int level, int optname,
 	    struct mbuf *m0);
 int	soshutdown(struct socket *so, int how);
 void	sowakeup(struct socket *so, struct sockbuf *sb);
+int	sokqfilter(struct socket *so, struct knote *kn);
+void	soknote(struct sockbuf *sb);
+void	soknote_close(struct socket *so);
 #endif /* _KERNEL */
 
 #endif /* !_SYS_SOCKETVAR_H_ */
@@ -2956,6 +2956,21 @@ static void send_file_data(struct mg_connection *conn, struct file *filep,
     }
     mg_write(conn, filep->membuf + offset, (size_t) len);
   } else if (len > 0 && filep->fp != NULL) {
+#if defined(__rtems__)
+    // Plain connections without throttling let the stack read the file
+    if (conn->ssl == NULL && conn->throttle <= 0) {
+      off_t sent = 0;
+      int rv = sendfile(fileno(filep->fp), conn->client.sock, offset,
+                        (size_t) len, NULL, &sent, 0);
+
+      conn->num_bytes_sent += sent;
+      offset += sent;
+      len -= sent;
+      if (rv == 0) {
+        return;
+      }
+    }
+#endif // __rtems__
     fseeko(filep->fp, offset, SEEK_SET);
     while (len > 0) {
       // Calculate how much to read from the file in the buffer
@@ -31,6 +31,18 @@ extern "C"
 {
 #endif
 
+  /* Completion of a list of requests submitted by lio_listio() */
+  typedef struct
+  {
+    pthread_mutex_t mutex;
+    pthread_cond_t done;        /* signalled if the last request completed */
+    int pending;                /* the number of requests not yet completed */
+    int errors;                 /* the number of failed requests */
+    int notify;                 /* if set, then send the signal and free the
+                                   list after the last completion (LIO_NOWAIT) */
+    struct sigevent sig;        /* notification of a LIO_NOWAIT list */
+  } rtems_aio_list;
+
   /* Actual request being processed */
   typedef struct
   {
@@ -40,6 +52,7 @@ extern "C"
     int priority;               /* see above */
     pthread_t caller_thread;    /* used for notification */
     struct aiocb *aiocbp;       /* aio control block */
+    rtems_aio_list *list;       /* list of lio_listio() or NULL */
   } rtems_aio_request;
 
   typedef struct
@@ -48,23 +61,34 @@ extern "C"
     rtems_chain_control perfd;  /* chain of requests for this fd */
     int fildes;                 /* file descriptor to be processed */
     int new_fd;                 /* if this is a newly created chain */
-    pthread_mutex_t mutex;      
-    pthread_cond_t cond;
-
   } rtems_aio_request_chain;
 
+  /*
+   * Work queue of a fixed set of worker threads.  All requests for a file
+   * descriptor are submitted to the same work queue, so they are processed
+   * in order by one worker at a time.  A worker owns an fd chain while it is
+   * on the work_req chain.
+   */
   typedef struct
   {
-    pthread_mutex_t mutex;
-    pthread_cond_t new_req;
-    pthread_attr_t attr;
+    pthread_mutex_t mutex;        /* protects all members of the work queue */
+    pthread_cond_t new_req;       /* signalled for new fd chains on idle_req */
 
     rtems_chain_control work_req; /* chains being worked by active threads */
     rtems_chain_control idle_req; /* fd chains waiting to be processed */
-    unsigned int initialized;     /* specific value if queue is initialized */
     int active_threads;           /* the number of active threads */
     int idle_threads;             /* number of idle threads */
+    int threads;                  /* the number of created worker threads */
+  } rtems_aio_work_queue;
+
+  typedef struct
+  {
+    pthread_attr_t attr;
 
+    rtems_aio_work_queue *queues; /* one work queue per processor */
+    uint32_t queue_count;         /* the number of work queues */
+    int threads_per_queue;        /* the worker thread limit of each queue */
+    unsigned int initialized;     /* specific value if queue is initialized */
   } rtems_aio_queue;
 
 extern rtems_aio_queue aio_request_queue;
@@ -79,8 +103,25 @@ extern rtems_aio_queue aio_request_queue;
 #define AIO_MAX_QUEUE_SIZE 30
 #endif
 
+/* Maximum count of adjacent reads or writes merged into one transfer */
+#ifndef AIO_MAX_MERGE
+#define AIO_MAX_MERGE 16
+#endif
+
+#ifndef AIO_LISTIO_MAX
+#define AIO_LISTIO_MAX 64
+#endif
+
+static inline rtems_aio_work_queue *rtems_aio_get_queue (int fildes)
+{
+  return &aio_request_queue.queues[
+    (uint32_t) fildes % aio_request_queue.queue_count
+  ];
+}
+
 int rtems_aio_init (void);
 int rtems_aio_enqueue (rtems_aio_request *req);
+int rtems_aio_enqueue_list (rtems_aio_request **reqs, int count);
 rtems_aio_request_chain *rtems_aio_search_fd 
 (
   rtems_chain_control *chain,
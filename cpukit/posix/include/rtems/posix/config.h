@@ -116,6 +116,12 @@ typedef struct {
    */
   uint32_t                            maximum_spinlocks;
 
+  /**
+   * This field contains the maximum number of POSIX API
+   * shared memory objects which are configured for this application.
+   */
+  uint32_t                            maximum_shms;
+
   /**
    * This field contains the number of POSIX API Initialization
    * threads listed in @a User_initialization_thread_table.
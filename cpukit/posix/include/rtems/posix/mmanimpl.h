@@ -0,0 +1,112 @@
+/**
+ * @file
+ *
+ * @brief Private Support for Memory Mappings
+ *
+ * This include file contains the internal support for mmap(), munmap() and
+ * msync().
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_POSIX_MMANIMPL_H
+#define _RTEMS_POSIX_MMANIMPL_H
+
+#include <rtems/libio_.h>
+#include <rtems/posix/shm.h>
+#include <rtems/score/chainimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup POSIXMmanPrivate POSIX Memory Mapping Private Support
+ *
+ * @ingroup POSIXAPI
+ *
+ * There is no memory management unit support, so a mapping is either
+ * private memory with a copy of the data or the memory which backs the
+ * shared memory object or file.
+ */
+/**@{*/
+
+typedef struct {
+  Chain_Node Node;
+
+  /**
+   * @brief The start address of the mapping.
+   */
+  void *addr;
+
+  /**
+   * @brief The length of the mapping in bytes.
+   */
+  size_t len;
+
+  /**
+   * @brief The mmap() flags of the mapping.
+   */
+  int flags;
+
+  /**
+   * @brief The shared memory object of a shared mapping, otherwise NULL.
+   */
+  POSIX_Shm_Control *shm;
+
+  /**
+   * @brief Indicates if the location refers to the file of a shared
+   * mapping.
+   *
+   * The location keeps the file node alive until the mapping is removed.
+   */
+  bool has_location;
+
+  rtems_filesystem_location_info_t location;
+} POSIX_Mmap_Mapping;
+
+/**
+ * @brief The list of active mappings.
+ *
+ * It is protected by the libio lock.
+ */
+extern Chain_Control _POSIX_Mmap_Mappings;
+
+/**
+ * @brief Returns the mapping which contains the address or NULL.
+ *
+ * The caller must own the libio lock.
+ */
+RTEMS_INLINE_ROUTINE POSIX_Mmap_Mapping *_POSIX_Mmap_Find( const void *addr )
+{
+  Chain_Node *node = _Chain_First( &_POSIX_Mmap_Mappings );
+  const Chain_Node *tail = _Chain_Immutable_tail( &_POSIX_Mmap_Mappings );
+
+  while ( node != tail ) {
+    POSIX_Mmap_Mapping *mapping = (POSIX_Mmap_Mapping *) node;
+    uintptr_t begin = (uintptr_t) mapping->addr;
+
+    if ( (uintptr_t) addr - begin < mapping->len ) {
+      return mapping;
+    }
+
+    node = _Chain_Next( node );
+  }
+
+  return NULL;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*  end of include file */
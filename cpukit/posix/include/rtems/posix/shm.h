@@ -0,0 +1,98 @@
+/**
+ * @file
+ *
+ * @brief Constants and Structures Associated with the POSIX Shared Memory
+ * Objects
+ *
+ * This include file contains all the constants and structures associated
+ * with the POSIX shared memory objects.
+ *
+ * Directives provided are:
+ *
+ *  - open a shared memory object
+ *  - unlink a shared memory object
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_POSIX_SHM_H
+#define _RTEMS_POSIX_SHM_H
+
+#include <sys/types.h>
+#include <time.h>
+
+#include <rtems/score/object.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup POSIXShmPrivate POSIX Shared Memory Private Support
+ *
+ * @ingroup POSIXAPI
+ *
+ * This defines the internal implementation support for POSIX shared memory
+ * objects.
+ */
+/**@{*/
+
+/**
+ * @brief Control block of a POSIX shared memory object.
+ *
+ * The data of the object is stored in contiguous memory, so that each part
+ * of it can be mapped directly by mmap().
+ */
+typedef struct {
+  Objects_Control  Object;
+
+  /**
+   * @brief Count of open file descriptors and mappings of this object.
+   */
+  uint32_t         reference_count;
+
+  /**
+   * @brief Count of mappings of this object.
+   *
+   * The size of a mapped object cannot change since this would move its
+   * data.
+   */
+  uint32_t         mmap_count;
+
+  /**
+   * @brief Indicates if the object is still accessible by its name.
+   */
+  bool             linked;
+
+  /**
+   * @brief The data of the object.
+   */
+  void            *addr;
+
+  /**
+   * @brief The size of the object in bytes.
+   */
+  size_t           size;
+
+  mode_t           mode;
+  uid_t            uid;
+  gid_t            gid;
+  time_t           atime;
+  time_t           mtime;
+  time_t           ctime;
+} POSIX_Shm_Control;
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*  end of include file */
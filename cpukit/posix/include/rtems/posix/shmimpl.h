@@ -0,0 +1,113 @@
+/**
+ * @file
+ *
+ * @brief Private Inlined Routines for POSIX Shared Memory Objects
+ *
+ * This include file contains the static inline implementation of the private
+ * inlined routines for POSIX shared memory objects.
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_POSIX_SHMIMPL_H
+#define _RTEMS_POSIX_SHMIMPL_H
+
+#include <rtems/posix/shm.h>
+#include <rtems/posix/posixapi.h>
+#include <rtems/libio.h>
+#include <rtems/score/objectimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup POSIXShmPrivate
+ */
+/**@{*/
+
+/**
+ *  This defines the information control block used to manage
+ *  this class of objects.
+ */
+extern Objects_Information _POSIX_Shm_Information;
+
+/**
+ * @brief The file handlers of shared memory object file descriptors.
+ */
+extern const rtems_filesystem_file_handlers_r _POSIX_Shm_handlers;
+
+RTEMS_INLINE_ROUTINE POSIX_Shm_Control *_POSIX_Shm_Allocate_unprotected( void )
+{
+  return (POSIX_Shm_Control *)
+    _Objects_Allocate_unprotected( &_POSIX_Shm_Information );
+}
+
+/**
+ * @brief POSIX Shared Memory Object Free
+ *
+ * This routine frees a shared memory object control block to the inactive
+ * chain of free shared memory object control blocks.
+ */
+RTEMS_INLINE_ROUTINE void _POSIX_Shm_Free( POSIX_Shm_Control *the_shm )
+{
+  _Objects_Free( &_POSIX_Shm_Information, &the_shm->Object );
+}
+
+RTEMS_INLINE_ROUTINE POSIX_Shm_Control *_POSIX_Shm_Get_by_name(
+  const char                *name,
+  size_t                    *name_length_p,
+  Objects_Get_by_name_error *error
+)
+{
+  return (POSIX_Shm_Control *) _Objects_Get_by_name(
+    &_POSIX_Shm_Information,
+    name,
+    name_length_p,
+    error
+  );
+}
+
+/**
+ * @brief POSIX Shared Memory Object Namespace Remove
+ */
+RTEMS_INLINE_ROUTINE void _POSIX_Shm_Namespace_remove(
+  POSIX_Shm_Control *the_shm
+)
+{
+  _Objects_Namespace_remove( &_POSIX_Shm_Information, &the_shm->Object );
+}
+
+/**
+ * @brief Releases a reference to a shared memory object.
+ *
+ * The object is deleted once it is unlinked and no longer referenced by a
+ * file descriptor or a mapping.  The caller must own the allocator lock.
+ *
+ * @param[in] the_shm The shared memory object.
+ */
+void _POSIX_Shm_Release( POSIX_Shm_Control *the_shm );
+
+/**
+ * @brief Releases a mapping of a shared memory object.
+ *
+ * @param[in] the_shm The shared memory object.
+ *
+ * @see _POSIX_Shm_Release().
+ */
+void _POSIX_Shm_Unmap( POSIX_Shm_Control *the_shm );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*  end of include file */
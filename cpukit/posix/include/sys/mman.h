@@ -177,6 +177,10 @@ int	mlock(const void *, size_t);
 int	munlock(const void *, size_t);
 int	mlockall(int);
 int	munlockall(void);
+#if defined(__rtems__)
+int	shm_open(const char *, int, mode_t);
+int	shm_unlink(const char *);
+#endif
 #if defined(_NETBSD_SOURCE)
 int	madvise(void *, size_t, int);
 int	mincore(void *, size_t, char *);
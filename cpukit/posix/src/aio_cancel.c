@@ -20,24 +20,39 @@
 #include <aio.h>
 #include <rtems/posix/aio_misc.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <stdlib.h>
 #include <rtems/system.h>
 #include <rtems/seterr.h>
 
 int aio_cancel(int fildes, struct aiocb  *aiocbp)
 {
-  rtems_chain_control *idle_req_chain = &aio_request_queue.idle_req;
-  rtems_chain_control *work_req_chain = &aio_request_queue.work_req;
+  rtems_aio_work_queue *queue;
+  rtems_chain_control *idle_req_chain;
+  rtems_chain_control *work_req_chain;
   rtems_aio_request_chain *r_chain;
   int result;
   
-  pthread_mutex_lock (&aio_request_queue.mutex);
-
   if (fcntl (fildes, F_GETFD) < 0) {
-    pthread_mutex_unlock(&aio_request_queue.mutex);
     rtems_set_errno_and_return_minus_one (EBADF);
   }
 
+  /* Without rtems_aio_init() no request can be queued */
+  if (aio_request_queue.initialized != AIO_QUEUE_INITIALIZED) {
+    if (aiocbp != NULL && aiocbp->aio_fildes != fildes) {
+      rtems_set_errno_and_return_minus_one (EINVAL);
+    }
+
+    return AIO_ALLDONE;
+  }
+
+  /* All requests for a file descriptor are in the same work queue */
+  queue = rtems_aio_get_queue (fildes);
+  idle_req_chain = &queue->idle_req;
+  work_req_chain = &queue->work_req;
+
+  pthread_mutex_lock (&queue->mutex);
+
   /* if aiocbp is NULL remove all request for given file descriptor */
   if (aiocbp == NULL) {
     AIO_printf ("Cancel all requests\n");        
@@ -49,7 +64,7 @@ int aio_cancel(int fildes, struct aiocb  *aiocbp)
       if (!rtems_chain_is_empty (idle_req_chain)) {
         r_chain = rtems_aio_search_fd (idle_req_chain, fildes, 0);
         if (r_chain == NULL) {
-          pthread_mutex_unlock(&aio_request_queue.mutex);
+          pthread_mutex_unlock(&queue->mutex);
           return AIO_ALLDONE;
         }
 
@@ -57,31 +72,27 @@ int aio_cancel(int fildes, struct aiocb  *aiocbp)
 
         rtems_chain_extract (&r_chain->next_fd);
         rtems_aio_remove_fd (r_chain);
-        pthread_mutex_destroy (&r_chain->mutex);
-        pthread_cond_destroy (&r_chain->mutex);
         free (r_chain);
 
-        pthread_mutex_unlock (&aio_request_queue.mutex);
+        pthread_mutex_unlock (&queue->mutex);
         return AIO_CANCELED;
       }
 
-      pthread_mutex_unlock (&aio_request_queue.mutex);
+      pthread_mutex_unlock (&queue->mutex);
       return AIO_ALLDONE;
     }
 
     AIO_printf ("Request chain on [WQ]\n");
 
-    pthread_mutex_lock (&r_chain->mutex);
-    rtems_chain_extract (&r_chain->next_fd);
+    /* The worker owns the chain and removes it once it is empty */
     rtems_aio_remove_fd (r_chain);
-    pthread_mutex_unlock (&r_chain->mutex);
-    pthread_mutex_unlock (&aio_request_queue.mutex);
+    pthread_mutex_unlock (&queue->mutex);
     return AIO_CANCELED;
   } else {
     AIO_printf ("Cancel request\n");
 
     if (aiocbp->aio_fildes != fildes) {
-      pthread_mutex_unlock (&aio_request_queue.mutex);
+      pthread_mutex_unlock (&queue->mutex);
       rtems_set_errno_and_return_minus_one (EINVAL);
     }
       
@@ -90,26 +101,24 @@ int aio_cancel(int fildes, struct aiocb  *aiocbp)
       if (!rtems_chain_is_empty (idle_req_chain)) {
         r_chain = rtems_aio_search_fd (idle_req_chain, fildes, 0);
         if (r_chain == NULL) { 
-          pthread_mutex_unlock (&aio_request_queue.mutex);
+          pthread_mutex_unlock (&queue->mutex);
           rtems_set_errno_and_return_minus_one (EINVAL);
         }      
            
         AIO_printf ("Request on [IQ]\n");                     
    
         result = rtems_aio_remove_req (&r_chain->perfd, aiocbp);
-        pthread_mutex_unlock (&aio_request_queue.mutex);
+        pthread_mutex_unlock (&queue->mutex);
         return result;
       } else {
-        pthread_mutex_unlock (&aio_request_queue.mutex);
+        pthread_mutex_unlock (&queue->mutex);
         return AIO_ALLDONE;
       }
     }  
       AIO_printf ("Request on [WQ]\n");
       
-      pthread_mutex_lock (&r_chain->mutex);
       result = rtems_aio_remove_req (&r_chain->perfd, aiocbp);
-      pthread_mutex_unlock (&r_chain->mutex);
-      pthread_mutex_unlock (&aio_request_queue.mutex);
+      pthread_mutex_unlock (&queue->mutex);
       return result;
   }
   return AIO_ALLDONE;
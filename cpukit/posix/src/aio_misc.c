@@ -17,6 +17,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <time.h>
+#include <sys/uio.h>
 #include <rtems/posix/aio_misc.h>
 #include <errno.h>
 
@@ -40,6 +41,8 @@ int
 rtems_aio_init (void)
 {
   int result = 0;
+  uint32_t count;
+  uint32_t i;
 
   result = pthread_attr_init (&aio_request_queue.attr);
   if (result != 0)
@@ -48,26 +51,50 @@ rtems_aio_init (void)
   result =
     pthread_attr_setdetachstate (&aio_request_queue.attr,
                                  PTHREAD_CREATE_DETACHED);
-  if (result != 0)
+  if (result != 0) {
     pthread_attr_destroy (&aio_request_queue.attr);
+    return result;
+  }
 
-
-  result = pthread_mutex_init (&aio_request_queue.mutex, NULL);
-  if (result != 0)
+  count = rtems_get_processor_count ();
+  aio_request_queue.queues = calloc (count, sizeof (rtems_aio_work_queue));
+  if (aio_request_queue.queues == NULL) {
     pthread_attr_destroy (&aio_request_queue.attr);
+    return ENOMEM;
+  }
 
+  for (i = 0; i < count; ++i) {
+    rtems_aio_work_queue *queue = &aio_request_queue.queues[i];
+
+    result = pthread_mutex_init (&queue->mutex, NULL);
+    if (result != 0)
+      break;
+
+    result = pthread_cond_init (&queue->new_req, NULL);
+    if (result != 0) {
+      pthread_mutex_destroy (&queue->mutex);
+      break;
+    }
+
+    rtems_chain_initialize_empty (&queue->work_req);
+    rtems_chain_initialize_empty (&queue->idle_req);
+  }
 
-  result = pthread_cond_init (&aio_request_queue.new_req, NULL);
   if (result != 0) {
-    pthread_mutex_destroy (&aio_request_queue.mutex);
+    while (i > 0) {
+      --i;
+      pthread_cond_destroy (&aio_request_queue.queues[i].new_req);
+      pthread_mutex_destroy (&aio_request_queue.queues[i].mutex);
+    }
+
+    free (aio_request_queue.queues);
     pthread_attr_destroy (&aio_request_queue.attr);
+    return result;
   }
 
-  rtems_chain_initialize_empty (&aio_request_queue.work_req);
-  rtems_chain_initialize_empty (&aio_request_queue.idle_req);
-
-  aio_request_queue.active_threads = 0;
-  aio_request_queue.idle_threads = 0;
+  aio_request_queue.queue_count = count;
+  aio_request_queue.threads_per_queue =
+    (int) ((AIO_MAX_THREADS + count - 1) / count);
   aio_request_queue.initialized = AIO_QUEUE_INITIALIZED;
 
   return result;
@@ -90,7 +117,8 @@ rtems_aio_init (void)
  *                     - pointer to chain is there exists
  *                       a chain for given fildes
  *                     - pointer to newly create chain if
- *                       create == 1
+ *                       create == 1, NULL if there is not
+ *                       enough memory
  *
  */
 
@@ -108,23 +136,22 @@ rtems_aio_search_fd (rtems_chain_control *chain, int fildes, int create)
     r_chain = (rtems_aio_request_chain *) node;
   }
 
-  if (r_chain->fildes == fildes)
+  if (!rtems_chain_is_tail (chain, node) && r_chain->fildes == fildes)
     r_chain->new_fd = 0;
   else {
     if (create == 0)
       r_chain = NULL;
     else {
       r_chain = malloc (sizeof (rtems_aio_request_chain));
+      if (r_chain == NULL)
+        return NULL;
+
       rtems_chain_initialize_empty (&r_chain->perfd);
       rtems_chain_initialize_node (&r_chain->next_fd);
-
-      if (rtems_chain_is_empty (chain))
-        rtems_chain_prepend (chain, &r_chain->next_fd);
-      else
-        rtems_chain_insert (rtems_chain_previous (node), &r_chain->next_fd);
+      rtems_chain_insert (rtems_chain_previous (node), &r_chain->next_fd);
 
       r_chain->new_fd = 1;
-	  r_chain->fildes = fildes;
+      r_chain->fildes = fildes;
     }
   }
   return r_chain;
@@ -136,6 +163,7 @@ rtems_aio_search_fd (rtems_chain_control *chain, int fildes, int create)
  * Move chain of requests from IQ to WQ
  *
  *  Input parameters:
+ *        queue        - work queue of the chain
  *        r_chain      - chain of requests
  *
  *  Output paramteres:
@@ -143,17 +171,18 @@ rtems_aio_search_fd (rtems_chain_control *chain, int fildes, int create)
  */
 
 static void
-rtems_aio_move_to_work (rtems_aio_request_chain *r_chain)
+rtems_aio_move_to_work (rtems_aio_work_queue *queue,
+                        rtems_aio_request_chain *r_chain)
 {
-  rtems_chain_control *work_req_chain = &aio_request_queue.work_req;
+  rtems_chain_control *work_req_chain = &queue->work_req;
   rtems_aio_request_chain *temp;
   rtems_chain_node *node;
 
   node = rtems_chain_first (work_req_chain);
   temp = (rtems_aio_request_chain *) node;
 
-  while (temp->fildes < r_chain->fildes &&
-	 !rtems_chain_is_tail (work_req_chain, node)) {
+  while (!rtems_chain_is_tail (work_req_chain, node) &&
+	 temp->fildes < r_chain->fildes) {
     node = rtems_chain_next (node);
     temp = (rtems_aio_request_chain *) node;
   }
@@ -166,7 +195,8 @@ rtems_aio_move_to_work (rtems_aio_request_chain *r_chain)
  *  rtems_aio_insert_prio
  *
  * Add request to given FD chain. The chain is ordered
- * by priority
+ * by priority, requests of equal priority are kept in
+ * submission order
  *
  *  Input parameters:
  *        chain        - chain of requests for a given FD
@@ -182,24 +212,68 @@ rtems_aio_insert_prio (rtems_chain_control *chain, rtems_aio_request *req)
   rtems_chain_node *node;
 
   AIO_printf ("FD exists \n");
-  node = rtems_chain_first (chain);
+  node = rtems_chain_last (chain);
 
-  if (rtems_chain_is_empty (chain)) {
-    AIO_printf ("First in chain \n");
-    rtems_chain_prepend (chain, &req->next_prio);
-  } else {
-    AIO_printf ("Add by priority \n");
-    int prio = ((rtems_aio_request *) node)->aiocbp->aio_reqprio;
+  while (!rtems_chain_is_head (chain, node) &&
+         ((rtems_aio_request *) node)->aiocbp->aio_reqprio >
+           req->aiocbp->aio_reqprio) {
+    node = rtems_chain_previous (node);
+  }
 
-    while (req->aiocbp->aio_reqprio > prio &&
-           !rtems_chain_is_tail (chain, node)) {
-      node = rtems_chain_next (node);
-      prio = ((rtems_aio_request *) node)->aiocbp->aio_reqprio;
-    }
+  rtems_chain_insert (node, &req->next_prio);
+}
 
-    rtems_chain_insert (node->previous, &req->next_prio);
+/*
+ *  rtems_aio_complete
+ *
+ * Set the result of a request, notify a waiting list and
+ * free the request
+ *
+ *  Input parameters:
+ *        req          - request (see aio_misc.h)
+ *        result       - the return value of the request
+ *        error        - the error code of the request
+ *
+ *  Output parameters:
+ *        NONE
+ */
 
+static void
+rtems_aio_complete (rtems_aio_request *req, ssize_t result, int error)
+{
+  rtems_aio_list *list = req->list;
+
+  req->aiocbp->return_value = result;
+  req->aiocbp->error_code = error;
+
+  if (list != NULL) {
+    int pending;
+    int notify;
+
+    /*
+     * For LIO_WAIT the list is on the stack of lio_listio(), which may
+     * return once the mutex is unlocked, so read it only while locked.
+     */
+    pthread_mutex_lock (&list->mutex);
+    if (error != 0)
+      ++list->errors;
+    pending = --list->pending;
+    notify = list->notify;
+    if (pending == 0 && !notify)
+      pthread_cond_signal (&list->done);
+    pthread_mutex_unlock (&list->mutex);
+
+    if (pending == 0 && notify) {
+      if (list->sig.sigev_notify == SIGEV_SIGNAL)
+        sigqueue (getpid (), list->sig.sigev_signo, list->sig.sigev_value);
+
+      pthread_mutex_destroy (&list->mutex);
+      pthread_cond_destroy (&list->done);
+      free (list);
+    }
   }
+
+  free (req);
 }
 
 /* 
@@ -226,9 +300,7 @@ void rtems_aio_remove_fd (rtems_aio_request_chain *r_chain)
       rtems_aio_request *req = (rtems_aio_request *) node;
       node = rtems_chain_next (node);
       rtems_chain_extract (&req->next_prio);
-      req->aiocbp->error_code = ECANCELED;
-      req->aiocbp->return_value = -1;
-      free (req);
+      rtems_aio_complete (req, -1, ECANCELED);
     }
 }
 
@@ -268,46 +340,30 @@ int rtems_aio_remove_req (rtems_chain_control *chain, struct aiocb *aiocbp)
   else
     {
       rtems_chain_extract (node);
-      current->aiocbp->error_code = ECANCELED;
-      current->aiocbp->return_value = -1;
-      free (current); 
+      rtems_aio_complete (current, -1, ECANCELED);
     }
     
   return AIO_CANCELED;
 }
 
-/* 
- *  rtems_aio_enqueue
+/*
+ *  rtems_aio_prepare
  *
- * Enqueue requests, and creates threads to process them 
+ * Initialize the scheduling and status fields of a request
  *
  *  Input parameters:
  *        req        - see aio_misc.h
- * 
- *  Output parameters: 
- *         0         - if request was added to queue
- *         errno     - otherwise
+ *
+ *  Output parameters:
+ *        NONE
  */
 
-int
-rtems_aio_enqueue (rtems_aio_request *req)
+static void
+rtems_aio_prepare (rtems_aio_request *req)
 {
-
-  rtems_aio_request_chain *r_chain;
-  rtems_chain_control *chain;
-  pthread_t thid;
-  int result, policy;
+  int policy;
   struct sched_param param;
 
-  /* The queue should be initialized */
-  AIO_assert (aio_request_queue.initialized == AIO_QUEUE_INITIALIZED);
-
-  result = pthread_mutex_lock (&aio_request_queue.mutex);
-  if (result != 0) {
-    free (req);
-    return result;
-  }
-
   /* _POSIX_PRIORITIZED_IO and _POSIX_PRIORITY_SCHEDULING are defined, 
      we can use aio_reqprio to lower the priority of the request */
   pthread_getschedparam (pthread_self(), &policy, &param);
@@ -318,84 +374,334 @@ rtems_aio_enqueue (rtems_aio_request *req)
   req->policy = policy;
   req->aiocbp->error_code = EINPROGRESS;
   req->aiocbp->return_value = 0;
+}
 
-  if ((aio_request_queue.idle_threads == 0) &&
-      aio_request_queue.active_threads < AIO_MAX_THREADS)
-    /* we still have empty places on the active_threads chain */
-    {
-      chain = &aio_request_queue.work_req;
-      r_chain = rtems_aio_search_fd (chain, req->aiocbp->aio_fildes, 1);
-      
-      if (r_chain->new_fd == 1) {
-	rtems_chain_prepend (&r_chain->perfd, &req->next_prio);
-	r_chain->new_fd = 0;
-	pthread_mutex_init (&r_chain->mutex, NULL);
-	pthread_cond_init (&r_chain->cond, NULL);
-	    
-	AIO_printf ("New thread \n");
-	result = pthread_create (&thid, &aio_request_queue.attr,
-				 rtems_aio_handle, (void *) r_chain);
-	if (result != 0) {
-	  pthread_mutex_unlock (&aio_request_queue.mutex);
-	  return result;
-	}
-	++aio_request_queue.active_threads;
-      }
-      else {
-	/* put request in the fd chain it belongs to */
-	pthread_mutex_lock (&r_chain->mutex);
-	rtems_aio_insert_prio (&r_chain->perfd, req);
-	pthread_cond_signal (&r_chain->cond);
-	pthread_mutex_unlock (&r_chain->mutex);
-      }
+/*
+ *  rtems_aio_insert
+ *
+ * Add a request to the fd chain it belongs to.  The
+ * queue mutex must be locked
+ *
+ *  Input parameters:
+ *        queue      - work queue of the request
+ *        req        - see aio_misc.h
+ *
+ *  Output parameters:
+ *         0         - if request was added to queue
+ *         ENOMEM    - otherwise
+ */
+
+static int
+rtems_aio_insert (rtems_aio_work_queue *queue, rtems_aio_request *req)
+{
+  rtems_aio_request_chain *r_chain;
+
+  /* If a worker owns the fd chain, it will process the request */
+  r_chain = rtems_aio_search_fd (&queue->work_req,
+                                 req->aiocbp->aio_fildes, 0);
+  if (r_chain == NULL) {
+    /* otherwise, it is waiting for a worker on the idle chain */
+    r_chain = rtems_aio_search_fd (&queue->idle_req,
+                                   req->aiocbp->aio_fildes, 1);
+    if (r_chain == NULL)
+      return ENOMEM;
+  }
+
+  rtems_aio_insert_prio (&r_chain->perfd, req);
+  return 0;
+}
+
+/*
+ *  rtems_aio_enqueue_list
+ *
+ * Enqueue a batch of requests.  Each work queue is locked only
+ * once for all requests of the batch which belong to it.  The
+ * worker threads of a work queue are created on demand up to a
+ * fixed limit and they wait for new requests while idle
+ *
+ *  Input parameters:
+ *        reqs       - requests (see aio_misc.h)
+ *        count      - the number of requests
+ *
+ *  Output parameters:
+ *         0         - if all requests were added to queue
+ *         errno     - otherwise, requests which could not be
+ *                     added are completed with this error
+ */
+
+int
+rtems_aio_enqueue_list (rtems_aio_request **reqs, int count)
+{
+  uint32_t queue_count;
+  uint32_t q;
+  int result = 0;
+  int i;
+
+  /* The queue should be initialized */
+  AIO_assert (aio_request_queue.initialized == AIO_QUEUE_INITIALIZED);
+
+  for (i = 0; i < count; ++i)
+    rtems_aio_prepare (reqs[i]);
+
+  queue_count = aio_request_queue.queue_count;
+
+  for (q = 0; q < queue_count; ++q) {
+    rtems_aio_work_queue *queue = &aio_request_queue.queues[q];
+    int lock_error;
+    int error;
+    int queued = 0;
+
+    for (i = 0; i < count; ++i) {
+      if ((uint32_t) reqs[i]->aiocbp->aio_fildes % queue_count == q)
+        break;
     }
-  else 
-    {
-      /* the maximum number of threads has been already created
-	 even though some of them might be idle.
-	 The request belongs to one of the active fd chain */
-      r_chain = rtems_aio_search_fd (&aio_request_queue.work_req,
-				     req->aiocbp->aio_fildes, 0);
-      if (r_chain != NULL)
-	{
-	  pthread_mutex_lock (&r_chain->mutex);
-	  rtems_aio_insert_prio (&r_chain->perfd, req);
-	  pthread_cond_signal (&r_chain->cond);
-	  pthread_mutex_unlock (&r_chain->mutex);
-	    
-	} else {
-      
-	/* or to the idle chain */
-	chain = &aio_request_queue.idle_req;
-	r_chain = rtems_aio_search_fd (chain, req->aiocbp->aio_fildes, 1);
-      
-	if (r_chain->new_fd == 1) {
-	  /* If this is a new fd chain we signal the idle threads that
-	     might be waiting for requests */
-	  AIO_printf (" New chain on waiting queue \n ");
-	  rtems_chain_prepend (&r_chain->perfd, &req->next_prio);
-	  r_chain->new_fd = 0;
-	  pthread_mutex_init (&r_chain->mutex, NULL);
-	  pthread_cond_init (&r_chain->cond, NULL);
-	} else
-	  /* just insert the request in the existing fd chain */
-	  rtems_aio_insert_prio (&r_chain->perfd, req);
-	if (aio_request_queue.idle_threads > 0)
-	  pthread_cond_signal (&aio_request_queue.new_req);
+
+    if (i == count)
+      continue;
+
+    lock_error = pthread_mutex_lock (&queue->mutex);
+    error = lock_error;
+
+    if (error == 0 && queue->idle_threads == 0 &&
+        queue->threads < aio_request_queue.threads_per_queue) {
+      pthread_t thid;
+      int eno;
+
+      AIO_printf ("New thread \n");
+      eno = pthread_create (&thid, &aio_request_queue.attr,
+                            rtems_aio_handle, queue);
+      if (eno == 0)
+        ++queue->threads;
+      else if (queue->threads == 0)
+        /* without a worker thread, the requests would never complete */
+        error = eno;
+    }
+
+    for (; i < count; ++i) {
+      rtems_aio_request *req = reqs[i];
+
+      if ((uint32_t) req->aiocbp->aio_fildes % queue_count != q)
+        continue;
+
+      if (error == 0)
+        error = rtems_aio_insert (queue, req);
+
+      if (error == 0) {
+        ++queued;
+      } else {
+        if (result == 0)
+          result = error;
+        rtems_aio_complete (req, -1, EAGAIN);
       }
     }
 
-  pthread_mutex_unlock (&aio_request_queue.mutex);
-  return 0;
+    if (queued > 0) {
+      if (queued > 1)
+        pthread_cond_broadcast (&queue->new_req);
+      else
+        pthread_cond_signal (&queue->new_req);
+    }
+
+    if (lock_error == 0)
+      pthread_mutex_unlock (&queue->mutex);
+  }
+
+  return result;
+}
+
+/* 
+ *  rtems_aio_enqueue
+ *
+ * Enqueue requests, and creates threads to process them 
+ *
+ *  Input parameters:
+ *        req        - see aio_misc.h
+ * 
+ *  Output parameters: 
+ *         0         - if request was added to queue
+ *         errno     - otherwise
+ */
+
+int
+rtems_aio_enqueue (rtems_aio_request *req)
+{
+  req->list = NULL;
+  return rtems_aio_enqueue_list (&req, 1);
+}
+
+/*
+ *  rtems_aio_take
+ *
+ * Extract the next request of an fd chain together with the
+ * following requests of the same kind which continue it in the
+ * file, so that they can be done by one transfer
+ *
+ *  Input parameters:
+ *        chain      - non-empty chain of requests for a given FD
+ *        batch      - array of at least AIO_MAX_MERGE requests
+ *
+ *  Output parameters:
+ *        the number of requests in the batch
+ */
+
+static int
+rtems_aio_take (rtems_chain_control *chain, rtems_aio_request **batch)
+{
+  rtems_aio_request *req;
+  struct aiocb *first;
+  off_t end;
+  int n;
+
+  req = (rtems_aio_request *) rtems_chain_get_unprotected (chain);
+  batch[0] = req;
+  n = 1;
+
+  first = req->aiocbp;
+  if (first->aio_lio_opcode != LIO_READ && first->aio_lio_opcode != LIO_WRITE)
+    return n;
+
+  end = first->aio_offset + (off_t) first->aio_nbytes;
+
+  while (n < AIO_MAX_MERGE && !rtems_chain_is_empty (chain)) {
+    struct aiocb *next;
+
+    req = (rtems_aio_request *) rtems_chain_first (chain);
+    next = req->aiocbp;
+
+    if (next->aio_lio_opcode != first->aio_lio_opcode ||
+        next->aio_offset != end ||
+        req->priority != batch[0]->priority)
+      break;
+
+    rtems_chain_extract_unprotected (&req->next_prio);
+    batch[n] = req;
+    ++n;
+    end += (off_t) next->aio_nbytes;
+  }
+
+  return n;
+}
+
+/*
+ *  rtems_aio_transfer
+ *
+ * Positioned read or write of a batch of adjacent requests
+ * with one vectored transfer
+ *
+ *  Input parameters:
+ *        batch      - requests of the same kind in file order
+ *        n          - the number of requests
+ *
+ *  Output parameters:
+ *        the transferred byte count or -1 with errno set
+ */
+
+static ssize_t
+rtems_aio_transfer (rtems_aio_request **batch, int n)
+{
+  struct aiocb *first = batch[0]->aiocbp;
+  struct iovec iov[AIO_MAX_MERGE];
+  off_t cur_pos;
+  ssize_t result;
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    iov[i].iov_base = (void *) batch[i]->aiocbp->aio_buf;
+    iov[i].iov_len = batch[i]->aiocbp->aio_nbytes;
+  }
+
+  /* Like pread() and pwrite(), restore the file position */
+  cur_pos = lseek (first->aio_fildes, 0, SEEK_CUR);
+  if (cur_pos == (off_t) -1)
+    return -1;
+
+  if (lseek (first->aio_fildes, first->aio_offset, SEEK_SET) == (off_t) -1)
+    return -1;
+
+  if (first->aio_lio_opcode == LIO_READ)
+    result = readv (first->aio_fildes, iov, n);
+  else
+    result = writev (first->aio_fildes, iov, n);
+
+  if (lseek (first->aio_fildes, cur_pos, SEEK_SET) == (off_t) -1)
+    return -1;
+
+  return result;
+}
+
+/*
+ *  rtems_aio_process
+ *
+ * Perform a batch of requests and complete them
+ *
+ *  Input parameters:
+ *        batch      - requests (see rtems_aio_take())
+ *        n          - the number of requests
+ *
+ *  Output parameters:
+ *        NONE
+ */
+
+static void
+rtems_aio_process (rtems_aio_request **batch, int n)
+{
+  struct aiocb *aiocbp = batch[0]->aiocbp;
+  ssize_t result;
+  int i;
+
+  switch (aiocbp->aio_lio_opcode) {
+  case LIO_READ:
+    AIO_printf ("read\n");
+    if (n == 1)
+      result = pread (aiocbp->aio_fildes, (void *) aiocbp->aio_buf,
+                      aiocbp->aio_nbytes, aiocbp->aio_offset);
+    else
+      result = rtems_aio_transfer (batch, n);
+    break;
+
+  case LIO_WRITE:
+    AIO_printf ("write\n");
+    if (n == 1)
+      result = pwrite (aiocbp->aio_fildes, (void *) aiocbp->aio_buf,
+                       aiocbp->aio_nbytes, aiocbp->aio_offset);
+    else
+      result = rtems_aio_transfer (batch, n);
+    break;
+
+  case LIO_SYNC:
+    AIO_printf ("sync\n");
+    result = fsync (aiocbp->aio_fildes);
+    break;
+
+  default:
+    errno = EINVAL;
+    result = -1;
+  }
+
+  if (result == -1) {
+    int error = errno;
+
+    for (i = 0; i < n; ++i)
+      rtems_aio_complete (batch[i], -1, error);
+  } else {
+    /* A short transfer ends within the request which hit it */
+    for (i = 0; i < n; ++i) {
+      size_t nbytes = batch[i]->aiocbp->aio_nbytes;
+      size_t done = (size_t) result < nbytes ? (size_t) result : nbytes;
+
+      result -= (ssize_t) done;
+      rtems_aio_complete (batch[i], (ssize_t) done, 0);
+    }
+  }
 }
 
 /* 
  *  rtems_aio_handle
  *
- * Thread processing requests 
+ * Worker thread processing requests of a work queue 
  *
  *  Input parameters:
- *        arg        - the chain for the fd to be worked on
+ *        arg        - the work queue
  * 
  *  Output parameters: 
  *        NULL       - if error
@@ -404,161 +710,62 @@ rtems_aio_enqueue (rtems_aio_request *req)
 static void *
 rtems_aio_handle (void *arg)
 {
-
-  rtems_aio_request_chain *r_chain = arg;
-  rtems_aio_request *req;
-  rtems_chain_control *chain;
+  rtems_aio_work_queue *queue = arg;
+  rtems_aio_request *batch[AIO_MAX_MERGE];
+  rtems_aio_request_chain *r_chain;
   rtems_chain_node *node;
-  int result, policy;
+  int result, policy, n;
   struct sched_param param;
 
   AIO_printf ("Thread started\n");
- 
+
+  result = pthread_mutex_lock (&queue->mutex);
+  if (result != 0)
+    return NULL;
+
   while (1) {
-    
-    /* acquire the mutex of the current fd chain.
-       we don't need to lock the queue mutex since we can
-       add requests to idle fd chains or even active ones
-       if the working request has been extracted from the
-       chain */
-    result = pthread_mutex_lock (&r_chain->mutex);
-    if (result != 0)
-      return NULL;
-    
-    chain = &r_chain->perfd;    
-
-    /* If the locked chain is not empty, take the first
-       request extract it, unlock the chain and process 
-       the request, in this way the user can supply more
-       requests to this fd chain */
-    if (!rtems_chain_is_empty (chain)) {
-
-      AIO_printf ("Get new request from not empty chain\n");	
-      node = rtems_chain_first (chain);
-      req = (rtems_aio_request *) node;
-      
-      /* See _POSIX_PRIORITIZE_IO and _POSIX_PRIORITY_SCHEDULING
-	 discussion in rtems_aio_enqueue () */
-      pthread_getschedparam (pthread_self(), &policy, &param);
-      param.sched_priority = req->priority;
-      pthread_setschedparam (pthread_self(), req->policy, &param);
 
-      rtems_chain_extract (node);
+    /* Wait for an fd chain which is not owned by another worker */
+    while (rtems_chain_is_empty (&queue->idle_req)) {
+      AIO_printf ("Chain is empty [IQ], wait for work\n");
+      ++queue->idle_threads;
+      pthread_cond_wait (&queue->new_req, &queue->mutex);
+      --queue->idle_threads;
+    }
 
-      pthread_mutex_unlock (&r_chain->mutex);
+    AIO_printf ("Work on idle\n");
+    node = rtems_chain_first (&queue->idle_req);
+    rtems_chain_extract (node);
+    r_chain = (rtems_aio_request_chain *) node;
+    rtems_aio_move_to_work (queue, r_chain);
+    ++queue->active_threads;
 
-      switch (req->aiocbp->aio_lio_opcode) {
-      case LIO_READ:
-	AIO_printf ("read\n");
-        result = pread (req->aiocbp->aio_fildes,
-                        (void *) req->aiocbp->aio_buf,
-                        req->aiocbp->aio_nbytes, req->aiocbp->aio_offset);
-        break;
+    /* The fd chain is owned by this worker until it is empty, in
+       this way the requests for a file descriptor are done in order.
+       The user can supply more requests to the fd chain while the
+       queue is unlocked */
+    while (!rtems_chain_is_empty (&r_chain->perfd)) {
+      AIO_printf ("Get new request from not empty chain\n");
+      n = rtems_aio_take (&r_chain->perfd, batch);
 
-      case LIO_WRITE:
-	AIO_printf ("write\n");
-        result = pwrite (req->aiocbp->aio_fildes,
-                         (void *) req->aiocbp->aio_buf,
-                         req->aiocbp->aio_nbytes, req->aiocbp->aio_offset);
-        break;
-        
-      case LIO_SYNC:
-	AIO_printf ("sync\n");
-      	result = fsync (req->aiocbp->aio_fildes);
-      	break;
-
-      default:
-        result = -1;
-      }
-      if (result == -1) {
-        req->aiocbp->return_value = -1;
-	req->aiocbp->error_code = errno;
-      } else {
-        req->aiocbp->return_value = result;
-        req->aiocbp->error_code = 0;
-      }
+      pthread_mutex_unlock (&queue->mutex);
 
-      // notification needed for lio
-
-    } else {
-      /* If the fd chain is empty we unlock the fd chain
-	 and we lock the queue chain, this will ensure that
-	 we have at most one request comming to our fd chain
-	 when we check. 
-	 
-	 If there was no request added sleep for 3 seconds and
-	 wait for a signal on chain, this will unlock the queue.
-	 The fd chain is already unlocked */
-
-      struct timespec timeout;
-      
-      AIO_printf ("Chain is empty [WQ], wait for work\n");
-     
-      pthread_mutex_unlock (&r_chain->mutex);
-      pthread_mutex_lock (&aio_request_queue.mutex);
-      
-      if (rtems_chain_is_empty (chain))
-	{
-	  clock_gettime (CLOCK_REALTIME, &timeout);
-	  timeout.tv_sec += 3;
-	  timeout.tv_nsec = 0;
-	  result = pthread_cond_timedwait (&r_chain->cond,
-					   &aio_request_queue.mutex,
-					   &timeout);
-
-	  /* If no requests were added to the chain we delete the fd chain from 
-	     the queue and start working with idle fd chains */
-	  if (result == ETIMEDOUT) {
-	    rtems_chain_extract (&r_chain->next_fd);
-	    pthread_mutex_destroy (&r_chain->mutex);
-	    pthread_cond_destroy (&r_chain->cond);
-	    free (r_chain);
-	    
-	    /* If the idle chain is empty sleep for 3 seconds and wait for a 
-	       signal. The thread now becomes idle. */
-	    if (rtems_chain_is_empty (&aio_request_queue.idle_req)) {
-	      AIO_printf ("Chain is empty [IQ], wait for work\n");	      
-
-	      ++aio_request_queue.idle_threads;
-	      --aio_request_queue.active_threads;
-	      clock_gettime (CLOCK_REALTIME, &timeout);
-	      timeout.tv_sec += 3;
-	      timeout.tv_nsec = 0;
-
-	      result = pthread_cond_timedwait (&aio_request_queue.new_req,
-					       &aio_request_queue.mutex,
-					       &timeout);
-	      
-	      /* If no new fd chain was added in the idle requests
-		 then this thread is finished */
-	      if (result == ETIMEDOUT) {
-		AIO_printf ("Etimeout\n");
-		--aio_request_queue.idle_threads;
-		pthread_mutex_unlock (&aio_request_queue.mutex);
-		return NULL;
-	      }
-	    }
-	    /* Otherwise move this chain to the working chain and 
-	       start the loop all over again */
-	    AIO_printf ("Work on idle\n");
-	    --aio_request_queue.idle_threads;
-	    ++aio_request_queue.active_threads;
-
-	    node = rtems_chain_first (&aio_request_queue.idle_req);
-	    rtems_chain_extract (node);
-
-	    r_chain = (rtems_aio_request_chain *) node;
-	    rtems_aio_move_to_work (r_chain);
-	    
-	  }
-	}
-      /* If there was a request added in the initial fd chain then release
-	 the mutex and process it */
-      pthread_mutex_unlock (&aio_request_queue.mutex);
-      
+      /* See _POSIX_PRIORITIZE_IO and _POSIX_PRIORITY_SCHEDULING
+	 discussion in rtems_aio_prepare () */
+      pthread_getschedparam (pthread_self(), &policy, &param);
+      param.sched_priority = batch[0]->priority;
+      pthread_setschedparam (pthread_self(), batch[0]->policy, &param);
+
+      rtems_aio_process (batch, n);
+
+      pthread_mutex_lock (&queue->mutex);
     }
+
+    rtems_chain_extract (&r_chain->next_fd);
+    free (r_chain);
+    --queue->active_threads;
   }
-  
+
   AIO_printf ("Thread finished\n");
   return NULL;
 }
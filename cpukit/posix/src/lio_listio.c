@@ -22,16 +22,191 @@
 
 #include <aio.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
 
+#include <rtems/posix/aio_misc.h>
 #include <rtems/system.h>
 #include <rtems/seterr.h>
 
+/*
+ *  lio_listio_check
+ *
+ * Check a list entry like aio_read() and aio_write() do
+ *
+ *  Input parameters:
+ *        aiocbp - asynchronous I/O control block
+ *
+ *  Output parameters:
+ *        0      - if the entry is valid
+ *        errno  - otherwise
+ */
+
+static int lio_listio_check( const struct aiocb *aiocbp )
+{
+  int mode;
+
+  mode = fcntl( aiocbp->aio_fildes, F_GETFL );
+  if ( mode == -1 )
+    return EBADF;
+
+  mode &= O_ACCMODE;
+  if ( aiocbp->aio_lio_opcode == LIO_READ ) {
+    if ( mode != O_RDONLY && mode != O_RDWR )
+      return EBADF;
+  } else {
+    if ( mode != O_WRONLY && mode != O_RDWR )
+      return EBADF;
+  }
+
+  if ( aiocbp->aio_reqprio < 0 || aiocbp->aio_reqprio > AIO_PRIO_DELTA_MAX )
+    return EINVAL;
+
+  if ( aiocbp->aio_offset < 0 )
+    return EINVAL;
+
+  return 0;
+}
+
+/*
+ *  lio_listio
+ *
+ * Initiate a list of I/O requests.  The valid entries are submitted
+ * as one batch, see rtems_aio_enqueue_list().
+ *
+ *  Input parameters:
+ *        mode   - LIO_WAIT or LIO_NOWAIT
+ *        list   - asynchronous I/O control blocks
+ *        nent   - the number of entries in the list
+ *        sig    - notification for LIO_NOWAIT or NULL
+ *
+ *  Output parameters:
+ *        -1     - invalid arguments
+ *               - some requests could not be enqueued or
+ *                 failed for LIO_WAIT
+ *         0     - otherwise
+ */
+
 int lio_listio(
-  int              mode RTEMS_UNUSED,
-  struct aiocb    *__restrict const  list[__restrict] RTEMS_UNUSED,
-  int              nent RTEMS_UNUSED,
-  struct sigevent *__restrict sig RTEMS_UNUSED
+  int              mode,
+  struct aiocb    *__restrict const  list[__restrict],
+  int              nent,
+  struct sigevent *__restrict sig
 )
 {
-  rtems_set_errno_and_return_minus_one( ENOSYS );
+  rtems_aio_request **reqs;
+  rtems_aio_list     *lio;
+  rtems_aio_list      wait_list;
+  int                 count;
+  int                 error;
+  int                 i;
+
+  if ( mode != LIO_WAIT && mode != LIO_NOWAIT )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  if ( nent <= 0 || nent > AIO_LISTIO_MAX )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  reqs = malloc( (size_t) nent * sizeof( *reqs ) );
+  if ( reqs == NULL )
+    rtems_set_errno_and_return_minus_one( EAGAIN );
+
+  if ( mode == LIO_WAIT ) {
+    lio = &wait_list;
+  } else {
+    lio = malloc( sizeof( *lio ) );
+    if ( lio == NULL ) {
+      free( reqs );
+      rtems_set_errno_and_return_minus_one( EAGAIN );
+    }
+  }
+
+  pthread_mutex_init( &lio->mutex, NULL );
+  pthread_cond_init( &lio->done, NULL );
+  lio->errors = 0;
+  lio->notify = ( mode == LIO_NOWAIT );
+  if ( sig != NULL )
+    lio->sig = *sig;
+  else
+    lio->sig.sigev_notify = SIGEV_NONE;
+
+  count = 0;
+  error = 0;
+
+  for ( i = 0; i < nent; ++i ) {
+    struct aiocb *aiocbp = list[ i ];
+    int           eno;
+
+    if ( aiocbp == NULL || aiocbp->aio_lio_opcode == LIO_NOP )
+      continue;
+
+    if (
+      aiocbp->aio_lio_opcode != LIO_READ
+        && aiocbp->aio_lio_opcode != LIO_WRITE
+    ) {
+      eno = EINVAL;
+    } else {
+      eno = lio_listio_check( aiocbp );
+    }
+
+    if ( eno == 0 ) {
+      rtems_aio_request *req = malloc( sizeof( *req ) );
+
+      if ( req != NULL ) {
+        req->aiocbp = aiocbp;
+        req->list = lio;
+        reqs[ count ] = req;
+        ++count;
+        continue;
+      }
+
+      eno = EAGAIN;
+    }
+
+    aiocbp->error_code = eno;
+    aiocbp->return_value = -1;
+    error = EIO;
+  }
+
+  /*
+   * The list is done once all submitted requests completed.  The pending
+   * count must be valid before the first request is submitted.
+   */
+  lio->pending = count;
+
+  if ( count > 0 ) {
+    if ( rtems_aio_enqueue_list( reqs, count ) != 0 ) {
+      error = EAGAIN;
+    }
+  }
+
+  free( reqs );
+
+  if ( mode == LIO_WAIT ) {
+    pthread_mutex_lock( &lio->mutex );
+    while ( lio->pending > 0 ) {
+      pthread_cond_wait( &lio->done, &lio->mutex );
+    }
+    if ( lio->errors > 0 && error == 0 ) {
+      error = EIO;
+    }
+    pthread_mutex_unlock( &lio->mutex );
+
+    pthread_cond_destroy( &lio->done );
+    pthread_mutex_destroy( &lio->mutex );
+  } else if ( count == 0 ) {
+    /* Nothing was submitted, so the list completes now */
+    if ( lio->sig.sigev_notify == SIGEV_SIGNAL )
+      sigqueue( getpid(), lio->sig.sigev_signo, lio->sig.sigev_value );
+
+    pthread_cond_destroy( &lio->done );
+    pthread_mutex_destroy( &lio->mutex );
+    free( lio );
+  }
+
+  if ( error != 0 ) {
+    rtems_set_errno_and_return_minus_one( error );
+  }
+
+  return 0;
 }
@@ -6,6 +6,8 @@
  *  COPYRIGHT (c) 2014.
  *  On-Line Applications Research Corporation (OAR).
  *
+ *  Copyright (c) 2026 agent <agent@local>
+ *
  *  The license and distribution terms for this file may be
  *  found in the file LICENSE in this distribution or at
  *  http://www.rtems.org/license/LICENSE.
@@ -16,21 +18,189 @@
 #endif
 
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <rtems/posix/mmanimpl.h>
+#include <rtems/posix/shmimpl.h>
+
+CHAIN_DEFINE_EMPTY( _POSIX_Mmap_Mappings );
+
+static void *mmap_error( int eno )
+{
+  errno = eno;
+  return MAP_FAILED;
+}
+
+/*
+ * There is no MMU support, so private mappings get a copy of the file data
+ * which is never written back.  The data is read through a private copy of
+ * the descriptor, so that the file offset of the descriptor is not changed.
+ */
+static int mmap_read_private(
+  const rtems_libio_t *iop,
+  void                *addr,
+  size_t               len,
+  off_t                off
+)
+{
+  rtems_libio_t fio = *iop;
+  size_t        done = 0;
+  int           rv = 0;
+
+  fio.offset = off;
+
+  while ( done < len ) {
+    ssize_t n = (*fio.pathinfo.handlers->read_h)(
+      &fio,
+      (char *) addr + done,
+      len - done
+    );
+
+    if ( n <= 0 ) {
+      if ( n == 0 ) {
+        errno = ENXIO;
+      }
+
+      rv = -1;
+      break;
+    }
+
+    done += (size_t) n;
+  }
+
+  return rv;
+}
 
 void *mmap(
   void   *addr,
-  size_t  lenhth,
+  size_t  len,
   int     prot,
   int     flags,
   int     fildes,
   off_t   off
 )
 {
+  POSIX_Mmap_Mapping *mapping;
+  rtems_libio_t      *iop;
+  int                 map_type;
+  int                 rv;
+
+  /* Without MAP_FIXED the address is only a hint, which is ignored */
   (void) addr;
-  (void) lenhth;
-  (void) prot;
-  (void) flags;
-  (void) fildes;
-  (void) off;
-  return MAP_FAILED;
+
+  if ( ( flags & MAP_FIXED ) != 0 ) {
+    return mmap_error( ENOTSUP );
+  }
+
+  map_type = flags & ( MAP_SHARED | MAP_PRIVATE );
+  if ( map_type != MAP_SHARED && map_type != MAP_PRIVATE ) {
+    return mmap_error( EINVAL );
+  }
+
+  if ( len == 0 ) {
+    return mmap_error( EINVAL );
+  }
+
+  if ( ( flags & MAP_ANON ) != 0 ) {
+    if ( fildes != -1 || off != 0 ) {
+      return mmap_error( EINVAL );
+    }
+
+    iop = NULL;
+  } else {
+    struct stat st;
+
+    if ( (uint32_t) fildes >= rtems_libio_number_iops ) {
+      return mmap_error( EBADF );
+    }
+
+    iop = rtems_libio_iop( fildes );
+    if ( ( iop->flags & LIBIO_FLAGS_OPEN ) == 0 ) {
+      return mmap_error( EBADF );
+    }
+
+    if (
+      ( iop->flags & LIBIO_FLAGS_READ ) == 0
+        || (
+          map_type == MAP_SHARED
+            && ( prot & PROT_WRITE ) != 0
+            && ( iop->flags & LIBIO_FLAGS_WRITE ) == 0
+        )
+    ) {
+      return mmap_error( EACCES );
+    }
+
+    st.st_mode = 0;
+    st.st_size = 0;
+    rv = (*iop->pathinfo.handlers->fstat_h)( &iop->pathinfo, &st );
+    if ( rv != 0 ) {
+      return MAP_FAILED;
+    }
+
+    if ( !S_ISREG( st.st_mode ) ) {
+      return mmap_error( ENODEV );
+    }
+
+    if ( off < 0 || off > st.st_size || (off_t) len > st.st_size - off ) {
+      return mmap_error( ENXIO );
+    }
+  }
+
+  mapping = calloc( 1, sizeof( *mapping ) );
+  if ( mapping == NULL ) {
+    return mmap_error( ENOMEM );
+  }
+
+  mapping->len = len;
+  mapping->flags = flags;
+
+  if ( iop == NULL ) {
+    mapping->addr = calloc( 1, len );
+    if ( mapping->addr == NULL ) {
+      free( mapping );
+      return mmap_error( ENOMEM );
+    }
+  } else if ( map_type == MAP_PRIVATE ) {
+    mapping->addr = malloc( len );
+    if ( mapping->addr == NULL ) {
+      free( mapping );
+      return mmap_error( ENOMEM );
+    }
+
+    rv = mmap_read_private( iop, mapping->addr, len, off );
+    if ( rv != 0 ) {
+      free( mapping->addr );
+      free( mapping );
+      return MAP_FAILED;
+    }
+  } else {
+    rv = (*iop->pathinfo.handlers->mmap_h)(
+      iop,
+      &mapping->addr,
+      len,
+      prot,
+      off
+    );
+    if ( rv != 0 ) {
+      free( mapping );
+      return MAP_FAILED;
+    }
+
+    if ( iop->pathinfo.handlers == &_POSIX_Shm_handlers ) {
+      mapping->shm = iop->pathinfo.node_access;
+    } else {
+      rtems_filesystem_instance_lock( &iop->pathinfo );
+      rtems_filesystem_location_clone( &mapping->location, &iop->pathinfo );
+      rtems_filesystem_instance_unlock( &iop->pathinfo );
+      mapping->has_location = true;
+    }
+  }
+
+  rtems_libio_lock();
+  _Chain_Append_unprotected( &_POSIX_Mmap_Mappings, &mapping->Node );
+  rtems_libio_unlock();
+
+  return mapping->addr;
 }
@@ -0,0 +1,56 @@
+/**
+ * @file
+ *
+ * @brief Synchronize Memory with Physical Storage
+ * @ingroup POSIXMmanPrivate
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/mman.h>
+#include <errno.h>
+
+#include <rtems/posix/mmanimpl.h>
+#include <rtems/seterr.h>
+
+/*
+ * Shared mappings use the memory of the object itself and private mappings
+ * are never written back, so there is nothing to synchronize.
+ */
+int msync( void *addr, size_t len, int flags )
+{
+  POSIX_Mmap_Mapping *mapping;
+  bool                mapped;
+
+  if (
+    ( flags & ~( MS_ASYNC | MS_SYNC | MS_INVALIDATE ) ) != 0
+      || ( flags & ( MS_ASYNC | MS_SYNC ) ) == ( MS_ASYNC | MS_SYNC )
+  ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  rtems_libio_lock();
+
+  mapping = _POSIX_Mmap_Find( addr );
+  mapped = mapping != NULL
+    && len <= mapping->len
+      - ( (uintptr_t) addr - (uintptr_t) mapping->addr );
+
+  rtems_libio_unlock();
+
+  if ( !mapped ) {
+    rtems_set_errno_and_return_minus_one( ENOMEM );
+  }
+
+  return 0;
+}
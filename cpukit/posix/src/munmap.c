@@ -6,6 +6,8 @@
  *  COPYRIGHT (c) 2014.
  *  On-Line Applications Research Corporation (OAR).
  *
+ *  Copyright (c) 2026 agent <agent@local>
+ *
  *  The license and distribution terms for this file may be
  *  found in the file LICENSE in this distribution or at
  *  http://www.rtems.org/license/LICENSE.
@@ -16,13 +18,62 @@
 #endif
 
 #include <sys/mman.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <rtems/posix/mmanimpl.h>
+#include <rtems/posix/shmimpl.h>
+#include <rtems/seterr.h>
 
+/*
+ * Partial unmaps are not supported.  The range must start at the mapping
+ * address and cover the complete mapping, otherwise EINVAL is returned and
+ * the mapping is left untouched.
+ */
 int munmap(
   void   *addr,
   size_t  length
 )
 {
-  (void) addr;
-  (void) length;
-  return -1;
+  POSIX_Mmap_Mapping *mapping;
+  bool                partial;
+
+  if ( length == 0 ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  rtems_libio_lock();
+
+  mapping = _POSIX_Mmap_Find( addr );
+  partial = mapping != NULL
+    && ( addr != mapping->addr || length < mapping->len );
+  if ( mapping != NULL && !partial ) {
+    _Chain_Extract_unprotected( &mapping->Node );
+  }
+
+  rtems_libio_unlock();
+
+  if ( partial ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  if ( mapping == NULL ) {
+    return 0;
+  }
+
+  if ( mapping->shm != NULL ) {
+    _POSIX_Shm_Unmap( mapping->shm );
+  } else if ( mapping->has_location ) {
+    (*mapping->location.handlers->munmap_h)(
+      &mapping->location,
+      mapping->addr,
+      mapping->len
+    );
+    rtems_filesystem_location_free( &mapping->location );
+  } else {
+    free( mapping->addr );
+  }
+
+  free( mapping );
+  return 0;
 }
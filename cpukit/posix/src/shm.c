@@ -0,0 +1,71 @@
+/**
+ * @file
+ *
+ * @brief POSIX Shared Memory Manager Initialization
+ * @ingroup POSIXShmPrivate
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <limits.h>
+#include <stdlib.h>
+
+#include <rtems/config.h>
+#include <rtems/sysinit.h>
+#include <rtems/posix/shmimpl.h>
+#include <rtems/score/assert.h>
+
+Objects_Information _POSIX_Shm_Information;
+
+static void _POSIX_Shm_Manager_initialization( void )
+{
+  _Objects_Initialize_information(
+    &_POSIX_Shm_Information,    /* object information table */
+    OBJECTS_POSIX_API,          /* object API */
+    OBJECTS_POSIX_SHMS,         /* object class */
+    Configuration_POSIX_API.maximum_shms,
+                                /* maximum objects of this class */
+    sizeof( POSIX_Shm_Control ),
+                                /* size of this object's control block */
+    true,                       /* true if names for this object are strings */
+    _POSIX_PATH_MAX,            /* maximum length of each object's name */
+    NULL                        /* Proxy extraction support callout */
+  );
+}
+
+RTEMS_SYSINIT_ITEM(
+  _POSIX_Shm_Manager_initialization,
+  RTEMS_SYSINIT_POSIX_SHM,
+  RTEMS_SYSINIT_ORDER_MIDDLE
+);
+
+void _POSIX_Shm_Release( POSIX_Shm_Control *the_shm )
+{
+  _Assert( the_shm->reference_count > 0 );
+  --the_shm->reference_count;
+
+  if ( !the_shm->linked && the_shm->reference_count == 0 ) {
+    _Objects_Close( &_POSIX_Shm_Information, &the_shm->Object );
+    free( the_shm->addr );
+    _POSIX_Shm_Free( the_shm );
+  }
+}
+
+void _POSIX_Shm_Unmap( POSIX_Shm_Control *the_shm )
+{
+  _Objects_Allocator_lock();
+  _Assert( the_shm->mmap_count > 0 );
+  --the_shm->mmap_count;
+  _POSIX_Shm_Release( the_shm );
+  _Objects_Allocator_unlock();
+}
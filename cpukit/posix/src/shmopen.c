@@ -0,0 +1,370 @@
+/**
+ * @file
+ *
+ * @brief Open a Shared Memory Object
+ * @ingroup POSIXShmPrivate
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rtems/libio_.h>
+#include <rtems/posix/shmimpl.h>
+#include <rtems/score/wkspace.h>
+#include <rtems/seterr.h>
+
+static POSIX_Shm_Control *shm_get( const rtems_libio_t *iop )
+{
+  return iop->pathinfo.node_access;
+}
+
+/*
+ * The data must stay contiguous to be mappable, so a resize moves it.  This
+ * is not possible while the object is mapped.
+ */
+static int shm_resize( POSIX_Shm_Control *the_shm, size_t size )
+{
+  void *addr;
+
+  if ( size == the_shm->size ) {
+    return 0;
+  }
+
+  if ( the_shm->mmap_count > 0 ) {
+    return EBUSY;
+  }
+
+  if ( size > 0 ) {
+    addr = realloc( the_shm->addr, size );
+    if ( addr == NULL ) {
+      return ENOSPC;
+    }
+
+    if ( size > the_shm->size ) {
+      memset( (char *) addr + the_shm->size, 0, size - the_shm->size );
+    }
+  } else {
+    free( the_shm->addr );
+    addr = NULL;
+  }
+
+  the_shm->addr = addr;
+  the_shm->size = size;
+  the_shm->mtime = time( NULL );
+  the_shm->ctime = the_shm->mtime;
+  return 0;
+}
+
+static int shm_handler_open(
+  rtems_libio_t *iop,
+  const char    *path,
+  int            oflag,
+  mode_t         mode
+)
+{
+  POSIX_Shm_Control *the_shm = shm_get( iop );
+
+  (void) path;
+  (void) oflag;
+  (void) mode;
+
+  _Objects_Allocator_lock();
+  ++the_shm->reference_count;
+  _Objects_Allocator_unlock();
+
+  return 0;
+}
+
+static int shm_handler_close( rtems_libio_t *iop )
+{
+  _Objects_Allocator_lock();
+  _POSIX_Shm_Release( shm_get( iop ) );
+  _Objects_Allocator_unlock();
+
+  return 0;
+}
+
+static ssize_t shm_handler_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  POSIX_Shm_Control *the_shm = shm_get( iop );
+  ssize_t            n;
+
+  _Objects_Allocator_lock();
+
+  if ( iop->offset < (off_t) the_shm->size ) {
+    size_t avail = the_shm->size - (size_t) iop->offset;
+
+    if ( count > avail ) {
+      count = avail;
+    }
+
+    memcpy( buffer, (char *) the_shm->addr + iop->offset, count );
+    iop->offset += count;
+    n = (ssize_t) count;
+  } else {
+    n = 0;
+  }
+
+  the_shm->atime = time( NULL );
+
+  _Objects_Allocator_unlock();
+
+  return n;
+}
+
+static ssize_t shm_handler_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  POSIX_Shm_Control *the_shm = shm_get( iop );
+  off_t              end = iop->offset + (off_t) count;
+  int                eno = 0;
+
+  _Objects_Allocator_lock();
+
+  if ( end > (off_t) the_shm->size ) {
+    eno = shm_resize( the_shm, (size_t) end );
+  }
+
+  if ( eno == 0 ) {
+    memcpy( (char *) the_shm->addr + iop->offset, buffer, count );
+    iop->offset = end;
+    the_shm->mtime = time( NULL );
+    the_shm->ctime = the_shm->mtime;
+  }
+
+  _Objects_Allocator_unlock();
+
+  if ( eno != 0 ) {
+    rtems_set_errno_and_return_minus_one( eno );
+  }
+
+  return (ssize_t) count;
+}
+
+static int shm_handler_ftruncate( rtems_libio_t *iop, off_t length )
+{
+  int eno;
+
+  if ( length < 0 || (uintmax_t) length > SIZE_MAX ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  _Objects_Allocator_lock();
+  eno = shm_resize( shm_get( iop ), (size_t) length );
+  _Objects_Allocator_unlock();
+
+  if ( eno != 0 ) {
+    rtems_set_errno_and_return_minus_one( eno );
+  }
+
+  return 0;
+}
+
+static int shm_handler_fstat(
+  const rtems_filesystem_location_info_t *loc,
+  struct stat                            *buf
+)
+{
+  POSIX_Shm_Control *the_shm = loc->node_access;
+
+  _Objects_Allocator_lock();
+  buf->st_ino = the_shm->Object.id;
+  buf->st_mode = S_IFREG | the_shm->mode;
+  buf->st_nlink = the_shm->linked ? 1 : 0;
+  buf->st_uid = the_shm->uid;
+  buf->st_gid = the_shm->gid;
+  buf->st_size = (off_t) the_shm->size;
+  buf->st_atime = the_shm->atime;
+  buf->st_mtime = the_shm->mtime;
+  buf->st_ctime = the_shm->ctime;
+  _Objects_Allocator_unlock();
+
+  return 0;
+}
+
+static int shm_handler_mmap(
+  rtems_libio_t  *iop,
+  void          **addr,
+  size_t          len,
+  int             prot,
+  off_t           off
+)
+{
+  POSIX_Shm_Control *the_shm = shm_get( iop );
+  int                rv;
+
+  (void) prot;
+
+  _Objects_Allocator_lock();
+
+  if ( off <= (off_t) the_shm->size && len <= the_shm->size - (size_t) off ) {
+    *addr = (char *) the_shm->addr + off;
+    ++the_shm->reference_count;
+    ++the_shm->mmap_count;
+    rv = 0;
+  } else {
+    rv = -1;
+  }
+
+  _Objects_Allocator_unlock();
+
+  if ( rv != 0 ) {
+    errno = ENXIO;
+  }
+
+  return rv;
+}
+
+const rtems_filesystem_file_handlers_r _POSIX_Shm_handlers = {
+  .open_h = shm_handler_open,
+  .close_h = shm_handler_close,
+  .read_h = shm_handler_read,
+  .write_h = shm_handler_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = shm_handler_fstat,
+  .ftruncate_h = shm_handler_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev,
+  .mmap_h = shm_handler_mmap,
+  .munmap_h = rtems_filesystem_default_munmap
+};
+
+static int shm_create(
+  const char          *name_arg,
+  size_t               name_len,
+  mode_t               mode,
+  POSIX_Shm_Control  **the_shm_p
+)
+{
+  POSIX_Shm_Control *the_shm;
+  char              *name;
+
+  name = _Workspace_String_duplicate( name_arg, name_len );
+  if ( name == NULL ) {
+    return ENOSPC;
+  }
+
+  the_shm = _POSIX_Shm_Allocate_unprotected();
+  if ( the_shm == NULL ) {
+    _Workspace_Free( name );
+    return ENFILE;
+  }
+
+  the_shm->reference_count = 0;
+  the_shm->mmap_count = 0;
+  the_shm->linked = true;
+  the_shm->addr = NULL;
+  the_shm->size = 0;
+  the_shm->mode = mode & ~rtems_filesystem_umask & ~S_IFMT;
+  the_shm->uid = geteuid();
+  the_shm->gid = getegid();
+  the_shm->atime = time( NULL );
+  the_shm->mtime = the_shm->atime;
+  the_shm->ctime = the_shm->atime;
+
+  _Objects_Open_string( &_POSIX_Shm_Information, &the_shm->Object, name );
+
+  *the_shm_p = the_shm;
+  return 0;
+}
+
+int shm_open( const char *name, int oflag, mode_t mode )
+{
+  POSIX_Shm_Control         *the_shm;
+  rtems_libio_t             *iop;
+  size_t                     name_len;
+  Objects_Get_by_name_error  error;
+  int                        access;
+  int                        eno;
+
+  if ( ( oflag & O_ACCMODE ) == O_RDWR ) {
+    access = RTEMS_FS_PERMS_READ | RTEMS_FS_PERMS_WRITE;
+  } else if ( ( oflag & O_ACCMODE ) == O_RDONLY ) {
+    access = RTEMS_FS_PERMS_READ;
+  } else {
+    rtems_set_errno_and_return_minus_one( EACCES );
+  }
+
+  iop = rtems_libio_allocate();
+  if ( iop == NULL ) {
+    rtems_set_errno_and_return_minus_one( EMFILE );
+  }
+
+  rtems_filesystem_location_initialize_to_null( &iop->pathinfo );
+
+  _Objects_Allocator_lock();
+  the_shm = _POSIX_Shm_Get_by_name( name, &name_len, &error );
+
+  if ( the_shm == NULL ) {
+    if ( error == OBJECTS_GET_BY_NAME_NO_OBJECT && ( oflag & O_CREAT ) != 0 ) {
+      eno = shm_create( name, name_len, mode, &the_shm );
+    } else {
+      eno = _POSIX_Get_by_name_error( error );
+    }
+  } else if ( ( oflag & ( O_CREAT | O_EXCL ) ) == ( O_CREAT | O_EXCL ) ) {
+    eno = EEXIST;
+  } else if (
+    !rtems_filesystem_check_access(
+      access,
+      the_shm->mode,
+      the_shm->uid,
+      the_shm->gid
+    )
+  ) {
+    eno = EACCES;
+  } else if (
+    ( oflag & O_TRUNC ) != 0 && ( oflag & O_ACCMODE ) == O_RDWR
+  ) {
+    eno = shm_resize( the_shm, 0 );
+  } else {
+    eno = 0;
+  }
+
+  if ( eno == 0 ) {
+    ++the_shm->reference_count;
+  }
+
+  _Objects_Allocator_unlock();
+
+  if ( eno != 0 ) {
+    rtems_libio_free( iop );
+    rtems_set_errno_and_return_minus_one( eno );
+  }
+
+  iop->flags |= rtems_libio_fcntl_flags( oflag & O_ACCMODE );
+  iop->pathinfo.node_access = the_shm;
+  iop->pathinfo.handlers = &_POSIX_Shm_handlers;
+
+  return rtems_libio_iop_to_descriptor( iop );
+}
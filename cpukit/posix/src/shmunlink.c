@@ -0,0 +1,47 @@
+/**
+ * @file
+ *
+ * @brief Remove a Shared Memory Object
+ * @ingroup POSIXShmPrivate
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/mman.h>
+
+#include <rtems/posix/shmimpl.h>
+#include <rtems/seterr.h>
+
+int shm_unlink( const char *name )
+{
+  POSIX_Shm_Control         *the_shm;
+  Objects_Get_by_name_error  error;
+
+  _Objects_Allocator_lock();
+
+  the_shm = _POSIX_Shm_Get_by_name( name, NULL, &error );
+  if ( the_shm == NULL ) {
+    _Objects_Allocator_unlock();
+    rtems_set_errno_and_return_minus_one( _POSIX_Get_by_name_error( error ) );
+  }
+
+  _POSIX_Shm_Namespace_remove( the_shm );
+  the_shm->linked = false;
+
+  /* Take a temporary reference to delete an unreferenced object */
+  ++the_shm->reference_count;
+  _POSIX_Shm_Release( the_shm );
+
+  _Objects_Allocator_unlock();
+  return 0;
+}
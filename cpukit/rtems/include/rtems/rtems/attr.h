@@ -153,6 +153,18 @@ typedef uint32_t   rtems_attribute;
  */
 #define RTEMS_MULTIPROCESSOR_RESOURCE_SHARING 0x00000100
 
+/******************* RTEMS Partition Specific Attributes *******************/
+
+/**
+ *  This attribute constant indicates that the Classic API Partition instance
+ *  created will use a buffer cache for each processor.
+ *
+ *  Buffers are allocated from and returned to the cache of the current
+ *  processor without acquiring the partition lock.  The partition lock is
+ *  only used to move a batch of buffers between a cache and the partition.
+ */
+#define RTEMS_PARTITION_PER_PROCESSOR_CACHE 0x00000200
+
 /******************** RTEMS Barrier Specific Attributes ********************/
 
 /**
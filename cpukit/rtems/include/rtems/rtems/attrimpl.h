@@ -225,6 +225,20 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_multiprocessor_resource_sharing(
   return ( attribute_set & RTEMS_MULTIPROCESSOR_RESOURCE_SHARING ) != 0;
 }
 
+/**
+ *  @brief Checks if the partition per-processor cache attribute
+ *  is enabled in the attribute_set
+ *
+ *  This function returns TRUE if the partition per-processor cache attribute
+ *  is enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_partition_per_processor_cache(
+  rtems_attribute attribute_set
+)
+{
+  return ( attribute_set & RTEMS_PARTITION_PER_PROCESSOR_CACHE ) != 0;
+}
+
 /**
  *  @brief Checks if the barrier automatic release
  *  attribute is enabled in the attribute_set
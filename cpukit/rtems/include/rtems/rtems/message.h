@@ -126,11 +126,13 @@ rtems_status_code rtems_message_queue_ident(
  * @brief RTEMS Delete Message Queue
  *
  * This routine implements the rtems_message_queue_delete directive. The
- * message queue indicated by ID is deleted.
+ * message queue indicated by ID is deleted.  A message queue with message
+ * buffers loaned to tasks cannot be deleted.
  *
  * @param[in] id is the queue id
  *
  * @retval RTEMS_SUCCESSFUL if successful or error code if unsuccessful
+ * @retval RTEMS_RESOURCE_IN_USE Message buffers are loaned to tasks.
  */
 rtems_status_code rtems_message_queue_delete(
   rtems_id id
@@ -260,6 +262,109 @@ rtems_status_code rtems_message_queue_get_number_pending(
   uint32_t *count
 );
 
+/**
+ * @brief RTEMS Message Queue Get Buffer
+ *
+ * This routine implements the rtems_message_queue_get_buffer directive.
+ * This directive loans an inactive message buffer of the message queue
+ * indicated by ID to the calling task.  The task may fill in the message
+ * buffer and send it via rtems_message_queue_send_ref() without a copy of the
+ * message content, or give it back via rtems_message_queue_return_buffer().
+ *
+ * @param[in] id is the queue id
+ * @param[out] buffer is the pointer to the loaned message buffer
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The buffer pointer is NULL.
+ * @retval RTEMS_INVALID_ID Invalid message queue identifier.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote queues.
+ * @retval RTEMS_UNSATISFIED No inactive message buffer is available.
+ */
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+
+/**
+ * @brief RTEMS Message Queue Return Buffer
+ *
+ * This routine implements the rtems_message_queue_return_buffer directive.
+ * This directive returns a message buffer obtained by
+ * rtems_message_queue_get_buffer() or rtems_message_queue_receive_ref() to
+ * the inactive message buffers of the message queue indicated by ID.
+ *
+ * @param[in] id is the queue id
+ * @param[in] buffer is the loaned message buffer
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The buffer is no loaned message buffer of
+ *   this message queue.
+ * @retval RTEMS_INVALID_ID Invalid message queue identifier.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote queues.
+ */
+rtems_status_code rtems_message_queue_return_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+
+/**
+ * @brief RTEMS Message Queue Send by Reference
+ *
+ * This routine implements the rtems_message_queue_send_ref directive.
+ * This directive sends a message buffer obtained by
+ * rtems_message_queue_get_buffer() or rtems_message_queue_receive_ref() to
+ * the message queue indicated by ID.  The message buffer is handed over to
+ * the message queue without a copy of the message content.  The calling task
+ * must not use the message buffer afterwards.  A task waiting in
+ * rtems_message_queue_receive() receives a copy of the message content.
+ *
+ * @param[in] id is the queue id
+ * @param[in] buffer is the loaned message buffer
+ * @param[in] size is the size of the message content
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The buffer is no loaned message buffer of
+ *   this message queue.
+ * @retval RTEMS_INVALID_ID Invalid message queue identifier.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote queues.
+ * @retval RTEMS_INVALID_SIZE The size exceeds the maximum message size, the
+ *   message buffer is still owned by the calling task in this case.
+ */
+rtems_status_code rtems_message_queue_send_ref(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+
+/**
+ * @brief RTEMS Message Queue Receive by Reference
+ *
+ * This routine implements the rtems_message_queue_receive_ref directive.
+ * This directive is invoked when the calling task wishes to receive a
+ * message from the message queue indicated by ID without a copy of the
+ * message content.  The message buffer is loaned to the calling task and
+ * must be returned via rtems_message_queue_return_buffer() or sent again via
+ * rtems_message_queue_send_ref().  The blocking behaviour is the same as for
+ * rtems_message_queue_receive().
+ *
+ * @param[in] id is the queue id
+ * @param[out] buffer is the pointer to the loaned message buffer
+ * @param[out] size is the size of the message content
+ * @param[in] option_set is the options on receive
+ * @param[in] timeout is the number of ticks to wait
+ *
+ * @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code rtems_message_queue_receive_ref(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -18,6 +18,7 @@
  * - delete a partition
  * - get a buffer from a partition
  * - return a buffer to a partition
+ * - get the statistics of a per-processor buffer cache of a partition
  */
 
 /* COPYRIGHT (c) 1989-2008.
@@ -50,6 +51,73 @@ extern "C" {
  */
 /**@{*/
 
+/**
+ *  @brief The maximum count of buffers in a per-processor buffer cache of a
+ *  partition.
+ *
+ *  An empty cache is refilled and a full cache is flushed by half of this
+ *  count with one acquire of the partition lock.
+ */
+#define PARTITION_CACHE_CAPACITY 16
+
+/**
+ *  @brief Statistics of a per-processor buffer cache of a partition.
+ *
+ *  @see rtems_partition_get_cache_statistics().
+ */
+typedef struct {
+  /**
+   *  @brief Count of buffers currently held by the cache.
+   */
+  uint32_t cached_buffers;
+
+  /**
+   *  @brief Count of buffer allocations satisfied by the cache.
+   */
+  uint32_t get_hits;
+
+  /**
+   *  @brief Count of buffer allocations which had to refill the cache from
+   *  the partition.
+   */
+  uint32_t get_refills;
+
+  /**
+   *  @brief Count of buffer returns absorbed by the cache.
+   */
+  uint32_t return_hits;
+
+  /**
+   *  @brief Count of buffer returns which had to flush the cache to the
+   *  partition.
+   */
+  uint32_t return_flushes;
+} rtems_partition_cache_statistics;
+
+/**
+ *  @brief A per-processor buffer cache of a partition.
+ *
+ *  The cache is protected by its own lock.  In the common case only its
+ *  processor acquires this lock, so it is not contended.  The partition lock
+ *  may be acquired while the cache lock is owned, but not vice versa.  Each
+ *  cache starts on its own cache line to avoid false sharing.
+ */
+typedef struct {
+  /** This field is the lock of the cache. */
+  ISR_LOCK_MEMBER(                  Lock )
+  /** This field is the count of buffers in the cache. */
+  uint32_t                          count;
+  /**
+   * This field is true, if the cache is disabled.  A disabled cache is empty
+   * and the directives use the partition lock instead.
+   */
+  bool                              disabled;
+  /** This field is the stack of cached buffers. */
+  void                             *buffers[ PARTITION_CACHE_CAPACITY ];
+  /** This field contains the statistics of the cache. */
+  rtems_partition_cache_statistics  Statistics;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Partition_Cache;
+
 /**
  *  The following defines the control block used to manage each partition.
  */
@@ -70,6 +138,11 @@ typedef struct {
   uint32_t            number_of_used_blocks;
   /** This field is the chain used to manage unallocated buffers. */
   Chain_Control       Memory;
+  /**
+   * This field is the table of per-processor buffer caches indexed by the
+   * processor index, or NULL if the partition uses no buffer caches.
+   */
+  Partition_Cache    *Caches;
 }   Partition_Control;
 
 /**
@@ -82,8 +155,9 @@ typedef struct {
  *  the partition is of length bytes and starts at starting_address.
  *  The memory area will be divided into as many buffers of
  *  buffer_size bytes as possible.   The attribute_set determines if
- *  the partition is global or local.  It returns the id of the
- *  created partition in ID.
+ *  the partition is global or local and if it uses per-processor buffer
+ *  caches, see RTEMS_PARTITION_PER_PROCESSOR_CACHE.  It returns the id of
+ *  the created partition in ID.
  */
 rtems_status_code rtems_partition_create(
   rtems_name       name,
@@ -164,6 +238,33 @@ rtems_status_code rtems_partition_return_buffer(
   void     *buffer
 );
 
+/**
+ * @brief RTEMS Get Partition Cache Statistics
+ *
+ * This routine implements the rtems_partition_get_cache_statistics
+ * directive.  It returns the statistics of the buffer cache of the processor
+ * with index cpu_index of the partition associated with ID.  The statistics
+ * of other processors are a snapshot, since these processors may use their
+ * caches concurrently.
+ *
+ * @param[in] id is the partition id
+ * @param[in] cpu_index is the index of the processor
+ * @param[out] statistics is the pointer to the statistics
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The statistics pointer is NULL.
+ * @retval RTEMS_INVALID_ID Invalid partition identifier.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote partitions.
+ * @retval RTEMS_NOT_DEFINED The partition uses no per-processor buffer
+ *   caches.
+ * @retval RTEMS_INVALID_NUMBER Invalid processor index.
+ */
+rtems_status_code rtems_partition_get_cache_statistics(
+  rtems_id                          id,
+  uint32_t                          cpu_index,
+  rtems_partition_cache_statistics *statistics
+);
+
 /**@}*/
 
 #ifdef __cplusplus
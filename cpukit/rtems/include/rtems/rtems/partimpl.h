@@ -20,6 +20,12 @@
 #include <rtems/rtems/part.h>
 #include <rtems/score/chainimpl.h>
 #include <rtems/score/objectimpl.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smp.h>
+#if defined(RTEMS_SMP)
+#include <rtems/score/smpimpl.h>
+#endif
+#include <rtems/score/wkspace.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -66,6 +72,206 @@ RTEMS_INLINE_ROUTINE void _Partition_Free_buffer (
   _Chain_Append_unprotected( &the_partition->Memory, the_buffer );
 }
 
+RTEMS_INLINE_ROUTINE void _Partition_Acquire_critical(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+)
+{
+  _ISR_lock_Acquire( &the_partition->Lock, lock_context );
+}
+
+RTEMS_INLINE_ROUTINE void _Partition_Release(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &the_partition->Lock, lock_context );
+}
+
+/**
+ *  @brief Returns the buffer cache of the current processor.
+ *
+ *  The partition must use per-processor buffer caches.  Interrupts must be
+ *  disabled.
+ */
+RTEMS_INLINE_ROUTINE Partition_Cache *_Partition_Get_cache(
+  const Partition_Control *the_partition
+)
+{
+  return &the_partition->Caches[ _Per_CPU_Get_index( _Per_CPU_Get() ) ];
+}
+
+RTEMS_INLINE_ROUTINE void _Partition_Cache_acquire_critical(
+  Partition_Cache  *the_cache,
+  ISR_lock_Context *lock_context
+)
+{
+  _ISR_lock_Acquire( &the_cache->Lock, lock_context );
+}
+
+RTEMS_INLINE_ROUTINE void _Partition_Cache_release_critical(
+  Partition_Cache  *the_cache,
+  ISR_lock_Context *lock_context
+)
+{
+  _ISR_lock_Release( &the_cache->Lock, lock_context );
+}
+
+/**
+ *  @brief Refills the_cache with buffers of the_partition.
+ *
+ *  This routine moves up to half of the cache capacity buffers from
+ *  the_partition to the empty the_cache.  The cache lock must be owned.
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Refill_cache(
+  Partition_Control *the_partition,
+  Partition_Cache   *the_cache
+)
+{
+  ISR_lock_Context lock_context;
+  uint32_t         count;
+
+  count = 0;
+  _Partition_Acquire_critical( the_partition, &lock_context );
+
+  while ( count < PARTITION_CACHE_CAPACITY / 2 ) {
+    void *the_buffer;
+
+    the_buffer = _Partition_Allocate_buffer( the_partition );
+    if ( the_buffer == NULL ) {
+      break;
+    }
+
+    the_cache->buffers[ count ] = the_buffer;
+    ++count;
+  }
+
+  the_cache->count = count;
+  the_partition->number_of_used_blocks += count;
+  _ISR_lock_Release( &the_partition->Lock, &lock_context );
+}
+
+/**
+ *  @brief Flushes count buffers of the_cache to the_partition.
+ *
+ *  The cache lock must be owned.
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Flush_cache(
+  Partition_Control *the_partition,
+  Partition_Cache   *the_cache,
+  uint32_t           count
+)
+{
+  ISR_lock_Context lock_context;
+
+  _Partition_Acquire_critical( the_partition, &lock_context );
+  the_cache->count -= count;
+  the_partition->number_of_used_blocks -= count;
+
+  while ( count > 0 ) {
+    --count;
+    _Partition_Free_buffer(
+      the_partition,
+      the_cache->buffers[ the_cache->count + count ]
+    );
+  }
+
+  _ISR_lock_Release( &the_partition->Lock, &lock_context );
+}
+
+/**
+ *  @brief Disables all buffer caches of the_partition.
+ *
+ *  Each cache is flushed completely to the_partition.  Afterwards, the
+ *  directives use the partition lock instead of the caches.  Interrupts must
+ *  be disabled and the partition lock must not be owned.
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Disable_caches(
+  Partition_Control *the_partition
+)
+{
+  uint32_t cpu_count;
+  uint32_t cpu_index;
+
+  cpu_count = _SMP_Get_processor_count();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    Partition_Cache  *the_cache;
+    ISR_lock_Context  lock_context;
+
+    the_cache = &the_partition->Caches[ cpu_index ];
+    _Partition_Cache_acquire_critical( the_cache, &lock_context );
+    _Partition_Flush_cache( the_partition, the_cache, the_cache->count );
+    the_cache->disabled = true;
+    _Partition_Cache_release_critical( the_cache, &lock_context );
+  }
+}
+
+/**
+ *  @brief Enables all buffer caches of the_partition.
+ *
+ *  Interrupts must be disabled.
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Enable_caches(
+  Partition_Control *the_partition
+)
+{
+  uint32_t cpu_count;
+  uint32_t cpu_index;
+
+  cpu_count = _SMP_Get_processor_count();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    Partition_Cache  *the_cache;
+    ISR_lock_Context  lock_context;
+
+    the_cache = &the_partition->Caches[ cpu_index ];
+    _Partition_Cache_acquire_critical( the_cache, &lock_context );
+    the_cache->disabled = false;
+    _Partition_Cache_release_critical( the_cache, &lock_context );
+  }
+}
+
+/**
+ *  @brief Returns the count of buffers of the_partition in use.
+ *
+ *  The buffers held by the per-processor buffer caches are not in use.  The
+ *  cache locks and the partition lock are acquired one at a time, so the
+ *  count is only approximate while buffers are concurrently allocated or
+ *  freed.  Interrupts must be enabled.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Partition_Get_used_blocks(
+  Partition_Control *the_partition
+)
+{
+  uint32_t         cpu_count;
+  uint32_t         cpu_index;
+  ISR_lock_Context lock_context;
+  uint32_t         cached_blocks;
+  uint32_t         used_blocks;
+
+  cpu_count = the_partition->Caches != NULL ? _SMP_Get_processor_count() : 0;
+  cached_blocks = 0;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    Partition_Cache *the_cache;
+
+    the_cache = &the_partition->Caches[ cpu_index ];
+    _ISR_lock_ISR_disable( &lock_context );
+    _Partition_Cache_acquire_critical( the_cache, &lock_context );
+    cached_blocks += the_cache->count;
+    _Partition_Cache_release_critical( the_cache, &lock_context );
+    _ISR_lock_ISR_enable( &lock_context );
+  }
+
+  _ISR_lock_ISR_disable( &lock_context );
+  _Partition_Acquire_critical( the_partition, &lock_context );
+  used_blocks = the_partition->number_of_used_blocks;
+  _Partition_Release( the_partition, &lock_context );
+
+  return used_blocks > cached_blocks ? used_blocks - cached_blocks : 0;
+}
+
 /**
  *  @brief Checks whether is on a valid buffer boundary for the_partition.
  *
@@ -141,7 +347,8 @@ RTEMS_INLINE_ROUTINE void _Partition_Initialize(
   void              *starting_address,
   uint32_t           length,
   uint32_t           buffer_size,
-  rtems_attribute    attribute_set
+  rtems_attribute    attribute_set,
+  Partition_Cache   *caches
 )
 {
   the_partition->starting_address      = starting_address;
@@ -149,6 +356,7 @@ RTEMS_INLINE_ROUTINE void _Partition_Initialize(
   the_partition->buffer_size           = buffer_size;
   the_partition->attribute_set         = attribute_set;
   the_partition->number_of_used_blocks = 0;
+  the_partition->Caches                = caches;
 
   _Chain_Initialize(
     &the_partition->Memory,
@@ -158,13 +366,62 @@ RTEMS_INLINE_ROUTINE void _Partition_Initialize(
   );
 
   _ISR_lock_Initialize( &the_partition->Lock, "Partition" );
+
+  if ( caches != NULL ) {
+    uint32_t cpu_count;
+    uint32_t cpu_index;
+
+    cpu_count = _SMP_Get_processor_count();
+
+    for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+      _ISR_lock_Initialize( &caches[ cpu_index ].Lock, "Partition Cache" );
+    }
+  }
 }
 
+#if defined(RTEMS_SMP)
+RTEMS_INLINE_ROUTINE void _Partition_Synchronize_action( void *arg )
+{
+  (void) arg;
+}
+#endif
+
+/**
+ *  @brief Destroys the_partition.
+ *
+ *  The partition must be closed and its buffer caches must be disabled.  In
+ *  SMP configurations, other processors may still use the buffer caches in
+ *  the interrupt disabled section which began before the object was closed.
+ *  A multicast action waits until every processor left this section before
+ *  the caches are freed.
+ */
 RTEMS_INLINE_ROUTINE void _Partition_Destroy(
   Partition_Control *the_partition
 )
 {
+  Partition_Cache *caches;
+
   _ISR_lock_Destroy( &the_partition->Lock );
+
+  caches = the_partition->Caches;
+
+  if ( caches != NULL ) {
+    uint32_t cpu_count;
+    uint32_t cpu_index;
+
+#if defined(RTEMS_SMP)
+    _SMP_Multicast_action( 0, NULL, _Partition_Synchronize_action, NULL );
+#endif
+
+    cpu_count = _SMP_Get_processor_count();
+
+    for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+      _ISR_lock_Destroy( &caches[ cpu_index ].Lock );
+    }
+
+    the_partition->Caches = NULL;
+    _Workspace_Free( caches );
+  }
 }
 
 /**
@@ -193,22 +450,6 @@ RTEMS_INLINE_ROUTINE Partition_Control *_Partition_Get(
   );
 }
 
-RTEMS_INLINE_ROUTINE void _Partition_Acquire_critical(
-  Partition_Control *the_partition,
-  ISR_lock_Context  *lock_context
-)
-{
-  _ISR_lock_Acquire( &the_partition->Lock, lock_context );
-}
-
-RTEMS_INLINE_ROUTINE void _Partition_Release(
-  Partition_Control *the_partition,
-  ISR_lock_Context  *lock_context
-)
-{
-  _ISR_lock_Release_and_ISR_enable( &the_partition->Lock, lock_context );
-}
-
 /**@}*/
 
 #ifdef __cplusplus
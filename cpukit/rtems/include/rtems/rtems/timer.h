@@ -322,6 +322,11 @@ rtems_status_code rtems_timer_reset(
  *  This directive creates and starts the server for task-based timers.
  *  It must be invoked before any task-based timers can be initiated.
  *
+ *  In case the attribute set contains RTEMS_TIMER_SERVER_PER_PROCESSOR, then
+ *  one timer server is created for each processor.  A task-based timer is
+ *  serviced by the timer server of the processor which most recently fired
+ *  or reset the timer.
+ *
  *  @param priority The timer server task priority.
  *  @param stack_size The stack size in bytes for the timer server task.
  *  @param attribute_set The timer server task attributes.
@@ -342,6 +347,16 @@ rtems_status_code rtems_timer_initiate_server(
  */
 #define RTEMS_TIMER_SERVER_DEFAULT_PRIORITY (uint32_t) -1
 
+/**
+ *  This attribute requests one timer server for each processor from
+ *  rtems_timer_initiate_server().  Each timer server task is moved to the
+ *  scheduler instance owning its processor.  In case this scheduler instance
+ *  supports thread to processor affinities, then the timer server task
+ *  executes only on its processor.  On uni-processor configurations this
+ *  attribute has no effect.
+ */
+#define RTEMS_TIMER_SERVER_PER_PROCESSOR 0x00010000
+
 /**
  *  This is the structure filled in by the timer get information
  *  service.
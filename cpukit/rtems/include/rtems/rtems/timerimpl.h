@@ -43,6 +43,18 @@ typedef struct Timer_server_Control {
   Chain_Control Pending;
 
   Objects_Id server_id;
+
+#if defined(RTEMS_SMP)
+  /**
+   * @brief The count of timer servers in the timer server array starting
+   * with this timer server.
+   *
+   * This value is only valid for the default timer server.  It is the
+   * processor count in case the timer servers were initiated with
+   * RTEMS_TIMER_SERVER_PER_PROCESSOR, otherwise it is one.
+   */
+  uint32_t count;
+#endif
 } Timer_server_Control;
 
 /**
@@ -101,8 +113,22 @@ RTEMS_INLINE_ROUTINE Per_CPU_Control *_Timer_Acquire_critical(
 {
   Per_CPU_Control *cpu;
 
+#if defined(RTEMS_SMP)
+  while ( true ) {
+    cpu = _Watchdog_Get_CPU( &the_timer->Ticker );
+    _Watchdog_Per_CPU_acquire_critical( cpu, lock_context );
+
+    /* The timer may have moved to another processor in the meantime */
+    if ( cpu == _Watchdog_Get_CPU( &the_timer->Ticker ) ) {
+      break;
+    }
+
+    _Watchdog_Per_CPU_release_critical( cpu, lock_context );
+  }
+#else
   cpu = _Watchdog_Get_CPU( &the_timer->Ticker );
   _Watchdog_Per_CPU_acquire_critical( cpu, lock_context );
+#endif
 
   return cpu;
 }
@@ -179,10 +205,78 @@ rtems_status_code _Timer_Fire_when(
 
 void _Timer_Cancel( Per_CPU_Control *cpu, Timer_Control *the_timer );
 
+/**
+ * @brief Cancels the timer and moves it to the current processor.
+ *
+ * The timer is re-armed on the processor of the caller, so that its watchdog
+ * fires and its task-based service routine executes there.  Interrupts must
+ * be disabled.
+ *
+ * @param[in] cpu The processor of the timer returned by
+ *   _Timer_Acquire_critical().
+ * @param[in] the_timer The timer.
+ * @param[in] lock_context The lock context.
+ *
+ * @return The current processor.  Its watchdog lock is acquired instead of
+ *   the one of @a cpu.
+ */
+RTEMS_INLINE_ROUTINE Per_CPU_Control *_Timer_Cancel_and_move(
+  Per_CPU_Control  *cpu,
+  Timer_Control    *the_timer,
+  ISR_lock_Context *lock_context
+)
+{
+  _Timer_Cancel( cpu, the_timer );
+
+#if defined(RTEMS_SMP)
+  while ( cpu != _Per_CPU_Get() ) {
+    _Watchdog_Set_CPU( &the_timer->Ticker, _Per_CPU_Get() );
+    _Watchdog_Per_CPU_release_critical( cpu, lock_context );
+
+    /* Another processor may use the timer until we own it again */
+    cpu = _Timer_Acquire_critical( the_timer, lock_context );
+    _Timer_Cancel( cpu, the_timer );
+  }
+#endif
+
+  return cpu;
+}
+
 void _Timer_Routine_adaptor( Watchdog_Control *the_watchdog );
 
 void _Timer_server_Routine_adaptor( Watchdog_Control *the_watchdog );
 
+/**
+ * @brief Returns the timer server responsible for the task-based timers of
+ * the specified processor.
+ *
+ * The watchdog of a timer fires on the processor which armed it, so this is
+ * the processor of the timer watchdog and the processor executing the
+ * watchdog service routine.
+ *
+ * @param[in] timer_server The default timer server.
+ * @param[in] cpu The processor which fires the timer.
+ */
+RTEMS_INLINE_ROUTINE Timer_server_Control *_Timer_server_Get(
+  Timer_server_Control  *timer_server,
+  const Per_CPU_Control *cpu
+)
+{
+#if defined(RTEMS_SMP)
+  uint32_t cpu_index;
+
+  cpu_index = _Per_CPU_Get_index( cpu );
+
+  if ( cpu_index < timer_server->count ) {
+    return &timer_server[ cpu_index ];
+  }
+#else
+  (void) cpu;
+#endif
+
+  return timer_server;
+}
+
 RTEMS_INLINE_ROUTINE void _Timer_server_Acquire_critical(
   Timer_server_Control *timer_server,
   ISR_lock_Context     *lock_context
@@ -48,6 +48,15 @@ rtems_status_code rtems_message_queue_delete(
     &queue_context
   );
 
+  if ( the_message_queue->message_queue.number_of_loaned_messages != 0 ) {
+    _CORE_message_queue_Release(
+      &the_message_queue->message_queue,
+      &queue_context
+    );
+    _Objects_Allocator_unlock();
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
   _Objects_Close( &_Message_queue_Information, &the_message_queue->Object );
 
   _Thread_queue_Context_set_MP_callout(
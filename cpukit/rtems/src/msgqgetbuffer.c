@@ -0,0 +1,73 @@
+/**
+ * @file
+ *
+ * @brief RTEMS Message Queue Get Buffer
+ * @ingroup ClassicMessageQueue
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/messageimpl.h>
+
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+)
+{
+  Message_queue_Control             *the_message_queue;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+
+  if ( buffer == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  the_message_queue = _Message_queue_Get( id, &queue_context );
+
+  if ( the_message_queue == NULL ) {
+#if defined(RTEMS_MULTIPROCESSING)
+    if ( _Message_queue_MP_Is_remote( id ) ) {
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+    }
+#endif
+
+    return RTEMS_INVALID_ID;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+  the_message = _CORE_message_queue_Allocate_message_buffer(
+    &the_message_queue->message_queue
+  );
+
+  if ( the_message != NULL ) {
+    _CORE_message_queue_Loan_message_buffer(
+      &the_message_queue->message_queue,
+      the_message
+    );
+  }
+
+  _CORE_message_queue_Release(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+
+  if ( the_message == NULL ) {
+    return RTEMS_UNSATISFIED;
+  }
+
+  *buffer = the_message->Contents.buffer;
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file
+ *
+ * @brief RTEMS Message Queue Receive by Reference
+ * @ingroup ClassicMessageQueue
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/messageimpl.h>
+#include <rtems/rtems/optionsimpl.h>
+#include <rtems/rtems/statusimpl.h>
+
+rtems_status_code rtems_message_queue_receive_ref(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+)
+{
+  Message_queue_Control             *the_message_queue;
+  Thread_queue_Context               queue_context;
+  Thread_Control                    *executing;
+  CORE_message_queue_Buffer_control *the_message;
+  Status_Control                     status;
+
+  if ( buffer == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( size == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  the_message_queue = _Message_queue_Get( id, &queue_context );
+
+  if ( the_message_queue == NULL ) {
+#if defined(RTEMS_MULTIPROCESSING)
+    if ( _Message_queue_MP_Is_remote( id ) ) {
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+    }
+#endif
+
+    return RTEMS_INVALID_ID;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+
+  executing = _Thread_Executing;
+  _Thread_queue_Context_set_relative_timeout( &queue_context, timeout );
+  status = _CORE_message_queue_Seize_loan(
+    &the_message_queue->message_queue,
+    executing,
+    &the_message,
+    !_Options_Is_no_wait( option_set ),
+    &queue_context
+  );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    *buffer = the_message->Contents.buffer;
+    *size = the_message->Contents.size;
+  }
+
+  return _Status_Get( status );
+}
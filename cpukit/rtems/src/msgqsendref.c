@@ -0,0 +1,81 @@
+/**
+ * @file
+ *
+ * @brief RTEMS Message Queue Send by Reference
+ * @ingroup ClassicMessageQueue
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/messageimpl.h>
+#include <rtems/rtems/statusimpl.h>
+
+rtems_status_code rtems_message_queue_send_ref(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+)
+{
+  Message_queue_Control             *the_message_queue;
+  Thread_queue_Context               queue_context;
+  CORE_message_queue_Buffer_control *the_message;
+  Status_Control                     status;
+
+  the_message_queue = _Message_queue_Get( id, &queue_context );
+
+  if ( the_message_queue == NULL ) {
+#if defined(RTEMS_MULTIPROCESSING)
+    if ( _Message_queue_MP_Is_remote( id ) ) {
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+    }
+#endif
+
+    return RTEMS_INVALID_ID;
+  }
+
+  the_message = _CORE_message_queue_Get_message_buffer(
+    &the_message_queue->message_queue,
+    buffer
+  );
+
+  if ( the_message == NULL ) {
+    _ISR_lock_ISR_enable( &queue_context.Lock_context );
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+
+  if ( !_CORE_message_queue_Is_message_buffer_loaned( the_message ) ) {
+    _CORE_message_queue_Release(
+      &the_message_queue->message_queue,
+      &queue_context
+    );
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  _Thread_queue_Context_set_MP_callout(
+    &queue_context,
+    _Message_queue_Core_message_queue_mp_support
+  );
+  status = _CORE_message_queue_Submit_loan(
+    &the_message_queue->message_queue,
+    the_message,
+    size,
+    CORE_MESSAGE_QUEUE_SEND_REQUEST,
+    &queue_context
+  );
+  return _Status_Get( status );
+}
@@ -24,6 +24,8 @@
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/sysstate.h>
 
+#include <string.h>
+
 /*
  *  rtems_partition_create
  *
@@ -54,6 +56,7 @@ rtems_status_code rtems_partition_create(
 )
 {
   Partition_Control *the_partition;
+  Partition_Cache   *caches;
 
   if ( !rtems_is_name_valid( name ) )
     return RTEMS_INVALID_NAME;
@@ -84,10 +87,28 @@ rtems_status_code rtems_partition_create(
     return RTEMS_TOO_MANY;
   }
 
+  if ( _Attributes_Is_partition_per_processor_cache( attribute_set ) ) {
+    size_t size;
+
+    size = _SMP_Get_processor_count() * sizeof( *caches );
+    caches = _Workspace_Allocate_aligned( size, CPU_CACHE_LINE_BYTES );
+
+    if ( caches == NULL ) {
+      _Partition_Free( the_partition );
+      _Objects_Allocator_unlock();
+      return RTEMS_UNSATISFIED;
+    }
+
+    memset( caches, 0, size );
+  } else {
+    caches = NULL;
+  }
+
 #if defined(RTEMS_MULTIPROCESSING)
   if ( _Attributes_Is_global( attribute_set ) &&
        !( _Objects_MP_Allocate_and_open( &_Partition_Information, name,
                             the_partition->Object.id, false ) ) ) {
+    _Workspace_Free( caches );
     _Partition_Free( the_partition );
     _Objects_Allocator_unlock();
     return RTEMS_TOO_MANY;
@@ -99,7 +120,8 @@ rtems_status_code rtems_partition_create(
     starting_address,
     length,
     buffer_size,
-    attribute_set
+    attribute_set,
+    caches
   );
 
   _Objects_Open(
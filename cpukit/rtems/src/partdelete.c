@@ -43,10 +43,20 @@ rtems_status_code rtems_partition_delete(
     return RTEMS_INVALID_ID;
   }
 
+  if ( the_partition->Caches != NULL ) {
+    _Partition_Disable_caches( the_partition );
+  }
+
   _Partition_Acquire_critical( the_partition, &lock_context );
 
   if ( the_partition->number_of_used_blocks != 0 ) {
-    _Partition_Release( the_partition, &lock_context );
+    _ISR_lock_Release( &the_partition->Lock, &lock_context );
+
+    if ( the_partition->Caches != NULL ) {
+      _Partition_Enable_caches( the_partition );
+    }
+
+    _ISR_lock_ISR_enable( &lock_context );
     _Objects_Allocator_unlock();
     return RTEMS_RESOURCE_IN_USE;
   }
@@ -20,6 +20,34 @@
 
 #include <rtems/rtems/partimpl.h>
 
+static rtems_status_code _Partition_Get_cached_buffer(
+  Partition_Control *the_partition,
+  Partition_Cache   *the_cache,
+  ISR_lock_Context  *lock_context,
+  void             **buffer
+)
+{
+  if ( the_cache->count > 0 ) {
+    ++the_cache->Statistics.get_hits;
+  } else {
+    _Partition_Refill_cache( the_partition, the_cache );
+
+    if ( the_cache->count == 0 ) {
+      _Partition_Cache_release_critical( the_cache, lock_context );
+      _ISR_lock_ISR_enable( lock_context );
+      return RTEMS_UNSATISFIED;
+    }
+
+    ++the_cache->Statistics.get_refills;
+  }
+
+  --the_cache->count;
+  *buffer = the_cache->buffers[ the_cache->count ];
+  _Partition_Cache_release_critical( the_cache, lock_context );
+  _ISR_lock_ISR_enable( lock_context );
+  return RTEMS_SUCCESSFUL;
+}
+
 rtems_status_code rtems_partition_get_buffer(
   rtems_id   id,
   void     **buffer
@@ -43,6 +71,24 @@ rtems_status_code rtems_partition_get_buffer(
 #endif
   }
 
+  if ( the_partition->Caches != NULL ) {
+    Partition_Cache *the_cache;
+
+    the_cache = _Partition_Get_cache( the_partition );
+    _Partition_Cache_acquire_critical( the_cache, &lock_context );
+
+    if ( !the_cache->disabled ) {
+      return _Partition_Get_cached_buffer(
+        the_partition,
+        the_cache,
+        &lock_context,
+        buffer
+      );
+    }
+
+    _Partition_Cache_release_critical( the_cache, &lock_context );
+  }
+
   _Partition_Acquire_critical( the_partition, &lock_context );
   the_buffer = _Partition_Allocate_buffer( the_partition );
 
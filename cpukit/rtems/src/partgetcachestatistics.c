@@ -0,0 +1,65 @@
+/**
+ * @file
+ *
+ * @brief RTEMS Get Partition Cache Statistics
+ * @ingroup ClassicPart
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/partimpl.h>
+
+rtems_status_code rtems_partition_get_cache_statistics(
+  rtems_id                          id,
+  uint32_t                          cpu_index,
+  rtems_partition_cache_statistics *statistics
+)
+{
+  Partition_Control *the_partition;
+  ISR_lock_Context   lock_context;
+  Partition_Cache   *the_cache;
+
+  if ( statistics == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  the_partition = _Partition_Get( id, &lock_context );
+
+  if ( the_partition == NULL ) {
+#if defined(RTEMS_MULTIPROCESSING)
+    if ( _Partition_MP_Is_remote( id ) ) {
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+    }
+#endif
+
+    return RTEMS_INVALID_ID;
+  }
+
+  if ( the_partition->Caches == NULL ) {
+    _ISR_lock_ISR_enable( &lock_context );
+    return RTEMS_NOT_DEFINED;
+  }
+
+  if ( cpu_index >= _SMP_Get_processor_count() ) {
+    _ISR_lock_ISR_enable( &lock_context );
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  the_cache = &the_partition->Caches[ cpu_index ];
+  _Partition_Cache_acquire_critical( the_cache, &lock_context );
+  *statistics = the_cache->Statistics;
+  statistics->cached_buffers = the_cache->count;
+  _Partition_Cache_release_critical( the_cache, &lock_context );
+  _ISR_lock_ISR_enable( &lock_context );
+  return RTEMS_SUCCESSFUL;
+}
@@ -16,6 +16,26 @@
 
 #include <rtems/rtems/partimpl.h>
 
+static void _Partition_Return_cached_buffer(
+  Partition_Control *the_partition,
+  Partition_Cache   *the_cache,
+  ISR_lock_Context  *lock_context,
+  void              *buffer
+)
+{
+  if ( the_cache->count < PARTITION_CACHE_CAPACITY ) {
+    ++the_cache->Statistics.return_hits;
+  } else {
+    _Partition_Flush_cache( the_partition, the_cache, the_cache->count / 2 );
+    ++the_cache->Statistics.return_flushes;
+  }
+
+  the_cache->buffers[ the_cache->count ] = buffer;
+  ++the_cache->count;
+  _Partition_Cache_release_critical( the_cache, lock_context );
+  _ISR_lock_ISR_enable( lock_context );
+}
+
 rtems_status_code rtems_partition_return_buffer(
   rtems_id  id,
   void     *buffer
@@ -34,6 +54,30 @@ rtems_status_code rtems_partition_return_buffer(
 #endif
   }
 
+  if ( the_partition->Caches != NULL ) {
+    Partition_Cache *the_cache;
+
+    if ( !_Partition_Is_buffer_valid( buffer, the_partition ) ) {
+      _ISR_lock_ISR_enable( &lock_context );
+      return RTEMS_INVALID_ADDRESS;
+    }
+
+    the_cache = _Partition_Get_cache( the_partition );
+    _Partition_Cache_acquire_critical( the_cache, &lock_context );
+
+    if ( !the_cache->disabled ) {
+      _Partition_Return_cached_buffer(
+        the_partition,
+        the_cache,
+        &lock_context,
+        buffer
+      );
+      return RTEMS_SUCCESSFUL;
+    }
+
+    _Partition_Cache_release_critical( the_cache, &lock_context );
+  }
+
   _Partition_Acquire_critical( the_partition, &lock_context );
 
   if ( !_Partition_Is_buffer_valid( buffer, the_partition ) ) {
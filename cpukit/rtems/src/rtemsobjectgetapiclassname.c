@@ -56,6 +56,7 @@ static const rtems_assoc_t rtems_object_api_posix_assoc[] = {
   { "Barrier",                 OBJECTS_POSIX_BARRIERS, 0},
   { "Spinlock",                OBJECTS_POSIX_SPINLOCKS, 0},
   { "RWLock",                  OBJECTS_POSIX_RWLOCKS, 0},
+  { "Shared Memory",           OBJECTS_POSIX_SHMS, 0},
   { NULL,                      0, 0}
 };
 #endif
@@ -62,7 +62,7 @@ rtems_status_code _Timer_Fire(
     Per_CPU_Control *cpu;
 
     cpu = _Timer_Acquire_critical( the_timer, &lock_context );
-    _Timer_Cancel( cpu, the_timer );
+    cpu = _Timer_Cancel_and_move( cpu, the_timer, &lock_context );
     _Watchdog_Initialize( &the_timer->Ticker, adaptor );
     the_timer->the_class = the_class;
     the_timer->routine = routine;
@@ -166,8 +166,8 @@ void _Timer_Cancel( Per_CPU_Control *cpu, Timer_Control *the_timer )
     Timer_server_Control *timer_server;
     ISR_lock_Context      lock_context;
 
-    timer_server = _Timer_server;
-    _Assert( timer_server != NULL );
+    _Assert( _Timer_server != NULL );
+    timer_server = _Timer_server_Get( _Timer_server, cpu );
     _Timer_server_Acquire_critical( timer_server, &lock_context );
 
     if ( _Watchdog_Get_state( &the_timer->Ticker ) == WATCHDOG_PENDING ) {
@@ -35,7 +35,7 @@ rtems_status_code rtems_timer_reset(
     cpu = _Timer_Acquire_critical( the_timer, &lock_context );
 
     if ( _Timer_Is_interval_class( the_timer->the_class ) ) {
-      _Timer_Cancel( cpu, the_timer );
+      cpu = _Timer_Cancel_and_move( cpu, the_timer, &lock_context );
       _Watchdog_Insert(
         &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_RELATIVE ],
         &the_timer->Ticker,
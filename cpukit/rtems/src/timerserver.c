@@ -30,7 +30,10 @@
 #include <rtems/rtems/timerimpl.h>
 #include <rtems/rtems/tasksimpl.h>
 #include <rtems/score/apimutex.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/smp.h>
 #include <rtems/score/todimpl.h>
+#include <rtems/score/wkspace.h>
 
 static Timer_server_Control _Timer_server_Default;
 
@@ -58,15 +61,16 @@ void _Timer_server_Routine_adaptor( Watchdog_Control *the_watchdog )
   Timer_server_Control *ts;
   bool                  wakeup;
 
-  ts = _Timer_server;
-  _Assert( ts != NULL );
+  _Assert( _Timer_server != NULL );
   the_timer = RTEMS_CONTAINER_OF( the_watchdog, Timer_Control, Ticker );
+  cpu = _Per_CPU_Get();
+  _Assert( cpu == _Watchdog_Get_CPU( &the_timer->Ticker ) );
+  ts = _Timer_server_Get( _Timer_server, cpu );
 
   _Timer_server_Acquire( ts, &lock_context );
 
   _Assert( _Watchdog_Get_state( &the_timer->Ticker ) == WATCHDOG_INACTIVE );
   _Watchdog_Set_state( &the_timer->Ticker, WATCHDOG_PENDING );
-  cpu = _Watchdog_Get_CPU( &the_timer->Ticker );
   the_timer->stop_time = _Timer_Get_CPU_ticks( cpu );
   wakeup = _Chain_Is_empty( &ts->Pending );
   _Chain_Append_unprotected( &ts->Pending, &the_timer->Ticker.Node.Chain );
@@ -136,6 +140,49 @@ static rtems_task _Timer_server_Body(
   }
 }
 
+#if defined(RTEMS_SMP)
+/*
+ *  Moves the timer server task to the scheduler instance owning the processor
+ *  and restricts its affinity to this processor.  The affinity change fails
+ *  in case the scheduler instance does not support thread to processor
+ *  affinities.  This is not an error, since the timer server still executes
+ *  on a processor of the scheduler instance.
+ */
+static void _Timer_server_Bind(
+  rtems_id            id,
+  uint32_t            cpu_index,
+  rtems_task_priority priority
+)
+{
+  const Scheduler_Control *scheduler;
+  rtems_status_code        status;
+
+  scheduler = _Scheduler_Get_by_CPU_index( cpu_index );
+  if ( scheduler == NULL ) {
+    return;
+  }
+
+  status = rtems_task_set_scheduler(
+    id,
+    _Scheduler_Build_id( _Scheduler_Get_index( scheduler ) ),
+    priority
+  );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    return;
+  }
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  {
+    cpu_set_t cpuset;
+
+    CPU_ZERO( &cpuset );
+    CPU_SET( (int) cpu_index, &cpuset );
+    (void) rtems_task_set_affinity( id, sizeof( cpuset ), &cpuset );
+  }
+#endif
+}
+#endif
+
 static rtems_status_code _Timer_server_Initiate(
   rtems_task_priority priority,
   size_t              stack_size,
@@ -143,8 +190,9 @@ static rtems_status_code _Timer_server_Initiate(
 )
 {
   rtems_status_code     status;
-  rtems_id              id;
-  Timer_server_Control *ts;
+  Timer_server_Control *servers;
+  uint32_t              count;
+  uint32_t              i;
 
   /*
    *  Just to make sure this is only called once.
@@ -157,60 +205,103 @@ static rtems_status_code _Timer_server_Initiate(
     priority = PRIORITY_PSEUDO_ISR;
   }
 
-  /*
-   *  Create the Timer Server with the name the name of "TIME".  The attribute
-   *  RTEMS_SYSTEM_TASK allows us to set a priority to 0 which will makes it
-   *  higher than any other task in the system.  It can be viewed as a low
-   *  priority interrupt.  It is also always NO_PREEMPT so it looks like
-   *  an interrupt to other tasks.
-   *
-   *  We allow the user to override the default priority because the Timer
-   *  Server can invoke TSRs which must adhere to language run-time or
-   *  other library rules.  For example, if using a TSR written in Ada the
-   *  Server should run at the same priority as the priority Ada task.
-   *  Otherwise, the priority ceiling for the mutex used to protect the
-   *  GNAT run-time is violated.
-   */
-  status = rtems_task_create(
-    rtems_build_name('T','I','M','E'),
-    priority,
-    stack_size,
-    rtems_configuration_is_smp_enabled() ?
-      RTEMS_DEFAULT_MODES : /* no preempt is not supported for SMP */
-      RTEMS_NO_PREEMPT,   /* no preempt is like an interrupt */
-                          /* user may want floating point but we need */
-                          /*   system task specified for 0 priority */
-    attribute_set | RTEMS_SYSTEM_TASK,
-    &id
-  );
-  if (status != RTEMS_SUCCESSFUL) {
-    return status;
+  count = 1;
+  servers = &_Timer_server_Default;
+
+#if defined(RTEMS_SMP)
+  if (
+    ( attribute_set & RTEMS_TIMER_SERVER_PER_PROCESSOR ) != 0
+      && _SMP_Get_processor_count() > 1
+  ) {
+    count = _SMP_Get_processor_count();
+    servers = _Workspace_Allocate( count * sizeof( *servers ) );
+    if ( servers == NULL ) {
+      return RTEMS_NO_MEMORY;
+    }
   }
+#endif
 
-  /*
-   *  Do all the data structure initialization before starting the
-   *  Timer Server so we do not have to have a critical section.
-   */
+  attribute_set &= ~RTEMS_TIMER_SERVER_PER_PROCESSOR;
+
+  for ( i = 0 ; i < count ; ++i ) {
+    Timer_server_Control *ts;
+    rtems_id              id;
+
+    /*
+     *  Create the Timer Server with the name the name of "TIME".  The
+     *  attribute RTEMS_SYSTEM_TASK allows us to set a priority to 0 which
+     *  will makes it higher than any other task in the system.  It can be
+     *  viewed as a low priority interrupt.  It is also always NO_PREEMPT so
+     *  it looks like an interrupt to other tasks.
+     *
+     *  We allow the user to override the default priority because the Timer
+     *  Server can invoke TSRs which must adhere to language run-time or
+     *  other library rules.  For example, if using a TSR written in Ada the
+     *  Server should run at the same priority as the priority Ada task.
+     *  Otherwise, the priority ceiling for the mutex used to protect the
+     *  GNAT run-time is violated.
+     */
+    status = rtems_task_create(
+      rtems_build_name('T','I','M','E'),
+      priority,
+      stack_size,
+      rtems_configuration_is_smp_enabled() ?
+        RTEMS_DEFAULT_MODES : /* no preempt is not supported for SMP */
+        RTEMS_NO_PREEMPT,   /* no preempt is like an interrupt */
+                            /* user may want floating point but we need */
+                            /*   system task specified for 0 priority */
+      attribute_set | RTEMS_SYSTEM_TASK,
+      &id
+    );
+    if (status != RTEMS_SUCCESSFUL) {
+      while ( i > 0 ) {
+        --i;
+        (void) rtems_task_delete( servers[ i ].server_id );
+      }
 
-  ts = &_Timer_server_Default;
-  _ISR_lock_Initialize( &ts->Lock, "Timer Server" );
-  _Chain_Initialize_empty( &ts->Pending );
-  ts->server_id = id;
+      if ( servers != &_Timer_server_Default ) {
+        _Workspace_Free( servers );
+      }
+
+      return status;
+    }
+
+#if defined(RTEMS_SMP)
+    if ( count > 1 ) {
+      _Timer_server_Bind( id, i, priority );
+    }
+#endif
+
+    /*
+     *  Do all the data structure initialization before starting the
+     *  Timer Server so we do not have to have a critical section.
+     */
+
+    ts = &servers[ i ];
+    _ISR_lock_Initialize( &ts->Lock, "Timer Server" );
+    _Chain_Initialize_empty( &ts->Pending );
+    ts->server_id = id;
+#if defined(RTEMS_SMP)
+    ts->count = count;
+#endif
+  }
 
   /*
    * The default timer server is now available.
    */
-  _Timer_server = ts;
+  _Timer_server = servers;
 
   /*
-   *  Start the timer server
+   *  Start the timer servers
    */
-  status = rtems_task_start(
-    id,
-    _Timer_server_Body,
-    (rtems_task_argument) ts
-  );
-  _Assert( status == RTEMS_SUCCESSFUL );
+  for ( i = 0 ; i < count ; ++i ) {
+    status = rtems_task_start(
+      servers[ i ].server_id,
+      _Timer_server_Body,
+      (rtems_task_argument) &servers[ i ]
+    );
+    _Assert( status == RTEMS_SUCCESSFUL );
+  }
 
   return status;
 }
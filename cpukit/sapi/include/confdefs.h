@@ -371,6 +371,16 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
                     IMFS_MEMFILE_DEFAULT_BYTES_PER_BLOCK
 #endif
 
+/**
+ * This specifies the size of the first extent of files within the IMFS in
+ * case CONFIGURE_IMFS_ENABLE_EXTFILE is defined.  The following extents grow
+ * geometrically.
+ */
+#ifndef CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT
+  #define CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT \
+                    IMFS_EXTFILE_DEFAULT_BYTES_PER_EXTENT
+#endif
+
 /**
  * This defines the IMFS file system table entry.
  */
@@ -531,6 +541,8 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     !defined(CONFIGURE_USE_DEVFS_AS_BASE_FILESYSTEM)
     int imfs_rq_memfile_bytes_per_block =
       CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK;
+    const size_t imfs_extfile_bytes_per_extent =
+      CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT;
   #endif
 
   /**
@@ -657,14 +669,18 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       };
 
       static const IMFS_mknod_controls _Configure_IMFS_mknod_controls = {
-        #ifdef CONFIGURE_IMFS_DISABLE_READDIR
+        #if defined(CONFIGURE_IMFS_DISABLE_READDIR)
           &IMFS_mknod_control_dir_minimal,
+        #elif defined(CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX)
+          &IMFS_mknod_control_dir_indexed,
         #else
           &IMFS_mknod_control_dir_default,
         #endif
         &IMFS_mknod_control_device,
-        #ifdef CONFIGURE_IMFS_DISABLE_MKNOD_FILE
+        #if defined(CONFIGURE_IMFS_DISABLE_MKNOD_FILE)
           &IMFS_mknod_control_enosys,
+        #elif defined(CONFIGURE_IMFS_ENABLE_EXTFILE)
+          &IMFS_mknod_control_extfile,
         #else
           &IMFS_mknod_control_memfile,
         #endif
@@ -768,6 +784,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
  *  - CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP - Deterministic
  *    Priority SMP Affinity Scheduler
  *  - CONFIGURE_SCHEDULER_STRONG_APA - Strong APA Scheduler
+ *  - CONFIGURE_SCHEDULER_WORK_STEALING_SMP - Work Stealing SMP Scheduler
  *  - CONFIGURE_SCHEDULER_SIMPLE - Light-weight Priority Scheduler
  *  - CONFIGURE_SCHEDULER_SIMPLE_SMP - Simple SMP Priority Scheduler
  *  - CONFIGURE_SCHEDULER_EDF - EDF Scheduler
@@ -793,6 +810,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     !defined(CONFIGURE_SCHEDULER_PRIORITY_SMP) && \
     !defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP) && \
     !defined(CONFIGURE_SCHEDULER_STRONG_APA) && \
+    !defined(CONFIGURE_SCHEDULER_WORK_STEALING_SMP) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) && \
     !defined(CONFIGURE_SCHEDULER_EDF) && \
@@ -912,6 +930,32 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
   #endif
 #endif
 
+/*
+ * If the Work Stealing SMP Scheduler is selected, then configure for it.
+ */
+#if defined(CONFIGURE_SCHEDULER_WORK_STEALING_SMP)
+  #if !defined(CONFIGURE_SCHEDULER_NAME)
+    /** Configure the name of the scheduler instance */
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name('M', 'W', 'S', ' ')
+  #endif
+
+  #if !defined(CONFIGURE_SCHEDULER_CONTROLS)
+    /** Configure the context needed by the scheduler instance */
+    #define CONFIGURE_SCHEDULER_CONTEXT \
+      RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP( \
+        dflt, \
+        CONFIGURE_MAXIMUM_PRIORITY + 1 \
+      )
+
+    /** Configure the controls for this scheduler instance */
+    #define CONFIGURE_SCHEDULER_CONTROLS \
+      RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP( \
+        dflt, \
+        CONFIGURE_SCHEDULER_NAME \
+      )
+  #endif
+#endif
+
 /*
  * If the Simple Priority Scheduler is selected, then configure for it.
  */
@@ -1347,6 +1391,51 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       NULL;
     #endif
 #endif
+
+#ifdef CONFIGURE_INIT
+  /**
+   * This configures the per-processor caches for small allocations in front
+   * of the C program heap.
+   */
+  #ifdef CONFIGURE_MALLOC_PER_CPU_CACHE
+    #ifndef CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK
+      #define CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK 32
+    #endif
+
+    #if CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK < 2 \
+      || CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK \
+        > RTEMS_MALLOC_CACHE_MAXIMUM_HIGH_WATERMARK
+      #error "CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK must be in range 2 to 64"
+    #endif
+
+    #if defined(RTEMS_SMP)
+      #define _CONFIGURE_MALLOC_CACHE_PROCESSORS \
+        CONFIGURE_SMP_MAXIMUM_PROCESSORS
+    #else
+      #define _CONFIGURE_MALLOC_CACHE_PROCESSORS 1
+    #endif
+
+    static rtems_malloc_cache _Configure_Malloc_caches[
+      _CONFIGURE_MALLOC_CACHE_PROCESSORS * RTEMS_MALLOC_CACHE_CLASS_COUNT
+    ];
+
+    static void *_Configure_Malloc_cache_objects[
+      _CONFIGURE_MALLOC_CACHE_PROCESSORS * RTEMS_MALLOC_CACHE_CLASS_COUNT
+        * CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK
+    ];
+
+    const rtems_malloc_cache_configuration
+      rtems_malloc_cache_config = {
+        _Configure_Malloc_caches,
+        _Configure_Malloc_cache_objects,
+        _CONFIGURE_MALLOC_CACHE_PROCESSORS,
+        CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK
+      };
+  #else
+    const rtems_malloc_cache_configuration
+      rtems_malloc_cache_config = { NULL, NULL, 0, 0 };
+  #endif
+#endif
 /**@}*/  /* end of Malloc Configuration */
 
 /**
@@ -1417,10 +1506,22 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       _Configure_Zero_or_One(_number) * ( \
         (_Configure_Max_Objects(_number) + 1) * sizeof(Objects_Control *) + \
         _Configure_Align_up(sizeof(void *), CPU_ALIGNMENT) + \
-        _Configure_Align_up(sizeof(uint32_t), CPU_ALIGNMENT) \
+        _Configure_Align_up(sizeof(uint32_t), CPU_ALIGNMENT) + \
+        _Configure_Object_name_hash_RAM(_number) \
       ) \
     ) \
   )
+
+/**
+ * This is a helper macro used to calculate the size of the object name hash
+ * tables.  The bucket count is the next power of two of the object count.
+ */
+#ifdef CONFIGURE_OBJECT_NAME_HASH
+  #define _Configure_Object_name_hash_RAM(_number) \
+    ((3 * _Configure_Max_Objects(_number) + 1) * sizeof(Objects_Maximum))
+#else
+  #define _Configure_Object_name_hash_RAM(_number) 0
+#endif
 /**@}*/
 
 /**
@@ -1781,6 +1882,16 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     #define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY \
                               RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT
   #endif
+  #ifndef CONFIGURE_BDBUF_CACHE_SHARDS
+    #define CONFIGURE_BDBUF_CACHE_SHARDS \
+                              RTEMS_BDBUF_CACHE_SHARDS_DEFAULT
+  #endif
+  /*
+   * The bdbuf treats a shard count of zero as one.  Use this value to
+   * calculate the resources of the shards.
+   */
+  #define CONFIGURE_BDBUF_CACHE_SHARDS_EFFECTIVE \
+    (CONFIGURE_BDBUF_CACHE_SHARDS == 0 ? 1 : CONFIGURE_BDBUF_CACHE_SHARDS)
   #ifdef CONFIGURE_INIT
     const rtems_bdbuf_config rtems_bdbuf_configuration = {
       CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS,
@@ -1794,7 +1905,13 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       CONFIGURE_BDBUF_CACHE_MEMORY_SIZE,
       CONFIGURE_BDBUF_BUFFER_MIN_SIZE,
       CONFIGURE_BDBUF_BUFFER_MAX_SIZE,
-      CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
+      CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY,
+      CONFIGURE_BDBUF_CACHE_SHARDS,
+      #ifdef CONFIGURE_BDBUF_HASH_INDEX
+        true
+      #else
+        false
+      #endif
     };
   #endif
 
@@ -1816,29 +1933,32 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
 
     /*
      * POSIX Mutexes:
-     *  o bdbuf lock
+     *  o bdbuf lock for each shard
      *  o bdbuf sync lock
      */
-    #define CONFIGURE_LIBBLOCK_POSIX_MUTEXES 2
+    #define CONFIGURE_LIBBLOCK_POSIX_MUTEXES \
+      (CONFIGURE_BDBUF_CACHE_SHARDS_EFFECTIVE + 1)
 
     /*
-     * POSIX Condition Variables:
+     * POSIX Condition Variables for each shard:
      *  o bdbuf access condition
      *  o bdbuf transfer condition
      *  o bdbuf buffer condition
      */
-    #define CONFIGURE_LIBBLOCK_POSIX_CONDITION_VARIABLES 3
+    #define CONFIGURE_LIBBLOCK_POSIX_CONDITION_VARIABLES \
+      (3 * CONFIGURE_BDBUF_CACHE_SHARDS_EFFECTIVE)
   #else
     /*
      * Semaphores:
      *   o disk lock
-     *   o bdbuf lock
      *   o bdbuf sync lock
-     *   o bdbuf access condition
-     *   o bdbuf transfer condition
-     *   o bdbuf buffer condition
+     *   o bdbuf lock for each shard
+     *   o bdbuf access condition for each shard
+     *   o bdbuf transfer condition for each shard
+     *   o bdbuf buffer condition for each shard
      */
-    #define CONFIGURE_LIBBLOCK_SEMAPHORES 6
+    #define CONFIGURE_LIBBLOCK_SEMAPHORES \
+      (2 + 4 * CONFIGURE_BDBUF_CACHE_SHARDS_EFFECTIVE)
 
     #define CONFIGURE_LIBBLOCK_POSIX_MUTEXES 0
     #define CONFIGURE_LIBBLOCK_POSIX_CONDITION_VARIABLES 0
@@ -2072,6 +2192,10 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       #define CONFIGURE_MAXIMUM_POSIX_SPINLOCKS \
         rtems_resource_unlimited(CONFIGURE_UNLIMITED_ALLOCATION_SIZE)
     #endif
+    #if !defined(CONFIGURE_MAXIMUM_POSIX_SHMS)
+      #define CONFIGURE_MAXIMUM_POSIX_SHMS \
+        rtems_resource_unlimited(CONFIGURE_UNLIMITED_ALLOCATION_SIZE)
+    #endif
   #endif /* RTEMS_POSIX_API */
 #endif /* CONFIGURE_UNLIMITED_OBJECTS */
 
@@ -2468,6 +2592,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
   #include <rtems/posix/pthread.h>
   #include <rtems/posix/rwlock.h>
   #include <rtems/posix/semaphore.h>
+  #include <rtems/posix/shm.h>
   #include <rtems/posix/spinlock.h>
   #include <rtems/posix/threadsup.h>
   #include <rtems/posix/timer.h>
@@ -2648,6 +2773,23 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
   #define CONFIGURE_MEMORY_FOR_POSIX_RWLOCKS(_rwlocks) \
     _Configure_Object_RAM(_rwlocks, sizeof(POSIX_RWLock_Control) )
 
+  /**
+   * This configuration parameter specifies the maximum number of
+   * POSIX API shared memory objects.
+   */
+  #ifndef CONFIGURE_MAXIMUM_POSIX_SHMS
+    #define CONFIGURE_MAXIMUM_POSIX_SHMS 0
+  #endif
+
+  /**
+   * This macro is calculated to specify the memory required for
+   * POSIX API shared memory objects.
+   *
+   * This is an internal parameter.
+   */
+  #define CONFIGURE_MEMORY_FOR_POSIX_SHMS(_shms) \
+    _Configure_POSIX_Named_Object_RAM(_shms, sizeof(POSIX_Shm_Control) )
+
   #ifdef CONFIGURE_POSIX_INIT_THREAD_TABLE
 
     #ifdef CONFIGURE_POSIX_HAS_OWN_INIT_THREAD_TABLE
@@ -2875,6 +3017,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
         CONFIGURE_MAXIMUM_POSIX_SPINLOCKS) + \
       CONFIGURE_MEMORY_FOR_POSIX_RWLOCKS( \
         CONFIGURE_MAXIMUM_POSIX_RWLOCKS) + \
+      CONFIGURE_MEMORY_FOR_POSIX_SHMS(CONFIGURE_MAXIMUM_POSIX_SHMS) + \
       CONFIGURE_MEMORY_FOR_POSIX_TIMERS(CONFIGURE_MAXIMUM_POSIX_TIMERS))
 #else
   /**
@@ -3252,6 +3395,9 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       #ifdef CONFIGURE_SCHEDULER_STRONG_APA
         Scheduler_strong_APA_Node Strong_APA;
       #endif
+      #ifdef CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+        Scheduler_work_stealing_SMP_Node Work_stealing_SMP;
+      #endif
       #ifdef CONFIGURE_SCHEDULER_USER_PER_THREAD
         CONFIGURE_SCHEDULER_USER_PER_THREAD User;
       #endif
@@ -3334,6 +3480,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
       CONFIGURE_MAXIMUM_POSIX_BARRIERS,
       CONFIGURE_MAXIMUM_POSIX_RWLOCKS,
       CONFIGURE_MAXIMUM_POSIX_SPINLOCKS,
+      CONFIGURE_MAXIMUM_POSIX_SHMS,
       CONFIGURE_POSIX_INIT_THREAD_TABLE_SIZE,
       CONFIGURE_POSIX_INIT_THREAD_TABLE_NAME
     };
@@ -3381,6 +3528,21 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     #else
       false,
     #endif
+    #ifdef CONFIGURE_WORK_SPACE_TLSF          /* true for TLSF work space */
+      true,
+    #else
+      false,
+    #endif
+    #ifdef CONFIGURE_MALLOC_TLSF              /* true for TLSF C program heap */
+      true,
+    #else
+      false,
+    #endif
+    #ifdef CONFIGURE_OBJECT_NAME_HASH         /* true for object name hash */
+      true,
+    #else
+      false,
+    #endif
     #ifdef RTEMS_SMP
       #ifdef CONFIGURE_SMP_APPLICATION
         true,
@@ -3411,6 +3573,34 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
 
 #endif
 
+/*
+ *  If the user has requested the timer wheel for the relative watchdogs,
+ *  then instantiate one wheel per processor and install them before the
+ *  first watchdog is used.
+ */
+#if defined(CONFIGURE_INIT) && defined(CONFIGURE_WATCHDOG_TIMER_WHEEL)
+  #if defined(RTEMS_SMP)
+    static Watchdog_Wheel
+      _Configure_Watchdog_wheels[ CONFIGURE_SMP_MAXIMUM_PROCESSORS ];
+  #else
+    static Watchdog_Wheel _Configure_Watchdog_wheels[ 1 ];
+  #endif
+
+  static void _Configure_Watchdog_wheels_initialize( void )
+  {
+    _Watchdog_Initialize_wheels(
+      _Configure_Watchdog_wheels,
+      RTEMS_ARRAY_SIZE( _Configure_Watchdog_wheels )
+    );
+  }
+
+  RTEMS_SYSINIT_ITEM(
+    _Configure_Watchdog_wheels_initialize,
+    RTEMS_SYSINIT_DATA_STRUCTURES,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
+#endif
+
 /*
  *  If the user has configured a set of Classic API Initialization Tasks,
  *  then we need to install the code that runs that loop.
@@ -3550,6 +3740,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     uint32_t POSIX_BARRIERS;
     uint32_t POSIX_SPINLOCKS;
     uint32_t POSIX_RWLOCKS;
+    uint32_t POSIX_SHMS;
 #endif
 
     /* Stack space sizes */
@@ -3604,6 +3795,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
     CONFIGURE_MEMORY_FOR_POSIX_BARRIERS( CONFIGURE_MAXIMUM_POSIX_BARRIERS ),
     CONFIGURE_MEMORY_FOR_POSIX_SPINLOCKS( CONFIGURE_MAXIMUM_POSIX_SPINLOCKS ),
     CONFIGURE_MEMORY_FOR_POSIX_RWLOCKS( CONFIGURE_MAXIMUM_POSIX_RWLOCKS ),
+    CONFIGURE_MEMORY_FOR_POSIX_SHMS( CONFIGURE_MAXIMUM_POSIX_SHMS ),
     CONFIGURE_MEMORY_FOR_POSIX_TIMERS( CONFIGURE_MAXIMUM_POSIX_TIMERS ),
 #endif
 
@@ -3676,6 +3868,7 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
        (CONFIGURE_MAXIMUM_POSIX_BARRIERS != 0) || \
        (CONFIGURE_MAXIMUM_POSIX_SPINLOCKS != 0) || \
        (CONFIGURE_MAXIMUM_POSIX_RWLOCKS != 0) || \
+       (CONFIGURE_MAXIMUM_POSIX_SHMS != 0) || \
       defined(CONFIGURE_POSIX_INIT_THREAD_TABLE))
   #error "CONFIGURATION ERROR: POSIX API support not configured!!"
   #endif
@@ -3767,6 +3960,22 @@ extern rtems_initialization_tasks_table Initialization_tasks[];
   #error "IMFS Memfile block size must be a power of 2 between 16 and 512"
 #endif
 
+/*
+ * IMFS extent size for extent files (extfiles) must be a power of two
+ * between 16 and 4096 inclusive.
+ */
+#if ((CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 16) && \
+     (CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 32) && \
+     (CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 64) && \
+     (CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 128) && \
+     (CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 256) && \
+     (CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 512) && \
+     (CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 1024) && \
+     (CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 2048) && \
+     (CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT != 4096))
+  #error "IMFS Extfile extent size must be a power of 2 between 16 and 4096"
+#endif
+
 
 #endif
 /* end of include file */
@@ -237,6 +237,36 @@ typedef struct {
    */
   bool                           stack_allocator_avoids_work_space;
 
+  /**
+   * @brief Specifies if the RTEMS Workspace uses the two-level segregated fit
+   * (TLSF) free block index.
+   *
+   * If this element is @a true, then the RTEMS Workspace is initialized with
+   * _Heap_Initialize_TLSF(), otherwise with _Heap_Initialize().  In case of a
+   * unified work area this applies also to the C Program Heap.
+   */
+  bool                           work_space_tlsf;
+
+  /**
+   * @brief Specifies if the C Program Heap uses the two-level segregated fit
+   * (TLSF) free block index.
+   *
+   * If this element is @a true, then the separate C Program Heap is
+   * initialized with _Heap_Initialize_TLSF(), otherwise with
+   * _Heap_Initialize().
+   */
+  bool                           malloc_tlsf;
+
+  /**
+   * @brief Specifies if the object information tables maintain an object
+   * name hash index.
+   *
+   * If this element is @a true, then the object name to identifier
+   * translation uses a hash index instead of a linear search of the local
+   * object table.
+   */
+  bool                           object_name_hash;
+
   #ifdef RTEMS_SMP
     bool                         smp_enabled;
   #endif
@@ -292,6 +322,15 @@ extern const rtems_configuration_table Configuration;
 #define rtems_configuration_get_stack_allocator_avoids_work_space() \
         (Configuration.stack_allocator_avoids_work_space)
 
+#define rtems_configuration_get_work_space_tlsf() \
+        (Configuration.work_space_tlsf)
+
+#define rtems_configuration_get_malloc_tlsf() \
+        (Configuration.malloc_tlsf)
+
+#define rtems_configuration_get_object_name_hash() \
+        (Configuration.object_name_hash)
+
 #define rtems_configuration_get_stack_space_size() \
         (Configuration.stack_space_size)
 
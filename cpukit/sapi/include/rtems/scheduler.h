@@ -171,6 +171,7 @@
   #define RTEMS_SCHEDULER_CONTEXT_STRONG_APA( name, prio_count ) \
     static struct { \
       Scheduler_strong_APA_Context Base; \
+      Scheduler_strong_APA_CPU     CPU[ CONFIGURE_SMP_MAXIMUM_PROCESSORS ]; \
       Chain_Control                Ready[ ( prio_count ) ]; \
     } RTEMS_SCHEDULER_CONTEXT_STRONG_APA_NAME( name )
 
@@ -185,6 +186,32 @@
     }
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+  #include <rtems/score/schedulerworkstealingsmp.h>
+
+  #define RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP_NAME( name ) \
+    RTEMS_SCHEDULER_CONTEXT_NAME( work_stealing_SMP_ ## name )
+
+  #define RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP( name, prio_count ) \
+    static struct { \
+      Scheduler_work_stealing_SMP_Context Base; \
+      Scheduler_work_stealing_SMP_Queue \
+        Queues[ CONFIGURE_SMP_MAXIMUM_PROCESSORS ]; \
+      Chain_Control \
+        Ready[ CONFIGURE_SMP_MAXIMUM_PROCESSORS ][ ( prio_count ) ]; \
+    } RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP_NAME( name )
+
+  #define RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP( name, obj_name ) \
+    { \
+      &RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP_NAME( name ).Base.Base.Base, \
+      SCHEDULER_WORK_STEALING_SMP_ENTRY_POINTS, \
+      RTEMS_ARRAY_SIZE( \
+        RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP_NAME( name ).Ready[ 0 ] \
+      ) - 1, \
+      ( obj_name ) \
+    }
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_SIMPLE
   #include <rtems/score/schedulersimple.h>
 
@@ -150,6 +150,10 @@ struct CORE_message_queue_Control {
   /** This element is the number of messages which are currently pending.
    */
   uint32_t                           number_of_pending_messages;
+  /** This element is the number of message buffers which are currently
+   *  loaned to tasks.  A loaned message buffer is on no chain.
+   */
+  uint32_t                           number_of_loaned_messages;
   /** This is the size in bytes of the largest message which may be
    *  sent via this queue.
    */
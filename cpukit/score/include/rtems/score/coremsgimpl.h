@@ -53,6 +53,20 @@ extern "C" {
  */
 #define  CORE_MESSAGE_QUEUE_URGENT_REQUEST INT_MIN
 
+/**
+ *  @brief Indicates a receiver which expects a copy of the message.
+ *
+ *  This value is stored in the wait option of a thread blocked on receive.
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_COPY 0
+
+/**
+ *  @brief Indicates a receiver which expects the loan of a message buffer.
+ *
+ *  This value is stored in the wait option of a thread blocked on receive.
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_LOAN 1
+
 /**
  *  @brief The modes in which a message may be submitted to a message queue.
  *
@@ -270,6 +284,87 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 );
 
+/**
+ *  @brief Insert a message buffer into the message queue without a copy.
+ *
+ *  The message content must be already present in the message buffer.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the message to enqueue
+ *  @param[in] content_size the message content size in bytes
+ *  @param[in] submit_type determines whether the message is prepended,
+ *         appended, or enqueued in priority order.
+ */
+void _CORE_message_queue_Insert_loaned_message(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             content_size,
+  CORE_message_queue_Submit_types    submit_type
+);
+
+/**
+ *  @brief Submit a loaned message buffer to the message queue.
+ *
+ *  The message buffer must be loaned from this message queue, see
+ *  _CORE_message_queue_Is_message_buffer_loaned().  The ownership of the
+ *  message buffer passes to the message queue.  The message content is not
+ *  copied in case the message is enqueued or a receiver waits for a loan.  A
+ *  waiting receiver which expects a copy receives a copy and the message
+ *  buffer returns to the inactive message buffers.
+ *
+ *  The loan of message buffers must not be used for message queues with
+ *  blocking senders.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the loaned message buffer
+ *  @param[in] size is the size of the message content
+ *  @param[in] submit_type determines whether the message is prepended,
+ *         appended, or enqueued in priority order.
+ *  @param[in] queue_context The thread queue context used for
+ *    _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *  @retval indication of the successful completion or reason for failure
+ */
+Status_Control _CORE_message_queue_Submit_loan(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+);
+
+/**
+ *  @brief Seize a message buffer from the message queue.
+ *
+ *  This routine dequeues a message and loans its message buffer to the
+ *  caller without a copy of the message content.  The caller must return
+ *  the message buffer via _CORE_message_queue_Free_message_buffer() or
+ *  _CORE_message_queue_Submit_loan().  The thread will be blocked if wait is
+ *  true, otherwise an error will be given to the thread if no messages are
+ *  available.
+ *
+ *  The loan of message buffers must not be used for message queues with
+ *  blocking senders.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] executing the executing thread
+ *  @param[out] the_message_p points to the location for the loaned message
+ *         buffer
+ *  @param[in] wait indicates whether the calling thread is willing to block
+ *         if the message queue is empty.
+ *  @param[in] queue_context The thread queue context used for
+ *    _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *  @retval indication of the successful completion or reason for failure
+ *
+ *  @note Returns message priority via return area in TCB.
+ */
+Status_Control _CORE_message_queue_Seize_loan(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  CORE_message_queue_Buffer_control **the_message_p,
+  bool                                wait,
+  Thread_queue_Context               *queue_context
+);
+
 RTEMS_INLINE_ROUTINE Status_Control _CORE_message_queue_Send(
   CORE_message_queue_Control       *the_message_queue,
   const void                       *buffer,
@@ -379,6 +474,86 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Free_message_buffer (
   _Chain_Append_unprotected( &the_message_queue->Inactive_messages, &the_message->Node );
 }
 
+/**
+ * This routine loans @a the_message to a task.  A loaned message buffer is
+ * on no chain of @a the_message_queue until it returns to the message queue.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Loan_message_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message
+)
+{
+  _Chain_Set_off_chain( &the_message->Node );
+  ++the_message_queue->number_of_loaned_messages;
+}
+
+/**
+ * This routine gives the loaned @a the_message back to @a the_message_queue.
+ * The caller has to insert it into a chain or loan it again.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Return_message_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message
+)
+{
+  _Assert( _Chain_Is_node_off_chain( &the_message->Node ) );
+  (void) the_message;
+  --the_message_queue->number_of_loaned_messages;
+}
+
+/**
+ * This function returns true if @a the_message is loaned to a task, and
+ * false otherwise.  The message queue lock must be owned.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Is_message_buffer_loaned(
+  const CORE_message_queue_Buffer_control *the_message
+)
+{
+  return _Chain_Is_node_off_chain( &the_message->Node );
+}
+
+/**
+ * This function returns the message buffer associated with the message
+ * content area @a buffer or NULL if @a buffer is not the content area of a
+ * message buffer of @a the_message_queue.  It does not check whether the
+ * message buffer is loaned, see
+ * _CORE_message_queue_Is_message_buffer_loaned().
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Get_message_buffer(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  uintptr_t align_mask;
+  uintptr_t buffer_size;
+  uintptr_t begin;
+  uintptr_t offset;
+
+  align_mask = sizeof( uintptr_t ) - 1;
+  buffer_size = ( the_message_queue->maximum_message_size + align_mask )
+    & ~align_mask;
+  buffer_size += sizeof( CORE_message_queue_Buffer_control );
+  begin = (uintptr_t) the_message_queue->message_buffers;
+  offset = (uintptr_t) buffer
+    - offsetof( CORE_message_queue_Buffer_control, Contents.buffer );
+
+  if ( offset < begin ) {
+    return NULL;
+  }
+
+  offset -= begin;
+
+  if (
+    offset / buffer_size >= the_message_queue->maximum_pending_messages
+      || offset % buffer_size != 0
+  ) {
+    return NULL;
+  }
+
+  return (CORE_message_queue_Buffer_control *) ( begin + offset );
+}
+
 /**
  * This function returns the priority of @a the_message.
  *
@@ -474,14 +649,34 @@ RTEMS_INLINE_ROUTINE Thread_Control *_CORE_message_queue_Dequeue_receiver(
     return NULL;
   }
 
-   *(size_t *) the_thread->Wait.return_argument = size;
-   the_thread->Wait.count = (uint32_t) submit_type;
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_LOAN ) {
+    CORE_message_queue_Buffer_control *the_message;
+
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message == NULL ) {
+      return NULL;
+    }
+
+    _CORE_message_queue_Loan_message_buffer( the_message_queue, the_message );
+    the_message->Contents.size = size;
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_message->Contents.buffer,
+      size
+    );
+    *(CORE_message_queue_Buffer_control **)
+      the_thread->Wait.return_argument = the_message;
+  } else {
+    *(size_t *) the_thread->Wait.return_argument = size;
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+  }
 
-  _CORE_message_queue_Copy_buffer(
-    buffer,
-    the_thread->Wait.return_argument_second.mutable_object,
-    size
-  );
+  the_thread->Wait.count = (uint32_t) submit_type;
 
   _Thread_queue_Extract_critical(
     &the_message_queue->Wait_queue.Queue,
@@ -37,10 +37,13 @@ extern "C" {
  * @brief The Heap Handler provides a heap.
  *
  * A heap is a doubly linked list of variable size blocks which are allocated
- * using the first fit method.  Garbage collection is performed each time a
- * block is returned to the heap by coalescing neighbor blocks.  Control
- * information for both allocated and free blocks is contained in the heap
- * area.  A heap control structure contains control information for the heap.
+ * using the first fit method.  Alternatively, a heap initialized by
+ * _Heap_Initialize_TLSF() uses a two-level segregated fit free block index
+ * (see @ref Heap_TLSF_control) which bounds the search time.  Garbage
+ * collection is performed each time a block is returned to the heap by
+ * coalescing neighbor blocks.  Control information for both allocated and
+ * free blocks is contained in the heap area.  A heap control structure
+ * contains control information for the heap.
  *
  * The alignment routines could be made faster should we require only powers of
  * two to be supported for page size, alignment and boundary arguments.  The
@@ -336,11 +339,59 @@ typedef struct {
   uint32_t resizes;
 } Heap_Statistics;
 
+/**
+ * @brief Binary logarithm of the second level list count of the two-level
+ * segregated fit (TLSF) free block index.
+ */
+#define HEAP_TLSF_SL_SHIFT 3
+
+/**
+ * @brief Second level list count of the TLSF free block index.
+ */
+#define HEAP_TLSF_SL_COUNT (1U << HEAP_TLSF_SL_SHIFT)
+
+/**
+ * @brief Binary logarithm of the smallest block size which is not in the
+ * first level class zero of the TLSF free block index.
+ *
+ * Blocks smaller than this size are linearly distributed over the second
+ * level lists of the first level class zero.
+ */
+#define HEAP_TLSF_FL_SHIFT 7
+
+/**
+ * @brief First level class count of the TLSF free block index.
+ *
+ * Blocks of 2^32 bytes or more are in the last list of the last class.
+ */
+#define HEAP_TLSF_FL_COUNT (32 - HEAP_TLSF_FL_SHIFT + 1)
+
+/**
+ * @brief Two-level segregated fit (TLSF) free block index.
+ *
+ * The free blocks are kept in lists of blocks with a similar size.  The first
+ * level class of a block is determined by the most significant bit of its
+ * size, the second level list by the next HEAP_TLSF_SL_SHIFT bits.  A bit in
+ * the bitmaps indicates a non-empty class or list.  This allows a search for a
+ * suitable free block in constant time.
+ *
+ * The lists are doubly linked via the @ref Heap_Block.next and
+ * @ref Heap_Block.prev fields of the free blocks and terminated by @c NULL.
+ *
+ * @see _Heap_Initialize_TLSF().
+ */
+typedef struct {
+  uint32_t fl_bitmap;
+  uint32_t sl_bitmap [HEAP_TLSF_FL_COUNT];
+  Heap_Block *lists [HEAP_TLSF_FL_COUNT] [HEAP_TLSF_SL_COUNT];
+} Heap_TLSF_control;
+
 /**
  * @brief Control block used to manage a heap.
  */
 struct Heap_Control {
   Heap_Block free_list;
+  Heap_TLSF_control *tlsf;
   uintptr_t page_size;
   uintptr_t min_block_size;
   uintptr_t area_begin;
@@ -91,6 +91,36 @@ uintptr_t _Heap_Initialize(
   uintptr_t page_size
 );
 
+/**
+ * @brief Initializes the heap control block @a heap to manage the area
+ * starting at @a area_begin of size @a area_size bytes with a two-level
+ * segregated fit (TLSF) free block index.
+ *
+ * The index is placed at the begin of the area.  The allocation, free and
+ * resize operations of this heap look up free blocks in constant time unless
+ * no free block guarantees the requested size and alignment.  The heap may be
+ * extended with _Heap_Extend().
+ *
+ * Returns the maximum memory available, or zero in case of failure.
+ *
+ * @see _Heap_Initialize() and Heap_Initialization_or_extend_handler.
+ */
+uintptr_t _Heap_Initialize_TLSF(
+  Heap_Control *heap,
+  void *area_begin,
+  uintptr_t area_size,
+  uintptr_t page_size
+);
+
+/**
+ * @brief Returns the worst case overhead of the TLSF free block index placed
+ * by _Heap_Initialize_TLSF() in the first heap area.
+ */
+RTEMS_INLINE_ROUTINE uintptr_t _Heap_TLSF_overhead( void )
+{
+  return sizeof( Heap_TLSF_control ) + CPU_ALIGNMENT - 1;
+}
+
 /**
  * @brief Allocates a memory area of size @a size bytes from the heap @a heap.
  *
@@ -536,6 +566,296 @@ RTEMS_INLINE_ROUTINE bool _Heap_Is_block_in_heap(
     && (uintptr_t) block <= (uintptr_t) heap->last_block;
 }
 
+/**
+ * @brief Returns the binary logarithm of @a value rounded down.
+ *
+ * The value must not be zero.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Heap_TLSF_log2( uintptr_t value )
+{
+  return (uint32_t) ( sizeof( unsigned long ) * 8 - 1 )
+    - (uint32_t) __builtin_clzl( (unsigned long) value );
+}
+
+/**
+ * @brief Returns the index of the TLSF list containing blocks of size
+ * @a block_size.
+ *
+ * The index is the first level class times HEAP_TLSF_SL_COUNT plus the second
+ * level list.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Heap_TLSF_index( uintptr_t block_size )
+{
+  uint32_t fl;
+  uint32_t sl;
+
+  if ( block_size < ( (uintptr_t) 1 << HEAP_TLSF_FL_SHIFT ) ) {
+    fl = 0;
+    sl = (uint32_t)
+      ( block_size >> ( HEAP_TLSF_FL_SHIFT - HEAP_TLSF_SL_SHIFT ) );
+  } else {
+    uint32_t msb = _Heap_TLSF_log2( block_size );
+
+    if ( msb < 32 ) {
+      fl = msb - HEAP_TLSF_FL_SHIFT + 1;
+      sl = (uint32_t) ( block_size >> ( msb - HEAP_TLSF_SL_SHIFT ) )
+        & ( HEAP_TLSF_SL_COUNT - 1 );
+    } else {
+      fl = HEAP_TLSF_FL_COUNT - 1;
+      sl = HEAP_TLSF_SL_COUNT - 1;
+    }
+  }
+
+  return ( fl << HEAP_TLSF_SL_SHIFT ) | sl;
+}
+
+/**
+ * @brief Returns the index of the first TLSF list in which all blocks have a
+ * size of at least @a block_size.
+ *
+ * The index may be out of range in case no such list exists.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Heap_TLSF_search_index( uintptr_t block_size )
+{
+  uintptr_t round_up;
+
+  if ( block_size < ( (uintptr_t) 1 << HEAP_TLSF_FL_SHIFT ) ) {
+    round_up = ( (uintptr_t) 1 << ( HEAP_TLSF_FL_SHIFT - HEAP_TLSF_SL_SHIFT ) )
+      - 1;
+  } else {
+    round_up = ( (uintptr_t) 1
+      << ( _Heap_TLSF_log2( block_size ) - HEAP_TLSF_SL_SHIFT ) ) - 1;
+  }
+
+  if ( block_size + round_up < block_size ) {
+    /* Integer overflow */
+    return HEAP_TLSF_FL_COUNT << HEAP_TLSF_SL_SHIFT;
+  }
+
+  return _Heap_TLSF_index( block_size + round_up );
+}
+
+/**
+ * @brief Returns the first block of the first non-empty TLSF list with an
+ * index greater than or equal to the one referenced by @a index.
+ *
+ * In case a block is returned, then the list index is stored in @a index.
+ *
+ * Returns @c NULL if no such list exists.
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_TLSF_find_suitable(
+  const Heap_TLSF_control *tlsf,
+  uint32_t *index
+)
+{
+  uint32_t fl = *index >> HEAP_TLSF_SL_SHIFT;
+  uint32_t sl = *index & ( HEAP_TLSF_SL_COUNT - 1 );
+  uint32_t map;
+
+  if ( fl >= HEAP_TLSF_FL_COUNT ) {
+    return NULL;
+  }
+
+  map = tlsf->sl_bitmap [fl] & ( ~UINT32_C( 0 ) << sl );
+  if ( map == 0 ) {
+    map = tlsf->fl_bitmap & ( ~UINT32_C( 0 ) << fl << 1 );
+    if ( map == 0 ) {
+      return NULL;
+    }
+
+    fl = (uint32_t) __builtin_ctz( map );
+    map = tlsf->sl_bitmap [fl];
+  }
+
+  sl = (uint32_t) __builtin_ctz( map );
+  *index = ( fl << HEAP_TLSF_SL_SHIFT ) | sl;
+
+  return tlsf->lists [fl] [sl];
+}
+
+/**
+ * @brief Inserts the free block @a block into the TLSF list of its size.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_TLSF_insert(
+  Heap_TLSF_control *tlsf,
+  Heap_Block *block
+)
+{
+  uint32_t index = _Heap_TLSF_index( _Heap_Block_size( block ) );
+  uint32_t fl = index >> HEAP_TLSF_SL_SHIFT;
+  uint32_t sl = index & ( HEAP_TLSF_SL_COUNT - 1 );
+  Heap_Block *first = tlsf->lists [fl] [sl];
+
+  block->next = first;
+  block->prev = NULL;
+
+  if ( first != NULL ) {
+    first->prev = block;
+  }
+
+  tlsf->lists [fl] [sl] = block;
+  tlsf->fl_bitmap |= UINT32_C( 1 ) << fl;
+  tlsf->sl_bitmap [fl] |= UINT32_C( 1 ) << sl;
+}
+
+/**
+ * @brief Removes the free block @a block from the TLSF list of its size.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_TLSF_remove(
+  Heap_TLSF_control *tlsf,
+  Heap_Block *block
+)
+{
+  Heap_Block *next = block->next;
+  Heap_Block *prev = block->prev;
+
+  if ( next != NULL ) {
+    next->prev = prev;
+  }
+
+  if ( prev != NULL ) {
+    prev->next = next;
+  } else {
+    uint32_t index = _Heap_TLSF_index( _Heap_Block_size( block ) );
+    uint32_t fl = index >> HEAP_TLSF_SL_SHIFT;
+    uint32_t sl = index & ( HEAP_TLSF_SL_COUNT - 1 );
+
+    tlsf->lists [fl] [sl] = next;
+
+    if ( next == NULL ) {
+      tlsf->sl_bitmap [fl] &= ~( UINT32_C( 1 ) << sl );
+
+      if ( tlsf->sl_bitmap [fl] == 0 ) {
+        tlsf->fl_bitmap &= ~( UINT32_C( 1 ) << fl );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Inserts the free block @a block into the free block index of the
+ * heap.
+ *
+ * The size of the block must be set.  In case of the first fit method the
+ * block is inserted after @a block_before in the free list.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block *block_before,
+  Heap_Block *block
+)
+{
+  if ( heap->tlsf != NULL ) {
+    _Heap_TLSF_insert( heap->tlsf, block );
+  } else {
+    _Heap_Free_list_insert_after( block_before, block );
+  }
+}
+
+/**
+ * @brief Removes the free block @a block from the free block index of the
+ * heap.
+ *
+ * The size of the block must be the one it had during the insert.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( heap->tlsf != NULL ) {
+    _Heap_TLSF_remove( heap->tlsf, block );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Replaces the free block @a old_block with the free block
+ * @a new_block in the free block index of the heap.
+ *
+ * The size of the new block must be set.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block
+)
+{
+  if ( heap->tlsf != NULL ) {
+    _Heap_TLSF_remove( heap->tlsf, old_block );
+    _Heap_TLSF_insert( heap->tlsf, new_block );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Sets the size of the free block @a block to @a size and keeps the
+ * free block index of the heap up to date.
+ *
+ * The previous block of a free block is always used.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_set_size(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t size
+)
+{
+  if ( heap->tlsf != NULL ) {
+    _Heap_TLSF_remove( heap->tlsf, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_TLSF_insert( heap->tlsf, block );
+  } else {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  }
+}
+
+/**
+ * @brief Returns the first free block of the heap, or @c NULL if there are no
+ * free blocks.
+ *
+ * @see _Heap_Free_block_next().
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_block_first( Heap_Control *heap )
+{
+  if ( heap->tlsf != NULL ) {
+    uint32_t index = 0;
+
+    return _Heap_TLSF_find_suitable( heap->tlsf, &index );
+  } else {
+    Heap_Block *const first = _Heap_Free_list_first( heap );
+
+    return first != _Heap_Free_list_tail( heap ) ? first : NULL;
+  }
+}
+
+/**
+ * @brief Returns the free block following the free block @a block in the free
+ * block index of the heap, or @c NULL if @a block is the last one.
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_block_next(
+  Heap_Control *heap,
+  const Heap_Block *block
+)
+{
+  Heap_Block *const next = block->next;
+
+  if ( heap->tlsf != NULL ) {
+    uint32_t index;
+
+    if ( next != NULL ) {
+      return next;
+    }
+
+    index = _Heap_TLSF_index( _Heap_Block_size( block ) ) + 1;
+
+    return _Heap_TLSF_find_suitable( heap->tlsf, &index );
+  } else {
+    return next != _Heap_Free_list_tail( heap ) ? next : NULL;
+  }
+}
+
 /**
  * @brief Sets the size of the last block for heap @a heap.
  *
@@ -93,11 +93,12 @@ typedef enum {
   OBJECTS_POSIX_TIMERS              = 9,
   OBJECTS_POSIX_BARRIERS            = 10,
   OBJECTS_POSIX_SPINLOCKS           = 11,
-  OBJECTS_POSIX_RWLOCKS             = 12
+  OBJECTS_POSIX_RWLOCKS             = 12,
+  OBJECTS_POSIX_SHMS                = 13
 } Objects_POSIX_API;
 
 /** This macro is used to generically specify the last API index. */
-#define OBJECTS_POSIX_CLASSES_LAST OBJECTS_POSIX_RWLOCKS
+#define OBJECTS_POSIX_CLASSES_LAST OBJECTS_POSIX_SHMS
 
 /*
  * For fake objects, which have an object identifier, but no objects
@@ -157,6 +158,18 @@ typedef struct {
   #endif
   /** This is the maximum length of names. */
   uint16_t          name_length;
+  /**
+   * @brief The heads of the object name hash chains.
+   *
+   * The chains link the object indices via @a name_hash_next.  An index of
+   * zero terminates a chain.  This is @c NULL if the object name hash index
+   * is disabled, see rtems_configuration_get_object_name_hash().
+   */
+  Objects_Maximum  *name_hash_buckets;
+  /** This is the next index in the name hash chain for each object index. */
+  Objects_Maximum  *name_hash_next;
+  /** This is the count of name hash buckets minus one. */
+  uint32_t          name_hash_mask;
   #if defined(RTEMS_MULTIPROCESSING)
     /** This is this object class' method called when extracting a thread. */
     Objects_Thread_queue_Extract_callout extract;
@@ -797,6 +810,146 @@ RTEMS_INLINE_ROUTINE bool _Objects_Are_ids_equal(
   return ( left == right );
 }
 
+/**
+ * @brief Returns the name hash value of a 32-bit object name.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Objects_Name_hash_u32( uint32_t name )
+{
+  /* Fibonacci hashing, the upper bits are the best */
+  return ( name * UINT32_C( 2654435761 ) ) >> 16;
+}
+
+/**
+ * @brief Returns the name hash value of a string object name.
+ *
+ * At most @a max_length characters are used to be consistent with
+ * _Objects_Get_by_name().
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Objects_Name_hash_string(
+  const char *name,
+  size_t      max_length
+)
+{
+  uint32_t hash = UINT32_C( 2166136261 );
+  size_t   i;
+
+  /* FNV-1a */
+  for ( i = 0; i < max_length && name[ i ] != '\0'; ++i ) {
+    hash = ( hash ^ (unsigned char) name[ i ] ) * UINT32_C( 16777619 );
+  }
+
+  return _Objects_Name_hash_u32( hash );
+}
+
+/**
+ * @brief Builds the object name hash index for a new local table.
+ *
+ * All objects of the local table with an index less than @a index_end are
+ * inserted into the @a buckets.
+ *
+ * @param[in] information The object information table.
+ * @param[in] local_table The local table.
+ * @param[in] index_end The end of the used local table indices.
+ * @param[out] buckets The name hash bucket table with @a mask plus one
+ *   entries.
+ * @param[out] next The name hash chain table with @a index_end entries.
+ * @param[in] mask The count of name hash buckets minus one.
+ */
+void _Objects_Name_hash_build(
+  const Objects_Information  *information,
+  Objects_Control           **local_table,
+  uint32_t                    index_end,
+  Objects_Maximum            *buckets,
+  Objects_Maximum            *next,
+  uint32_t                    mask
+);
+
+void _Objects_Do_name_hash_insert(
+  Objects_Information *information,
+  Objects_Control     *the_object
+);
+
+void _Objects_Do_name_hash_remove(
+  Objects_Information *information,
+  Objects_Control     *the_object
+);
+
+/**
+ * @brief Inserts the object into the name hash index if it is enabled.
+ *
+ * The object allocator mutex must be owned by the caller or the system is
+ * not up.
+ *
+ * @param[in] information The object information table.
+ * @param[in] the_object The object with a valid identifier and name.
+ */
+RTEMS_INLINE_ROUTINE void _Objects_Name_hash_insert(
+  Objects_Information *information,
+  Objects_Control     *the_object
+)
+{
+  if ( information->name_hash_buckets != NULL ) {
+    _Objects_Do_name_hash_insert( information, the_object );
+  }
+}
+
+/**
+ * @brief Removes the object from the name hash index if it is enabled.
+ *
+ * The name of the object must be the one used to insert the object.
+ *
+ * @param[in] information The object information table.
+ * @param[in] the_object The object.
+ *
+ * @see _Objects_Name_hash_insert().
+ */
+RTEMS_INLINE_ROUTINE void _Objects_Name_hash_remove(
+  Objects_Information *information,
+  Objects_Control     *the_object
+)
+{
+  if ( information->name_hash_buckets != NULL ) {
+    _Objects_Do_name_hash_remove( information, the_object );
+  }
+}
+
+/**
+ * @brief Finds the local object with the lowest index and the specified
+ * 32-bit name in the name hash index.
+ *
+ * The name hash index must be enabled and the object allocator mutex must be
+ * owned by the caller.
+ *
+ * @param[in] information The object information table.
+ * @param[in] name The object name.
+ *
+ * @retval NULL No such object.
+ * @retval object The object.
+ */
+Objects_Control *_Objects_Name_hash_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name
+);
+
+#if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+/**
+ * @brief Finds the local object with the lowest index and the specified
+ * string name in the name hash index.
+ *
+ * @param[in] information The object information table.
+ * @param[in] name The object name.
+ *
+ * @retval NULL No such object.
+ * @retval object The object.
+ *
+ * @see _Objects_Name_hash_find_u32().
+ */
+Objects_Control *_Objects_Name_hash_find_string(
+  const Objects_Information *information,
+  const char                *name
+);
+#endif
+
 /**
  * This function sets the pointer to the local_table object
  * referenced by the index.
@@ -883,6 +1036,8 @@ RTEMS_INLINE_ROUTINE void _Objects_Open(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  _Objects_Name_hash_insert( information, the_object );
 }
 
 /**
@@ -907,6 +1062,8 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_u32(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  _Objects_Name_hash_insert( information, the_object );
 }
 
 /**
@@ -933,6 +1090,8 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  _Objects_Name_hash_insert( information, the_object );
 }
 
 /**
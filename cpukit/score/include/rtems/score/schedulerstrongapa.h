@@ -26,6 +26,7 @@
 #include <rtems/score/scheduler.h>
 #include <rtems/score/schedulerpriority.h>
 #include <rtems/score/schedulersmp.h>
+#include <rtems/score/cpuset.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -36,25 +37,87 @@ extern "C" {
  *
  * @ingroup ScoreSchedulerSMP
  *
- * This is an implementation of the global fixed priority scheduler (G-FP).  It
- * uses one ready chain per priority to ensure constant time insert operations.
- * The scheduled chain uses linear insert operations and has at most processor
- * count entries.  Since the processor and priority count are constants all
- * scheduler operations complete in a bounded execution time.
+ * This is an implementation of the global fixed priority scheduler with
+ * arbitrary processor affinities according to the strong APA (arbitrary
+ * processor affinity) scheduling rules of Bradenburg and Gujarati.  It uses
+ * one ready chain per priority to ensure constant time insert operations.
+ *
+ * In contrast to the simple affinity schedulers a node is not restricted to
+ * displace a node executing on one of its own processors.  In case a node
+ * becomes ready, then a breadth-first search over the processors determines
+ * the lowest priority scheduled node reachable by a displacement chain.  Each
+ * link of such a chain moves a scheduled node to another processor of its
+ * affinity set.  In case a processor becomes available, then a breadth-first
+ * search in the reverse direction determines the set of processors which can
+ * hand over their node to this processor.  The highest priority ready node
+ * with an affinity to this set is then selected with the help of the priority
+ * bit map.  The search effort is bounded by the square of the processor count.
  *
  * The the_thread preempt mode will be ignored.
  *
  * @{
  */
 
+/**
+ * @brief Per-processor search state of Strong APA schedulers.
+ */
+typedef struct {
+  /**
+   * @brief The scheduled node executing on this processor during a search.
+   */
+  Scheduler_Node *node;
+
+  /**
+   * @brief Index of the processor preceding this processor in the
+   * breadth-first search.
+   */
+  uint32_t parent;
+
+  /**
+   * @brief Indicates if this processor was already visited by the
+   * breadth-first search.
+   */
+  bool visited;
+
+  /**
+   * @brief The processor index at this position of the breadth-first search
+   * queue.
+   */
+  uint32_t queue;
+
+  /**
+   * @brief The processor index at this position of the displacement chain.
+   */
+  uint32_t chain;
+} Scheduler_strong_APA_CPU;
+
 /**
  * @brief Scheduler context specialization for Strong APA
  * schedulers.
+ *
+ * The per-processor search states are followed by the ready chains, see
+ * RTEMS_SCHEDULER_CONTEXT_STRONG_APA().
  */
 typedef struct {
   Scheduler_SMP_Context    Base;
   Priority_bit_map_Control Bit_map;
-  Chain_Control            Ready[ RTEMS_ZERO_LENGTH_ARRAY ];
+
+  /**
+   * @brief One ready chain per priority level.
+   */
+  Chain_Control *Ready;
+
+  /**
+   * @brief The length of the displacement chain determined by the last
+   * search.
+   *
+   * The first processor of the chain receives the new scheduled node.  Each
+   * other processor receives the node of its predecessor.  The last processor
+   * is the processor of the victim node.
+   */
+  uint32_t chain_length;
+
+  Scheduler_strong_APA_CPU CPU[ RTEMS_ZERO_LENGTH_ARRAY ];
 } Scheduler_strong_APA_Context;
 
 /**
@@ -71,8 +134,23 @@ typedef struct {
    * @brief The associated ready queue of this node.
    */
   Scheduler_priority_Ready_queue Ready_queue;
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  /**
+   * @brief The thread to processor affinity.
+   */
+  CPU_set_Control Affinity;
+#endif
 } Scheduler_strong_APA_Node;
 
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  #define SCHEDULER_STRONG_APA_GET_SET_AFFINITY \
+    , _Scheduler_strong_APA_Get_affinity \
+    , _Scheduler_strong_APA_Set_affinity
+#else
+  #define SCHEDULER_STRONG_APA_GET_SET_AFFINITY
+#endif
+
 /**
  * @brief Entry points for the Strong APA Scheduler.
  */
@@ -93,7 +171,7 @@ typedef struct {
     _Scheduler_default_Cancel_job, \
     _Scheduler_default_Tick, \
     _Scheduler_SMP_Start_idle \
-    SCHEDULER_OPERATION_DEFAULT_GET_SET_AFFINITY \
+    SCHEDULER_STRONG_APA_GET_SET_AFFINITY \
   }
 
 void _Scheduler_strong_APA_Initialize( const Scheduler_Control *scheduler );
@@ -131,6 +209,22 @@ Thread_Control *_Scheduler_strong_APA_Yield(
   Thread_Control          *the_thread
 );
 
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+bool _Scheduler_strong_APA_Get_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  cpu_set_t               *cpuset
+);
+
+bool _Scheduler_strong_APA_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  const cpu_set_t         *cpuset
+);
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,253 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreSchedulerWorkStealingSMP
+ *
+ * @brief Work Stealing SMP Scheduler API
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H
+#define _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulerpriority.h>
+#include <rtems/score/schedulersmp.h>
+#include <rtems/score/cpuset.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup ScoreSchedulerWorkStealingSMP Work Stealing SMP Scheduler
+ *
+ * @ingroup ScoreSchedulerSMP
+ *
+ * This is a variant of the Deterministic Priority SMP Scheduler with one
+ * ready queue per processor.  A ready node is placed in the ready queue of
+ * its home processor.  The home processor of a node is the processor which
+ * executed it last.  In case a processor needs a new heir, then the highest
+ * priority node of its own ready queue is selected, unless another ready
+ * queue contains a node of strictly higher priority which may execute on
+ * this processor (work stealing).  Nodes of equal priority stay on their
+ * home processor to preserve cache locality.  The thread to processor
+ * affinity is honoured.  Like the Deterministic Priority Affinity SMP
+ * Scheduler, the unblock, priority update and help operations check for
+ * migrations afterwards, so that a ready node never waits while a node of
+ * lower priority executes on a processor allowed for it.
+ *
+ * In addition, each processor pulls one ready node from the busiest ready
+ * queue every SCHEDULER_WORK_STEALING_SMP_BALANCE_INTERVAL clock ticks in
+ * case the ready queues are unbalanced (periodic load balancing).
+ *
+ * The per-processor ready queues are not protected by per-processor locks.
+ * All scheduler operations of all scheduler instances are still serialized
+ * by the one global _Scheduler_Lock, which the SMP scheduler framework, the
+ * thread lock and the helping protocol depend on.  Processors contending for
+ * this lock do not scale better than with the Deterministic Priority SMP
+ * Scheduler.  The per-processor ready queues only reduce the search and cache
+ * footprint of each operation done while the lock is held.  Per-processor
+ * locks for the ready queues would require a rework of the SMP scheduler
+ * framework and are out of scope of this scheduler.
+ *
+ * @{
+ */
+
+/**
+ * @brief The count of clock ticks between two load balance attempts of a
+ * processor.
+ */
+#define SCHEDULER_WORK_STEALING_SMP_BALANCE_INTERVAL 10
+
+/**
+ * @brief A per-processor ready queue.
+ */
+typedef struct {
+  /**
+   * @brief Bit map to indicate non-empty ready chains.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief One ready chain per priority level.
+   */
+  Chain_Control *Ready;
+
+  /**
+   * @brief The count of ready nodes in this queue not owned by an idle
+   * thread.
+   */
+  uint32_t ready_count;
+
+  /**
+   * @brief The count of clock ticks since the last load balance attempt.
+   */
+  uint32_t ticks;
+} Scheduler_work_stealing_SMP_Queue;
+
+/**
+ * @brief Scheduler context specialization for Work Stealing SMP
+ * schedulers.
+ *
+ * The ready queues are followed by the ready chains of all processors, see
+ * RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP().
+ */
+typedef struct {
+  Scheduler_SMP_Context             Base;
+  Priority_Control                  maximum_priority;
+  Scheduler_work_stealing_SMP_Queue Queues[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_work_stealing_SMP_Context;
+
+/**
+ * @brief Scheduler node specialization for Work Stealing SMP schedulers.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief The associated ready queue of this node.
+   */
+  Scheduler_priority_Ready_queue Ready_queue;
+
+  /**
+   * @brief Index of the home processor of this node.
+   *
+   * A ready node is in the ready queue of its home processor.
+   */
+  uint32_t home;
+
+  /**
+   * @brief Indicates if this node belongs to an idle thread.
+   *
+   * Idle threads are not moved by the periodic load balancing.
+   */
+  bool is_idle;
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  /**
+   * @brief The thread to processor affinity.
+   */
+  CPU_set_Control Affinity;
+#endif
+} Scheduler_work_stealing_SMP_Node;
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  #define SCHEDULER_WORK_STEALING_SMP_GET_SET_AFFINITY \
+    , _Scheduler_work_stealing_SMP_Get_affinity \
+    , _Scheduler_work_stealing_SMP_Set_affinity
+#else
+  #define SCHEDULER_WORK_STEALING_SMP_GET_SET_AFFINITY
+#endif
+
+/**
+ * @brief Entry points for the Work Stealing SMP Scheduler.
+ */
+#define SCHEDULER_WORK_STEALING_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_work_stealing_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_work_stealing_SMP_Yield, \
+    _Scheduler_work_stealing_SMP_Block, \
+    _Scheduler_work_stealing_SMP_Unblock, \
+    _Scheduler_work_stealing_SMP_Update_priority, \
+    _Scheduler_default_Map_priority, \
+    _Scheduler_default_Unmap_priority, \
+    _Scheduler_work_stealing_SMP_Ask_for_help, \
+    _Scheduler_work_stealing_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_default_Cancel_job, \
+    _Scheduler_work_stealing_SMP_Tick, \
+    _Scheduler_work_stealing_SMP_Start_idle \
+    SCHEDULER_WORK_STEALING_SMP_GET_SET_AFFINITY \
+  }
+
+void _Scheduler_work_stealing_SMP_Initialize(
+  const Scheduler_Control *scheduler
+);
+
+void _Scheduler_work_stealing_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+void _Scheduler_work_stealing_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+);
+
+Thread_Control *_Scheduler_work_stealing_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+);
+
+Thread_Control *_Scheduler_work_stealing_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+);
+
+Thread_Control *_Scheduler_work_stealing_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *offers_help,
+  Thread_Control          *needs_help
+);
+
+Thread_Control *_Scheduler_work_stealing_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+);
+
+/**
+ * @brief Performs the time slice handling and the periodic load balancing
+ * for the processor of the executing thread.
+ *
+ * @param[in] scheduler The scheduler instance.
+ * @param[in] executing The executing thread of the current processor.
+ */
+void _Scheduler_work_stealing_SMP_Tick(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *executing
+);
+
+void _Scheduler_work_stealing_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  struct Per_CPU_Control  *cpu
+);
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+bool _Scheduler_work_stealing_SMP_Get_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  cpu_set_t               *cpuset
+);
+
+bool _Scheduler_work_stealing_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  const cpu_set_t         *cpuset
+);
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H */
@@ -99,6 +99,54 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+/**
+ * @brief The count of expiration time bits covered by one level of a
+ * watchdog timer wheel.
+ */
+#define WATCHDOG_WHEEL_LEVEL_BITS 6
+
+/**
+ * @brief The count of slots of one level of a watchdog timer wheel.
+ */
+#define WATCHDOG_WHEEL_SLOT_COUNT ( 1U << WATCHDOG_WHEEL_LEVEL_BITS )
+
+/**
+ * @brief The count of levels of a watchdog timer wheel.
+ *
+ * Watchdogs which expire more than 2**30 - 1 ticks in the future are kept in
+ * the last slot reachable by the highest level and move down once this slot
+ * is due.
+ */
+#define WATCHDOG_WHEEL_LEVEL_COUNT 5
+
+/**
+ * @brief A hashed hierarchical timer wheel.
+ *
+ * The wheel is an alternative to the red-black tree of a watchdog header for
+ * watchdogs with an expiration time in clock ticks.  Insert and remove
+ * operations are O(1).  The watchdogs of level zero slots expire at the tick
+ * indicated by the slot.  Each time the lower level wrapped around, the
+ * watchdogs of the current slot of a higher level are distributed to the
+ * lower levels (cascade).
+ *
+ * @see _Watchdog_Header_initialize_wheel().
+ */
+typedef struct {
+  /**
+   * @brief The next tick to process.
+   */
+  uint64_t base;
+
+  /**
+   * @brief The slots of each level.
+   *
+   * A watchdog is in level @c l if its expiration time is less than
+   * 2**( ( l + 1 ) * WATCHDOG_WHEEL_LEVEL_BITS ) ticks after the base.
+   */
+  Chain_Control
+    Slots[ WATCHDOG_WHEEL_LEVEL_COUNT ][ WATCHDOG_WHEEL_SLOT_COUNT ];
+} Watchdog_Wheel;
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -113,6 +161,11 @@ typedef struct {
    * case no watchdog is scheduled.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timer wheel used instead of the red-black tree or NULL.
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -158,6 +211,19 @@ struct Watchdog_Control {
  */
 extern volatile Watchdog_Interval _Watchdog_Ticks_since_boot;
 
+/**
+ * @brief Uses the timer wheels for the relative watchdogs of the processors.
+ *
+ * The wheel of index @c i is used by the processor of index @c i.  This
+ * function is called by <rtems/confdefs.h> during system initialization
+ * before the first watchdog is inserted in case
+ * CONFIGURE_WATCHDOG_TIMER_WHEEL is defined.
+ *
+ * @param[in] wheels The timer wheels.
+ * @param[in] count The count of timer wheels.
+ */
+void _Watchdog_Initialize_wheels( Watchdog_Wheel *wheels, size_t count );
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -93,8 +93,23 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
 }
 
+/**
+ * @brief Initializes a watchdog header which uses a timer wheel.
+ *
+ * @param[in] header The watchdog header.
+ * @param[in] wheel The timer wheel.
+ * @param[in] now The current time in ticks.  The next tickle must use a now
+ *   value of @a now plus one.
+ */
+void _Watchdog_Header_initialize_wheel(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+);
+
 RTEMS_INLINE_ROUTINE void _Watchdog_Header_destroy(
   Watchdog_Header *header
 )
@@ -201,6 +216,28 @@ void _Watchdog_Do_tickle(
     _Watchdog_Do_tickle( header, now, lock_context )
 #endif
 
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+);
+
+void _Watchdog_Do_wheel_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Do_wheel_tickle( wheel, now, lock, lock_context )
+#else
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Do_wheel_tickle( wheel, now, lock_context )
+#endif
+
 /**
  * @brief Inserts a watchdog into the set of scheduled watchdogs according to
  * the specified expiration time.
@@ -103,6 +103,7 @@ bool _CORE_message_queue_Initialize(
   );
 
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+  the_message_queue->number_of_loaned_messages = 0;
 
   _Thread_queue_Initialize( &the_message_queue->Wait_queue );
 
@@ -45,15 +45,29 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 )
 {
-  Chain_Control *pending_messages;
-
-  the_message->Contents.size = content_size;
-
   _CORE_message_queue_Copy_buffer(
     content_source,
     the_message->Contents.buffer,
     content_size
   );
+  _CORE_message_queue_Insert_loaned_message(
+    the_message_queue,
+    the_message,
+    content_size,
+    submit_type
+  );
+}
+
+void _CORE_message_queue_Insert_loaned_message(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             content_size,
+  CORE_message_queue_Submit_types    submit_type
+)
+{
+  Chain_Control *pending_messages;
+
+  the_message->Contents.size = content_size;
 
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
   the_message->priority = submit_type;
@@ -0,0 +1,148 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Submit and Seize of Loaned Message Buffers
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/statesimpl.h>
+
+Status_Control _CORE_message_queue_Submit_loan(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+)
+{
+  Thread_Control *the_thread;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  _CORE_message_queue_Return_message_buffer( the_message_queue, the_message );
+
+  if ( the_message_queue->number_of_pending_messages == 0 ) {
+    the_thread = _Thread_queue_First_locked(
+      &the_message_queue->Wait_queue,
+      the_message_queue->operations
+    );
+  } else {
+    the_thread = NULL;
+  }
+
+  if ( the_thread == NULL ) {
+    _CORE_message_queue_Insert_loaned_message(
+      the_message_queue,
+      the_message,
+      size,
+      submit_type
+    );
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+    if (
+      the_message_queue->number_of_pending_messages == 1
+        && the_message_queue->notify_handler != NULL
+    ) {
+      ( *the_message_queue->notify_handler )(
+        the_message_queue,
+        queue_context
+      );
+    } else {
+      _CORE_message_queue_Release( the_message_queue, queue_context );
+    }
+#else
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   *  A receiver waits for a message.  Hand over the message buffer in case it
+   *  accepts a loan, otherwise copy the message content.
+   */
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_LOAN ) {
+    _CORE_message_queue_Loan_message_buffer( the_message_queue, the_message );
+    the_message->Contents.size = size;
+    *(CORE_message_queue_Buffer_control **)
+      the_thread->Wait.return_argument = the_message;
+  } else {
+    *(size_t *) the_thread->Wait.return_argument = size;
+    _CORE_message_queue_Copy_buffer(
+      the_message->Contents.buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  }
+
+  the_thread->Wait.count = (uint32_t) submit_type;
+
+  _Thread_queue_Extract_critical(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    the_thread,
+    queue_context
+  );
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Seize_loan(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  CORE_message_queue_Buffer_control **the_message_p,
+  bool                                wait,
+  Thread_queue_Context               *queue_context
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _CORE_message_queue_Loan_message_buffer( the_message_queue, the_message );
+
+    *the_message_p = the_message;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  executing->Wait.return_argument = the_message_p;
+  executing->Wait.option = CORE_MESSAGE_QUEUE_RECEIVE_LOAN;
+  /* Wait.count will be filled in with the message priority */
+
+  _Thread_queue_Context_set_expected_level( queue_context, 1 );
+  _Thread_queue_Enqueue_critical(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    STATES_WAITING_FOR_MESSAGE,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
@@ -186,6 +186,187 @@ static uintptr_t _Heap_Check_block(
   return 0;
 }
 
+static uintptr_t _Heap_Check_free_block(
+  const Heap_Control *heap,
+  const Heap_Block *block,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t block_size_floor
+)
+{
+  _HAssert( _Heap_Is_prev_used( block ) );
+
+  /*
+   * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
+   * field.  Thus the value is about one unit larger than the real block
+   * size.  The greater than operator takes this into account.
+   */
+  if ( block->size_and_flag > block_size_floor ) {
+    if ( alignment == 0 ) {
+      return _Heap_Alloc_area_of_block( block );
+    } else {
+      return _Heap_Check_block(
+        heap,
+        block,
+        alloc_size,
+        alignment,
+        boundary
+      );
+    }
+  }
+
+  return 0;
+}
+
+static Heap_Block *_Heap_First_fit_search(
+  Heap_Control *heap,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t block_size_floor,
+  uintptr_t *alloc_begin,
+  uint32_t *search_count
+)
+{
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Block *block = _Heap_Free_list_first( heap );
+
+  while ( block != free_list_tail ) {
+    _Heap_Protection_block_check( heap, block );
+
+    *alloc_begin = _Heap_Check_free_block(
+      heap,
+      block,
+      alloc_size,
+      alignment,
+      boundary,
+      block_size_floor
+    );
+
+    /* Statistics */
+    ++*search_count;
+
+    if ( *alloc_begin != 0 ) {
+      break;
+    }
+
+    block = block->next;
+  }
+
+  return block;
+}
+
+/*
+ * Searches the free blocks in the TLSF lists with an index in the range
+ * begin (inclusive) to end (exclusive).
+ */
+static Heap_Block *_Heap_TLSF_search_range(
+  Heap_Control *heap,
+  uint32_t begin,
+  uint32_t end,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t block_size_floor,
+  uintptr_t *alloc_begin,
+  uint32_t *search_count
+)
+{
+  uint32_t index = begin;
+  Heap_Block *block = _Heap_TLSF_find_suitable( heap->tlsf, &index );
+
+  while ( block != NULL && index < end ) {
+    _Heap_Protection_block_check( heap, block );
+
+    *alloc_begin = _Heap_Check_free_block(
+      heap,
+      block,
+      alloc_size,
+      alignment,
+      boundary,
+      block_size_floor
+    );
+
+    /* Statistics */
+    ++*search_count;
+
+    if ( *alloc_begin != 0 ) {
+      return block;
+    }
+
+    if ( block->next != NULL ) {
+      block = block->next;
+    } else {
+      ++index;
+      block = _Heap_TLSF_find_suitable( heap->tlsf, &index );
+    }
+  }
+
+  return NULL;
+}
+
+/*
+ * The first search uses the lists in which each block is large enough to
+ * satisfy the request including the worst case alignment overhead.  In case
+ * no alignment and boundary are requested, then the first block found is a
+ * fit and the search time is constant.  Only if this fails, then the lists
+ * with blocks which may be large enough are searched.
+ */
+static Heap_Block *_Heap_TLSF_search(
+  Heap_Control *heap,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t block_size_floor,
+  uintptr_t *alloc_begin,
+  uint32_t *search_count
+)
+{
+  uintptr_t good_fit_size = block_size_floor + 1;
+  uint32_t good_fit_index;
+  Heap_Block *block;
+
+  if ( alignment != 0 ) {
+    good_fit_size += alignment + heap->min_block_size;
+
+    if ( good_fit_size <= block_size_floor ) {
+      /* Integer overflow */
+      good_fit_size = UINTPTR_MAX;
+    }
+  }
+
+  good_fit_index = _Heap_TLSF_search_index( good_fit_size );
+
+  block = _Heap_TLSF_search_range(
+    heap,
+    good_fit_index,
+    UINT32_MAX,
+    alloc_size,
+    alignment,
+    boundary,
+    block_size_floor,
+    alloc_begin,
+    search_count
+  );
+
+  if ( block == NULL ) {
+    block = _Heap_TLSF_search_range(
+      heap,
+      _Heap_TLSF_index( block_size_floor + 1 ),
+      good_fit_index,
+      alloc_size,
+      alignment,
+      boundary,
+      block_size_floor,
+      alloc_begin,
+      search_count
+    );
+  }
+
+  return block;
+}
+
 void *_Heap_Allocate_aligned_with_boundary(
   Heap_Control *heap,
   uintptr_t alloc_size,
@@ -218,41 +399,26 @@ void *_Heap_Allocate_aligned_with_boundary(
   }
 
   do {
-    Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-
-    block = _Heap_Free_list_first( heap );
-    while ( block != free_list_tail ) {
-      _HAssert( _Heap_Is_prev_used( block ) );
-
-      _Heap_Protection_block_check( heap, block );
-
-      /*
-       * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
-       * field.  Thus the value is about one unit larger than the real block
-       * size.  The greater than operator takes this into account.
-       */
-      if ( block->size_and_flag > block_size_floor ) {
-        if ( alignment == 0 ) {
-          alloc_begin = _Heap_Alloc_area_of_block( block );
-        } else {
-          alloc_begin = _Heap_Check_block(
-            heap,
-            block,
-            alloc_size,
-            alignment,
-            boundary
-          );
-        }
-      }
-
-      /* Statistics */
-      ++search_count;
-
-      if ( alloc_begin != 0 ) {
-        break;
-      }
-
-      block = block->next;
+    if ( heap->tlsf != NULL ) {
+      block = _Heap_TLSF_search(
+        heap,
+        alloc_size,
+        alignment,
+        boundary,
+        block_size_floor,
+        &alloc_begin,
+        &search_count
+      );
+    } else {
+      block = _Heap_First_fit_search(
+        heap,
+        alloc_size,
+        alignment,
+        boundary,
+        block_size_floor,
+        &alloc_begin,
+        &search_count
+      );
     }
 
     search_again = _Heap_Protection_free_delayed_blocks( heap, alloc_begin );
@@ -36,13 +36,16 @@ static void _Heap_Free_block( Heap_Control *heap, Heap_Block *block )
   /*
    * The _Heap_Free() will place the block to the head of free list.  We want
    * the new block at the end of the free list.  So that initial and earlier
-   * areas are consumed first.
+   * areas are consumed first.  The TLSF free block index has no such order.
    */
   _Heap_Free( heap, (void *) _Heap_Alloc_area_of_block( block ) );
   _Heap_Protection_free_all_delayed_blocks( heap );
-  first_free = _Heap_Free_list_first( heap );
-  _Heap_Free_list_remove( first_free );
-  _Heap_Free_list_insert_before( _Heap_Free_list_tail( heap ), first_free );
+
+  if ( heap->tlsf == NULL ) {
+    first_free = _Heap_Free_list_first( heap );
+    _Heap_Free_list_remove( first_free );
+    _Heap_Free_list_insert_before( _Heap_Free_list_tail( heap ), first_free );
+  }
 }
 
 static void _Heap_Merge_below(
@@ -146,6 +149,15 @@ uintptr_t _Heap_Extend(
     return 0;
   }
 
+  if (
+    heap->tlsf != NULL
+      && extend_area_end > (uintptr_t) heap->tlsf
+      && (uintptr_t) ( heap->tlsf + 1 ) > extend_area_begin
+  ) {
+    /* The extend area overlaps the TLSF free block index */
+    return 0;
+  }
+
   extend_area_ok = _Heap_Get_first_and_last_block(
     extend_area_begin,
     extend_area_size,
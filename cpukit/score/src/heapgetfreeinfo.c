@@ -28,15 +28,14 @@ void _Heap_Get_free_information(
 )
 {
   Heap_Block *the_block;
-  Heap_Block *const tail = _Heap_Free_list_tail(the_heap);
 
   info->number = 0;
   info->largest = 0;
   info->total = 0;
 
-  for(the_block = _Heap_Free_list_first(the_heap);
-      the_block != tail;
-      the_block = the_block->next)
+  for(the_block = _Heap_Free_block_first(the_heap);
+      the_block != NULL;
+      the_block = _Heap_Free_block_next(the_heap, the_block))
   {
     uint32_t const the_size = _Heap_Block_size(the_block);
 
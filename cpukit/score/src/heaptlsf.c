@@ -0,0 +1,65 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreHeap
+ *
+ * @brief Heap Handler TLSF Initialization
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+uintptr_t _Heap_Initialize_TLSF(
+  Heap_Control *heap,
+  void *heap_area_begin_ptr,
+  uintptr_t heap_area_size,
+  uintptr_t page_size
+)
+{
+  uintptr_t const heap_area_begin = (uintptr_t) heap_area_begin_ptr;
+  uintptr_t const tlsf_begin =
+    _Heap_Align_up( heap_area_begin, CPU_ALIGNMENT );
+  uintptr_t const tlsf_end = tlsf_begin + sizeof( Heap_TLSF_control );
+  uintptr_t const overhead = tlsf_end - heap_area_begin;
+  Heap_TLSF_control *const tlsf = (Heap_TLSF_control *) tlsf_begin;
+  Heap_Block *first_block;
+  uintptr_t space_available;
+
+  if ( tlsf_begin < heap_area_begin || heap_area_size <= overhead ) {
+    /* Integer overflow or area too small */
+    return 0;
+  }
+
+  space_available = _Heap_Initialize(
+    heap,
+    (void *) tlsf_end,
+    heap_area_size - overhead,
+    page_size
+  );
+  if ( space_available == 0 ) {
+    return 0;
+  }
+
+  memset( tlsf, 0, sizeof( *tlsf ) );
+
+  /* Move the first block from the free list to the index */
+  first_block = heap->first_block;
+  _Heap_Free_list_remove( first_block );
+  _Heap_TLSF_insert( tlsf, first_block );
+  heap->tlsf = tlsf;
+
+  return space_available;
+}
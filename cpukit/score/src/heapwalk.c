@@ -120,6 +120,122 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_TLSF_lists(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  uintptr_t const page_size = heap->page_size;
+  const Heap_TLSF_control *const tlsf = heap->tlsf;
+  uint32_t fl;
+
+  for ( fl = 0; fl < HEAP_TLSF_FL_COUNT; ++fl ) {
+    bool const fl_set = ( tlsf->fl_bitmap & ( UINT32_C( 1 ) << fl ) ) != 0;
+    uint32_t sl;
+
+    if ( fl_set != ( tlsf->sl_bitmap [fl] != 0 ) ) {
+      (*printer)(
+        source,
+        true,
+        "TLSF class %u: inconsistent bitmaps\n",
+        fl
+      );
+
+      return false;
+    }
+
+    for ( sl = 0; sl < HEAP_TLSF_SL_COUNT; ++sl ) {
+      uint32_t const index = ( fl << HEAP_TLSF_SL_SHIFT ) | sl;
+      bool const sl_set =
+        ( tlsf->sl_bitmap [fl] & ( UINT32_C( 1 ) << sl ) ) != 0;
+      const Heap_Block *prev_block = NULL;
+      const Heap_Block *free_block = tlsf->lists [fl] [sl];
+
+      if ( sl_set != ( free_block != NULL ) ) {
+        (*printer)(
+          source,
+          true,
+          "TLSF list %u: inconsistent bitmap\n",
+          index
+        );
+
+        return false;
+      }
+
+      while ( free_block != NULL ) {
+        if ( !_Heap_Is_block_in_heap( heap, free_block ) ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: not in heap\n",
+            free_block
+          );
+
+          return false;
+        }
+
+        if (
+          !_Heap_Is_aligned(
+            _Heap_Alloc_area_of_block( free_block ),
+            page_size
+          )
+        ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: alloc area not page aligned\n",
+            free_block
+          );
+
+          return false;
+        }
+
+        if ( _Heap_Is_used( free_block ) ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: is used\n",
+            free_block
+          );
+
+          return false;
+        }
+
+        if ( free_block->prev != prev_block ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: invalid previous block 0x%08x\n",
+            free_block,
+            free_block->prev
+          );
+
+          return false;
+        }
+
+        if ( _Heap_TLSF_index( _Heap_Block_size( free_block ) ) != index ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: size %u not in TLSF list %u\n",
+            free_block,
+            _Heap_Block_size( free_block ),
+            index
+          );
+
+          return false;
+        }
+
+        prev_block = free_block;
+        free_block = free_block->next;
+      }
+    }
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
@@ -128,6 +244,22 @@ static bool _Heap_Walk_is_in_free_list(
   const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
   const Heap_Block *free_block = _Heap_Free_list_first( heap );
 
+  if ( heap->tlsf != NULL ) {
+    uint32_t const index = _Heap_TLSF_index( _Heap_Block_size( block ) );
+
+    free_block = heap->tlsf->lists
+      [index >> HEAP_TLSF_SL_SHIFT] [index & ( HEAP_TLSF_SL_COUNT - 1 )];
+
+    while ( free_block != NULL ) {
+      if ( free_block == block ) {
+        return true;
+      }
+      free_block = free_block->next;
+    }
+
+    return false;
+  }
+
   while ( free_block != free_list_tail ) {
     if ( free_block == block ) {
       return true;
@@ -237,6 +369,22 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
+  if ( heap->tlsf != NULL ) {
+    if (
+      _Heap_Free_list_first( heap ) != _Heap_Free_list_tail( heap )
+    ) {
+      (*printer)(
+        source,
+        true,
+        "free list: not empty in TLSF mode\n"
+      );
+
+      return false;
+    }
+
+    return _Heap_Walk_check_TLSF_lists( source, printer, heap );
+  }
+
   return _Heap_Walk_check_free_list( source, printer, heap );
 }
 
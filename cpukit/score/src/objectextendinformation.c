@@ -25,6 +25,7 @@
 #include <rtems/score/isrlevel.h>
 #include <rtems/score/sysstate.h>
 #include <rtems/score/wkspace.h>
+#include <rtems/config.h>
 
 #include <string.h>  /* for memcpy() */
 
@@ -121,6 +122,10 @@ void _Objects_Extend_information(
     size_t            block_size;
     uintptr_t         object_blocks_size;
     uintptr_t         inactive_per_block_size;
+    uintptr_t         name_hash_size;
+    uint32_t          name_hash_mask;
+    Objects_Maximum  *name_hash_next;
+    Objects_Maximum  *name_hash_buckets;
 
     /*
      *  Growing the tables means allocating a new area, doing a copy and
@@ -134,6 +139,11 @@ void _Objects_Extend_information(
      *      void            *objects[block_count];
      *      uint32_t         inactive_count[block_count];
      *      Objects_Control *local_table[maximum];
+     *      Objects_Maximum  name_hash_next[maximum];
+     *      Objects_Maximum  name_hash_buckets[name_hash_mask + 1];
+     *
+     *  The name hash tables are only present if the object name hash index
+     *  is enabled.
      *
      *  This is the order in memory. Watch changing the order. See the memcpy
      *  below.
@@ -159,8 +169,25 @@ void _Objects_Extend_information(
             (void*)(block_count * sizeof(uint32_t)),
             CPU_ALIGNMENT
         );
+    if ( rtems_configuration_get_object_name_hash() ) {
+      /*
+       *  Use at least one bucket per object to get short hash chains.
+       */
+      name_hash_mask = 1;
+      while ( name_hash_mask < maximum )
+        name_hash_mask <<= 1;
+      --name_hash_mask;
+
+      name_hash_size = (maximum + minimum_index + name_hash_mask + 1) *
+        sizeof(Objects_Maximum);
+    } else {
+      name_hash_mask = 0;
+      name_hash_size = 0;
+    }
+
     block_size = object_blocks_size + inactive_per_block_size +
-        ((maximum + minimum_index) * sizeof(Objects_Control *));
+        ((maximum + minimum_index) * sizeof(Objects_Control *)) +
+        name_hash_size;
     if ( information->auto_extend ) {
       object_blocks = _Workspace_Allocate( block_size );
       if ( !object_blocks ) {
@@ -183,6 +210,15 @@ void _Objects_Extend_information(
         inactive_per_block_size
     );
 
+    if ( name_hash_size != 0 ) {
+      name_hash_next =
+        (Objects_Maximum *) &local_table[ maximum + minimum_index ];
+      name_hash_buckets = &name_hash_next[ maximum + minimum_index ];
+    } else {
+      name_hash_next = NULL;
+      name_hash_buckets = NULL;
+    }
+
     /*
      *  Take the block count down. Saves all the (block_count - 1)
      *  in the copies.
@@ -225,6 +261,20 @@ void _Objects_Extend_information(
       local_table[ index ] = NULL;
     }
 
+    /*
+     *  Rebuild the name hash index since the bucket count changed.
+     */
+    if ( name_hash_buckets != NULL ) {
+      _Objects_Name_hash_build(
+        information,
+        local_table,
+        maximum + minimum_index,
+        name_hash_buckets,
+        name_hash_next,
+        name_hash_mask
+      );
+    }
+
     /* FIXME: https://devel.rtems.org/ticket/2280 */
     _ISR_lock_ISR_disable( &lock_context );
 
@@ -233,6 +283,9 @@ void _Objects_Extend_information(
     information->object_blocks = object_blocks;
     information->inactive_per_block = inactive_per_block;
     information->local_table = local_table;
+    information->name_hash_buckets = name_hash_buckets;
+    information->name_hash_next = name_hash_next;
+    information->name_hash_mask = name_hash_mask;
     information->maximum = (Objects_Maximum) maximum;
     information->maximum_id = _Objects_Build_id(
         information->the_api,
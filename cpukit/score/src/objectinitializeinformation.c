@@ -49,6 +49,9 @@ void _Objects_Do_initialize_information(
   information->inactive_per_block = 0;
   information->object_blocks      = 0;
   information->inactive           = 0;
+  information->name_hash_buckets  = NULL;
+  information->name_hash_next     = NULL;
+  information->name_hash_mask     = 0;
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     information->is_string        = is_string;
   #endif
@@ -0,0 +1,224 @@
+/**
+ * @file
+ *
+ * @brief Object Name Hash Index
+ * @ingroup Score
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/assert.h>
+
+#include <string.h>
+
+static bool _Objects_Name_hash_get_bucket(
+  const Objects_Information *information,
+  const Objects_Control     *the_object,
+  uint32_t                   mask,
+  uint32_t                  *bucket
+)
+{
+  uint32_t hash;
+
+#if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+  if ( information->is_string ) {
+    if ( the_object->name.name_p == NULL ) {
+      return false;
+    }
+
+    hash = _Objects_Name_hash_string(
+      the_object->name.name_p,
+      information->name_length
+    );
+  } else
+#endif
+  {
+    hash = _Objects_Name_hash_u32( the_object->name.name_u32 );
+  }
+
+  *bucket = hash & mask;
+  return true;
+}
+
+void _Objects_Name_hash_build(
+  const Objects_Information  *information,
+  Objects_Control           **local_table,
+  uint32_t                    index_end,
+  Objects_Maximum            *buckets,
+  Objects_Maximum            *next,
+  uint32_t                    mask
+)
+{
+  uint32_t index;
+
+  memset( buckets, 0, ( mask + 1 ) * sizeof( *buckets ) );
+  memset( next, 0, index_end * sizeof( *next ) );
+
+  for ( index = 1; index < index_end; ++index ) {
+    Objects_Control *the_object;
+    uint32_t         bucket;
+
+    the_object = local_table[ index ];
+
+    if (
+      the_object != NULL
+        && _Objects_Name_hash_get_bucket(
+          information,
+          the_object,
+          mask,
+          &bucket
+        )
+    ) {
+      next[ index ] = buckets[ bucket ];
+      buckets[ bucket ] = (Objects_Maximum) index;
+    }
+  }
+}
+
+void _Objects_Do_name_hash_insert(
+  Objects_Information *information,
+  Objects_Control     *the_object
+)
+{
+  uint32_t        bucket;
+  Objects_Maximum index;
+
+  if (
+    !_Objects_Name_hash_get_bucket(
+      information,
+      the_object,
+      information->name_hash_mask,
+      &bucket
+    )
+  ) {
+    return;
+  }
+
+  index = (Objects_Maximum) _Objects_Get_index( the_object->id );
+  information->name_hash_next[ index ] =
+    information->name_hash_buckets[ bucket ];
+  information->name_hash_buckets[ bucket ] = index;
+}
+
+void _Objects_Do_name_hash_remove(
+  Objects_Information *information,
+  Objects_Control     *the_object
+)
+{
+  uint32_t         bucket;
+  Objects_Maximum  index;
+  Objects_Maximum *link;
+
+  if (
+    !_Objects_Name_hash_get_bucket(
+      information,
+      the_object,
+      information->name_hash_mask,
+      &bucket
+    )
+  ) {
+    return;
+  }
+
+  index = (Objects_Maximum) _Objects_Get_index( the_object->id );
+  link = &information->name_hash_buckets[ bucket ];
+
+  while ( *link != 0 ) {
+    if ( *link == index ) {
+      *link = information->name_hash_next[ index ];
+      information->name_hash_next[ index ] = 0;
+      return;
+    }
+
+    link = &information->name_hash_next[ *link ];
+  }
+}
+
+Objects_Control *_Objects_Name_hash_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name
+)
+{
+  Objects_Control *found;
+  Objects_Maximum  index;
+
+  _Assert( information->name_hash_buckets != NULL );
+
+  found = NULL;
+  index = information->name_hash_buckets[
+    _Objects_Name_hash_u32( name ) & information->name_hash_mask
+  ];
+
+  /*
+   * Return the object with the lowest index to get the same result as the
+   * linear search of the local table.
+   */
+  while ( index != 0 ) {
+    Objects_Control *the_object;
+
+    the_object = information->local_table[ index ];
+
+    if (
+      the_object != NULL
+        && the_object->name.name_u32 == name
+        && ( found == NULL || the_object->id < found->id )
+    ) {
+      found = the_object;
+    }
+
+    index = information->name_hash_next[ index ];
+  }
+
+  return found;
+}
+
+#if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+Objects_Control *_Objects_Name_hash_find_string(
+  const Objects_Information *information,
+  const char                *name
+)
+{
+  Objects_Control *found;
+  Objects_Maximum  index;
+  size_t           max_name_length;
+
+  _Assert( information->name_hash_buckets != NULL );
+
+  found = NULL;
+  max_name_length = information->name_length;
+  index = information->name_hash_buckets[
+    _Objects_Name_hash_string( name, max_name_length )
+      & information->name_hash_mask
+  ];
+
+  while ( index != 0 ) {
+    Objects_Control *the_object;
+
+    the_object = information->local_table[ index ];
+
+    if (
+      the_object != NULL
+        && the_object->name.name_p != NULL
+        && strncmp( name, the_object->name.name_p, max_name_length ) == 0
+        && ( found == NULL || the_object->id < found->id )
+    ) {
+      found = the_object;
+    }
+
+    index = information->name_hash_next[ index ];
+  }
+
+  return found;
+}
+#endif
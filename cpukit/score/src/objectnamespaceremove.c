@@ -27,6 +27,8 @@ void _Objects_Namespace_remove(
   Objects_Control      *the_object
 )
 {
+  _Objects_Name_hash_remove( information, the_object );
+
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     /*
      *  If this is a string format name, then free the memory.
@@ -51,7 +51,16 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_u32(
       ))
    search_local_node = true;
 
-  if ( search_local_node ) {
+  if ( search_local_node && information->name_hash_buckets != NULL ) {
+    _Objects_Allocator_lock();
+    the_object = _Objects_Name_hash_find_u32( information, name );
+    _Objects_Allocator_unlock();
+
+    if ( the_object != NULL ) {
+      *id = the_object->id;
+      return OBJECTS_NAME_OR_ID_LOOKUP_SUCCESSFUL;
+    }
+  } else if ( search_local_node ) {
     for ( index = 1; index <= information->maximum; index++ ) {
       the_object = information->local_table[ index ];
       if ( !the_object )
@@ -27,6 +27,10 @@
 #include <rtems/score/schedulerstrongapa.h>
 #include <rtems/score/schedulerpriorityimpl.h>
 #include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/cpusetimpl.h>
+#include <rtems/config.h>
+
+#define SCHEDULER_STRONG_APA_NO_PARENT UINT32_MAX
 
 static Scheduler_strong_APA_Context *_Scheduler_strong_APA_Get_self(
   Scheduler_Context *context
@@ -41,6 +45,182 @@ _Scheduler_strong_APA_Node_downcast( Scheduler_Node *node )
   return (Scheduler_strong_APA_Node *) node;
 }
 
+static Scheduler_strong_APA_Node *
+_Scheduler_strong_APA_Thread_get_node( Thread_Control *the_thread )
+{
+  return (Scheduler_strong_APA_Node *) _Scheduler_Thread_get_node( the_thread );
+}
+
+static uint32_t _Scheduler_strong_APA_Get_processor_index(
+  Scheduler_Node *node
+)
+{
+  return _Per_CPU_Get_index(
+    _Thread_Get_CPU( _Scheduler_Node_get_user( node ) )
+  );
+}
+
+static bool _Scheduler_strong_APA_Is_allowed(
+  const Scheduler_strong_APA_Context *self,
+  Scheduler_Node                     *node,
+  uint32_t                            cpu_index
+)
+{
+  if (
+    !_Scheduler_SMP_Is_processor_owned_by_us(
+      &self->Base.Base,
+      _Per_CPU_Get_by_index( cpu_index )
+    )
+  ) {
+    return false;
+  }
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  return CPU_ISSET(
+    (int) cpu_index,
+    _Scheduler_strong_APA_Node_downcast( node )->Affinity.set
+  );
+#else
+  (void) node;
+
+  return true;
+#endif
+}
+
+static Priority_Control _Scheduler_strong_APA_Get_priority(
+  Scheduler_Node *node
+)
+{
+  return _Scheduler_SMP_Node_downcast( node )->priority;
+}
+
+/*
+ * Prepares a search.  Records the scheduled node of each processor and marks
+ * all processors as not visited.
+ */
+static void _Scheduler_strong_APA_Search_begin(
+  Scheduler_strong_APA_Context *self,
+  uint32_t                      cpu_count
+)
+{
+  Chain_Control *scheduled = &self->Base.Scheduled;
+  Chain_Node    *chain_node;
+  uint32_t       cpu_index;
+
+  self->chain_length = 0;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    Scheduler_strong_APA_CPU *cpu = &self->CPU[ cpu_index ];
+
+    cpu->node = NULL;
+    cpu->parent = SCHEDULER_STRONG_APA_NO_PARENT;
+    cpu->visited = false;
+  }
+
+  for (
+    chain_node = _Chain_First( scheduled ) ;
+    chain_node != _Chain_Immutable_tail( scheduled ) ;
+    chain_node = _Chain_Next( chain_node )
+  ) {
+    Scheduler_Node *node = (Scheduler_Node *) chain_node;
+
+    cpu_index = _Scheduler_strong_APA_Get_processor_index( node );
+    self->CPU[ cpu_index ].node = node;
+  }
+}
+
+static void _Scheduler_strong_APA_Visit(
+  Scheduler_strong_APA_Context *self,
+  uint32_t                      cpu_index,
+  uint32_t                      parent,
+  uint32_t                     *tail
+)
+{
+  Scheduler_strong_APA_CPU *cpu = &self->CPU[ cpu_index ];
+
+  cpu->visited = true;
+  cpu->parent = parent;
+  self->CPU[ *tail ].queue = cpu_index;
+  ++( *tail );
+}
+
+/*
+ * Records the displacement chain defined by the parent links starting at the
+ * specified processor.  In case reverse is true, then the chain is recorded
+ * in the reverse order of the parent links.
+ */
+static void _Scheduler_strong_APA_Set_chain(
+  Scheduler_strong_APA_Context *self,
+  uint32_t                      cpu_index,
+  bool                          reverse
+)
+{
+  uint32_t length = 0;
+
+  do {
+    self->CPU[ length ].chain = cpu_index;
+    ++length;
+    cpu_index = self->CPU[ cpu_index ].parent;
+  } while ( cpu_index != SCHEDULER_STRONG_APA_NO_PARENT );
+
+  if ( reverse ) {
+    uint32_t i;
+
+    for ( i = 0 ; i < length / 2 ; ++i ) {
+      uint32_t j = length - 1 - i;
+      uint32_t tmp = self->CPU[ i ].chain;
+
+      self->CPU[ i ].chain = self->CPU[ j ].chain;
+      self->CPU[ j ].chain = tmp;
+    }
+  }
+
+  self->chain_length = length;
+}
+
+/*
+ * Moves the scheduled thread to the first processor of the displacement chain
+ * determined by the last search.  The nodes along the chain move to the next
+ * processor of the chain.  The last processor of the chain is the processor
+ * of the victim thread.  Without a valid chain an exact processor allocation
+ * is performed.
+ */
+static void _Scheduler_strong_APA_Allocate_processor(
+  Scheduler_Context *context,
+  Thread_Control    *scheduled_thread,
+  Thread_Control    *victim_thread
+)
+{
+  Scheduler_strong_APA_Context *self =
+    _Scheduler_strong_APA_Get_self( context );
+  Per_CPU_Control              *cpu_self = _Per_CPU_Get();
+  Per_CPU_Control              *cpu = _Thread_Get_CPU( victim_thread );
+  uint32_t                      length = self->chain_length;
+
+  self->chain_length = 0;
+
+  if (
+    length > 0
+      && self->CPU[ length - 1 ].chain == _Per_CPU_Get_index( cpu )
+  ) {
+    uint32_t i;
+
+    for ( i = length - 1 ; i > 0 ; --i ) {
+      Per_CPU_Control *to = _Per_CPU_Get_by_index( self->CPU[ i ].chain );
+      Scheduler_Node  *moved = self->CPU[ self->CPU[ i - 1 ].chain ].node;
+      Thread_Control  *moved_thread = _Scheduler_Node_get_user( moved );
+
+      _Thread_Set_CPU( moved_thread, to );
+      _Thread_Dispatch_update_heir( cpu_self, to, moved_thread );
+    }
+
+    cpu = _Per_CPU_Get_by_index( self->CPU[ 0 ].chain );
+  }
+
+  _Thread_Set_CPU( scheduled_thread, cpu );
+  _Thread_Dispatch_update_heir( cpu_self, cpu, scheduled_thread );
+}
+
 static void _Scheduler_strong_APA_Move_from_scheduled_to_ready(
   Scheduler_Context *context,
   Scheduler_Node    *scheduled_to_ready
@@ -148,7 +328,7 @@ static void _Scheduler_strong_APA_Do_update(
     &node->Ready_queue,
     new_priority,
     &self->Bit_map,
-    &self->Ready[ 0 ]
+    self->Ready
   );
 }
 
@@ -165,8 +345,13 @@ void _Scheduler_strong_APA_Initialize( const Scheduler_Control *scheduler )
 
   _Scheduler_SMP_Initialize( &self->Base );
   _Priority_bit_map_Initialize( &self->Bit_map );
+  self->chain_length = 0;
+
+  /* The ready chains follow the per-processor search states */
+  self->Ready = (Chain_Control *)
+    &self->CPU[ rtems_configuration_get_maximum_processors() ];
   _Scheduler_priority_Ready_queue_initialize(
-    &self->Ready[ 0 ],
+    self->Ready,
     scheduler->maximum_priority
   );
 }
@@ -184,6 +369,10 @@ void _Scheduler_strong_APA_Node_initialize(
 
   the_node = _Scheduler_strong_APA_Node_downcast( node );
   _Scheduler_SMP_Node_initialize( &the_node->Base, the_thread, priority );
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  the_node->Affinity = *_CPU_set_Default();
+  the_node->Affinity.set = &the_node->Affinity.preallocated;
+#endif
 
   context = _Scheduler_Get_context( scheduler );
   self = _Scheduler_strong_APA_Get_self( context );
@@ -191,26 +380,202 @@ void _Scheduler_strong_APA_Node_initialize(
     &the_node->Ready_queue,
     priority,
     &self->Bit_map,
-    &self->Ready[ 0 ]
+    self->Ready
   );
 }
 
+/*
+ * Returns the highest priority ready node which may execute on the processor
+ * of the victim node either directly or via a displacement chain.  The
+ * breadth-first search runs in the reverse direction starting at the
+ * processor of the victim.  A processor is reachable if its scheduled node
+ * may move to an already reachable processor.  The victim node is not in the
+ * set of scheduled nodes.
+ */
 static Scheduler_Node *_Scheduler_strong_APA_Get_highest_ready(
   Scheduler_Context *context,
-  Scheduler_Node    *node
+  Scheduler_Node    *victim
 )
 {
   Scheduler_strong_APA_Context *self =
     _Scheduler_strong_APA_Get_self( context );
+  uint32_t                      cpu_count =
+    rtems_configuration_get_maximum_processors();
+  Priority_bit_map_Control      bit_map;
+  uint32_t                      head;
+  uint32_t                      tail;
+
+  _Scheduler_strong_APA_Search_begin( self, cpu_count );
+
+  tail = 0;
+  _Scheduler_strong_APA_Visit(
+    self,
+    _Scheduler_strong_APA_Get_processor_index( victim ),
+    SCHEDULER_STRONG_APA_NO_PARENT,
+    &tail
+  );
 
-  (void) node;
-
+  for ( head = 0 ; head < tail ; ++head ) {
+    uint32_t cpu_index = self->CPU[ head ].queue;
+    uint32_t other_index;
+
+    for ( other_index = 0 ; other_index < cpu_count ; ++other_index ) {
+      Scheduler_strong_APA_CPU *other = &self->CPU[ other_index ];
+
+      if (
+        !other->visited
+          && other->node != NULL
+          && _Scheduler_strong_APA_Is_allowed( self, other->node, cpu_index )
+      ) {
+        _Scheduler_strong_APA_Visit( self, other_index, cpu_index, &tail );
+      }
+    }
+  }
+
+  /*
+   * Use a copy of the bit map to visit the non-empty ready chains in priority
+   * order and skip the empty ones.
+   */
+  bit_map = self->Bit_map;
+
+  while ( !_Priority_bit_map_Is_empty( &bit_map ) ) {
+    unsigned int                  index;
+    Chain_Control                *ready;
+    Chain_Node                   *chain_node;
+    Priority_bit_map_Information  info;
+
+    index = _Priority_bit_map_Get_highest( &bit_map );
+    ready = &self->Ready[ index ];
+
+    for (
+      chain_node = _Chain_First( ready ) ;
+      chain_node != _Chain_Immutable_tail( ready ) ;
+      chain_node = _Chain_Next( chain_node )
+    ) {
+      Scheduler_Node *node = (Scheduler_Node *) chain_node;
+
+      for ( head = 0 ; head < tail ; ++head ) {
+        uint32_t cpu_index = self->CPU[ head ].queue;
+
+        if ( _Scheduler_strong_APA_Is_allowed( self, node, cpu_index ) ) {
+          _Scheduler_strong_APA_Set_chain( self, cpu_index, false );
+
+          return node;
+        }
+      }
+    }
+
+    _Priority_bit_map_Initialize_information( &bit_map, &info, index );
+    _Priority_bit_map_Remove( &bit_map, &info );
+  }
+
+  /*
+   * The idle threads may execute on all processors, so this should not
+   * happen.
+   */
   return (Scheduler_Node *) _Scheduler_priority_Ready_queue_first(
     &self->Bit_map,
-    &self->Ready[ 0 ]
+    self->Ready
   );
 }
 
+static bool _Scheduler_strong_APA_Insert_priority_lifo_order(
+  const Chain_Node *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Insert_priority_lifo_order( to_insert, next );
+}
+
+static bool _Scheduler_strong_APA_Insert_priority_fifo_order(
+  const Chain_Node *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Insert_priority_fifo_order( to_insert, next );
+}
+
+/*
+ * Returns the lowest priority scheduled node which may be displaced by the
+ * filter node either directly or via a displacement chain or NULL if no such
+ * node exists.  The breadth-first search starts at the processors allowed for
+ * the filter node.  A processor is reachable if the scheduled node of an
+ * already reachable processor may move to it.  In case of equal priorities
+ * the node with the shortest displacement chain is selected.
+ */
+static Scheduler_Node *_Scheduler_strong_APA_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter,
+  Chain_Node_order   order
+)
+{
+  Scheduler_strong_APA_Context *self =
+    _Scheduler_strong_APA_Get_self( context );
+  uint32_t                      cpu_count =
+    rtems_configuration_get_maximum_processors();
+  Scheduler_Node               *lowest = NULL;
+  uint32_t                      lowest_index = 0;
+  uint32_t                      cpu_index;
+  uint32_t                      head;
+  uint32_t                      tail;
+
+  _Scheduler_strong_APA_Search_begin( self, cpu_count );
+
+  tail = 0;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    if ( _Scheduler_strong_APA_Is_allowed( self, filter, cpu_index ) ) {
+      _Scheduler_strong_APA_Visit(
+        self,
+        cpu_index,
+        SCHEDULER_STRONG_APA_NO_PARENT,
+        &tail
+      );
+    }
+  }
+
+  for ( head = 0 ; head < tail ; ++head ) {
+    Scheduler_Node *node;
+    uint32_t        other_index;
+
+    cpu_index = self->CPU[ head ].queue;
+    node = self->CPU[ cpu_index ].node;
+
+    if ( node == NULL ) {
+      continue;
+    }
+
+    if (
+      ( *order )( &filter->Node, &node->Node )
+        && (
+          lowest == NULL
+            || _Scheduler_strong_APA_Get_priority( node )
+              > _Scheduler_strong_APA_Get_priority( lowest )
+        )
+    ) {
+      lowest = node;
+      lowest_index = cpu_index;
+    }
+
+    for ( other_index = 0 ; other_index < cpu_count ; ++other_index ) {
+      if (
+        !self->CPU[ other_index ].visited
+          && _Scheduler_strong_APA_Is_allowed( self, node, other_index )
+      ) {
+        _Scheduler_strong_APA_Visit( self, other_index, cpu_index, &tail );
+      }
+    }
+  }
+
+  if ( lowest != NULL ) {
+    _Scheduler_strong_APA_Set_chain( self, lowest_index, true );
+  }
+
+  return lowest;
+}
+
 void _Scheduler_strong_APA_Block(
   const Scheduler_Control *scheduler,
   Thread_Control          *the_thread
@@ -224,7 +589,7 @@ void _Scheduler_strong_APA_Block(
     _Scheduler_strong_APA_Extract_from_ready,
     _Scheduler_strong_APA_Get_highest_ready,
     _Scheduler_strong_APA_Move_from_ready_to_scheduled,
-    _Scheduler_SMP_Allocate_processor_exact
+    _Scheduler_strong_APA_Allocate_processor
   );
 }
 
@@ -245,8 +610,8 @@ static Thread_Control *_Scheduler_strong_APA_Enqueue_ordered(
     insert_ready,
     insert_scheduled,
     _Scheduler_strong_APA_Move_from_scheduled_to_ready,
-    _Scheduler_SMP_Get_lowest_scheduled,
-    _Scheduler_SMP_Allocate_processor_exact
+    _Scheduler_strong_APA_Get_lowest_scheduled,
+    _Scheduler_strong_APA_Allocate_processor
   );
 }
 
@@ -260,7 +625,7 @@ static Thread_Control *_Scheduler_strong_APA_Enqueue_lifo(
     context,
     node,
     needs_help,
-    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_strong_APA_Insert_priority_lifo_order,
     _Scheduler_strong_APA_Insert_ready_lifo,
     _Scheduler_SMP_Insert_scheduled_lifo
   );
@@ -276,7 +641,7 @@ static Thread_Control *_Scheduler_strong_APA_Enqueue_fifo(
     context,
     node,
     needs_help,
-    _Scheduler_SMP_Insert_priority_fifo_order,
+    _Scheduler_strong_APA_Insert_priority_fifo_order,
     _Scheduler_strong_APA_Insert_ready_fifo,
     _Scheduler_SMP_Insert_scheduled_fifo
   );
@@ -299,7 +664,7 @@ static Thread_Control *_Scheduler_strong_APA_Enqueue_scheduled_ordered(
     insert_ready,
     insert_scheduled,
     _Scheduler_strong_APA_Move_from_ready_to_scheduled,
-    _Scheduler_SMP_Allocate_processor_exact
+    _Scheduler_strong_APA_Allocate_processor
   );
 }
 
@@ -396,3 +761,63 @@ Thread_Control *_Scheduler_strong_APA_Yield(
     _Scheduler_strong_APA_Enqueue_scheduled_fifo
   );
 }
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+bool _Scheduler_strong_APA_Get_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  cpu_set_t               *cpuset
+)
+{
+  Scheduler_strong_APA_Node *node =
+    _Scheduler_strong_APA_Thread_get_node( thread );
+
+  (void) scheduler;
+
+  if ( node->Affinity.setsize != cpusetsize ) {
+    return false;
+  }
+
+  CPU_COPY( cpuset, node->Affinity.set );
+  return true;
+}
+
+bool _Scheduler_strong_APA_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  const cpu_set_t         *cpuset
+)
+{
+  Scheduler_strong_APA_Node *node;
+  States_Control             current_state;
+
+  if ( !_CPU_set_Is_valid( cpuset, cpusetsize ) ) {
+    return false;
+  }
+
+  node = _Scheduler_strong_APA_Thread_get_node( thread );
+
+  if ( CPU_EQUAL_S( cpusetsize, cpuset, node->Affinity.set ) ) {
+    return true;
+  }
+
+  current_state = thread->current_state;
+
+  if ( _States_Is_ready( current_state ) ) {
+    _Scheduler_strong_APA_Block( scheduler, thread );
+  }
+
+  CPU_COPY( node->Affinity.set, cpuset );
+
+  if ( _States_Is_ready( current_state ) ) {
+    /*
+     * FIXME: Do not ignore threads in need for help.
+     */
+    (void) _Scheduler_strong_APA_Unblock( scheduler, thread );
+  }
+
+  return true;
+}
+#endif
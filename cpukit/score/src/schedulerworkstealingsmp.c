@@ -0,0 +1,983 @@
+/**
+ * @file
+ *
+ * @brief Work Stealing SMP Scheduler Implementation
+ *
+ * @ingroup ScoreSchedulerWorkStealingSMP
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/schedulerworkstealingsmp.h>
+#include <rtems/score/schedulerpriorityimpl.h>
+#include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/cpusetimpl.h>
+#include <rtems/config.h>
+
+static Scheduler_work_stealing_SMP_Context *
+_Scheduler_work_stealing_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_work_stealing_SMP_Context *)
+    _Scheduler_Get_context( scheduler );
+}
+
+static Scheduler_work_stealing_SMP_Context *
+_Scheduler_work_stealing_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_work_stealing_SMP_Context *) context;
+}
+
+static Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Thread_get_node( Thread_Control *the_thread )
+{
+  return (Scheduler_work_stealing_SMP_Node *)
+    _Scheduler_Thread_get_node( the_thread );
+}
+
+static Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_work_stealing_SMP_Node *) node;
+}
+
+static uint32_t _Scheduler_work_stealing_SMP_Get_processor_index(
+  Scheduler_Node *node
+)
+{
+  return _Per_CPU_Get_index(
+    _Thread_Get_CPU( _Scheduler_Node_get_user( node ) )
+  );
+}
+
+static bool _Scheduler_work_stealing_SMP_Is_allowed(
+  const Scheduler_work_stealing_SMP_Context *self,
+  const Scheduler_work_stealing_SMP_Node    *node,
+  uint32_t                                   cpu_index
+)
+{
+  if (
+    !_Scheduler_SMP_Is_processor_owned_by_us(
+      &self->Base.Base,
+      _Per_CPU_Get_by_index( cpu_index )
+    )
+  ) {
+    return false;
+  }
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  return CPU_ISSET( (int) cpu_index, node->Affinity.set );
+#else
+  (void) node;
+
+  return true;
+#endif
+}
+
+/*
+ * Makes the specified processor the home processor of the node.  In case the
+ * node is not allowed to execute on this processor, then the first allowed
+ * processor is used instead.  The node must not be in a ready queue.
+ */
+static Scheduler_work_stealing_SMP_Queue *_Scheduler_work_stealing_SMP_Set_home(
+  Scheduler_work_stealing_SMP_Context *self,
+  Scheduler_work_stealing_SMP_Node    *node,
+  uint32_t                             cpu_index
+)
+{
+  Scheduler_work_stealing_SMP_Queue *queue;
+
+  if ( !_Scheduler_work_stealing_SMP_Is_allowed( self, node, cpu_index ) ) {
+    uint32_t cpu_count = _SMP_Get_processor_count();
+
+    for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+      if ( _Scheduler_work_stealing_SMP_Is_allowed( self, node, cpu_index ) ) {
+        break;
+      }
+    }
+
+    _Assert( cpu_index < cpu_count );
+  }
+
+  node->home = cpu_index;
+  queue = &self->Queues[ cpu_index ];
+  _Scheduler_priority_Ready_queue_update(
+    &node->Ready_queue,
+    node->Ready_queue.current_priority,
+    &queue->Bit_map,
+    queue->Ready
+  );
+
+  return queue;
+}
+
+static void _Scheduler_work_stealing_SMP_Queue_enqueue(
+  Scheduler_work_stealing_SMP_Queue *queue,
+  Scheduler_work_stealing_SMP_Node  *node
+)
+{
+  _Scheduler_priority_Ready_queue_enqueue(
+    &node->Base.Base.Node,
+    &node->Ready_queue,
+    &queue->Bit_map
+  );
+
+  if ( !node->is_idle ) {
+    ++queue->ready_count;
+  }
+}
+
+static void _Scheduler_work_stealing_SMP_Queue_enqueue_first(
+  Scheduler_work_stealing_SMP_Queue *queue,
+  Scheduler_work_stealing_SMP_Node  *node
+)
+{
+  _Scheduler_priority_Ready_queue_enqueue_first(
+    &node->Base.Base.Node,
+    &node->Ready_queue,
+    &queue->Bit_map
+  );
+
+  if ( !node->is_idle ) {
+    ++queue->ready_count;
+  }
+}
+
+static void _Scheduler_work_stealing_SMP_Queue_extract(
+  Scheduler_work_stealing_SMP_Context *self,
+  Scheduler_work_stealing_SMP_Node    *node
+)
+{
+  Scheduler_work_stealing_SMP_Queue *queue = &self->Queues[ node->home ];
+
+  _Scheduler_priority_Ready_queue_extract(
+    &node->Base.Base.Node,
+    &node->Ready_queue,
+    &queue->Bit_map
+  );
+
+  if ( !node->is_idle ) {
+    _Assert( queue->ready_count > 0 );
+    --queue->ready_count;
+  }
+}
+
+/*
+ * Returns the highest priority node of the ready queue which is allowed to
+ * execute on the specified processor or NULL if no such node exists.
+ */
+static Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Queue_first_allowed(
+  const Scheduler_work_stealing_SMP_Context *self,
+  Scheduler_work_stealing_SMP_Queue         *queue,
+  uint32_t                                   cpu_index
+)
+{
+  Priority_Control index;
+
+  if ( _Priority_bit_map_Is_empty( &queue->Bit_map ) ) {
+    return NULL;
+  }
+
+  for (
+    index = _Priority_bit_map_Get_highest( &queue->Bit_map ) ;
+    index <= self->maximum_priority ;
+    ++index
+  ) {
+    Chain_Control    *chain = &queue->Ready[ index ];
+    const Chain_Node *tail = _Chain_Immutable_tail( chain );
+    Chain_Node       *chain_node;
+
+    for (
+      chain_node = _Chain_First( chain ) ;
+      chain_node != tail ;
+      chain_node = _Chain_Next( chain_node )
+    ) {
+      Scheduler_work_stealing_SMP_Node *node =
+        (Scheduler_work_stealing_SMP_Node *) chain_node;
+
+      if ( _Scheduler_work_stealing_SMP_Is_allowed( self, node, cpu_index ) ) {
+        return node;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+void _Scheduler_work_stealing_SMP_Initialize(
+  const Scheduler_Control *scheduler
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_context( scheduler );
+  uint32_t       queue_count = rtems_configuration_get_maximum_processors();
+  size_t         chain_count = (size_t) scheduler->maximum_priority + 1;
+  Chain_Control *ready;
+  uint32_t       i;
+
+  _Scheduler_SMP_Initialize( &self->Base );
+  self->maximum_priority = scheduler->maximum_priority;
+
+  /* The ready chains follow the ready queues */
+  ready = (Chain_Control *) &self->Queues[ queue_count ];
+
+  for ( i = 0 ; i < queue_count ; ++i ) {
+    Scheduler_work_stealing_SMP_Queue *queue = &self->Queues[ i ];
+
+    queue->Ready = &ready[ i * chain_count ];
+    _Priority_bit_map_Initialize( &queue->Bit_map );
+    _Scheduler_priority_Ready_queue_initialize(
+      queue->Ready,
+      scheduler->maximum_priority
+    );
+  }
+}
+
+void _Scheduler_work_stealing_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_context( scheduler );
+  Scheduler_work_stealing_SMP_Node    *the_node =
+    _Scheduler_work_stealing_SMP_Node_downcast( node );
+
+  _Scheduler_SMP_Node_initialize( &the_node->Base, the_thread, priority );
+
+  the_node->home = 0;
+  the_node->is_idle = false;
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  the_node->Affinity = *_CPU_set_Default();
+  the_node->Affinity.set = &the_node->Affinity.preallocated;
+#endif
+
+  _Scheduler_priority_Ready_queue_update(
+    &the_node->Ready_queue,
+    priority,
+    &self->Queues[ 0 ].Bit_map,
+    self->Queues[ 0 ].Ready
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Thread_get_node( idle );
+
+  _Scheduler_SMP_Start_idle( scheduler, idle, cpu );
+
+  node->is_idle = true;
+  node->home = _Per_CPU_Get_index( cpu );
+}
+
+static void _Scheduler_work_stealing_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_update,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  Scheduler_work_stealing_SMP_Node    *node =
+    _Scheduler_work_stealing_SMP_Node_downcast( node_to_update );
+  Scheduler_work_stealing_SMP_Queue   *queue = &self->Queues[ node->home ];
+
+  _Scheduler_SMP_Node_update_priority( &node->Base, new_priority );
+  _Scheduler_priority_Ready_queue_update(
+    &node->Ready_queue,
+    new_priority,
+    &queue->Bit_map,
+    queue->Ready
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Insert_ready_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  Scheduler_work_stealing_SMP_Node    *node =
+    _Scheduler_work_stealing_SMP_Node_downcast( node_to_insert );
+  Scheduler_work_stealing_SMP_Queue   *queue;
+
+  queue = _Scheduler_work_stealing_SMP_Set_home( self, node, node->home );
+  _Scheduler_work_stealing_SMP_Queue_enqueue( queue, node );
+}
+
+static void _Scheduler_work_stealing_SMP_Insert_ready_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  Scheduler_work_stealing_SMP_Node    *node =
+    _Scheduler_work_stealing_SMP_Node_downcast( node_to_insert );
+  Scheduler_work_stealing_SMP_Queue   *queue;
+
+  queue = _Scheduler_work_stealing_SMP_Set_home( self, node, node->home );
+  _Scheduler_work_stealing_SMP_Queue_enqueue_first( queue, node );
+}
+
+static void _Scheduler_work_stealing_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  _Scheduler_work_stealing_SMP_Queue_extract(
+    _Scheduler_work_stealing_SMP_Get_self( context ),
+    _Scheduler_work_stealing_SMP_Node_downcast( node_to_extract )
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Insert_scheduled_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Node_downcast( node_to_insert );
+
+  node->home = _Scheduler_work_stealing_SMP_Get_processor_index(
+    node_to_insert
+  );
+  _Scheduler_SMP_Insert_scheduled_lifo( context, node_to_insert );
+}
+
+static void _Scheduler_work_stealing_SMP_Insert_scheduled_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Node_downcast( node_to_insert );
+
+  node->home = _Scheduler_work_stealing_SMP_Get_processor_index(
+    node_to_insert
+  );
+  _Scheduler_SMP_Insert_scheduled_fifo( context, node_to_insert );
+}
+
+/*
+ * The node returns to the ready queue of the processor which executed it last
+ * to preserve cache locality.
+ */
+static void _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  Scheduler_work_stealing_SMP_Node    *node =
+    _Scheduler_work_stealing_SMP_Node_downcast( scheduled_to_ready );
+  Scheduler_work_stealing_SMP_Queue   *queue;
+
+  _Chain_Extract_unprotected( &node->Base.Base.Node );
+  queue = _Scheduler_work_stealing_SMP_Set_home(
+    self,
+    node,
+    _Scheduler_work_stealing_SMP_Get_processor_index( scheduled_to_ready )
+  );
+  _Scheduler_work_stealing_SMP_Queue_enqueue_first( queue, node );
+}
+
+static void _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  Scheduler_work_stealing_SMP_Node    *node =
+    _Scheduler_work_stealing_SMP_Node_downcast( ready_to_scheduled );
+
+  _Scheduler_work_stealing_SMP_Queue_extract( self, node );
+  node->home = _Scheduler_work_stealing_SMP_Get_processor_index(
+    ready_to_scheduled
+  );
+  _Chain_Insert_ordered_unprotected(
+    &self->Base.Scheduled,
+    &node->Base.Base.Node,
+    _Scheduler_SMP_Insert_priority_fifo_order
+  );
+}
+
+/*
+ * Selects the highest priority node of the local ready queue of the victim
+ * processor.  The ready queues of the other processors are only searched for
+ * nodes of strictly higher priority, so nodes of equal priority stay on their
+ * home processor.
+ */
+static Scheduler_Node *_Scheduler_work_stealing_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *victim
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  uint32_t                             cpu_index =
+    _Scheduler_work_stealing_SMP_Get_processor_index( victim );
+  uint32_t                             cpu_count = _SMP_Get_processor_count();
+  Scheduler_work_stealing_SMP_Node    *highest;
+  uint32_t                             i;
+
+  highest = _Scheduler_work_stealing_SMP_Queue_first_allowed(
+    self,
+    &self->Queues[ cpu_index ],
+    cpu_index
+  );
+
+  for ( i = 0 ; i < cpu_count ; ++i ) {
+    Scheduler_work_stealing_SMP_Queue *queue = &self->Queues[ i ];
+    Scheduler_work_stealing_SMP_Node  *candidate;
+
+    if (
+      i == cpu_index
+        || _Priority_bit_map_Is_empty( &queue->Bit_map )
+        || (
+          highest != NULL
+            && _Priority_bit_map_Get_highest( &queue->Bit_map )
+              >= highest->Base.priority
+        )
+    ) {
+      continue;
+    }
+
+    candidate = _Scheduler_work_stealing_SMP_Queue_first_allowed(
+      self,
+      queue,
+      cpu_index
+    );
+
+    if (
+      candidate != NULL
+        && ( highest == NULL || candidate->Base.priority < highest->Base.priority )
+    ) {
+      highest = candidate;
+    }
+  }
+
+  _Assert( highest != NULL );
+
+  return &highest->Base.Base;
+}
+
+static bool _Scheduler_work_stealing_SMP_Insert_priority_lifo_order(
+  const Chain_Node *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Insert_priority_lifo_order( to_insert, next );
+}
+
+static bool _Scheduler_work_stealing_SMP_Insert_priority_fifo_order(
+  const Chain_Node *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Insert_priority_fifo_order( to_insert, next );
+}
+
+/*
+ * Returns the lowest priority scheduled node which executes on a processor
+ * allowed for the filter node or NULL if no such node exists.
+ */
+static Scheduler_Node *_Scheduler_work_stealing_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter_base,
+  Chain_Node_order   order
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  Scheduler_work_stealing_SMP_Node    *filter =
+    _Scheduler_work_stealing_SMP_Node_downcast( filter_base );
+  Chain_Control                       *scheduled = &self->Base.Scheduled;
+  Chain_Node                          *chain_node;
+
+  for (
+    chain_node = _Chain_Last( scheduled ) ;
+    chain_node != _Chain_Immutable_head( scheduled ) ;
+    chain_node = _Chain_Previous( chain_node )
+  ) {
+    Scheduler_Node *node = (Scheduler_Node *) chain_node;
+
+    if ( ( *order )( &node->Node, &filter_base->Node ) ) {
+      break;
+    }
+
+    if (
+      _Scheduler_work_stealing_SMP_Is_allowed(
+        self,
+        filter,
+        _Scheduler_work_stealing_SMP_Get_processor_index( node )
+      )
+    ) {
+      return node;
+    }
+  }
+
+  return NULL;
+}
+
+/*
+ * Returns the highest priority ready node of all ready queues regardless of
+ * the processor affinity or NULL if all ready queues are empty.
+ */
+static Scheduler_Node *_Scheduler_work_stealing_SMP_Get_highest_ready_of_all(
+  Scheduler_work_stealing_SMP_Context *self
+)
+{
+  Scheduler_work_stealing_SMP_Queue *highest_queue = NULL;
+  Priority_Control                   highest_priority = 0;
+  uint32_t                           cpu_count = _SMP_Get_processor_count();
+  uint32_t                           i;
+
+  for ( i = 0 ; i < cpu_count ; ++i ) {
+    Scheduler_work_stealing_SMP_Queue *queue = &self->Queues[ i ];
+    Priority_Control                   priority;
+
+    if ( _Priority_bit_map_Is_empty( &queue->Bit_map ) ) {
+      continue;
+    }
+
+    priority = _Priority_bit_map_Get_highest( &queue->Bit_map );
+
+    if ( highest_queue == NULL || priority < highest_priority ) {
+      highest_queue = queue;
+      highest_priority = priority;
+    }
+  }
+
+  if ( highest_queue == NULL ) {
+    return NULL;
+  }
+
+  return (Scheduler_Node *)
+    _Chain_First( &highest_queue->Ready[ highest_priority ] );
+}
+
+/*
+ * This method is invoked at the end of certain scheduling operations to
+ * ensure that the highest priority ready node is scheduled in case a lower
+ * priority node is scheduled on a processor allowed for it.  This mirrors the
+ * Deterministic Priority Affinity SMP Scheduler, see
+ * _Scheduler_priority_affinity_SMP_Check_for_migrations().
+ */
+static void _Scheduler_work_stealing_SMP_Check_for_migrations(
+  Scheduler_Context *context
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+
+  while ( true ) {
+    Scheduler_Node *highest_ready;
+    Scheduler_Node *lowest_scheduled;
+
+    highest_ready = _Scheduler_work_stealing_SMP_Get_highest_ready_of_all(
+      self
+    );
+
+    if ( highest_ready == NULL ) {
+      break;
+    }
+
+    lowest_scheduled = _Scheduler_work_stealing_SMP_Get_lowest_scheduled(
+      context,
+      highest_ready,
+      _Scheduler_SMP_Insert_priority_lifo_order
+    );
+
+    if ( lowest_scheduled == NULL ) {
+      break;
+    }
+
+    /*
+     * FIXME: Do not consider threads using the scheduler helping protocol
+     * since this could produce more than one thread in need for help in one
+     * operation which is currently not possible.
+     */
+    if ( lowest_scheduled->help_state != SCHEDULER_HELP_YOURSELF ) {
+      break;
+    }
+
+    _Scheduler_SMP_Node_change_state(
+      _Scheduler_SMP_Node_downcast( lowest_scheduled ),
+      SCHEDULER_SMP_NODE_READY
+    );
+    _Scheduler_Thread_change_state(
+      _Scheduler_Node_get_user( lowest_scheduled ),
+      THREAD_SCHEDULER_READY
+    );
+
+    _Scheduler_SMP_Allocate_processor(
+      context,
+      highest_ready,
+      lowest_scheduled,
+      _Scheduler_SMP_Allocate_processor_exact
+    );
+
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled(
+      context,
+      highest_ready
+    );
+
+    _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready(
+      context,
+      lowest_scheduled
+    );
+  }
+}
+
+void _Scheduler_work_stealing_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    the_thread,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Get_highest_ready,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static Thread_Control *_Scheduler_work_stealing_SMP_Enqueue_ordered(
+  Scheduler_Context    *context,
+  Scheduler_Node       *node,
+  Thread_Control       *needs_help,
+  Chain_Node_order      order,
+  Scheduler_SMP_Insert  insert_ready,
+  Scheduler_SMP_Insert  insert_scheduled
+)
+{
+  return _Scheduler_SMP_Enqueue_ordered(
+    context,
+    node,
+    needs_help,
+    order,
+    insert_ready,
+    insert_scheduled,
+    _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_work_stealing_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static Thread_Control *_Scheduler_work_stealing_SMP_Enqueue_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Thread_Control    *needs_help
+)
+{
+  return _Scheduler_work_stealing_SMP_Enqueue_ordered(
+    context,
+    node,
+    needs_help,
+    _Scheduler_work_stealing_SMP_Insert_priority_lifo_order,
+    _Scheduler_work_stealing_SMP_Insert_ready_lifo,
+    _Scheduler_work_stealing_SMP_Insert_scheduled_lifo
+  );
+}
+
+static Thread_Control *_Scheduler_work_stealing_SMP_Enqueue_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Thread_Control    *needs_help
+)
+{
+  return _Scheduler_work_stealing_SMP_Enqueue_ordered(
+    context,
+    node,
+    needs_help,
+    _Scheduler_work_stealing_SMP_Insert_priority_fifo_order,
+    _Scheduler_work_stealing_SMP_Insert_ready_fifo,
+    _Scheduler_work_stealing_SMP_Insert_scheduled_fifo
+  );
+}
+
+static Thread_Control *_Scheduler_work_stealing_SMP_Enqueue_scheduled_ordered(
+  Scheduler_Context    *context,
+  Scheduler_Node       *node,
+  Chain_Node_order      order,
+  Scheduler_SMP_Insert  insert_ready,
+  Scheduler_SMP_Insert  insert_scheduled
+)
+{
+  return _Scheduler_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    order,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Get_highest_ready,
+    insert_ready,
+    insert_scheduled,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static Thread_Control *_Scheduler_work_stealing_SMP_Enqueue_scheduled_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_work_stealing_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_work_stealing_SMP_Insert_ready_lifo,
+    _Scheduler_work_stealing_SMP_Insert_scheduled_lifo
+  );
+}
+
+static Thread_Control *_Scheduler_work_stealing_SMP_Enqueue_scheduled_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_work_stealing_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_fifo_order,
+    _Scheduler_work_stealing_SMP_Insert_ready_fifo,
+    _Scheduler_work_stealing_SMP_Insert_scheduled_fifo
+  );
+}
+
+Thread_Control *_Scheduler_work_stealing_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+  Thread_Control    *needs_help;
+
+  needs_help = _Scheduler_SMP_Unblock(
+    context,
+    the_thread,
+    _Scheduler_work_stealing_SMP_Do_update,
+    _Scheduler_work_stealing_SMP_Enqueue_fifo
+  );
+
+  _Scheduler_work_stealing_SMP_Check_for_migrations( context );
+
+  return needs_help;
+}
+
+Thread_Control *_Scheduler_work_stealing_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+  Thread_Control    *displaced;
+
+  displaced = _Scheduler_SMP_Update_priority(
+    context,
+    the_thread,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Do_update,
+    _Scheduler_work_stealing_SMP_Enqueue_fifo,
+    _Scheduler_work_stealing_SMP_Enqueue_lifo,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled_fifo,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled_lifo
+  );
+
+  _Scheduler_work_stealing_SMP_Check_for_migrations( context );
+
+  return displaced;
+}
+
+Thread_Control *_Scheduler_work_stealing_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *offers_help,
+  Thread_Control          *needs_help
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  needs_help = _Scheduler_SMP_Ask_for_help(
+    context,
+    offers_help,
+    needs_help,
+    _Scheduler_work_stealing_SMP_Enqueue_fifo
+  );
+
+  _Scheduler_work_stealing_SMP_Check_for_migrations( context );
+
+  return needs_help;
+}
+
+Thread_Control *_Scheduler_work_stealing_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_SMP_Yield(
+    context,
+    the_thread,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Enqueue_fifo,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled_fifo
+  );
+}
+
+/*
+ * Pulls one ready node from the busiest ready queue into the ready queue of
+ * the specified processor in case the ready node count of the busiest ready
+ * queue exceeds the local one by more than one.  Only the ready queues change,
+ * so no new scheduling decision is necessary.
+ */
+static void _Scheduler_work_stealing_SMP_Balance(
+  Scheduler_work_stealing_SMP_Context *self,
+  uint32_t                             cpu_index
+)
+{
+  Scheduler_work_stealing_SMP_Queue *local = &self->Queues[ cpu_index ];
+  Scheduler_work_stealing_SMP_Queue *busiest = local;
+  Scheduler_work_stealing_SMP_Node  *node;
+  uint32_t                           cpu_count = _SMP_Get_processor_count();
+  uint32_t                           i;
+
+  for ( i = 0 ; i < cpu_count ; ++i ) {
+    Scheduler_work_stealing_SMP_Queue *queue = &self->Queues[ i ];
+
+    if ( queue->ready_count > busiest->ready_count ) {
+      busiest = queue;
+    }
+  }
+
+  if ( busiest->ready_count <= local->ready_count + 1 ) {
+    return;
+  }
+
+  node = _Scheduler_work_stealing_SMP_Queue_first_allowed(
+    self,
+    busiest,
+    cpu_index
+  );
+
+  if ( node != NULL && !node->is_idle ) {
+    _Scheduler_work_stealing_SMP_Queue_extract( self, node );
+    local = _Scheduler_work_stealing_SMP_Set_home( self, node, cpu_index );
+    _Scheduler_work_stealing_SMP_Queue_enqueue( local, node );
+  }
+}
+
+void _Scheduler_work_stealing_SMP_Tick(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *executing
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_context( scheduler );
+  Scheduler_work_stealing_SMP_Queue   *queue;
+  ISR_lock_Context                     lock_context;
+  uint32_t                             cpu_index;
+
+  _Scheduler_default_Tick( scheduler, executing );
+
+  _ISR_lock_ISR_disable( &lock_context );
+  cpu_index = _Per_CPU_Get_index( _Per_CPU_Get() );
+  queue = &self->Queues[ cpu_index ];
+
+  if ( ++queue->ticks >= SCHEDULER_WORK_STEALING_SMP_BALANCE_INTERVAL ) {
+    queue->ticks = 0;
+
+    _Scheduler_Acquire_critical( scheduler, &lock_context );
+    _Scheduler_work_stealing_SMP_Balance( self, cpu_index );
+    _Scheduler_Release_critical( scheduler, &lock_context );
+  }
+
+  _ISR_lock_ISR_enable( &lock_context );
+}
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+bool _Scheduler_work_stealing_SMP_Get_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  cpu_set_t               *cpuset
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Thread_get_node( thread );
+
+  (void) scheduler;
+
+  if ( node->Affinity.setsize != cpusetsize ) {
+    return false;
+  }
+
+  CPU_COPY( cpuset, node->Affinity.set );
+  return true;
+}
+
+bool _Scheduler_work_stealing_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  const cpu_set_t         *cpuset
+)
+{
+  Scheduler_work_stealing_SMP_Node *node;
+  States_Control                    current_state;
+
+  if ( !_CPU_set_Is_valid( cpuset, cpusetsize ) ) {
+    return false;
+  }
+
+  node = _Scheduler_work_stealing_SMP_Thread_get_node( thread );
+
+  if ( CPU_EQUAL_S( cpusetsize, cpuset, node->Affinity.set ) ) {
+    return true;
+  }
+
+  current_state = thread->current_state;
+
+  if ( _States_Is_ready( current_state ) ) {
+    _Scheduler_work_stealing_SMP_Block( scheduler, thread );
+  }
+
+  CPU_COPY( node->Affinity.set, cpuset );
+
+  if ( _States_Is_ready( current_state ) ) {
+    /*
+     * FIXME: Do not ignore threads in need for help.
+     */
+    (void) _Scheduler_work_stealing_SMP_Unblock( scheduler, thread );
+  }
+
+  return true;
+}
+#endif
@@ -38,6 +38,12 @@ void _Watchdog_Insert(
 
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
+  if ( header->wheel != NULL ) {
+    the_watchdog->expire = expire;
+    _Watchdog_Wheel_insert( header->wheel, the_watchdog );
+    return;
+  }
+
   link = _RBTree_Root_reference( &header->Watchdogs );
   parent = NULL;
   old_first = header->first;
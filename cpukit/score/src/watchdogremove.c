@@ -24,6 +24,7 @@
 #endif
 
 #include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
 
 void _Watchdog_Remove(
   Watchdog_Header  *header,
@@ -31,6 +32,12 @@ void _Watchdog_Remove(
 )
 {
   if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
+    if ( header->wheel != NULL ) {
+      _Chain_Extract_unprotected( &the_watchdog->Node.Chain );
+      _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+      return;
+    }
+
     if ( header->first == &the_watchdog->Node.RBTree ) {
       _Watchdog_Next_first( header, the_watchdog );
     }
@@ -30,6 +30,11 @@ void _Watchdog_Do_tickle(
   ISR_lock_Context *lock_context
 )
 {
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_tickle( header->wheel, now, lock, lock_context );
+    return;
+  }
+
   while ( true ) {
     Watchdog_Control *the_watchdog;
 
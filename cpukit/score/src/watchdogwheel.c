@@ -0,0 +1,221 @@
+/**
+ * @file
+ *
+ * @brief Watchdog Timer Wheel
+ * @ingroup ScoreWatchdog
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/percpu.h>
+#include <rtems/config.h>
+
+#define WATCHDOG_WHEEL_SLOT_MASK ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+
+#define WATCHDOG_WHEEL_MAXIMUM_DELTA \
+  ( ( UINT64_C( 1 ) \
+    << ( WATCHDOG_WHEEL_LEVEL_COUNT * WATCHDOG_WHEEL_LEVEL_BITS ) ) - 1 )
+
+static void _Watchdog_Wheel_do_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          base
+)
+{
+  uint64_t delta;
+  uint64_t expire;
+  size_t   level;
+  size_t   slot;
+
+  expire = the_watchdog->expire;
+
+  /* Watchdogs in the past expire with the next tick */
+  if ( expire < base ) {
+    expire = base;
+  }
+
+  delta = expire - base;
+
+  if ( delta > WATCHDOG_WHEEL_MAXIMUM_DELTA ) {
+    delta = WATCHDOG_WHEEL_MAXIMUM_DELTA;
+    expire = base + delta;
+  }
+
+  level = 0;
+
+  while ( ( delta >> ( ( level + 1 ) * WATCHDOG_WHEEL_LEVEL_BITS ) ) != 0 ) {
+    ++level;
+  }
+
+  slot = (size_t) ( expire >> ( level * WATCHDOG_WHEEL_LEVEL_BITS ) )
+    & WATCHDOG_WHEEL_SLOT_MASK;
+
+  _Chain_Append_unprotected(
+    &wheel->Slots[ level ][ slot ],
+    &the_watchdog->Node.Chain
+  );
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_BLACK );
+}
+
+static void _Watchdog_Wheel_cascade(
+  Watchdog_Wheel *wheel,
+  uint64_t        base
+)
+{
+  size_t level;
+
+  level = 1;
+
+  while ( level < WATCHDOG_WHEEL_LEVEL_COUNT ) {
+    Chain_Control *chain;
+    Chain_Node    *node;
+    size_t         slot;
+
+    slot = (size_t) ( base >> ( level * WATCHDOG_WHEEL_LEVEL_BITS ) )
+      & WATCHDOG_WHEEL_SLOT_MASK;
+    chain = &wheel->Slots[ level ][ slot ];
+
+    /*
+     * Distribute the watchdogs of the current slot of this level to the lower
+     * levels.
+     */
+    while ( ( node = _Chain_Get_unprotected( chain ) ) != NULL ) {
+      _Watchdog_Wheel_do_insert( wheel, (Watchdog_Control *) node, base );
+    }
+
+    /* Continue only if this level wrapped around as well */
+    if ( slot != 0 ) {
+      break;
+    }
+
+    ++level;
+  }
+}
+
+void _Watchdog_Header_initialize_wheel(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+)
+{
+  size_t level;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    size_t slot;
+
+    for ( slot = 0; slot < WATCHDOG_WHEEL_SLOT_COUNT; ++slot ) {
+      _Chain_Initialize_empty( &wheel->Slots[ level ][ slot ] );
+    }
+  }
+
+  wheel->base = now + 1;
+  _Watchdog_Header_initialize( header );
+  header->wheel = wheel;
+}
+
+void _Watchdog_Initialize_wheels( Watchdog_Wheel *wheels, size_t count )
+{
+  uint32_t cpu_count;
+  uint32_t cpu_index;
+
+  cpu_count = rtems_configuration_get_maximum_processors();
+
+  if ( cpu_count > count ) {
+    cpu_count = (uint32_t) count;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_count; ++cpu_index ) {
+    Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    _Watchdog_Header_initialize_wheel(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_RELATIVE ],
+      &wheels[ cpu_index ],
+      cpu->Watchdog.ticks
+    );
+  }
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  _Watchdog_Wheel_do_insert( wheel, the_watchdog, wheel->base );
+}
+
+void _Watchdog_Do_wheel_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  while ( wheel->base <= now ) {
+    Chain_Control  expired;
+    Chain_Control *slot;
+    uint64_t       base;
+
+    base = wheel->base;
+
+    if ( ( base & WATCHDOG_WHEEL_SLOT_MASK ) == 0 ) {
+      _Watchdog_Wheel_cascade( wheel, base );
+    }
+
+    wheel->base = base + 1;
+    slot = &wheel->Slots[ 0 ][ base & WATCHDOG_WHEEL_SLOT_MASK ];
+
+    if ( _Chain_Is_empty( slot ) ) {
+      continue;
+    }
+
+    /*
+     * Move the expired watchdogs to a local chain, since the service routines
+     * may insert watchdogs into this slot again.
+     */
+    _Chain_Initialize_empty( &expired );
+    _Chain_Head( &expired )->next = _Chain_First( slot );
+    _Chain_First( slot )->previous = _Chain_Head( &expired );
+    _Chain_Tail( &expired )->previous = _Chain_Last( slot );
+    _Chain_Last( slot )->next = _Chain_Tail( &expired );
+    _Chain_Initialize_empty( slot );
+
+    while ( true ) {
+      Watchdog_Control               *the_watchdog;
+      Watchdog_Service_routine_entry  routine;
+
+      /*
+       * The expired chain is protected by the lock as well, since the
+       * watchdogs on it may get removed while the lock is released.
+       */
+      the_watchdog = (Watchdog_Control *) _Chain_Get_unprotected( &expired );
+
+      if ( the_watchdog == NULL ) {
+        break;
+      }
+
+      _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+      routine = the_watchdog->routine;
+
+      _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+      ( *routine )( the_watchdog );
+      _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+    }
+  }
+
+  _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+}
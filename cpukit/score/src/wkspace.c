@@ -61,6 +61,7 @@ void _Workspace_Handler_initialization(
 {
   Heap_Initialization_or_extend_handler init_or_extend = _Heap_Initialize;
   uintptr_t remaining = rtems_configuration_get_work_space_size();
+  bool tlsf = rtems_configuration_get_work_space_tlsf();
   bool do_zero = rtems_configuration_get_do_zero_of_workspace();
   bool unified = rtems_configuration_get_unified_work_area();
   uintptr_t page_size = CPU_HEAP_ALIGNMENT;
@@ -91,6 +92,11 @@ void _Workspace_Handler_initialization(
       * _Heap_Size_with_overhead( page_size, tls_alloc, tls_align );
   }
 
+  if ( tlsf ) {
+    init_or_extend = _Heap_Initialize_TLSF;
+    remaining += _Heap_TLSF_overhead();
+  }
+
   for (i = 0; i < area_count; ++i) {
     Heap_Area *area = &areas [i];
 
@@ -540,6 +540,82 @@ the @code{rtems_resource_unlimited} macros themselves.
 #define CONFIGURE_UNLIMITED_ALLOCATION_SIZE 5
 @end example
 
+@c
+@c === CONFIGURE_OBJECT_NAME_HASH ===
+@c
+@subsection Enable Object Name Hash Index
+
+@findex CONFIGURE_OBJECT_NAME_HASH
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_OBJECT_NAME_HASH}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, which specifies that the object name to
+identifier translation searches the object table linearly.
+
+@end table
+
+@subheading DESCRIPTION:
+When defined, each object class maintains a hash index of the local object
+names.  The object name to identifier translation, for example in
+@code{rtems_task_ident()}, @code{rtems_semaphore_ident()} or
+@code{sem_open()}, is then independent of the object count.
+
+@subheading NOTES:
+The hash index needs about six bytes per object in the RTEMS Workspace.  It
+is rebuilt each time an object class is extended with
+@code{CONFIGURE_UNLIMITED_OBJECTS}.  In case several objects have the same
+name, then the object with the lowest index is returned, just as with the
+linear search.  With this option the Classic API ident directives obtain the
+object allocator mutex and must not be called from interrupt context.
+
+@c
+@c === CONFIGURE_WATCHDOG_TIMER_WHEEL ===
+@c
+@subsection Enable Watchdog Timer Wheel
+
+@findex CONFIGURE_WATCHDOG_TIMER_WHEEL
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_WATCHDOG_TIMER_WHEEL}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, which specifies that the relative watchdogs
+of each processor are kept in a red-black tree.
+
+@end table
+
+@subheading DESCRIPTION:
+When defined, the relative watchdogs of each processor, for example the
+timeouts of blocking directives, @code{rtems_task_wake_after()} and the
+interval timers, are kept in a hashed hierarchical timer wheel.  The insert
+and remove operations are then O(1) and independent of the count of active
+watchdogs.
+
+@subheading NOTES:
+The timer wheel needs about 3.8KiB of memory per processor on 32-bit targets.
+Every 64 clock ticks the watchdogs of a higher wheel level are redistributed
+to the lower levels, so the worst case clock tick interrupt service time
+depends on the count of watchdogs in one slot of the higher levels.  A
+watchdog inserted with an expiration time in the past expires with the next
+clock tick.  The absolute watchdogs (e.g. @code{rtems_task_wake_when()}) use
+the red-black tree in any case.
+
 @c
 @c === Classic API Configuration ===
 @c
@@ -1558,6 +1634,37 @@ API Read/Write Locks that can be concurrently active.
 @subheading NOTES:
 This object class can be configured in unlimited allocation mode.
 
+@c
+@c === CONFIGURE_MAXIMUM_POSIX_SHMS ===
+@c
+@subsection Specify Maximum POSIX API Shared Memory Objects
+
+@findex CONFIGURE_MAXIMUM_POSIX_SHMS
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_MAXIMUM_POSIX_SHMS}
+
+@item DATA TYPE:
+Unsigned integer (@code{uint32_t}).
+
+@item RANGE:
+Zero or positive.
+
+@item DEFAULT VALUE:
+The default value is 0.
+
+@end table
+
+@subheading DESCRIPTION:
+@code{CONFIGURE_MAXIMUM_POSIX_SHMS} is the maximum number of POSIX
+API Shared Memory Objects that can be concurrently active.
+
+@subheading NOTES:
+This object class can be configured in unlimited allocation mode.
+
+The data of a shared memory object is allocated from the C Program Heap.
+
 @c
 @c === POSIX Initialization Threads Table Configuration ===
 @c
@@ -1757,6 +1864,145 @@ RTEMS "unlimited" objects option.  You will be able to create objects
 until you run out of all available memory rather then just until you
 run out of RTEMS Workspace.
 
+@c
+@c === CONFIGURE_WORK_SPACE_TLSF ===
+@c
+@subsection Use TLSF Allocator for RTEMS Workspace
+
+@findex CONFIGURE_WORK_SPACE_TLSF
+@cindex TLSF
+@cindex RTEMS Workspace
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_WORK_SPACE_TLSF}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, which specifies that the RTEMS Workspace uses
+the first fit allocator.
+
+@end table
+
+@subheading DESCRIPTION:
+When defined, the RTEMS Workspace uses a two-level segregated fit (TLSF) index
+of the free blocks.  The time to allocate memory is then bounded and
+independent of the fragmentation of the heap unless an alignment or boundary
+is requested or no free block guarantees the requested size.
+
+@subheading NOTES:
+The index needs about one kilobyte of the first work area.  In case
+@code{CONFIGURE_UNIFIED_WORK_AREAS} is defined, then this option applies also
+to the C Program Heap.
+
+@c
+@c === CONFIGURE_MALLOC_TLSF ===
+@c
+@subsection Use TLSF Allocator for C Program Heap
+
+@findex CONFIGURE_MALLOC_TLSF
+@cindex TLSF
+@cindex C Program Heap
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_MALLOC_TLSF}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, which specifies that the C Program Heap uses
+the first fit allocator.
+
+@end table
+
+@subheading DESCRIPTION:
+When defined, the C Program Heap uses a two-level segregated fit (TLSF) index
+of the free blocks, see @code{CONFIGURE_WORK_SPACE_TLSF}.
+
+@subheading NOTES:
+This option is ignored if @code{CONFIGURE_UNIFIED_WORK_AREAS} is defined.
+
+@c
+@c === CONFIGURE_MALLOC_PER_CPU_CACHE ===
+@c
+@subsection Enable Per-Processor Caches for Small Allocations
+
+@findex CONFIGURE_MALLOC_PER_CPU_CACHE
+@cindex C Program Heap
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_MALLOC_PER_CPU_CACHE}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, which specifies that each @code{malloc()} and
+@code{free()} call obtains the allocator mutex.
+
+@end table
+
+@subheading DESCRIPTION:
+When defined, each processor has a cache of free memory areas for each size
+class in front of the C Program Heap.  The size classes are the powers of two
+from 16 to 256 bytes.  The allocation of a small area by @code{malloc()} and
+the release of a small area by @code{free()} use the cache of the current
+processor and do not obtain the allocator mutex unless the cache is empty or
+full.  An empty cache is refilled from the heap with a batch of areas.  A full
+cache returns one half of its areas to the heap.
+
+@subheading NOTES:
+The cached areas are allocated blocks from the point of view of the heap, so
+they are not available for other size classes or heap users.  Use
+@code{rtems_malloc_cache_get_statistics()} to obtain the cache hit rates.  The
+@code{malloc} shell command displays them as well.
+
+@c
+@c === CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK ===
+@c
+@subsection High Watermark of the Per-Processor Malloc Caches
+
+@findex CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK
+@cindex C Program Heap
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK}
+
+@item DATA TYPE:
+Unsigned integer (@code{uint32_t}).
+
+@item RANGE:
+2 to 64.
+
+@item DEFAULT VALUE:
+The default value is 32.
+
+@end table
+
+@subheading DESCRIPTION:
+This is the maximum count of free memory areas held by one per-processor
+malloc cache of one size class.
+
+@subheading NOTES:
+This option is only used if @code{CONFIGURE_MALLOC_PER_CPU_CACHE} is defined.
+The cache table needs this count of pointers for each processor and size
+class.
+
 @c
 @c === CONFIGURE_MICROSECONDS_PER_TICK ===
 @c
@@ -2943,6 +3189,100 @@ In case this configuration option is defined, then the support to read a
 directory is disabled in the root IMFS.  It is still possible to open nodes in
 a directory.
 
+@c
+@c === CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX ===
+@c
+@subsection Enable Directory Name Index of Root IMFS
+
+@findex CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default.
+
+@end table
+
+@subheading DESCRIPTION:
+In case this configuration option is defined, then the directories of the root
+IMFS use a hash table to look up their entries by name.  The hash table of a
+directory is built once it contains 32 entries and removed once it shrinks
+below 16 entries.  Smaller directories use the linear search.  The order of
+the entries returned by @code{readdir()} is not affected.
+
+@subheading NOTES:
+This option is ignored if @code{CONFIGURE_IMFS_DISABLE_READDIR} is defined.
+
+@c
+@c === CONFIGURE_IMFS_ENABLE_EXTFILE ===
+@c
+@subsection Enable Extent Files of Root IMFS
+
+@findex CONFIGURE_IMFS_ENABLE_EXTFILE
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_IMFS_ENABLE_EXTFILE}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default.
+
+@end table
+
+@subheading DESCRIPTION:
+In case this configuration option is defined, then the regular files of the
+root IMFS store their data in contiguous extents instead of blocks of
+@code{CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK} bytes.  The first extent has
+@code{CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT} bytes and each following extent
+doubles in size up to 1024 times the first extent.  This reduces the count of
+memory allocations and copy operations for larger files.  A truncate operation
+returns the extents beyond the new file size to the heap.
+
+@subheading NOTES:
+This option is ignored if @code{CONFIGURE_IMFS_DISABLE_MKNOD_FILE} is defined.
+
+@c
+@c === CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT ===
+@c
+@subsection Specify First Extent Size for IMFS Extent Files
+
+@findex CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_IMFS_EXTFILE_BYTES_PER_EXTENT}
+
+@item DATA TYPE:
+Unsigned integer (@code{size_t}).
+
+@item RANGE:
+Valid values for this configuration parameter are a power of two (2)
+between 16 and 4096 inclusive.
+
+@item DEFAULT VALUE:
+The default size of the first extent is 512 bytes.
+
+@end table
+
+@subheading DESCRIPTION:
+This configuration parameter specifies the size of the first extent of files
+in case @code{CONFIGURE_IMFS_ENABLE_EXTFILE} is defined.  Larger values waste
+more memory for small files, smaller values need more extents for large files.
+
 @c
 @c === CONFIGURE_IMFS_DISABLE_MOUNT ===
 @c
@@ -3449,6 +3789,72 @@ Defines the swapout worker task priority.
 @subheading NOTES:
 None.
 
+@c
+@c === CONFIGURE_BDBUF_CACHE_SHARDS ===
+@c
+@subsection Block Device Cache Shard Count
+
+@findex CONFIGURE_BDBUF_CACHE_SHARDS
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_BDBUF_CACHE_SHARDS}
+
+@item DATA TYPE:
+Unsigned integer (@code{size_t}).
+
+@item RANGE:
+Positive.
+
+@item DEFAULT VALUE:
+The default value is 1.
+
+@end table
+
+@subheading DESCRIPTION:
+Defines the count of shards of the block device cache.  Each shard has its
+own lock, buffer look-up tree and buffer lists.  Blocks are distributed to
+the shards by a hash of the disk device and the block number.
+
+@subheading NOTES:
+More than one shard reduces the lock contention of parallel file system
+activity on SMP configurations.  Each shard needs one mutex and three
+condition variables or four semaphores.  The buffer memory is divided evenly
+among the shards, so the shard count is limited to the count of maximum size
+buffers.  A value of zero is treated as one.
+
+@c
+@c === CONFIGURE_BDBUF_HASH_INDEX ===
+@c
+@subsection Block Device Cache Hash Index
+
+@findex CONFIGURE_BDBUF_HASH_INDEX
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_BDBUF_HASH_INDEX}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, which specifies that the block device cache
+uses an AVL tree to look up the buffers.
+
+@end table
+
+@subheading DESCRIPTION:
+When defined, the block device cache uses an open addressing hash index
+instead of an AVL tree to look up the buffers.
+
+@subheading NOTES:
+The hash index reduces the look-up time of large caches.  The hash table of
+each shard has at least twice as many entries as the shard has buffers, so it
+needs up to four pointers per minimum size buffer of additional memory.
+
 @c
 @c === BSP Specific Settings ===
 @c
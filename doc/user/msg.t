@@ -24,6 +24,10 @@ directives provided by the message manager are:
 @item @code{@value{DIRPREFIX}message_queue_receive} - Receive message from a queue
 @item @code{@value{DIRPREFIX}message_queue_get_number_pending} - Get number of messages pending on a queue
 @item @code{@value{DIRPREFIX}message_queue_flush} - Flush all messages on a queue
+@item @code{@value{DIRPREFIX}message_queue_get_buffer} - Obtain a message buffer of a queue
+@item @code{@value{DIRPREFIX}message_queue_return_buffer} - Return a message buffer to a queue
+@item @code{@value{DIRPREFIX}message_queue_send_ref} - Put message buffer at rear of a queue
+@item @code{@value{DIRPREFIX}message_queue_receive_ref} - Receive message buffer from a queue
 @end itemize
 
 @section Background
@@ -404,7 +408,8 @@ procedure Message_Queue_Delete (
 @subheading DIRECTIVE STATUS CODES:
 @code{@value{RPREFIX}SUCCESSFUL} - queue deleted successfully@*
 @code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
-@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - cannot delete remote queue
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - cannot delete remote queue@*
+@code{@value{RPREFIX}RESOURCE_IN_USE} - message buffers are loaned to tasks
 
 @subheading DESCRIPTION:
 
@@ -433,6 +438,11 @@ When the queue is deleted, any messages in the queue
 are returned to the free message buffer pool.  Any information
 stored in those messages is lost.
 
+A queue cannot be deleted while message buffers obtained via
+@code{@value{DIRPREFIX}message_queue_get_buffer} or
+@code{@value{DIRPREFIX}message_queue_receive_ref} are not yet returned
+or sent.
+
 When a global message queue is deleted, the message
 queue id must be transmitted to every node in the system for
 deletion from the local copy of the global object table.
@@ -834,3 +844,209 @@ Flushing all messages on a global message queue which
 does not reside on the local node will generate a request to the
 remote node to actually flush the specified message queue.
 
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_GET_BUFFER - Obtain a message buffer of a queue
+
+@cindex obtain a message buffer of a queue
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_get_buffer
+@example
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message buffer obtained successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is NULL@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote queues@*
+@code{@value{RPREFIX}UNSATISFIED} - no message buffer available
+
+@subheading DESCRIPTION:
+
+This directive loans an inactive message buffer of the queue specified
+in id to the calling task and returns its address in buffer.  The message
+buffer can hold a message of the maximum length with respect to this message
+queue.  The calling task owns the message buffer until it is sent via
+@code{@value{DIRPREFIX}message_queue_send_ref} or returned via
+@code{@value{DIRPREFIX}message_queue_return_buffer}.
+
+@subheading NOTES:
+
+A loaned message buffer is not available for messages sent via
+@code{@value{DIRPREFIX}message_queue_send} until it is returned.  The
+message buffers are freed together with the message queue.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_RETURN_BUFFER - Return a message buffer to a queue
+
+@cindex return a message buffer to a queue
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_return_buffer
+@example
+rtems_status_code rtems_message_queue_return_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message buffer returned successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is not a loaned message buffer of this queue@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote queues
+
+@subheading DESCRIPTION:
+
+This directive returns a message buffer obtained via
+@code{@value{DIRPREFIX}message_queue_get_buffer} or
+@code{@value{DIRPREFIX}message_queue_receive_ref} to the inactive message
+buffers of the queue specified in id.
+
+@subheading NOTES:
+
+The calling task must not use the message buffer after this directive.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_SEND_REF - Put message buffer at rear of a queue
+
+@cindex send message buffer to a queue
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_send_ref
+@example
+rtems_status_code rtems_message_queue_send_ref(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message sent successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is not a loaned message buffer of this queue@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote queues@*
+@code{@value{RPREFIX}INVALID_SIZE} - invalid message size
+
+@subheading DESCRIPTION:
+
+This directive sends the message buffer obtained via
+@code{@value{DIRPREFIX}message_queue_get_buffer} or
+@code{@value{DIRPREFIX}message_queue_receive_ref} with a message of size
+bytes to the queue specified by id.  The message buffer is placed at the
+rear of the queue without a copy of the message.  In case a task waits in
+@code{@value{DIRPREFIX}message_queue_receive_ref} at the queue, then the
+message buffer is handed over to this task.  In case a task waits in
+@code{@value{DIRPREFIX}message_queue_receive} at the queue, then the message
+is copied to the buffer of this task and the message buffer returns to the
+inactive message buffers of the queue.
+
+@subheading NOTES:
+
+The calling task must not use the message buffer after a successful send.
+In case the message size is invalid, then the calling task still owns the
+message buffer.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_RECEIVE_REF - Receive message buffer from a queue
+
+@cindex receive message buffer from a queue
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_receive_ref
+@example
+rtems_status_code rtems_message_queue_receive_ref(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message received successfully@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote queues@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is NULL@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{size} is NULL@*
+@code{@value{RPREFIX}UNSATISFIED} - queue is empty@*
+@code{@value{RPREFIX}TIMEOUT} - timed out waiting for message@*
+@code{@value{RPREFIX}OBJECT_WAS_DELETED} - queue deleted while waiting
+
+@subheading DESCRIPTION:
+
+This directive receives a message from the queue specified in id
+without a copy of the message.  The message buffer containing the message is
+loaned to the calling task, its address is returned in buffer and the length
+of the message in bytes is returned in size.  The options and the timeout
+are the same as for @code{@value{DIRPREFIX}message_queue_receive}.
+
+@subheading NOTES:
+
+Messages sent via @code{@value{DIRPREFIX}message_queue_send},
+@code{@value{DIRPREFIX}message_queue_urgent} and
+@code{@value{DIRPREFIX}message_queue_broadcast} can be received via this
+directive.  In case a message is sent via these directives to a task waiting
+in this directive, then a message buffer is obtained from the inactive
+message buffers of the queue.
+
+The calling task must return the message buffer via
+@code{@value{DIRPREFIX}message_queue_return_buffer} or send it via
+@code{@value{DIRPREFIX}message_queue_send_ref}.
+
+A clock tick is required to support the timeout functionality of
+this directive.
@@ -19,6 +19,7 @@ provided by the partition manager are:
 @item @code{@value{DIRPREFIX}partition_delete} - Delete a partition
 @item @code{@value{DIRPREFIX}partition_get_buffer} - Get buffer from a partition
 @item @code{@value{DIRPREFIX}partition_return_buffer} - Return buffer to a partition
+@item @code{@value{DIRPREFIX}partition_get_cache_statistics} - Get statistics of a partition buffer cache
 @end itemize
 
 @section Background
@@ -54,6 +55,7 @@ attributes is provided in the following table:
 @itemize @bullet
 @item @code{@value{RPREFIX}LOCAL} - local partition (default)
 @item @code{@value{RPREFIX}GLOBAL} - global partition
+@item @code{@value{RPREFIX}PARTITION_PER_PROCESSOR_CACHE} - use a buffer cache for each processor
 @end itemize
 
 Attribute values are specifically designed to be
@@ -112,6 +114,24 @@ chain with the @code{@value{DIRPREFIX}partition_return_buffer} directive.  This
 directive returns an error status code if the returned buffer
 was not previously allocated from this partition.
 
+@subsection Per-Processor Buffer Caches
+
+@cindex partition, per-processor buffer caches
+
+A partition created with the
+@code{@value{RPREFIX}PARTITION_PER_PROCESSOR_CACHE} attribute has a small
+buffer cache for each processor.  Buffers are obtained from and returned to
+the cache of the current processor.  Each cache has its own lock, which is
+normally only acquired by its processor, so the partition lock is not
+acquired in the common case.  Only an empty cache is refilled from the partition and only a full cache is
+flushed to the partition, each time with a batch of buffers.  This avoids
+contention on the partition lock in SMP configurations.  Buffers held by the
+cache of one processor are not available to other processors.  The
+@code{@value{DIRPREFIX}partition_get_cache_statistics} directive returns the
+count of local cache hits versus refills and flushes of a cache.  The
+@code{@value{DIRPREFIX}partition_delete} directive flushes all caches to the
+partition before it checks whether buffers are still in use.
+
 @subsection Deleting a Partition
 
 The @code{@value{DIRPREFIX}partition_delete} directive allows a partition to
@@ -176,7 +196,8 @@ procedure Partition_Create (
 @code{@value{RPREFIX}INVALID_SIZE} - length is less than the buffer size@*
 @code{@value{RPREFIX}INVALID_SIZE} - buffer size not a multiple of 4@*
 @code{@value{RPREFIX}MP_NOT_CONFIGURED} - multiprocessing not configured@*
-@code{@value{RPREFIX}TOO_MANY} - too many global objects
+@code{@value{RPREFIX}TOO_MANY} - too many global objects@*
+@code{@value{RPREFIX}UNSATISFIED} - not enough memory for the per-processor buffer caches
 
 @subheading DESCRIPTION:
 
@@ -212,6 +233,7 @@ defined by RTEMS:
 @itemize @bullet
 @item @code{@value{RPREFIX}LOCAL} - local partition (default)
 @item @code{@value{RPREFIX}GLOBAL} - global partition
+@item @code{@value{RPREFIX}PARTITION_PER_PROCESSOR_CACHE} - use a buffer cache for each processor
 @end itemize
 
 The PTCB for a global partition is allocated on the
@@ -227,6 +249,10 @@ The total number of global objects, including
 partitions, is limited by the maximum_global_objects field in
 the Configuration Table.
 
+The per-processor buffer caches of a partition are allocated from the RTEMS
+Workspace.  Applications using this attribute must account for them with
+@code{CONFIGURE_MEMORY_OVERHEAD}.
+
 @c
 @c
 @c
@@ -457,3 +483,56 @@ remote node to return the buffer to the specified partition.
 
 Returning a buffer multiple times is an error.  It will corrupt the internal
 state of the partition.
+
+@c
+@c
+@c
+@page
+@subsection PARTITION_GET_CACHE_STATISTICS - Get statistics of a partition buffer cache
+
+@cindex get statistics of a partition buffer cache
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_partition_get_cache_statistics
+@example
+rtems_status_code rtems_partition_get_cache_statistics(
+  rtems_id                          id,
+  uint32_t                          cpu_index,
+  rtems_partition_cache_statistics *statistics
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - statistics returned successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{statistics} is NULL@*
+@code{@value{RPREFIX}INVALID_ID} - invalid partition id@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote partitions@*
+@code{@value{RPREFIX}NOT_DEFINED} - partition has no per-processor buffer caches@*
+@code{@value{RPREFIX}INVALID_NUMBER} - invalid processor index
+
+@subheading DESCRIPTION:
+
+This directive returns the statistics of the buffer cache of the processor
+with index @code{cpu_index} of the partition specified by id.  The statistics
+contain the count of buffers currently held by the cache, the count of buffer
+allocations satisfied by the cache, the count of buffer allocations which
+refilled the cache from the partition, the count of buffer returns absorbed
+by the cache and the count of buffer returns which flushed the cache to the
+partition.
+
+@subheading NOTES:
+
+This directive will not cause the running task to be
+preempted.
+
+The statistics of other processors are a snapshot, since these processors
+may use their caches concurrently.
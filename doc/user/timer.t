@@ -533,7 +533,9 @@ procedure Timer_Initiate_Server (
 
 @subheading DIRECTIVE STATUS CODES:
 @code{@value{RPREFIX}SUCCESSFUL} - Timer Server initiated successfully@*
-@code{@value{RPREFIX}TOO_MANY} - too many tasks created
+@code{@value{RPREFIX}TOO_MANY} - too many tasks created@*
+@code{@value{RPREFIX}NO_MEMORY} - not enough memory for the Timer Server
+control blocks
 
 @subheading DESCRIPTION:
 
@@ -554,6 +556,15 @@ Even through this directive invokes the @code{@value{DIRPREFIX}task_create}
 and @code{@value{DIRPREFIX}task_start} directives, it should only fail
 due to resource allocation problems.
 
+In SMP configurations the attribute
+@code{@value{RPREFIX}TIMER_SERVER_PER_PROCESSOR} may be added to the
+attribute set to create one Timer Server task for each processor.  A
+task-based timer is then executed by the Timer Server task of the processor
+which most recently initiated or reset the timer.  Each Timer Server task is moved to the scheduler
+instance owning its processor and, in case this scheduler instance supports
+thread to processor affinities, it executes only on this processor.  All Timer
+Server tasks must be accounted for when configuring the system.
+
 @c
 @c
 @c
@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <rtems/libio.h>
+#include <rtems/blkdev.h>
+#include <rtems/dosfs.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSDOSFSFATCACHE 1";
+
+#define SECTOR_SIZE 512
+
+#define SECTOR_COUNT 1536
+
+#define CLUSTER_SIZE SECTOR_SIZE
+
+/*
+ * With a bdbuf cache of 16 buffers the FAT buffer cache uses four entries, so
+ * the pool for the File Allocation Table holds three blocks.  The files of the
+ * eviction test span more FAT sectors than this.
+ */
+#define BDBUF_BUFFER_COUNT 16
+
+#define EVICTION_CLUSTERS 600
+
+#define FAT12_EOC 0xff8
+
+#define FILE_A 0
+
+#define FILE_B 1
+
+typedef struct {
+  uint32_t fat_sec;
+  uint32_t fat_length;
+  uint32_t fat_count;
+  uint32_t cluster_count;
+} volume_info;
+
+static uint8_t disk_image[SECTOR_COUNT * SECTOR_SIZE];
+
+static uint8_t cluster_buf[CLUSTER_SIZE];
+
+static const char rda[] = "/dev/rda";
+
+static const char mnt[] = "/mnt";
+
+static const char *const file_names[] = { "/mnt/a", "/mnt/b" };
+
+static uint8_t pattern(int file, off_t offset)
+{
+  return (uint8_t) (file * 37 + (offset / CLUSTER_SIZE) * 13 + offset);
+}
+
+static void write_clusters(int fd, int file, off_t offset, size_t count)
+{
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    off_t pos = offset + (off_t) i * CLUSTER_SIZE;
+    size_t j;
+    ssize_t n;
+
+    for (j = 0; j < CLUSTER_SIZE; ++j) {
+      cluster_buf[j] = pattern(file, pos + (off_t) j);
+    }
+
+    rtems_test_assert(lseek(fd, pos, SEEK_SET) == pos);
+
+    n = write(fd, cluster_buf, CLUSTER_SIZE);
+    rtems_test_assert(n == CLUSTER_SIZE);
+  }
+}
+
+static void check_cluster(int fd, int file, off_t pos)
+{
+  size_t j;
+  ssize_t n;
+
+  rtems_test_assert(lseek(fd, pos, SEEK_SET) == pos);
+
+  n = read(fd, cluster_buf, CLUSTER_SIZE);
+  rtems_test_assert(n == CLUSTER_SIZE);
+
+  for (j = 0; j < CLUSTER_SIZE; ++j) {
+    rtems_test_assert(cluster_buf[j] == pattern(file, pos + (off_t) j));
+  }
+}
+
+/*
+ * Reads the file forward and then backward with a stride, so that the cluster
+ * chain is walked through the FAT in both directions.
+ */
+static void check_file(int fd, int file, size_t clusters)
+{
+  struct stat st;
+  size_t i;
+  ssize_t n;
+  int rv;
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == (off_t) clusters * CLUSTER_SIZE);
+
+  for (i = 0; i < clusters; ++i) {
+    check_cluster(fd, file, (off_t) i * CLUSTER_SIZE);
+  }
+
+  n = read(fd, cluster_buf, CLUSTER_SIZE);
+  rtems_test_assert(n == 0);
+
+  for (i = clusters; i > 0; i = i > 3 ? i - 3 : 0) {
+    check_cluster(fd, file, (off_t) (i - 1) * CLUSTER_SIZE);
+  }
+}
+
+static uint32_t get_le16(const uint8_t *p)
+{
+  return (uint32_t) p[0] | ((uint32_t) p[1] << 8);
+}
+
+static void get_volume_info(volume_info *vi)
+{
+  uint32_t rsvd = get_le16(&disk_image[14]);
+  uint32_t root_entries = get_le16(&disk_image[17]);
+  uint32_t total = get_le16(&disk_image[19]);
+  uint32_t data_sec;
+
+  rtems_test_assert(get_le16(&disk_image[11]) == SECTOR_SIZE);
+  rtems_test_assert(disk_image[13] == 1);
+
+  vi->fat_sec = rsvd;
+  vi->fat_count = disk_image[16];
+  vi->fat_length = get_le16(&disk_image[22]);
+  data_sec = rsvd + vi->fat_count * vi->fat_length
+    + (root_entries * 32 + SECTOR_SIZE - 1) / SECTOR_SIZE;
+  vi->cluster_count = total - data_sec;
+
+  /* The FAT entries are decoded as FAT12 entries */
+  rtems_test_assert(vi->cluster_count < 4085);
+}
+
+static uint32_t get_fat12_entry(const volume_info *vi, uint32_t cln)
+{
+  const uint8_t *fat = &disk_image[vi->fat_sec * SECTOR_SIZE];
+  uint32_t ofs = cln + cln / 2;
+  uint32_t val = get_le16(&fat[ofs]);
+
+  return (cln & 1) != 0 ? val >> 4 : val & 0xfff;
+}
+
+/*
+ * Writes all modified buffers of the bdbuf to the RAM disk, checks that all
+ * copies of the FAT are equal and returns the count of allocated clusters and
+ * the count of clusters which end a chain according to the RAM disk image.
+ */
+static uint32_t count_allocated(int disk_fd, uint32_t *eoc_count)
+{
+  volume_info vi;
+  uint32_t allocated = 0;
+  uint32_t eoc = 0;
+  uint32_t cln;
+  uint32_t i;
+  int rv;
+
+  rv = rtems_disk_fd_sync(disk_fd);
+  rtems_test_assert(rv == 0);
+
+  get_volume_info(&vi);
+
+  for (i = 1; i < vi.fat_count; ++i) {
+    rtems_test_assert(
+      memcmp(
+        &disk_image[vi.fat_sec * SECTOR_SIZE],
+        &disk_image[(vi.fat_sec + i * vi.fat_length) * SECTOR_SIZE],
+        vi.fat_length * SECTOR_SIZE
+      ) == 0
+    );
+  }
+
+  for (cln = 2; cln < vi.cluster_count + 2; ++cln) {
+    uint32_t val = get_fat12_entry(&vi, cln);
+
+    if (val != 0) {
+      ++allocated;
+
+      if (val >= FAT12_EOC) {
+        ++eoc;
+      }
+    }
+  }
+
+  if (eoc_count != NULL) {
+    *eoc_count = eoc;
+  }
+
+  return allocated;
+}
+
+static int open_file(int file)
+{
+  int fd;
+
+  fd = open(file_names[file], O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  return fd;
+}
+
+static void close_and_unlink(int fd, int file)
+{
+  int rv;
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(file_names[file]);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * A truncated file must end its cluster chain on the media once the bdbuf is
+ * synchronized, even if the file is neither closed nor synchronized.
+ */
+static void test_write_back(int disk_fd)
+{
+  uint32_t eoc;
+  int fd;
+  int rv;
+
+  fd = open_file(FILE_A);
+
+  write_clusters(fd, FILE_A, 0, 16);
+  rtems_test_assert(count_allocated(disk_fd, &eoc) == 16);
+  rtems_test_assert(eoc == 1);
+
+  rv = ftruncate(fd, 3 * CLUSTER_SIZE);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(count_allocated(disk_fd, &eoc) == 3);
+  rtems_test_assert(eoc == 1);
+
+  rv = ftruncate(fd, 8 * CLUSTER_SIZE);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(count_allocated(disk_fd, &eoc) == 8);
+  rtems_test_assert(eoc == 1);
+
+  check_cluster(fd, FILE_A, 0);
+  check_cluster(fd, FILE_A, 2 * CLUSTER_SIZE);
+
+  close_and_unlink(fd, FILE_A);
+  rtems_test_assert(count_allocated(disk_fd, NULL) == 0);
+}
+
+/*
+ * Two files written alternately in chunks of the specified cluster count have
+ * fragmented cluster chains.  With a chunk of one cluster the chain has more
+ * runs than the extent map of a file may record.  The chains span more FAT
+ * sectors than the FAT buffer cache holds, so walking them evicts FAT sectors
+ * from the cache.
+ */
+static void test_eviction_and_extent_map(int disk_fd, size_t chunk)
+{
+  size_t clusters = EVICTION_CLUSTERS;
+  size_t half = clusters / 2;
+  uint32_t eoc;
+  int fd_a;
+  int fd_b;
+  size_t i;
+  int rv;
+
+  fd_a = open_file(FILE_A);
+  fd_b = open_file(FILE_B);
+
+  for (i = 0; i < clusters; i += chunk) {
+    write_clusters(fd_a, FILE_A, (off_t) i * CLUSTER_SIZE, chunk);
+    write_clusters(fd_b, FILE_B, (off_t) i * CLUSTER_SIZE, chunk);
+  }
+
+  check_file(fd_a, FILE_A, clusters);
+  check_file(fd_b, FILE_B, clusters);
+  rtems_test_assert(count_allocated(disk_fd, &eoc) == 2 * clusters);
+  rtems_test_assert(eoc == 2);
+
+  /* The extent map must forget the clusters beyond the new end */
+  rv = ftruncate(fd_a, (off_t) half * CLUSTER_SIZE);
+  rtems_test_assert(rv == 0);
+  check_file(fd_a, FILE_A, half);
+  rtems_test_assert(count_allocated(disk_fd, &eoc) == clusters + half);
+  rtems_test_assert(eoc == 2);
+
+  /* A write beyond the end grows the file, the gap is filled afterwards */
+  for (i = clusters; i > half; --i) {
+    write_clusters(fd_a, FILE_A, (off_t) (i - 1) * CLUSTER_SIZE, 1);
+  }
+
+  check_file(fd_a, FILE_A, clusters);
+  check_file(fd_b, FILE_B, clusters);
+  rtems_test_assert(count_allocated(disk_fd, &eoc) == 2 * clusters);
+  rtems_test_assert(eoc == 2);
+
+  /* A new first cluster must replace the extent map */
+  rv = ftruncate(fd_a, 0);
+  rtems_test_assert(rv == 0);
+  write_clusters(fd_a, FILE_A, 0, 5);
+  check_file(fd_a, FILE_A, 5);
+  rtems_test_assert(count_allocated(disk_fd, &eoc) == clusters + 5);
+  rtems_test_assert(eoc == 2);
+
+  close_and_unlink(fd_a, FILE_A);
+  close_and_unlink(fd_b, FILE_B);
+  rtems_test_assert(count_allocated(disk_fd, NULL) == 0);
+}
+
+static void test(void)
+{
+  static const msdos_format_request_param_t rqdata = {
+    .sectors_per_cluster = 1,
+    .fat_num = 2,
+    .quick_format = true,
+    .sync_device = true
+  };
+
+  rtems_status_code sc;
+  int disk_fd;
+  int rv;
+
+  sc = rtems_disk_io_initialize();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  disk_fd = open(rda, O_RDWR);
+  rtems_test_assert(disk_fd >= 0);
+
+  rv = msdos_format(rda, &rqdata);
+  rtems_test_assert(rv == 0);
+
+  rv = mount_and_make_target_path(
+    rda,
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  test_write_back(disk_fd);
+  test_eviction_and_extent_map(disk_fd, 1);
+  test_eviction_and_extent_map(disk_fd, 4);
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+
+  rv = close(disk_fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  {
+    .block_size = SECTOR_SIZE,
+    .block_num = SECTOR_COUNT,
+    .location = &disk_image[0]
+  }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE SECTOR_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE SECTOR_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BDBUF_BUFFER_COUNT * SECTOR_SIZE)
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+const char rtems_test_name[] = "FSIMFSCONFIG 4";
+
+#define FILE_COUNT 200
+
+static const char dir[] = "dir";
+
+static const char other[] = "other";
+
+static void make_path(char *path, size_t size, const char *d, char c, int i)
+{
+  snprintf(path, size, "%s/%c%03i", d, c, i);
+}
+
+static void create_file(const char *d, char c, int i)
+{
+  char path[32];
+  int fd;
+  int rv;
+
+  make_path(path, sizeof(path), d, c, i);
+  fd = creat(path, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void rename_file(
+  const char *old_dir,
+  char old_c,
+  const char *new_dir,
+  char new_c,
+  int i
+)
+{
+  char old_path[32];
+  char new_path[32];
+  int rv;
+
+  make_path(old_path, sizeof(old_path), old_dir, old_c, i);
+  make_path(new_path, sizeof(new_path), new_dir, new_c, i);
+  rv = rename(old_path, new_path);
+  rtems_test_assert(rv == 0);
+}
+
+static void remove_file(const char *d, char c, int i)
+{
+  char path[32];
+  int rv;
+
+  make_path(path, sizeof(path), d, c, i);
+  rv = unlink(path);
+  rtems_test_assert(rv == 0);
+}
+
+static bool file_exists(const char *d, char c, int i)
+{
+  struct stat st;
+  char path[32];
+  int rv;
+
+  make_path(path, sizeof(path), d, c, i);
+  errno = 0;
+  rv = stat(path, &st);
+  rtems_test_assert(rv == 0 || errno == ENOENT);
+
+  return rv == 0;
+}
+
+static void check_range(const char *d, char c, int begin, int end)
+{
+  int i;
+
+  for (i = begin; i < end; ++i) {
+    rtems_test_assert(file_exists(d, c, i));
+  }
+}
+
+static void check_readdir(const char *d, char c, int begin, int end)
+{
+  DIR *dirp;
+  struct dirent *entry;
+  int i;
+
+  dirp = opendir(d);
+  rtems_test_assert(dirp != NULL);
+
+  for (i = begin; i < end; ++i) {
+    char name[8];
+
+    snprintf(name, sizeof(name), "%c%03i", c, i);
+
+    entry = readdir(dirp);
+    rtems_test_assert(entry != NULL);
+    rtems_test_assert(strcmp(entry->d_name, name) == 0);
+  }
+
+  entry = readdir(dirp);
+  rtems_test_assert(entry == NULL);
+
+  closedir(dirp);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int rv;
+  int i;
+
+  TEST_BEGIN();
+
+  rv = mkdir(dir, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = mkdir(other, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  /* Build and grow the index */
+  for (i = 0; i < FILE_COUNT; ++i) {
+    create_file(dir, 'f', i);
+    rtems_test_assert(file_exists(dir, 'f', 0));
+    rtems_test_assert(file_exists(dir, 'f', i));
+    rtems_test_assert(!file_exists(dir, 'f', i + 1));
+  }
+
+  check_range(dir, 'f', 0, FILE_COUNT);
+  check_readdir(dir, 'f', 0, FILE_COUNT);
+
+  /* Rename inside the directory */
+  for (i = 0; i < FILE_COUNT; ++i) {
+    rename_file(dir, 'f', dir, 'r', i);
+    rtems_test_assert(!file_exists(dir, 'f', i));
+    rtems_test_assert(file_exists(dir, 'r', i));
+  }
+
+  check_range(dir, 'r', 0, FILE_COUNT);
+  check_readdir(dir, 'r', 0, FILE_COUNT);
+
+  /* Move to another directory */
+  for (i = 0; i < FILE_COUNT / 2; ++i) {
+    rename_file(dir, 'r', other, 'o', i);
+    rtems_test_assert(!file_exists(dir, 'r', i));
+    rtems_test_assert(file_exists(other, 'o', i));
+  }
+
+  check_range(dir, 'r', FILE_COUNT / 2, FILE_COUNT);
+  check_range(other, 'o', 0, FILE_COUNT / 2);
+  check_readdir(dir, 'r', FILE_COUNT / 2, FILE_COUNT);
+  check_readdir(other, 'o', 0, FILE_COUNT / 2);
+
+  /* Shrink until the index is dropped */
+  for (i = FILE_COUNT / 2; i < FILE_COUNT; ++i) {
+    remove_file(dir, 'r', i);
+    rtems_test_assert(!file_exists(dir, 'r', i));
+    check_range(dir, 'r', i + 1, FILE_COUNT);
+  }
+
+  for (i = FILE_COUNT / 2 - 1; i >= 0; --i) {
+    remove_file(other, 'o', i);
+    rtems_test_assert(!file_exists(other, 'o', i));
+    check_range(other, 'o', 0, i);
+  }
+
+  rv = rmdir(dir);
+  rtems_test_assert(rv == 0);
+
+  rv = rmdir(other);
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/libcsupport.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSEXTFILE 1";
+
+#define CHUNK_SIZE 4096
+
+#define MAX_FILE_SIZE (256 * 1024)
+
+static const char ext_file[] = "/ext";
+
+static const char mem_dir[] = "/mem";
+
+static const char mem_file[] = "/mem/file";
+
+static unsigned char out_buf[CHUNK_SIZE];
+
+static unsigned char in_buf[CHUNK_SIZE];
+
+static void fill_pattern(unsigned char *buf, size_t n, off_t offset)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    buf[i] = (unsigned char) ((offset + i) % 251);
+  }
+}
+
+static void write_file(int fd, size_t size)
+{
+  size_t done;
+
+  for (done = 0; done < size; done += CHUNK_SIZE) {
+    ssize_t n = write(fd, out_buf, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+}
+
+static void read_file(int fd, size_t size)
+{
+  size_t done;
+
+  for (done = 0; done < size; done += CHUNK_SIZE) {
+    ssize_t n = read(fd, in_buf, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+}
+
+static uintptr_t free_heap_space(void)
+{
+  Heap_Information_block info;
+  int rv;
+
+  rv = malloc_info(&info);
+  rtems_test_assert(rv == 0);
+
+  return info.Free.total;
+}
+
+static void test_content(void)
+{
+  static const size_t sizes[] = { 1, 511, 512, 513, 1535, 1536, 100000 };
+  unsigned char buf[128];
+  uintptr_t free_before;
+  uintptr_t free_after;
+  off_t offset;
+  ssize_t n;
+  size_t i;
+  int fd;
+  int rv;
+
+  fd = open(ext_file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  /* Writes crossing extent boundaries */
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    offset = lseek(fd, 0, SEEK_END);
+    rtems_test_assert(offset >= 0);
+
+    while (offset < (off_t) sizes[i]) {
+      size_t m = sizeof(buf);
+
+      if (m > sizes[i] - offset) {
+        m = sizes[i] - offset;
+      }
+
+      fill_pattern(buf, m, offset);
+      n = write(fd, buf, m);
+      rtems_test_assert(n == (ssize_t) m);
+      offset += m;
+    }
+  }
+
+  offset = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(offset == 0);
+
+  while (true) {
+    unsigned char expected[sizeof(buf)];
+
+    n = read(fd, buf, sizeof(buf));
+    rtems_test_assert(n >= 0);
+
+    if (n == 0) {
+      break;
+    }
+
+    fill_pattern(expected, (size_t) n, offset);
+    rtems_test_assert(memcmp(buf, expected, (size_t) n) == 0);
+    offset += n;
+  }
+
+  rtems_test_assert(offset == 100000);
+
+  /* Holes read as zero */
+  offset = lseek(fd, 200000, SEEK_SET);
+  rtems_test_assert(offset == 200000);
+
+  n = write(fd, buf, 1);
+  rtems_test_assert(n == 1);
+
+  offset = lseek(fd, 150000, SEEK_SET);
+  rtems_test_assert(offset == 150000);
+
+  n = read(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+
+  for (i = 0; i < sizeof(buf); ++i) {
+    rtems_test_assert(buf[i] == 0);
+  }
+
+  /* Truncate returns the extents to the heap */
+  free_before = free_heap_space();
+
+  rv = ftruncate(fd, 1000);
+  rtems_test_assert(rv == 0);
+
+  free_after = free_heap_space();
+  rtems_test_assert(free_after > free_before);
+
+  offset = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(offset == 0);
+
+  n = read(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+
+  fill_pattern(in_buf, sizeof(buf), 0);
+  rtems_test_assert(memcmp(buf, in_buf, sizeof(buf)) == 0);
+
+  /* Extend by truncate zero fills the previously used area */
+  rv = ftruncate(fd, 2000);
+  rtems_test_assert(rv == 0);
+
+  offset = lseek(fd, 1000, SEEK_SET);
+  rtems_test_assert(offset == 1000);
+
+  n = read(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+
+  for (i = 0; i < sizeof(buf); ++i) {
+    rtems_test_assert(buf[i] == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(ext_file);
+  rtems_test_assert(rv == 0);
+}
+
+#if defined(RTEMS_POSIX_API)
+static void test_mmap(void)
+{
+  unsigned char buf[128];
+  unsigned char *p;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(ext_file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  fill_pattern(buf, sizeof(buf), 0);
+  n = write(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+
+  p = mmap(NULL, sizeof(buf), PROT_READ, MAP_SHARED, fd, 0);
+  rtems_test_assert(p != MAP_FAILED);
+  rtems_test_assert(memcmp(p, buf, sizeof(buf)) == 0);
+
+  /* The mapping refers to the first extent, so it must not shrink */
+  errno = 0;
+  rv = ftruncate(fd, 0);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBUSY);
+
+  errno = 0;
+  rv = open(ext_file, O_RDWR | O_TRUNC);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBUSY);
+
+  /* Growing keeps the extents in place */
+  rv = ftruncate(fd, 2 * sizeof(buf));
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(memcmp(p, buf, sizeof(buf)) == 0);
+
+  rv = munmap(p, sizeof(buf));
+  rtems_test_assert(rv == 0);
+
+  rv = ftruncate(fd, 0);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(ext_file);
+  rtems_test_assert(rv == 0);
+}
+#endif
+
+static void measure(const char *path, size_t size, const char *name)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks c;
+  rtems_counter_ticks d;
+  off_t offset;
+  int fd;
+  int rv;
+
+  fd = open(path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  a = rtems_counter_read();
+  write_file(fd, size);
+  b = rtems_counter_read();
+
+  offset = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(offset == 0);
+
+  read_file(fd, size);
+  c = rtems_counter_read();
+
+  rv = ftruncate(fd, 0);
+  d = rtems_counter_read();
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(path);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "<%sWrite unit=\"ns\">%" PRIu64 "</%sWrite>"
+    "<%sRead unit=\"ns\">%" PRIu64 "</%sRead>"
+    "<%sTruncate unit=\"ns\">%" PRIu64 "</%sTruncate>",
+    name,
+    rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a)),
+    name,
+    name,
+    rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(c, b)),
+    name,
+    name,
+    rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(d, c)),
+    name
+  );
+}
+
+static void test_throughput(void)
+{
+  size_t size;
+  int rv;
+
+  rv = mount_and_make_target_path(
+    NULL,
+    mem_dir,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  fill_pattern(out_buf, sizeof(out_buf), 0);
+
+  printf("<FSIMFSExtfile01>\n");
+
+  for (size = 16 * 1024; size <= MAX_FILE_SIZE; size *= 4) {
+    printf("  <Sample>\n    <Size>%zu</Size>", size);
+    measure(ext_file, size, "Extfile");
+    measure(mem_file, size, "Memfile");
+    printf("\n  </Sample>\n");
+  }
+
+  printf("</FSIMFSExtfile01>\n");
+
+  rv = unmount(mem_dir);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_content();
+#if defined(RTEMS_POSIX_API)
+  test_mmap();
+#endif
+  test_throughput();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_IMFS_ENABLE_EXTFILE
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
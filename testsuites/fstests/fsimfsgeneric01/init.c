@@ -257,7 +257,9 @@ static const rtems_filesystem_file_handlers_r node_handlers = {
   .fdatasync_h = handler_fdatasync,
   .fcntl_h = handler_fcntl,
   .readv_h = handler_readv,
-  .writev_h = handler_writev
+  .writev_h = handler_writev,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .munmap_h = rtems_filesystem_default_munmap
 };
 
 static IMFS_jnode_t *node_initialize(
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2GC 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define BLOCK_COUNT 16
+
+#define FLASH_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+
+#define FILE_COUNT 8
+
+#define FILE_SIZE (8 * 1024)
+
+#define ROUND_COUNT 8
+
+#define RECORD_COUNT 64
+
+#define RECORD_SIZE 16
+
+#define WRITE_BUFFER_SIZE 256
+
+#define GC_TASK_PRIORITY 2
+
+#define MOUNT_DIR "/jffs2"
+
+#define LOG_FILE MOUNT_DIR "/log"
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static const rtems_jffs2_mount_data direct_mount_data = {
+  .flash_control = &flash_instance.super
+};
+
+static const rtems_jffs2_mount_data buffered_mount_data = {
+  .flash_control = &flash_instance.super,
+  .write_buffer_size = WRITE_BUFFER_SIZE
+};
+
+static const rtems_jffs2_mount_data gc_mount_data = {
+  .flash_control = &flash_instance.super,
+  .gc_task_priority = GC_TASK_PRIORITY,
+  .gc_free_block_reserve = BLOCK_COUNT / 2,
+  .write_buffer_size = WRITE_BUFFER_SIZE
+};
+
+static const rtems_jffs2_mount_data invalid_mount_data = {
+  .flash_control = &flash_instance.super,
+  .write_buffer_size = 3 * WRITE_BUFFER_SIZE
+};
+
+static unsigned char file_buffer[FILE_SIZE];
+
+static void file_path(char path[32], int i)
+{
+  snprintf(path, 32, "%s/%i", MOUNT_DIR, i);
+}
+
+static void file_data(unsigned char *data, size_t size, int i, int round)
+{
+  uint32_t v;
+  size_t j;
+
+  v = (uint32_t) (i + 1) * (uint32_t) (round + 1);
+
+  for (j = 0; j < size; ++j) {
+    v = v * 1664525 + 1013904223;
+    data[j] = (unsigned char) (v >> 24);
+  }
+}
+
+static void do_mount(const rtems_jffs2_mount_data *mount_data)
+{
+  int rv;
+
+  rv = mount(
+    NULL,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+}
+
+static void get_info(rtems_jffs2_info *info)
+{
+  int fd;
+  int rv;
+
+  fd = open(MOUNT_DIR, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, info);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd, _IO('F', 0xff));
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void write_log(void)
+{
+  ssize_t n;
+  int fd;
+  int rv;
+  int i;
+
+  fd = open(LOG_FILE, O_WRONLY | O_CREAT | O_APPEND, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  for (i = 0; i < RECORD_COUNT; ++i) {
+    file_data(file_buffer, RECORD_SIZE, i, 0);
+
+    n = write(fd, file_buffer, RECORD_SIZE);
+    rtems_test_assert(n == RECORD_SIZE);
+  }
+
+  rv = fsync(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_log(void)
+{
+  unsigned char expected[RECORD_SIZE];
+  ssize_t n;
+  int fd;
+  int rv;
+  int i;
+
+  fd = open(LOG_FILE, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  for (i = 0; i < RECORD_COUNT; ++i) {
+    file_data(expected, RECORD_SIZE, i, 0);
+
+    n = read(fd, file_buffer, RECORD_SIZE);
+    rtems_test_assert(n == RECORD_SIZE);
+    rtems_test_assert(memcmp(file_buffer, expected, RECORD_SIZE) == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static uint32_t log_programs(const rtems_jffs2_mount_data *mount_data)
+{
+  rtems_jffs2_info info;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  do_mount(mount_data);
+  write_log();
+  check_log();
+  get_info(&info);
+  do_unmount();
+
+  /* Ensure that the buffered data reached the flash */
+  do_mount(&direct_mount_data);
+  check_log();
+  do_unmount();
+
+  rtems_test_assert(info.user_bytes_written == RECORD_COUNT * RECORD_SIZE);
+  rtems_test_assert(info.flash_bytes_written > info.user_bytes_written);
+
+  return info.flash_programs;
+}
+
+static void write_files(int round)
+{
+  char path[32];
+  ssize_t n;
+  int fd;
+  int rv;
+  int i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    file_path(path, i);
+    file_data(file_buffer, FILE_SIZE, i, round);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    n = write(fd, file_buffer, FILE_SIZE);
+    rtems_test_assert(n == FILE_SIZE);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void check_files(int round)
+{
+  unsigned char expected[FILE_SIZE];
+  char path[32];
+  ssize_t n;
+  int fd;
+  int rv;
+  int i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    file_path(path, i);
+    file_data(expected, FILE_SIZE, i, round);
+
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    n = read(fd, file_buffer, FILE_SIZE);
+    rtems_test_assert(n == FILE_SIZE);
+    rtems_test_assert(memcmp(file_buffer, expected, FILE_SIZE) == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void run_gc_task(void)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+
+  /* Let the garbage collection task run until it waits for new work */
+  sc = rtems_task_set_priority(RTEMS_SELF, GC_TASK_PRIORITY + 1, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_priority(RTEMS_SELF, prio, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_write_buffer(uint32_t *direct, uint32_t *buffered)
+{
+  int rv;
+
+  errno = 0;
+  rv = mount(
+    NULL,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &invalid_mount_data
+  );
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  *direct = log_programs(&direct_mount_data);
+  *buffered = log_programs(&buffered_mount_data);
+  rtems_test_assert(*buffered < *direct);
+}
+
+static void test_gc(rtems_jffs2_info *info)
+{
+  int round;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  do_mount(&gc_mount_data);
+
+  for (round = 0; round < ROUND_COUNT; ++round) {
+    write_files(round);
+    run_gc_task();
+    check_files(round);
+  }
+
+  get_info(info);
+  do_unmount();
+
+  /* The user data exceeds the flash size, so the blocks must be reclaimed */
+  rtems_test_assert(
+    info->user_bytes_written == ROUND_COUNT * FILE_COUNT * FILE_SIZE
+  );
+  rtems_test_assert(info->user_bytes_written > FLASH_SIZE);
+  rtems_test_assert(info->flash_bytes_written >= info->user_bytes_written);
+  rtems_test_assert(info->flash_erases > 0);
+  rtems_test_assert(info->background_gc_passes > 0);
+  rtems_test_assert(info->gc_passes >= info->background_gc_passes);
+  rtems_test_assert(info->flash_blocks == BLOCK_COUNT);
+  rtems_test_assert(
+    info->clean_blocks + info->dirty_blocks + info->erasable_blocks
+      + info->free_blocks + info->bad_blocks <= BLOCK_COUNT
+  );
+
+  do_mount(&direct_mount_data);
+  check_files(ROUND_COUNT - 1);
+  do_unmount();
+}
+
+static void test(void)
+{
+  rtems_jffs2_info info;
+  uint32_t direct;
+  uint32_t buffered;
+  int rv;
+
+  rv = mkdir(MOUNT_DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  test_write_buffer(&direct, &buffered);
+  test_gc(&info);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
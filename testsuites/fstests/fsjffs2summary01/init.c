@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2SUMMARY 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define BLOCK_COUNT 16
+
+#define FLASH_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+
+#define FILE_COUNT 48
+
+#define FILE_SIZE 2048
+
+#define MOUNT_DIR "/jffs2"
+
+#define SUM_MAGIC 0x02851885
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  size_t bytes_read;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  self->bytes_read += size_of_buffer;
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static const rtems_jffs2_mount_data summary_mount_data = {
+  .flash_control = &flash_instance.super,
+  .enable_summary = true
+};
+
+static const rtems_jffs2_mount_data no_summary_mount_data = {
+  .flash_control = &flash_instance.super
+};
+
+static unsigned char file_buffer[FILE_SIZE];
+
+typedef struct {
+  size_t bytes_read;
+  uint64_t duration;
+} mount_info;
+
+static void file_path(char path[32], int i)
+{
+  snprintf(path, 32, "%s/%i", MOUNT_DIR, i);
+}
+
+static void file_data(unsigned char *data, int i)
+{
+  uint32_t v;
+  size_t j;
+
+  v = (uint32_t) i + 1;
+
+  for (j = 0; j < FILE_SIZE; ++j) {
+    v = v * 1664525 + 1013904223;
+    data[j] = (unsigned char) (v >> 24);
+  }
+}
+
+static void do_mount(const rtems_jffs2_mount_data *mount_data, mount_info *mi)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  int rv;
+
+  flash_instance.bytes_read = 0;
+
+  a = rtems_counter_read();
+  rv = mount(
+    NULL,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    mount_data
+  );
+  b = rtems_counter_read();
+  rtems_test_assert(rv == 0);
+
+  if (mi != NULL) {
+    mi->bytes_read = flash_instance.bytes_read;
+    mi->duration = rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(b, a)
+    );
+  }
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+}
+
+static void create_files(void)
+{
+  char path[32];
+  ssize_t n;
+  int fd;
+  int rv;
+  int i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    file_path(path, i);
+    file_data(file_buffer, i);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    n = write(fd, file_buffer, FILE_SIZE);
+    rtems_test_assert(n == FILE_SIZE);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void check_files(void)
+{
+  unsigned char expected[FILE_SIZE];
+  char path[32];
+  ssize_t n;
+  int fd;
+  int rv;
+  int i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    file_path(path, i);
+    file_data(expected, i);
+
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    n = read(fd, file_buffer, FILE_SIZE);
+    rtems_test_assert(n == FILE_SIZE);
+    rtems_test_assert(memcmp(file_buffer, expected, FILE_SIZE) == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static int count_summaries(void)
+{
+  int count;
+  int i;
+
+  count = 0;
+
+  for (i = 0; i < BLOCK_COUNT; ++i) {
+    uint32_t magic;
+
+    memcpy(
+      &magic,
+      &flash_instance.area[(i + 1) * BLOCK_SIZE - sizeof(magic)],
+      sizeof(magic)
+    );
+
+    if (magic == SUM_MAGIC) {
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+static void print_mount_info(const char *name, const mount_info *mi)
+{
+  printf(
+    "  <%s>\n"
+    "    <BytesRead>%zu</BytesRead>\n"
+    "    <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "  </%s>\n",
+    name,
+    mi->bytes_read,
+    mi->duration,
+    name
+  );
+}
+
+static void test(void)
+{
+  mount_info summary;
+  mount_info full_scan;
+  int summary_count;
+  int rv;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  rv = mkdir(MOUNT_DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  do_mount(&summary_mount_data, NULL);
+  create_files();
+  check_files();
+  do_unmount();
+
+  /* Each full erase block ends with a summary marker */
+  summary_count = count_summaries();
+  rtems_test_assert(summary_count > 0);
+
+  do_mount(&summary_mount_data, &summary);
+  check_files();
+  do_unmount();
+
+  /* Mount without summary support ignores the summary nodes */
+  do_mount(&no_summary_mount_data, &full_scan);
+  check_files();
+  do_unmount();
+
+  rtems_test_assert(count_summaries() == summary_count);
+  rtems_test_assert(summary.bytes_read < full_scan.bytes_read);
+
+  printf(
+    "<FSJFFS2Summary01 blockSize=\"%lu\" blockCount=\"%i\" "
+      "summaryCount=\"%i\">\n",
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    summary_count
+  );
+  print_mount_info("Summary", &summary);
+  print_mount_info("FullScan", &full_scan);
+  printf("</FSJFFS2Summary01>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -52,11 +52,11 @@ static const int action_sequence [READ_COUNT] = {
 static const int expected_block_access_counts [READ_COUNT] [BLOCK_COUNT] = {
    { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
    { 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0 },
+   { 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
-   { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
@@ -68,11 +68,11 @@ static const int expected_block_access_counts [READ_COUNT] [BLOCK_COUNT] = {
    { 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0 },
    UNUSED_LINE,
    { 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0 },
-   { 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1 },
+   { 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0 },
    UNUSED_LINE,
    { 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0 },
-   { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1 },
-   { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1 }
+   { 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0 },
+   { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0 }
 };
 
 #define NO_TRIGGER RTEMS_DISK_READ_AHEAD_NO_TRIGGER
@@ -80,7 +80,7 @@ static const int expected_block_access_counts [READ_COUNT] [BLOCK_COUNT] = {
 #define TRIGGER_AFTER_RESET RTEMS_DISK_READ_AHEAD_NO_TRIGGER
 
 static const rtems_blkdev_bnum trigger [READ_COUNT] = {
-  1, 3, 5, 5, 8, 8, 8, NO_TRIGGER, NO_TRIGGER, NO_TRIGGER,
+  1, 3, 4, 6, 6, 8, 8, NO_TRIGGER, NO_TRIGGER, NO_TRIGGER,
   TRIGGER_AFTER_RESET,
   11,
   TRIGGER_AFTER_RESET,
@@ -88,15 +88,15 @@ static const rtems_blkdev_bnum trigger [READ_COUNT] = {
   TRIGGER_AFTER_RESET,
   9,
   TRIGGER_AFTER_RESET,
-  8, NO_TRIGGER,
+  8, 9,
   TRIGGER_AFTER_RESET,
-  7, 9, NO_TRIGGER
+  7, 8, 10
 };
 
 #define NOT_CHANGED_BY_RESET(i) (i)
 
 static const rtems_blkdev_bnum next [READ_COUNT] = {
-  2, 4, 7, 7, 10, 10, 10, 10, 10, 10,
+  2, 4, 5, 7, 7, 10, 10, 10, 10, 10,
   NOT_CHANGED_BY_RESET(10),
   12,
   NOT_CHANGED_BY_RESET(12),
@@ -104,9 +104,9 @@ static const rtems_blkdev_bnum next [READ_COUNT] = {
   NOT_CHANGED_BY_RESET(11),
   10,
   NOT_CHANGED_BY_RESET(10),
-  9, 9,
-  NOT_CHANGED_BY_RESET(9),
-  8, 11, 11
+  9, 10,
+  NOT_CHANGED_BY_RESET(10),
+  8, 9, 11
 };
 
 static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
@@ -137,12 +137,31 @@ static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
   return rv;
 }
 
+static const rtems_blkdev_read_ahead_stream *most_recent_stream(
+  const rtems_disk_device *dd
+)
+{
+  const rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [0];
+  int i;
+
+  for (i = 1; i < RTEMS_DISK_READ_AHEAD_STREAMS; ++i) {
+    const rtems_blkdev_read_ahead_stream *other = &dd->read_ahead.streams [i];
+
+    if (other->last_use > stream->last_use) {
+      stream = other;
+    }
+  }
+
+  return stream;
+}
+
 static void test_read_ahead(rtems_disk_device *dd)
 {
   int i;
 
   for (i = 0; i < READ_COUNT; ++i) {
     int action = action_sequence [i];
+    const rtems_blkdev_read_ahead_stream *stream;
 
     if (action != RESET_CACHE) {
       rtems_blkdev_bnum block = (rtems_blkdev_bnum) action;
@@ -171,8 +190,9 @@ static void test_read_ahead(rtems_disk_device *dd)
       memset(&block_access_counts, 0, sizeof(block_access_counts));
     }
 
-    rtems_test_assert(trigger [i] == dd->read_ahead.trigger);
-    rtems_test_assert(next [i] == dd->read_ahead.next);
+    stream = most_recent_stream(dd);
+    rtems_test_assert(trigger [i] == stream->trigger);
+    rtems_test_assert(next [i] == stream->next);
   }
 
   printf("\n");
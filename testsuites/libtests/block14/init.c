@@ -30,6 +30,10 @@ const char rtems_test_name[] = "BLOCK 14";
 
 #define BLOCK_COUNT 6
 
+#define STREAM_BLOCK_COUNT 64
+
+#define BUFFER_COUNT 16
+
 typedef struct {
   rtems_blkdev_bnum block;
   rtems_status_code (*get)(
@@ -51,7 +55,7 @@ static const test_action actions [ACTION_COUNT] = {
   { 5, rtems_bdbuf_get, RTEMS_SUCCESSFUL, rtems_bdbuf_sync }
 };
 
-#define STATS(a, b, c, d, e, f, g, h) \
+#define STATS(a, b, c, d, e, f, g, h, i, j) \
   { \
     .read_hits = a, \
     .read_misses = b, \
@@ -60,17 +64,19 @@ static const test_action actions [ACTION_COUNT] = {
     .read_errors = e, \
     .write_transfers = f, \
     .write_blocks = g, \
-    .write_errors = h \
+    .write_errors = h, \
+    .read_ahead_hits = i, \
+    .read_ahead_wasted = j \
   }
 
 static const rtems_blkdev_stats expected_stats [ACTION_COUNT] = {
-  STATS(0, 1, 0, 1, 0, 0, 0, 0),
-  STATS(0, 2, 1, 3, 0, 0, 0, 0),
-  STATS(1, 2, 2, 4, 0, 0, 0, 0),
-  STATS(2, 2, 2, 4, 0, 0, 0, 0),
-  STATS(2, 2, 2, 4, 0, 1, 1, 0),
-  STATS(2, 3, 2, 5, 1, 1, 1, 0),
-  STATS(2, 3, 2, 5, 1, 2, 2, 1)
+  STATS(0, 1, 0, 1, 0, 0, 0, 0, 0, 0),
+  STATS(0, 2, 1, 3, 0, 0, 0, 0, 0, 0),
+  STATS(1, 2, 2, 4, 0, 0, 0, 0, 1, 0),
+  STATS(2, 2, 2, 4, 0, 0, 0, 0, 1, 0),
+  STATS(2, 2, 2, 4, 0, 1, 1, 0, 1, 0),
+  STATS(2, 3, 2, 5, 1, 1, 1, 0, 1, 0),
+  STATS(2, 3, 2, 5, 1, 2, 2, 1, 1, 0)
 };
 
 static const int expected_block_access_counts [ACTION_COUNT] [BLOCK_COUNT] = {
@@ -85,6 +91,8 @@ static const int expected_block_access_counts [ACTION_COUNT] [BLOCK_COUNT] = {
 
 static int block_access_counts [BLOCK_COUNT];
 
+static int stream_block_access_counts [STREAM_BLOCK_COUNT];
+
 static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
 {
   int rv = 0;
@@ -116,6 +124,32 @@ static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
   return rv;
 }
 
+static int stream_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_bnum block = sg [i].block;
+
+      rtems_test_assert(block < STREAM_BLOCK_COUNT);
+
+      ++stream_block_access_counts [block];
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
 static void test_actions(rtems_disk_device *dd)
 {
   rtems_printer printer;
@@ -161,6 +195,150 @@ static void test_actions(rtems_disk_device *dd)
   rtems_blkdev_print_stats(&dd->stats, 0, 1, 2, &printer);
 }
 
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void check_stats(
+  const rtems_disk_device *dd,
+  const rtems_blkdev_stats *expected
+)
+{
+  rtems_blkdev_stats stats;
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(memcmp(&stats, expected, sizeof(stats)) == 0);
+}
+
+/*
+ * Two sequential streams which read alternately must both keep their
+ * read-ahead.  The second and each following block of a stream is read ahead
+ * by the read of its predecessor.
+ */
+static void test_interleaved_streams(rtems_disk_device *dd)
+{
+  static const rtems_blkdev_stats expected =
+    STATS(4, 4, 6, 10, 0, 0, 0, 0, 4, 0);
+  rtems_blkdev_bnum block;
+  int i;
+
+  for (block = 0; block < 4; ++block) {
+    read_block(dd, block);
+    read_block(dd, block + STREAM_BLOCK_COUNT / 4);
+  }
+
+  check_stats(dd, &expected);
+
+  for (i = 0; i < STREAM_BLOCK_COUNT; ++i) {
+    int expected_count = (i % (STREAM_BLOCK_COUNT / 4)) <= 4
+      && i < STREAM_BLOCK_COUNT / 2;
+
+    rtems_test_assert(stream_block_access_counts [i] == expected_count);
+  }
+}
+
+/*
+ * The blocks 4 and 20 were read ahead by the interleaved streams and never
+ * read.  Block 4 is obtained to be overwritten and block 20 is purged.
+ */
+static void test_wasted_by_get_and_purge(rtems_disk_device *dd)
+{
+  static const rtems_blkdev_stats expected_get =
+    STATS(4, 4, 6, 10, 0, 0, 0, 0, 4, 1);
+  static const rtems_blkdev_stats expected_purge =
+    STATS(4, 4, 6, 10, 0, 0, 0, 0, 4, 2);
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, 4, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  check_stats(dd, &expected_get);
+
+  rtems_bdbuf_purge_dev(dd);
+
+  check_stats(dd, &expected_purge);
+}
+
+/*
+ * The read of block 1 reads block 2 ahead.  The following reads of blocks
+ * which continue no stream use up the free buffers.  Then they recycle the
+ * least recently used buffers, which are the buffers of block 0 and block 2.
+ */
+static void test_wasted_by_recycle(rtems_disk_device *dd)
+{
+  static const rtems_blkdev_stats expected_used =
+    STATS(0, 16, 1, 17, 0, 0, 0, 0, 0, 0);
+  static const rtems_blkdev_stats expected_recycled =
+    STATS(0, 17, 1, 18, 0, 0, 0, 0, 0, 1);
+  rtems_blkdev_bnum block;
+  int i;
+
+  rtems_bdbuf_reset_device_stats(dd);
+
+  read_block(dd, 0);
+  read_block(dd, 1);
+
+  block = STREAM_BLOCK_COUNT / 2;
+
+  for (i = 3; i < BUFFER_COUNT; ++i) {
+    read_block(dd, block);
+    block += 2;
+  }
+
+  /* Block 0 is recycled */
+  read_block(dd, block);
+  block += 2;
+
+  check_stats(dd, &expected_used);
+
+  /* Block 2 is recycled */
+  read_block(dd, block);
+
+  check_stats(dd, &expected_recycled);
+}
+
+static void test_streams(void)
+{
+  rtems_status_code sc;
+  dev_t dev = rtems_filesystem_make_dev_t(0, 1);
+  rtems_disk_device *dd;
+
+  sc = rtems_disk_create_phys(
+    dev,
+    1,
+    STREAM_BLOCK_COUNT,
+    stream_disk_ioctl,
+    NULL,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = rtems_disk_obtain(dev);
+  rtems_test_assert(dd != NULL);
+
+  test_interleaved_streams(dd);
+  test_wasted_by_get_and_purge(dd);
+  test_wasted_by_recycle(dd);
+
+  sc = rtems_disk_release(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_delete(dev);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
 static void test(void)
 {
   rtems_status_code sc;
@@ -190,6 +368,8 @@ static void test(void)
 
   sc = rtems_disk_delete(dev);
   rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_streams();
 }
 
 static void Init(rtems_task_argument arg)
@@ -209,7 +389,7 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
 #define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
-#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BUFFER_COUNT
 #define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 1
 #define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 1
 
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems/counter.h>
+
+#if defined(BLOCK19)
+const char rtems_test_name[] = "BLOCK 19";
+#define TEST_TAG "Block19"
+#define LOOKUP_NAME "HashIndex"
+#else
+const char rtems_test_name[] = "BLOCK 18";
+#define TEST_TAG "Block18"
+#define LOOKUP_NAME "AVLTree"
+#endif
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define MEDIA_BLOCK_SIZE 64
+
+#define CACHE_MEMORY_SIZE (1024 * 1024)
+
+#define BUFFER_COUNT (CACHE_MEMORY_SIZE / MEDIA_BLOCK_SIZE)
+
+#define MEDIA_BLOCK_COUNT (2 * BUFFER_COUNT)
+
+#define LOOKUP_COUNT 1024
+
+typedef struct {
+  rtems_disk_device *dd;
+  uint32_t random;
+} test_context;
+
+static test_context test_instance;
+
+static int disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *r = arg;
+
+    /* The data is not of interest, only the cache look-up */
+    rtems_blkdev_request_done(r, RTEMS_SUCCESSFUL);
+
+    return 0;
+  } else {
+    return rtems_blkdev_ioctl(dd, req, arg);
+  }
+}
+
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->random = ctx->random * 1103515245 + 12345;
+
+  return ctx->random >> 8;
+}
+
+static void fill_cache(test_context *ctx, size_t begin, size_t end)
+{
+  size_t i;
+
+  for (i = begin; i < end; ++i) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(ctx->dd, i, &bd);
+    ASSERT_SC(sc);
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+}
+
+static void test_hit(test_context *ctx, size_t cached)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  size_t i;
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < LOOKUP_COUNT; ++i) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(ctx->dd, next_random(ctx) % cached, &bd);
+    ASSERT_SC(sc);
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+
+  b = rtems_counter_read();
+  d = rtems_counter_difference(b, a);
+
+  printf(
+    "<Hit unit=\"ns\">%" PRIu64 "</Hit>",
+    rtems_counter_ticks_to_nanoseconds(d) / LOOKUP_COUNT
+  );
+}
+
+static void test_miss(test_context *ctx)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  size_t i;
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < LOOKUP_COUNT; ++i) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+    rtems_blkdev_bnum block;
+
+    /* Blocks in the upper half of the disk are never cached */
+    block = BUFFER_COUNT + next_random(ctx) % BUFFER_COUNT;
+
+    /*
+     * Getting a block which is not in the cache takes a free buffer.  The
+     * empty buffer is freed again by the release.
+     */
+    sc = rtems_bdbuf_get(ctx->dd, block, &bd);
+    ASSERT_SC(sc);
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+
+  b = rtems_counter_read();
+  d = rtems_counter_difference(b, a);
+
+  printf(
+    "<Miss unit=\"ns\">%" PRIu64 "</Miss>",
+    rtems_counter_ticks_to_nanoseconds(d) / LOOKUP_COUNT
+  );
+}
+
+static void test_case(test_context *ctx, size_t cached)
+{
+  printf("  <Sample>\n    <CachedBuffers>%zu</CachedBuffers>", cached);
+
+  test_hit(ctx, cached);
+  test_miss(ctx);
+
+  printf("\n  </Sample>\n");
+}
+
+static void test(void)
+{
+  static const char device[] = "/dev/bd";
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  size_t cached;
+  size_t next;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    device,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    disk_ioctl,
+    NULL
+  );
+  ASSERT_SC(sc);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &ctx->dd);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "<" TEST_TAG " lookup=\"" LOOKUP_NAME "\" bufferCount=\"%d\">\n",
+    BUFFER_COUNT
+  );
+
+  /* One buffer must stay free for the misses */
+  cached = 0;
+  next = 1;
+
+  while (next < BUFFER_COUNT) {
+    fill_cache(ctx, cached, next);
+    cached = next;
+    test_case(ctx, cached);
+    next = (123 * (cached + 1) + 99) / 100;
+  }
+
+  fill_cache(ctx, cached, BUFFER_COUNT - 1);
+  test_case(ctx, BUFFER_COUNT - 1);
+
+  printf("</" TEST_TAG ">\n");
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(device);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE MEDIA_BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE MEDIA_BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE CACHE_MEMORY_SIZE
+
+#if defined(BLOCK19)
+#define CONFIGURE_BDBUF_HASH_INDEX
+#endif
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
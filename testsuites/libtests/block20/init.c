@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+#include <rtems/ramdisk.h>
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 20";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define SHARD_COUNT 4
+
+#define BUFFER_SIZE 4
+
+#define BUFFER_COUNT 16
+
+/* Blocks of one stripe of 256 blocks belong to the same shard */
+#define STRIPE_SIZE 256
+
+#define STRIPE_COUNT 16
+
+#define MEDIA_BLOCK_COUNT (STRIPE_SIZE * STRIPE_COUNT)
+
+#define WORKER_COUNT 2
+
+#define WORKER_ROUNDS 8
+
+typedef struct {
+  unsigned char media[MEDIA_BLOCK_COUNT * BUFFER_SIZE];
+  rtems_disk_device *dd;
+  rtems_id master;
+} test_context;
+
+static test_context test_instance;
+
+static unsigned char pattern(rtems_blkdev_bnum block, unsigned char round)
+{
+  return (unsigned char) (block / STRIPE_SIZE + block + round);
+}
+
+static void write_block(
+  test_context *ctx,
+  rtems_blkdev_bnum block,
+  unsigned char round
+)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(ctx->dd, block, &bd);
+  ASSERT_SC(sc);
+
+  rtems_test_assert(bd->group->shard < SHARD_COUNT);
+  memset(bd->buffer, pattern(block, round), BUFFER_SIZE);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  ASSERT_SC(sc);
+}
+
+static void check_block(
+  test_context *ctx,
+  rtems_blkdev_bnum block,
+  unsigned char round
+)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  unsigned char expected[BUFFER_SIZE];
+
+  sc = rtems_bdbuf_read(ctx->dd, block, &bd);
+  ASSERT_SC(sc);
+
+  memset(expected, pattern(block, round), BUFFER_SIZE);
+  rtems_test_assert(memcmp(bd->buffer, expected, BUFFER_SIZE) == 0);
+
+  sc = rtems_bdbuf_release(bd);
+  ASSERT_SC(sc);
+}
+
+static void check_media(
+  const test_context *ctx,
+  rtems_blkdev_bnum block,
+  unsigned char round
+)
+{
+  unsigned char expected[BUFFER_SIZE];
+
+  memset(expected, pattern(block, round), BUFFER_SIZE);
+  rtems_test_assert(
+    memcmp(&ctx->media[block * BUFFER_SIZE], expected, BUFFER_SIZE) == 0
+  );
+}
+
+static void test_shards_in_use(test_context *ctx)
+{
+  rtems_status_code sc;
+  bool used[SHARD_COUNT];
+  size_t shards;
+  rtems_blkdev_bnum stripe;
+  size_t i;
+
+  memset(used, 0, sizeof(used));
+
+  for (stripe = 0; stripe < STRIPE_COUNT; ++stripe) {
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(ctx->dd, stripe * STRIPE_SIZE, &bd);
+    ASSERT_SC(sc);
+
+    rtems_test_assert(bd->group->shard < SHARD_COUNT);
+    used[bd->group->shard] = true;
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+
+  shards = 0;
+
+  for (i = 0; i < SHARD_COUNT; ++i) {
+    if (used[i]) {
+      ++shards;
+    }
+  }
+
+  rtems_test_assert(shards > 1);
+}
+
+static void test_write_back(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_blkdev_bnum stripe;
+
+  /*
+   * Write more blocks than the cache holds, so that the buffers of each shard
+   * are recycled.
+   */
+  for (stripe = 0; stripe < STRIPE_COUNT; ++stripe) {
+    rtems_blkdev_bnum i;
+
+    for (i = 0; i < 4; ++i) {
+      write_block(ctx, stripe * STRIPE_SIZE + i, 1);
+    }
+  }
+
+  sc = rtems_bdbuf_syncdev(ctx->dd);
+  ASSERT_SC(sc);
+
+  for (stripe = 0; stripe < STRIPE_COUNT; ++stripe) {
+    rtems_blkdev_bnum i;
+
+    for (i = 0; i < 4; ++i) {
+      check_media(ctx, stripe * STRIPE_SIZE + i, 1);
+      check_block(ctx, stripe * STRIPE_SIZE + i, 1);
+    }
+  }
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_blkdev_bnum first = (rtems_blkdev_bnum) arg;
+  rtems_status_code sc;
+  unsigned char round;
+
+  for (round = 2; round < 2 + WORKER_ROUNDS; ++round) {
+    rtems_blkdev_bnum stripe;
+
+    for (stripe = first; stripe < STRIPE_COUNT; stripe += WORKER_COUNT) {
+      write_block(ctx, stripe * STRIPE_SIZE + 8, round);
+    }
+
+    for (stripe = first; stripe < STRIPE_COUNT; stripe += WORKER_COUNT) {
+      check_block(ctx, stripe * STRIPE_SIZE + 8, round);
+    }
+  }
+
+  sc = rtems_event_transient_send(ctx->master);
+  ASSERT_SC(sc);
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void test_parallel_access(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_blkdev_bnum stripe;
+  size_t i;
+
+  ctx->master = rtems_task_self();
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    ASSERT_SC(sc);
+
+    sc = rtems_task_start(id, worker_task, i);
+    ASSERT_SC(sc);
+  }
+
+  for (i = 0; i < WORKER_COUNT; ++i) {
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    ASSERT_SC(sc);
+  }
+
+  sc = rtems_bdbuf_syncdev(ctx->dd);
+  ASSERT_SC(sc);
+
+  for (stripe = 0; stripe < STRIPE_COUNT; ++stripe) {
+    check_media(ctx, stripe * STRIPE_SIZE + 8, 1 + WORKER_ROUNDS);
+  }
+}
+
+static void test(test_context *ctx)
+{
+  static const char device[] = "/dev/rda";
+  rtems_status_code sc;
+  ramdisk *rd;
+  int fd;
+  int rv;
+
+  sc = rtems_disk_io_initialize();
+  ASSERT_SC(sc);
+
+  rd = ramdisk_allocate(ctx->media, BUFFER_SIZE, MEDIA_BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(
+    device,
+    BUFFER_SIZE,
+    MEDIA_BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  ASSERT_SC(sc);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &ctx->dd);
+  rtems_test_assert(rv == 0);
+
+  test_shards_in_use(ctx);
+  test_write_back(ctx);
+  test_parallel_access(ctx);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(device);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BUFFER_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BUFFER_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BUFFER_SIZE * BUFFER_COUNT)
+#define CONFIGURE_BDBUF_CACHE_SHARDS SHARD_COUNT
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 3
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/capture-ctf.h>
+
+const char rtems_test_name[] = "CAPTURE 2";
+
+#define BUFFER_SIZE 4096
+
+#define TRACE_PATH "/trace"
+
+static void worker(rtems_task_argument arg)
+{
+  int i;
+
+  for (i = 0; i < 3; ++i) {
+    rtems_task_wake_after(1);
+  }
+
+  rtems_task_suspend(RTEMS_SELF);
+}
+
+static void generate_events(void)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, worker, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(5);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_span(void)
+{
+  rtems_capture_record_span_t span;
+  rtems_capture_record_span_t other;
+  rtems_status_code sc;
+  uint8_t *ptr;
+  size_t size;
+  uint32_t i;
+
+  generate_events();
+
+  /* The span reader works while the capture engine is on */
+  sc = rtems_capture_read_span(0, &span);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(span.count > 0);
+  rtems_test_assert(span.lost == 0);
+
+  sc = rtems_capture_read_span(0, &other);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  ptr = (uint8_t *) span.records;
+  size = 0;
+
+  for (i = 0; i < span.count; ++i) {
+    rtems_capture_record_t *rec = (rtems_capture_record_t *) ptr;
+
+    rtems_test_assert(rec->size >= sizeof(*rec));
+    size += rec->size;
+    ptr += rec->size;
+  }
+
+  rtems_test_assert(size == span.size);
+
+  sc = rtems_capture_release_span(0, &span);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_release_span(0, &span);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+}
+
+static void test_ctf_export(void)
+{
+  static const char header[] = "/* CTF 1.8 */\n";
+  char buf[sizeof(header) - 1];
+  rtems_capture_record_span_t span;
+  rtems_status_code sc;
+  struct stat st;
+  uint32_t magic;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  generate_events();
+
+  sc = rtems_capture_control(false);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_ctf_export(TRACE_PATH);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(TRACE_PATH "/metadata", O_RDONLY);
+  rtems_test_assert(fd >= 0);
+  n = read(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+  rtems_test_assert(memcmp(buf, header, sizeof(buf)) == 0);
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = stat(TRACE_PATH "/stream_0", &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size > 0);
+
+  fd = open(TRACE_PATH "/stream_0", O_RDONLY);
+  rtems_test_assert(fd >= 0);
+  n = read(fd, &magic, sizeof(magic));
+  rtems_test_assert(n == (ssize_t) sizeof(magic));
+  rtems_test_assert(magic == 0xc1fc1fc1);
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  /* The export drained the buffer */
+  sc = rtems_capture_read_span(0, &span);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(span.count == 0);
+
+  /* No flush while a span reader is active */
+  sc = rtems_capture_flush(false);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_capture_release_span(0, &span);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_flush(false);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  sc = rtems_capture_open(BUFFER_SIZE, NULL);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_watch_global(true);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_control(true);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_span();
+  test_ctf_export();
+
+  sc = rtems_capture_close();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -37,7 +37,7 @@ const char rtems_test_name[] = "FLASHDISK 1";
 /* forward declarations to avoid warnings */
 static rtems_task Init(rtems_task_argument argument);
 
-#define FLASHDISK_CONFIG_COUNT 1
+#define FLASHDISK_CONFIG_COUNT 2
 
 #define FLASHDISK_DEVICE_COUNT 1
 
@@ -53,15 +53,23 @@ static rtems_task Init(rtems_task_argument argument);
 #define FLASHDISK_SIZE \
   (FLASHDISK_SEGMENT_COUNT * FLASHDISK_SEGMENT_SIZE)
 
+#define WEAR_COLD_BLOCKS 60U
+
+#define WEAR_HOT_BLOCKS 8U
+
+#define WEAR_HOT_ROUNDS 50U
+
 static const rtems_rfs_format_config rfs_config;
 
 static const char device [] = "/dev/fdda";
 
+static const char wear_device [] = "/dev/fddb";
+
 static const char mnt [] = "/mnt";
 
 static const char file [] = "/mnt/file";
 
-static uint8_t flashdisk_data [FLASHDISK_SIZE];
+static uint8_t flashdisk_data [FLASHDISK_CONFIG_COUNT * FLASHDISK_SIZE];
 
 static void flashdisk_print_status(const char *disk_path)
 {
@@ -147,11 +155,111 @@ static void test(void)
   flashdisk_print_status(device);
 }
 
+static void wear_fill_block(uint8_t *buf, uint32_t block, uint32_t round)
+{
+  memset(buf, (int) (block + round), FLASHDISK_BLOCK_SIZE);
+  buf [0] = (uint8_t) block;
+  buf [1] = (uint8_t) round;
+}
+
+static void wear_write_block(int fd, uint32_t block, uint32_t round)
+{
+  uint8_t buf [FLASHDISK_BLOCK_SIZE];
+  ssize_t n;
+
+  wear_fill_block(buf, block, round);
+
+  n = pwrite(fd, buf, sizeof(buf), (off_t) block * FLASHDISK_BLOCK_SIZE);
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+}
+
+static void wear_check_block(int fd, uint32_t block, uint32_t round)
+{
+  uint8_t expected [FLASHDISK_BLOCK_SIZE];
+  uint8_t buf [FLASHDISK_BLOCK_SIZE];
+  ssize_t n;
+
+  wear_fill_block(expected, block, round);
+
+  n = pread(fd, buf, sizeof(buf), (off_t) block * FLASHDISK_BLOCK_SIZE);
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+  rtems_test_assert(memcmp(buf, expected, sizeof(buf)) == 0);
+}
+
+static void test_wear(void)
+{
+  rtems_blkdev_wear_stats stats;
+  uint32_t block;
+  uint32_t round;
+  int rv;
+  int fd = open(wear_device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  for (block = 0; block < WEAR_COLD_BLOCKS; ++block) {
+    wear_write_block(fd, block, 0);
+  }
+
+  rv = rtems_disk_fd_sync(fd);
+  rtems_test_assert(rv == 0);
+
+  for (round = 1; round <= WEAR_HOT_ROUNDS; ++round) {
+    for (block = 0; block < WEAR_HOT_BLOCKS; ++block) {
+      wear_write_block(fd, WEAR_COLD_BLOCKS + block, round);
+    }
+
+    rv = rtems_disk_fd_sync(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  /* Give the background task a chance to compact */
+  rv = rtems_task_wake_after(rtems_clock_get_ticks_per_second() / 10);
+  rtems_test_assert(rv == RTEMS_SUCCESSFUL);
+
+  rv = rtems_disk_fd_purge(fd);
+  rtems_test_assert(rv == 0);
+
+  for (block = 0; block < WEAR_COLD_BLOCKS; ++block) {
+    wear_check_block(fd, block, 0);
+  }
+
+  for (block = 0; block < WEAR_HOT_BLOCKS; ++block) {
+    wear_check_block(fd, WEAR_COLD_BLOCKS + block, WEAR_HOT_ROUNDS);
+  }
+
+  rv = rtems_disk_fd_get_wear_stats(fd, &stats);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(stats.erase_blocks == FLASHDISK_SEGMENT_COUNT);
+  rtems_test_assert(stats.erase_count > 0);
+  rtems_test_assert(stats.erase_count_min <= stats.erase_count_max);
+  rtems_test_assert(
+    stats.host_writes
+      == WEAR_COLD_BLOCKS + WEAR_HOT_BLOCKS * WEAR_HOT_ROUNDS
+  );
+  rtems_test_assert(stats.media_writes >= stats.host_writes);
+  rtems_test_assert(stats.background_compactions <= stats.compactions);
+  rtems_test_assert(stats.compaction_time_max <= stats.compaction_time);
+
+  rv = rtems_disk_fd_reset_device_stats(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_disk_fd_get_wear_stats(fd, &stats);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(stats.erase_count > 0);
+  rtems_test_assert(stats.compactions == 0);
+  rtems_test_assert(stats.compaction_time == 0);
+  rtems_test_assert(stats.host_writes == 0);
+  rtems_test_assert(stats.media_writes == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
 static void Init(rtems_task_argument arg)
 {
   TEST_BEGIN();
 
   test();
+  test_wear();
 
   TEST_END();
 
@@ -160,7 +268,7 @@ static void Init(rtems_task_argument arg)
 
 static void erase_device(void)
 {
-  memset(&flashdisk_data [0], 0xff, FLASHDISK_SIZE);
+  memset(&flashdisk_data [0], 0xff, sizeof(flashdisk_data));
 }
 
 static rtems_device_driver flashdisk_initialize(
@@ -308,6 +416,19 @@ static const rtems_fdisk_device_desc flashdisk_device = {
   .flash_ops = &flashdisk_ops
 };
 
+static const rtems_fdisk_segment_desc flashdisk_wear_segment_desc = {
+  .count = FLASHDISK_SEGMENT_COUNT,
+  .segment = 0,
+  .offset = FLASHDISK_SIZE,
+  .size = FLASHDISK_SEGMENT_SIZE
+};
+
+static const rtems_fdisk_device_desc flashdisk_wear_device = {
+  .segment_count = 1,
+  .segments = &flashdisk_wear_segment_desc,
+  .flash_ops = &flashdisk_ops
+};
+
 const rtems_flashdisk_config
 rtems_flashdisk_configuration [FLASHDISK_CONFIG_COUNT] = {
   {
@@ -320,6 +441,18 @@ rtems_flashdisk_configuration [FLASHDISK_CONFIG_COUNT] = {
     .compact_segs = 2,
     .avail_compact_segs = 1,
     .info_level = 0
+  }, {
+    .block_size = FLASHDISK_BLOCK_SIZE,
+    .device_count = FLASHDISK_DEVICE_COUNT,
+    .devices = &flashdisk_wear_device,
+    .flags = RTEMS_FDISK_CHECK_PAGES
+      | RTEMS_FDISK_BACKGROUND_COMPACT
+      | RTEMS_FDISK_HOT_COLD_SEPARATION,
+    .unavail_blocks = FLASHDISK_BLOCKS_PER_SEGMENT,
+    .compact_segs = 2,
+    .avail_compact_segs = 1,
+    .info_level = 0,
+    .compact_watermark = 2
   }
 };
 
@@ -343,12 +476,12 @@ uint32_t rtems_flashdisk_configuration_size = FLASHDISK_CONFIG_COUNT;
 
 #define CONFIGURE_FILESYSTEM_RFS
 
-#define CONFIGURE_MAXIMUM_TASKS 2
-#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+#define CONFIGURE_MAXIMUM_TASKS 3
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
 
 #define CONFIGURE_MINIMUM_TASK_STACK_SIZE (32U * 1024U)
 
-#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+#define CONFIGURE_EXTRA_TASK_STACKS (40 * 1024)
 
 #define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
 
@@ -0,0 +1,556 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/score/heapimpl.h>
+
+const char rtems_test_name[] = "HEAPTLSF 1";
+
+#define UNIT 4096
+
+#define AREA_SIZE (4 * UNIT)
+
+#define PAGE_SIZE 128
+
+#define EXTEND_SIZE 256
+
+#define BLOCK_COUNT 24
+
+typedef struct {
+  Heap_Control heap;
+  void *blocks[BLOCK_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static uint8_t area[AREA_SIZE] RTEMS_ALIGNED(64);
+
+static void check_walk(test_context *ctx)
+{
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+}
+
+static uintptr_t init_heap(
+  test_context *ctx,
+  void *begin,
+  uintptr_t size,
+  uintptr_t page_size
+)
+{
+  uintptr_t space;
+
+  memset(begin, 0x7f, size);
+
+  space = _Heap_Initialize_TLSF(&ctx->heap, begin, size, page_size);
+  rtems_test_assert(space > 0);
+  rtems_test_assert(ctx->heap.tlsf != NULL);
+  rtems_test_assert((uintptr_t) ctx->heap.tlsf >= (uintptr_t) begin);
+  rtems_test_assert(
+    (uintptr_t) (ctx->heap.tlsf + 1) <= (uintptr_t) ctx->heap.first_block
+  );
+  check_walk(ctx);
+
+  return space;
+}
+
+static void check_free(
+  test_context *ctx,
+  uint32_t number,
+  uintptr_t total
+)
+{
+  Heap_Information info;
+
+  _Heap_Get_free_information(&ctx->heap, &info);
+  rtems_test_assert(info.number == number);
+  rtems_test_assert(info.total == total);
+}
+
+static void free_block(test_context *ctx, void *p)
+{
+  rtems_test_assert(_Heap_Free(&ctx->heap, p));
+  _Heap_Protection_free_all_delayed_blocks(&ctx->heap);
+  check_walk(ctx);
+}
+
+static Heap_Block *get_block(test_context *ctx, void *p)
+{
+  return _Heap_Block_of_alloc_area((uintptr_t) p, ctx->heap.page_size);
+}
+
+static Heap_Block *get_next_block(Heap_Block *block)
+{
+  return _Heap_Block_at(block, _Heap_Block_size(block));
+}
+
+/*
+ * The same checks as in the malloctest, since the block layout is the same for
+ * both free block methods.
+ */
+static void check_alloc(
+  test_context *ctx,
+  void *p,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary
+)
+{
+  uintptr_t const page_size = ctx->heap.page_size;
+  uintptr_t const alloc_begin = (uintptr_t) p;
+  uintptr_t const alloc_end = alloc_begin + alloc_size;
+  uintptr_t const alloc_area_begin = _Heap_Align_down(alloc_begin, page_size);
+  Heap_Block *const block = get_block(ctx, p);
+  uintptr_t const block_begin = (uintptr_t) block;
+  uintptr_t const block_size = _Heap_Block_size(block);
+  uintptr_t const block_end = block_begin + block_size;
+  uintptr_t size;
+
+  rtems_test_assert(p != NULL);
+  rtems_test_assert(_Heap_Is_block_in_heap(&ctx->heap, block));
+  rtems_test_assert(_Heap_Is_used(block));
+  rtems_test_assert(block_size >= ctx->heap.min_block_size);
+  rtems_test_assert(_Heap_Is_aligned(block_size, page_size));
+  rtems_test_assert(alloc_end <= block_end + HEAP_ALLOC_BONUS);
+  rtems_test_assert(alloc_begin - alloc_area_begin < page_size);
+
+  if (alignment == 0) {
+    rtems_test_assert(alloc_begin == alloc_area_begin);
+  } else {
+    rtems_test_assert(_Heap_Is_aligned(alloc_begin, alignment));
+  }
+
+  if (boundary != 0) {
+    uintptr_t boundary_line = _Heap_Align_down(alloc_end, boundary);
+
+    rtems_test_assert(alloc_size <= boundary);
+    rtems_test_assert(
+      boundary_line <= alloc_begin || alloc_end <= boundary_line
+    );
+  }
+
+  rtems_test_assert(_Heap_Size_of_alloc_area(&ctx->heap, p, &size));
+  rtems_test_assert(size >= alloc_size);
+
+  check_walk(ctx);
+}
+
+static void test_initialize(test_context *ctx)
+{
+  static const uintptr_t page_sizes[] = { 0, CPU_ALIGNMENT, PAGE_SIZE };
+  uintptr_t space;
+  size_t i;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(page_sizes); ++i) {
+    space = init_heap(ctx, area, sizeof(area), page_sizes[i]);
+    check_free(ctx, 1, space);
+    rtems_test_assert(
+      space + _Heap_TLSF_overhead() + 2 * ctx->heap.page_size
+        + 2 * HEAP_BLOCK_HEADER_SIZE >= sizeof(area)
+    );
+  }
+
+  space = _Heap_Initialize_TLSF(&ctx->heap, area, 0, 0);
+  rtems_test_assert(space == 0);
+
+  space = _Heap_Initialize_TLSF(
+    &ctx->heap,
+    area,
+    sizeof(Heap_TLSF_control),
+    0
+  );
+  rtems_test_assert(space == 0);
+
+  space = _Heap_Initialize_TLSF(&ctx->heap, area, (uintptr_t) -1, 0);
+  rtems_test_assert(space == 0);
+
+  space = _Heap_Initialize_TLSF(
+    &ctx->heap,
+    area,
+    sizeof(area),
+    (uintptr_t) -1
+  );
+  rtems_test_assert(space == 0);
+}
+
+/*
+ * Free every second block, so that the free blocks are spread over several
+ * lists of the index.
+ */
+static void fragment(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < BLOCK_COUNT; ++i) {
+    ctx->blocks[i] = _Heap_Allocate(&ctx->heap, (i * 37) % 200 + 1);
+    rtems_test_assert(ctx->blocks[i] != NULL);
+  }
+
+  for (i = 1; i < BLOCK_COUNT; i += 2) {
+    free_block(ctx, ctx->blocks[i]);
+    ctx->blocks[i] = NULL;
+  }
+}
+
+static void unfragment(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < BLOCK_COUNT; ++i) {
+    if (ctx->blocks[i] != NULL) {
+      free_block(ctx, ctx->blocks[i]);
+      ctx->blocks[i] = NULL;
+    }
+  }
+}
+
+static void test_allocate(test_context *ctx)
+{
+  static const uintptr_t sizes[] = { 1, 7, 16, 33, 100, 128, 200, 513, 1000 };
+  static const uintptr_t alignments[] = { 0, 16, 32, 64, 128, 256, 512 };
+  static const uintptr_t boundaries[] = { 0, 256, 1024 };
+  Heap_Information before;
+  Heap_Information after;
+  uintptr_t space;
+  size_t i;
+  size_t j;
+  size_t k;
+  void *p;
+
+  space = init_heap(ctx, area, sizeof(area), 0);
+  fragment(ctx);
+  _Heap_Get_free_information(&ctx->heap, &before);
+  rtems_test_assert(before.number > 1);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    for (j = 0; j < RTEMS_ARRAY_SIZE(alignments); ++j) {
+      for (k = 0; k < RTEMS_ARRAY_SIZE(boundaries); ++k) {
+        uintptr_t size = sizes[i];
+        uintptr_t alignment = alignments[j];
+        uintptr_t boundary = boundaries[k];
+
+        if (boundary != 0 && size > boundary) {
+          continue;
+        }
+
+        p = _Heap_Allocate_aligned_with_boundary(
+          &ctx->heap,
+          size,
+          alignment,
+          boundary
+        );
+        check_alloc(ctx, p, size, alignment, boundary);
+        free_block(ctx, p);
+      }
+    }
+  }
+
+  /* The freed blocks are coalesced again */
+  _Heap_Get_free_information(&ctx->heap, &after);
+  rtems_test_assert(after.number == before.number);
+  rtems_test_assert(after.total == before.total);
+  rtems_test_assert(after.largest == before.largest);
+
+  /* Integer overflow */
+  p = _Heap_Allocate_aligned_with_boundary(&ctx->heap, (uintptr_t) -1, 0, 0);
+  rtems_test_assert(p == NULL);
+
+  /* Size greater than the boundary */
+  p = _Heap_Allocate_aligned_with_boundary(&ctx->heap, 2, 0, 1);
+  rtems_test_assert(p == NULL);
+
+  /* Larger than the largest free block */
+  p = _Heap_Allocate(&ctx->heap, after.largest + 1);
+  rtems_test_assert(p == NULL);
+
+  /* The largest free block is found by the index */
+  p = _Heap_Allocate(
+    &ctx->heap,
+    after.largest - HEAP_BLOCK_HEADER_SIZE + HEAP_ALLOC_BONUS
+  );
+  rtems_test_assert(p != NULL);
+  check_walk(ctx);
+  free_block(ctx, p);
+
+  unfragment(ctx);
+  check_free(ctx, 1, space);
+}
+
+static void *alloc_one_page(test_context *ctx)
+{
+  void *p = _Heap_Allocate(&ctx->heap, 1);
+
+  check_alloc(ctx, p, 1, 0, 0);
+
+  return p;
+}
+
+static void resize(
+  test_context *ctx,
+  void *p,
+  uintptr_t size,
+  Heap_Resize_status expected_status
+)
+{
+  Heap_Resize_status status;
+  uintptr_t old_size;
+  uintptr_t new_size;
+
+  status = _Heap_Resize_block(&ctx->heap, p, size, &old_size, &new_size);
+  rtems_test_assert(status == expected_status);
+
+  if (status == HEAP_RESIZE_SUCCESSFUL) {
+    rtems_test_assert(new_size >= size);
+  } else {
+    rtems_test_assert(new_size == 0);
+  }
+
+  check_walk(ctx);
+}
+
+static void test_resize(test_context *ctx)
+{
+  uintptr_t page_size;
+  uintptr_t space;
+  uintptr_t size;
+  void *p1;
+  void *p2;
+  void *p3;
+
+  /* The index is outside of the heap blocks */
+  init_heap(ctx, area, sizeof(area), PAGE_SIZE);
+  page_size = ctx->heap.page_size;
+  p1 = (void *) ((uintptr_t) ctx->heap.first_block - page_size);
+  resize(ctx, p1, 1, HEAP_RESIZE_FATAL_ERROR);
+
+  /* The next block is used */
+  init_heap(ctx, area, sizeof(area), PAGE_SIZE);
+  p1 = alloc_one_page(ctx);
+  p2 = alloc_one_page(ctx);
+  rtems_test_assert(get_next_block(get_block(ctx, p1)) == get_block(ctx, p2));
+  resize(ctx, p1, 3 * page_size / 2, HEAP_RESIZE_UNSATISFIED);
+
+  /* The next block is free, so it is taken from the index */
+  space = init_heap(ctx, area, sizeof(area), PAGE_SIZE);
+  p1 = alloc_one_page(ctx);
+  resize(ctx, p1, 3 * page_size / 2, HEAP_RESIZE_SUCCESSFUL);
+  free_block(ctx, p1);
+  check_free(ctx, 1, space);
+
+  /* The next free block is too small */
+  init_heap(ctx, area, sizeof(area), PAGE_SIZE);
+  p1 = alloc_one_page(ctx);
+  p2 = alloc_one_page(ctx);
+  p3 = alloc_one_page(ctx);
+  rtems_test_assert(get_next_block(get_block(ctx, p2)) == get_block(ctx, p3));
+  free_block(ctx, p2);
+  resize(ctx, p1, 5 * page_size / 2, HEAP_RESIZE_UNSATISFIED);
+
+  /* The same size */
+  init_heap(ctx, area, sizeof(area), PAGE_SIZE);
+  p1 = alloc_one_page(ctx);
+  rtems_test_assert(_Heap_Size_of_alloc_area(&ctx->heap, p1, &size));
+  resize(ctx, p1, size, HEAP_RESIZE_SUCCESSFUL);
+
+  /* Decrease a block of two pages, the rest goes back to the index */
+  space = init_heap(ctx, area, sizeof(area), PAGE_SIZE);
+  p1 = _Heap_Allocate(&ctx->heap, 3 * page_size / 2);
+  check_alloc(ctx, p1, 3 * page_size / 2, 0, 0);
+  resize(ctx, p1, 1, HEAP_RESIZE_SUCCESSFUL);
+  free_block(ctx, p1);
+  check_free(ctx, 1, space);
+
+  /* Resize to zero */
+  init_heap(ctx, area, sizeof(area), PAGE_SIZE);
+  p1 = alloc_one_page(ctx);
+  resize(ctx, p1, 0, HEAP_RESIZE_SUCCESSFUL);
+}
+
+static void extend(
+  test_context *ctx,
+  uintptr_t begin,
+  uintptr_t size,
+  bool expected
+)
+{
+  uintptr_t extended;
+
+  extended = _Heap_Extend(&ctx->heap, (void *) begin, size, 0);
+  rtems_test_assert((extended > 0) == expected);
+  check_walk(ctx);
+}
+
+static void test_extend(test_context *ctx)
+{
+  uintptr_t const area_begin = (uintptr_t) &area[0];
+  uintptr_t index_begin;
+  uintptr_t index_end;
+  uintptr_t sub_area_begin;
+  uintptr_t sub_area_end;
+  void *p;
+
+  init_heap(ctx, &area[2 * UNIT], UNIT, 0);
+  index_begin = (uintptr_t) ctx->heap.tlsf;
+  index_end = (uintptr_t) (ctx->heap.tlsf + 1);
+  sub_area_begin = (uintptr_t) ctx->heap.first_block;
+  sub_area_end = ctx->heap.first_block->prev_size;
+
+  /* Link below */
+  extend(ctx, area_begin, EXTEND_SIZE, true);
+
+  /* The index must not be overwritten */
+  extend(ctx, index_begin - EXTEND_SIZE / 2, EXTEND_SIZE, false);
+  extend(ctx, index_end - EXTEND_SIZE / 2, EXTEND_SIZE, false);
+  extend(
+    ctx,
+    index_begin - EXTEND_SIZE,
+    index_end - index_begin + 2 * EXTEND_SIZE,
+    false
+  );
+
+  /* Link below the index, the gap covers the index */
+  extend(ctx, index_begin - EXTEND_SIZE, EXTEND_SIZE, true);
+
+  /* Merge below overlap */
+  extend(ctx, sub_area_begin - EXTEND_SIZE / 2, EXTEND_SIZE, false);
+
+  /* Merge above overlap */
+  extend(ctx, sub_area_end - EXTEND_SIZE / 2, EXTEND_SIZE, false);
+
+  /* Merge above */
+  extend(ctx, sub_area_end, EXTEND_SIZE, true);
+
+  /* Link above */
+  extend(ctx, area_begin + 7 * UNIT / 2, EXTEND_SIZE, true);
+
+  /* Area too small */
+  extend(ctx, area_begin + UNIT, 0, false);
+
+  /* Invalid area */
+  extend(ctx, (uintptr_t) -1, 2, false);
+
+  /* The greedy allocation takes the free blocks of all areas */
+  _Heap_Greedy_allocate(&ctx->heap, NULL, 0);
+  check_walk(ctx);
+  p = _Heap_Allocate(&ctx->heap, 1);
+  rtems_test_assert(p == NULL);
+
+  /* Extend an exhausted heap, the allocation must use the new area */
+  init_heap(ctx, &area[0], UNIT, 0);
+  _Heap_Greedy_allocate(&ctx->heap, NULL, 0);
+  extend(ctx, area_begin + 2 * UNIT, EXTEND_SIZE, true);
+  p = _Heap_Allocate(&ctx->heap, 1);
+  rtems_test_assert(p != NULL);
+  rtems_test_assert((uintptr_t) p - (area_begin + 2 * UNIT) < EXTEND_SIZE);
+  check_walk(ctx);
+}
+
+static void test_greedy(test_context *ctx)
+{
+  static const uintptr_t sizes[] = { 1, 100, 1000 };
+  Heap_Block *blocks;
+  uintptr_t space;
+  uintptr_t largest;
+  void *p[RTEMS_ARRAY_SIZE(sizes)];
+  size_t i;
+
+  space = init_heap(ctx, area, sizeof(area), 0);
+
+  blocks = _Heap_Greedy_allocate(&ctx->heap, sizes, RTEMS_ARRAY_SIZE(sizes));
+  check_walk(ctx);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    p[i] = _Heap_Allocate(&ctx->heap, sizes[i]);
+    check_alloc(ctx, p[i], sizes[i], 0, 0);
+  }
+
+  rtems_test_assert(_Heap_Allocate(&ctx->heap, 1) == NULL);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    free_block(ctx, p[i]);
+  }
+
+  _Heap_Greedy_free(&ctx->heap, blocks);
+  check_walk(ctx);
+  check_free(ctx, 1, space);
+
+  fragment(ctx);
+  blocks = _Heap_Greedy_allocate_all_except_largest(&ctx->heap, &largest);
+  check_walk(ctx);
+  check_free(ctx, 1, largest + HEAP_BLOCK_HEADER_SIZE - HEAP_ALLOC_BONUS);
+
+  p[0] = _Heap_Allocate(&ctx->heap, largest);
+  check_alloc(ctx, p[0], largest, 0, 0);
+  rtems_test_assert(_Heap_Allocate(&ctx->heap, 1) == NULL);
+  free_block(ctx, p[0]);
+
+  _Heap_Greedy_free(&ctx->heap, blocks);
+  check_walk(ctx);
+  unfragment(ctx);
+  check_free(ctx, 1, space);
+}
+
+static void test_walk(test_context *ctx)
+{
+  Heap_Information_block info;
+  uint32_t fl_bitmap;
+
+  init_heap(ctx, area, sizeof(area), 0);
+  fragment(ctx);
+
+  _Heap_Get_information(&ctx->heap, &info);
+  /* The last freed block merged with the free block at the end */
+  rtems_test_assert(info.Free.number == BLOCK_COUNT / 2);
+  rtems_test_assert(info.Used.number == BLOCK_COUNT / 2);
+
+  /* Inconsistent bitmaps of the index */
+  fl_bitmap = ctx->heap.tlsf->fl_bitmap;
+  ctx->heap.tlsf->fl_bitmap = 0;
+  rtems_test_assert(!_Heap_Walk(&ctx->heap, 0, false));
+  ctx->heap.tlsf->fl_bitmap = fl_bitmap;
+  check_walk(ctx);
+
+  unfragment(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_initialize(ctx);
+  test_allocate(ctx);
+  test_resize(ctx);
+  test_extend(ctx);
+  test_greedy(ctx);
+  test_walk(ctx);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
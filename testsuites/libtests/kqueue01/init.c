@@ -0,0 +1,520 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/event.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/rtems_bsdnet.h>
+
+const char rtems_test_name[] = "KQUEUE 1";
+
+#define SOCKET_COUNT 32
+
+#define SAMPLE_COUNT 100
+
+#define BASE_PORT 4000
+
+#define MSG_SIZE 16
+
+struct rtems_bsdnet_config rtems_bsdnet_config;
+
+typedef struct {
+  int kq;
+  int sender;
+  int sockets[SOCKET_COUNT];
+  struct kevent events[SOCKET_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static const struct timespec no_wait;
+
+static void fill_addr(struct sockaddr_in *addr, int i)
+{
+  memset(addr, 0, sizeof(*addr));
+  addr->sin_len = sizeof(*addr);
+  addr->sin_family = AF_INET;
+  addr->sin_port = htons(BASE_PORT + i);
+  addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+}
+
+static int create_socket(int i)
+{
+  struct sockaddr_in addr;
+  int fd;
+  int rv;
+
+  fd = socket(PF_INET, SOCK_DGRAM, 0);
+  rtems_test_assert(fd >= 0);
+
+  fill_addr(&addr, i);
+  rv = bind(fd, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  return fd;
+}
+
+static void send_to(test_context *ctx, int i)
+{
+  struct sockaddr_in addr;
+  char buf[MSG_SIZE];
+  ssize_t n;
+
+  memset(buf, i, sizeof(buf));
+  fill_addr(&addr, i);
+  n = sendto(
+    ctx->sender,
+    buf,
+    sizeof(buf),
+    0,
+    (struct sockaddr *) &addr,
+    sizeof(addr)
+  );
+  rtems_test_assert(n == MSG_SIZE);
+}
+
+static void receive_from(test_context *ctx, int i)
+{
+  char buf[MSG_SIZE];
+  char expected[MSG_SIZE];
+  ssize_t n;
+
+  memset(expected, i, sizeof(expected));
+  n = recv(ctx->sockets[i], buf, sizeof(buf), 0);
+  rtems_test_assert(n == MSG_SIZE);
+  rtems_test_assert(memcmp(buf, expected, sizeof(buf)) == 0);
+}
+
+static int poll_events(test_context *ctx)
+{
+  int n;
+
+  n = kevent(ctx->kq, NULL, 0, ctx->events, SOCKET_COUNT, &no_wait);
+  rtems_test_assert(n >= 0);
+
+  return n;
+}
+
+static bool has_read_event(const test_context *ctx, int n, int i)
+{
+  int j;
+
+  for (j = 0; j < n; ++j) {
+    const struct kevent *kev = &ctx->events[j];
+
+    if (
+      kev->ident == (uintptr_t) ctx->sockets[i]
+        && kev->filter == EVFILT_READ
+    ) {
+      rtems_test_assert(kev->udata == &ctx->sockets[i]);
+      rtems_test_assert(kev->data >= MSG_SIZE);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * The datagrams are delivered by the network task, so wait until the events
+ * of all expected sockets are present.
+ */
+static void wait_for_read_events(test_context *ctx, int a, int b)
+{
+  struct timespec timeout;
+  int n;
+
+  timeout.tv_sec = 1;
+  timeout.tv_nsec = 0;
+
+  do {
+    n = kevent(ctx->kq, NULL, 0, ctx->events, SOCKET_COUNT, &timeout);
+    rtems_test_assert(n > 0);
+  } while (!has_read_event(ctx, n, a) || !has_read_event(ctx, n, b));
+
+  rtems_test_assert(n == 2);
+}
+
+static void change(
+  test_context *ctx,
+  int fd,
+  short filter,
+  u_short flags,
+  void *udata
+)
+{
+  struct kevent kev;
+  int n;
+
+  EV_SET(&kev, fd, filter, flags, 0, 0, udata);
+  n = kevent(ctx->kq, &kev, 1, NULL, 0, NULL);
+  rtems_test_assert(n == 0);
+}
+
+static void change_error(
+  test_context *ctx,
+  int fd,
+  short filter,
+  u_short flags,
+  int expected_error
+)
+{
+  struct kevent kev;
+  struct kevent out;
+  int n;
+
+  EV_SET(&kev, fd, filter, flags, 0, 0, NULL);
+
+  errno = 0;
+  n = kevent(ctx->kq, &kev, 1, NULL, 0, NULL);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == expected_error);
+
+  n = kevent(ctx->kq, &kev, 1, &out, 1, NULL);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(out.ident == (uintptr_t) fd);
+  rtems_test_assert(out.filter == filter);
+  rtems_test_assert(out.flags == EV_ERROR);
+  rtems_test_assert(out.data == expected_error);
+}
+
+static void test_setup(test_context *ctx)
+{
+  struct kevent changes[SOCKET_COUNT];
+  int n;
+  int i;
+
+  ctx->kq = kqueue();
+  rtems_test_assert(ctx->kq >= 0);
+
+  ctx->sender = socket(PF_INET, SOCK_DGRAM, 0);
+  rtems_test_assert(ctx->sender >= 0);
+
+  for (i = 0; i < SOCKET_COUNT; ++i) {
+    ctx->sockets[i] = create_socket(i);
+    EV_SET(
+      &changes[i],
+      ctx->sockets[i],
+      EVFILT_READ,
+      EV_ADD,
+      0,
+      0,
+      &ctx->sockets[i]
+    );
+  }
+
+  /* The interest is registered once for all sockets */
+  n = kevent(ctx->kq, changes, SOCKET_COUNT, NULL, 0, NULL);
+  rtems_test_assert(n == 0);
+  rtems_test_assert(poll_events(ctx) == 0);
+}
+
+static void test_level_triggered(test_context *ctx)
+{
+  send_to(ctx, 3);
+  send_to(ctx, 5);
+  wait_for_read_events(ctx, 3, 5);
+
+  /* The events stay ready until the data is received */
+  rtems_test_assert(poll_events(ctx) == 2);
+  rtems_test_assert(has_read_event(ctx, 2, 3));
+  rtems_test_assert(has_read_event(ctx, 2, 5));
+
+  receive_from(ctx, 3);
+  rtems_test_assert(poll_events(ctx) == 1);
+  rtems_test_assert(has_read_event(ctx, 1, 5));
+
+  receive_from(ctx, 5);
+  rtems_test_assert(poll_events(ctx) == 0);
+}
+
+static void test_oneshot(test_context *ctx)
+{
+  int fd = ctx->sockets[0];
+  int n;
+
+  change(ctx, fd, EVFILT_WRITE, EV_ADD | EV_ONESHOT, NULL);
+
+  n = poll_events(ctx);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(ctx->events[0].ident == (uintptr_t) fd);
+  rtems_test_assert(ctx->events[0].filter == EVFILT_WRITE);
+  rtems_test_assert(ctx->events[0].data > 0);
+
+  rtems_test_assert(poll_events(ctx) == 0);
+  change_error(ctx, fd, EVFILT_WRITE, EV_DELETE, ENOENT);
+}
+
+static void test_clear_and_dispatch(test_context *ctx)
+{
+  struct timespec timeout;
+  int n;
+
+  timeout.tv_sec = 1;
+  timeout.tv_nsec = 0;
+
+  /* Replace the level triggered registration with an edge triggered one */
+  change(ctx, ctx->sockets[1], EVFILT_READ, EV_DELETE, NULL);
+  change(ctx, ctx->sockets[1], EVFILT_READ, EV_ADD | EV_CLEAR, NULL);
+
+  send_to(ctx, 1);
+  n = kevent(ctx->kq, NULL, 0, ctx->events, SOCKET_COUNT, &timeout);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(ctx->events[0].ident == (uintptr_t) ctx->sockets[1]);
+  rtems_test_assert(ctx->events[0].udata == NULL);
+  rtems_test_assert(poll_events(ctx) == 0);
+
+  send_to(ctx, 1);
+  n = kevent(ctx->kq, NULL, 0, ctx->events, SOCKET_COUNT, &timeout);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(ctx->events[0].data >= 2 * MSG_SIZE);
+
+  receive_from(ctx, 1);
+  receive_from(ctx, 1);
+  rtems_test_assert(poll_events(ctx) == 0);
+
+  /* A dispatched event is disabled until it is enabled again */
+  change(ctx, ctx->sockets[2], EVFILT_READ, EV_DELETE, NULL);
+  change(ctx, ctx->sockets[2], EVFILT_READ, EV_ADD | EV_DISPATCH, NULL);
+
+  send_to(ctx, 2);
+  n = kevent(ctx->kq, NULL, 0, ctx->events, SOCKET_COUNT, &timeout);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(ctx->events[0].ident == (uintptr_t) ctx->sockets[2]);
+  rtems_test_assert(poll_events(ctx) == 0);
+
+  change(ctx, ctx->sockets[2], EVFILT_READ, EV_ENABLE, NULL);
+  rtems_test_assert(poll_events(ctx) == 1);
+
+  change(ctx, ctx->sockets[2], EVFILT_READ, EV_DISABLE, NULL);
+  rtems_test_assert(poll_events(ctx) == 0);
+
+  receive_from(ctx, 2);
+  change(ctx, ctx->sockets[2], EVFILT_READ, EV_ENABLE, NULL);
+  rtems_test_assert(poll_events(ctx) == 0);
+}
+
+static void test_errors(test_context *ctx)
+{
+  struct kevent kev;
+  int n;
+
+  /* Only sockets provide a kqfilter handler */
+  change_error(ctx, ctx->kq, EVFILT_READ, EV_ADD, EINVAL);
+  change_error(ctx, ctx->sockets[0], EVFILT_TIMER, EV_ADD, EINVAL);
+  change_error(ctx, SOCKET_COUNT + 8, EVFILT_READ, EV_ADD, EBADF);
+  change_error(ctx, ctx->sender, EVFILT_READ, EV_DELETE, ENOENT);
+
+  EV_SET(&kev, ctx->sockets[0], EVFILT_WRITE, EV_ADD | EV_RECEIPT, 0, 0, 0);
+  n = kevent(ctx->kq, &kev, 1, ctx->events, 1, NULL);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(ctx->events[0].flags == EV_ERROR);
+  rtems_test_assert(ctx->events[0].data == 0);
+  change(ctx, ctx->sockets[0], EVFILT_WRITE, EV_DELETE, NULL);
+
+  errno = 0;
+  n = kevent(ctx->sockets[0], NULL, 0, ctx->events, 1, &no_wait);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EBADF);
+}
+
+static void test_timeout(test_context *ctx)
+{
+  struct timespec timeout;
+  rtems_interval then;
+  int n;
+
+  timeout.tv_sec = 0;
+  timeout.tv_nsec = 50000000;
+
+  then = rtems_clock_get_ticks_since_boot();
+  n = kevent(ctx->kq, NULL, 0, ctx->events, SOCKET_COUNT, &timeout);
+  rtems_test_assert(n == 0);
+  rtems_test_assert(rtems_clock_get_ticks_since_boot() - then > 0);
+}
+
+static void test_close(test_context *ctx)
+{
+  int fd = ctx->sockets[SOCKET_COUNT - 1];
+  int rv;
+
+  send_to(ctx, SOCKET_COUNT - 1);
+  send_to(ctx, 0);
+  wait_for_read_events(ctx, SOCKET_COUNT - 1, 0);
+
+  /* The close removes the registered events of the socket */
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(poll_events(ctx) == 1);
+  rtems_test_assert(has_read_event(ctx, 1, 0));
+  change_error(ctx, fd, EVFILT_READ, EV_DELETE, EBADF);
+
+  ctx->sockets[SOCKET_COUNT - 1] = create_socket(SOCKET_COUNT - 1);
+  change(
+    ctx,
+    ctx->sockets[SOCKET_COUNT - 1],
+    EVFILT_READ,
+    EV_ADD,
+    &ctx->sockets[SOCKET_COUNT - 1]
+  );
+}
+
+static uint64_t measure_select(test_context *ctx)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  int nfds;
+  int i;
+  int j;
+
+  nfds = 0;
+
+  for (i = 0; i < SOCKET_COUNT; ++i) {
+    if (ctx->sockets[i] >= nfds) {
+      nfds = ctx->sockets[i] + 1;
+    }
+  }
+
+  a = rtems_counter_read();
+
+  for (j = 0; j < SAMPLE_COUNT; ++j) {
+    fd_set set;
+    int n;
+
+    FD_ZERO(&set);
+
+    for (i = 0; i < SOCKET_COUNT; ++i) {
+      FD_SET(ctx->sockets[i], &set);
+    }
+
+    n = select(nfds, &set, NULL, NULL, NULL);
+    rtems_test_assert(n == 1);
+    rtems_test_assert(FD_ISSET(ctx->sockets[0], &set));
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a))
+    / SAMPLE_COUNT;
+}
+
+static uint64_t measure_kevent(test_context *ctx)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  int j;
+
+  a = rtems_counter_read();
+
+  for (j = 0; j < SAMPLE_COUNT; ++j) {
+    int n;
+
+    n = kevent(ctx->kq, NULL, 0, ctx->events, SOCKET_COUNT, NULL);
+    rtems_test_assert(n == 1);
+    rtems_test_assert(ctx->events[0].ident == (uintptr_t) ctx->sockets[0]);
+  }
+
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a))
+    / SAMPLE_COUNT;
+}
+
+static void test_measure(test_context *ctx)
+{
+  uint64_t select_duration;
+  uint64_t kevent_duration;
+
+  /* Socket 0 has still one datagram pending, all other sockets are idle */
+  select_duration = measure_select(ctx);
+  kevent_duration = measure_kevent(ctx);
+  receive_from(ctx, 0);
+
+  printf(
+    "<KQueue01 socketCount=\"%i\" sampleCount=\"%i\">\n"
+    "  <Select unit=\"ns\">%" PRIu64 "</Select>\n"
+    "  <KEvent unit=\"ns\">%" PRIu64 "</KEvent>\n"
+    "</KQueue01>\n",
+    SOCKET_COUNT,
+    SAMPLE_COUNT,
+    select_duration,
+    kevent_duration
+  );
+}
+
+static void test_cleanup(test_context *ctx)
+{
+  int rv;
+  int i;
+
+  rv = close(ctx->kq);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < SOCKET_COUNT; ++i) {
+    rv = close(ctx->sockets[i]);
+    rtems_test_assert(rv == 0);
+  }
+
+  rv = close(ctx->sender);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = rtems_bsdnet_initialize_network();
+  rtems_test_assert(rv == 0);
+
+  test_setup(ctx);
+  test_level_triggered(ctx);
+  test_oneshot(ctx);
+  test_clear_and_dispatch(ctx);
+  test_errors(ctx);
+  test_timeout(ctx);
+  test_close(ctx);
+  test_measure(ctx);
+  test_cleanup(ctx);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS (SOCKET_COUNT + 8)
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/libcsupport.h>
+#include <rtems/malloc.h>
+
+const char rtems_test_name[] = "MALLOC 5";
+
+#define HIGH_WATERMARK 8
+
+#define BATCH (HIGH_WATERMARK / 2)
+
+#define AREA_COUNT 10
+
+/* Size class of 128 bytes */
+#define SMALL_SIZE 100
+
+#define SMALL_CLASS 3
+
+/* Size class of 64 bytes */
+#define TINY_SIZE 50
+
+#define TINY_CLASS 2
+
+#define LARGE_SIZE 1024
+
+/*
+ * Use a global array to prevent compiler optimizations due to the malloc()
+ * builtin.
+ */
+void *areas[AREA_COUNT];
+
+static rtems_malloc_cache get_class_stats(size_t class_index)
+{
+  rtems_malloc_cache stats[RTEMS_MALLOC_CACHE_CLASS_COUNT];
+  bool ok;
+
+  ok = rtems_malloc_cache_get_statistics(stats);
+  rtems_test_assert(ok);
+
+  return stats[class_index];
+}
+
+static rtems_malloc_cache get_small_class_stats(void)
+{
+  return get_class_stats(SMALL_CLASS);
+}
+
+static uint32_t get_total_frees(void)
+{
+  rtems_malloc_cache stats[RTEMS_MALLOC_CACHE_CLASS_COUNT];
+  uint32_t frees;
+  size_t i;
+  bool ok;
+
+  ok = rtems_malloc_cache_get_statistics(stats);
+  rtems_test_assert(ok);
+
+  frees = 0;
+
+  for (i = 0; i < RTEMS_MALLOC_CACHE_CLASS_COUNT; ++i) {
+    frees += stats[i].frees;
+  }
+
+  return frees;
+}
+
+static void test_refill(void)
+{
+  rtems_malloc_cache s;
+  size_t i;
+
+  s = get_small_class_stats();
+  rtems_test_assert(s.count == 0);
+  rtems_test_assert(s.hits == 0);
+  rtems_test_assert(s.misses == 0);
+  rtems_test_assert(s.frees == 0);
+  rtems_test_assert(s.flushes == 0);
+
+  /* An empty cache is refilled with a batch of areas */
+  areas[0] = malloc(SMALL_SIZE);
+  rtems_test_assert(areas[0] != NULL);
+  memset(areas[0], 0xff, SMALL_SIZE);
+
+  s = get_small_class_stats();
+  rtems_test_assert(s.count == BATCH - 1);
+  rtems_test_assert(s.hits == 0);
+  rtems_test_assert(s.misses == 1);
+
+  free(areas[0]);
+
+  s = get_small_class_stats();
+  rtems_test_assert(s.count == BATCH);
+  rtems_test_assert(s.frees == 1);
+
+  /* The cache satisfies the next allocations */
+  for (i = 0; i < BATCH; ++i) {
+    areas[i] = malloc(SMALL_SIZE);
+    rtems_test_assert(areas[i] != NULL);
+  }
+
+  s = get_small_class_stats();
+  rtems_test_assert(s.count == 0);
+  rtems_test_assert(s.hits == BATCH);
+  rtems_test_assert(s.misses == 1);
+
+  for (i = 0; i < BATCH; ++i) {
+    free(areas[i]);
+  }
+
+  s = get_small_class_stats();
+  rtems_test_assert(s.count == BATCH);
+  rtems_test_assert(s.frees == 1 + BATCH);
+  rtems_test_assert(s.flushes == 0);
+}
+
+static void test_high_watermark(void)
+{
+  rtems_malloc_cache s;
+  size_t i;
+
+  for (i = 0; i < AREA_COUNT; ++i) {
+    areas[i] = malloc(SMALL_SIZE);
+    rtems_test_assert(areas[i] != NULL);
+  }
+
+  /*
+   * BATCH hits, one miss with a refill of BATCH - 1, BATCH - 1 hits, one miss
+   * with a refill of BATCH - 1 and one hit.
+   */
+  s = get_small_class_stats();
+  rtems_test_assert(s.count == BATCH - 2);
+  rtems_test_assert(s.hits == BATCH + BATCH + BATCH - 1 + 1);
+  rtems_test_assert(s.misses == 3);
+
+  for (i = 0; i < AREA_COUNT; ++i) {
+    free(areas[i]);
+
+    s = get_small_class_stats();
+    rtems_test_assert(s.count <= HIGH_WATERMARK);
+  }
+
+  /* One flush of the upper half of a full cache */
+  s = get_small_class_stats();
+  rtems_test_assert(s.flushes == HIGH_WATERMARK - HIGH_WATERMARK / 2);
+  rtems_test_assert(s.count == BATCH - 2 + AREA_COUNT - s.flushes);
+  rtems_test_assert(s.frees == 1 + BATCH + AREA_COUNT);
+}
+
+static void test_large(void)
+{
+  uint32_t frees;
+
+  frees = get_total_frees();
+
+  areas[0] = malloc(LARGE_SIZE);
+  rtems_test_assert(areas[0] != NULL);
+  free(areas[0]);
+
+  rtems_test_assert(get_total_frees() == frees);
+}
+
+static void test_double_free(void)
+{
+  rtems_malloc_cache before;
+  rtems_malloc_cache after;
+
+  areas[0] = malloc(SMALL_SIZE);
+  rtems_test_assert(areas[0] != NULL);
+  free(areas[0]);
+
+  /* The second free of a cached area is reported and ignored */
+  before = get_small_class_stats();
+  free(areas[0]);
+  after = get_small_class_stats();
+
+  rtems_test_assert(after.count == before.count);
+  rtems_test_assert(after.frees == before.frees);
+}
+
+static void test_exhausted_heap(void)
+{
+  rtems_malloc_cache s;
+  uint32_t flushes;
+  uint32_t count;
+  void *opaque;
+
+  s = get_small_class_stats();
+  rtems_test_assert(s.count > 0);
+  count = s.count;
+  flushes = s.flushes;
+
+  s = get_class_stats(TINY_CLASS);
+  rtems_test_assert(s.count == 0);
+
+  opaque = rtems_heap_greedy_allocate(NULL, 0);
+
+  /* Only the areas cached for the small size class are left */
+  areas[0] = malloc(TINY_SIZE);
+  rtems_test_assert(areas[0] != NULL);
+
+  s = get_small_class_stats();
+  rtems_test_assert(s.count == 0);
+  rtems_test_assert(s.flushes == flushes + count);
+
+  free(areas[0]);
+
+  rtems_heap_greedy_free(opaque);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  bool ok;
+
+  TEST_BEGIN();
+
+  test_refill();
+  test_high_watermark();
+  test_large();
+  test_double_free();
+  test_exhausted_heap();
+
+  ok = malloc_walk(0, false);
+  rtems_test_assert(ok);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+#define CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK HIGH_WATERMARK
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,1008 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rpc/rpc.h>
+#include <rpc/pmap_prot.h>
+
+#include <rtems.h>
+#include <rtems/libio.h>
+#include <rtems/rtems_bsdnet.h>
+#include <librtemsNfs.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "NFS 1";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define NETWORK_TASK_PRIORITY 100
+
+#define RESPONDER_PRIORITY 110
+
+#define DEPTH 4
+
+/* The protocol constants of RFC 1094, the headers are not installed */
+
+#define NFS_PROGRAM 100003
+
+#define NFS_VERSION 2
+
+#define MOUNT_PROGRAM 100005
+
+#define MOUNT_VERSION 1
+
+#define MOUNTPROC_MNT 1
+
+#define MOUNTPROC_UMNT 3
+
+#define NFSPROC_NULL 0
+
+#define NFSPROC_GETATTR 1
+
+#define NFSPROC_SETATTR 2
+
+#define NFSPROC_LOOKUP 4
+
+#define NFSPROC_READ 6
+
+#define NFSPROC_WRITE 8
+
+#define NFSPROC_CREATE 9
+
+#define NFSPROC_REMOVE 10
+
+#define NFS_OK 0
+
+#define NFSERR_NOENT 2
+
+#define NFSERR_FBIG 27
+
+#define NFSERR_NOSPC 28
+
+#define NFREG 1
+
+#define NFDIR 2
+
+#define NFS_FHSIZE 32
+
+#define NFS_MAXDATA 8192
+
+#define NFS_MAXNAMLEN 255
+
+#define MOUNT_MAXPATHLEN 1024
+
+#define ROOT_FILEID 1
+
+#define FILE_COUNT 2
+
+#define FILE_SIZE_MAX (2 * DEPTH * NFS_MAXDATA)
+
+#define BATCH_MAX (DEPTH + 2)
+
+#define MSG_SIZE (NFS_MAXDATA + 1024)
+
+#define CHUNK_SIZE 4096
+
+#define BUFFER_SIZE (DEPTH * NFS_MAXDATA)
+
+#define TEST_FILE_SIZE FILE_SIZE_MAX
+
+typedef struct {
+  bool used;
+  char name[NFS_MAXNAMLEN + 1];
+  uint32_t size;
+  uint8_t data[FILE_SIZE_MAX];
+} server_file;
+
+typedef struct {
+  struct sockaddr_in addr;
+  size_t call_len;
+  size_t reply_len;
+  bool io;
+  char call[MSG_SIZE];
+  char reply[MSG_SIZE];
+} server_msg;
+
+typedef struct {
+  int sock;
+  server_file files[FILE_COUNT];
+  server_msg batch[BATCH_MAX];
+  char cred_area[2 * MAX_AUTH_BYTES];
+  char data[NFS_MAXDATA];
+  uint32_t write_error;
+  uint32_t unexpected_count;
+  uint32_t read_count;
+  uint32_t read_offset;
+  uint32_t read_len;
+  uint32_t write_count;
+  uint32_t write_bytes;
+  uint32_t in_flight_max;
+} test_context;
+
+static test_context test_instance;
+
+static char chunk[CHUNK_SIZE];
+
+static const char mnt[] = "/nfs";
+
+static const char file_path[] = "/nfs/file";
+
+struct rtems_bsdnet_config rtems_bsdnet_config = {
+  .network_task_priority = NETWORK_TASK_PRIORITY,
+  .mbuf_bytecount = 256 * 1024,
+  .mbuf_cluster_bytecount = 256 * 1024
+};
+
+static uint8_t pattern(uint32_t offset)
+{
+  return (uint8_t) (offset + offset / 251);
+}
+
+static server_file *get_file(test_context *ctx, uint32_t fileid)
+{
+  uint32_t i = fileid - ROOT_FILEID - 1;
+
+  if (i < FILE_COUNT && ctx->files[i].used) {
+    return &ctx->files[i];
+  }
+
+  return NULL;
+}
+
+static server_file *find_file(test_context *ctx, const char *name)
+{
+  size_t i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    server_file *file = &ctx->files[i];
+
+    if (file->used && strcmp(file->name, name) == 0) {
+      return file;
+    }
+  }
+
+  return NULL;
+}
+
+static uint32_t get_fileid(const test_context *ctx, const server_file *file)
+{
+  return (uint32_t) (file - &ctx->files[0]) + ROOT_FILEID + 1;
+}
+
+static bool xdr_fh(XDR *xdrs, uint32_t *fileid)
+{
+  char fh[NFS_FHSIZE];
+
+  memset(fh, 0, sizeof(fh));
+
+  if (xdrs->x_op == XDR_ENCODE) {
+    memcpy(fh, fileid, sizeof(*fileid));
+  }
+
+  if (!xdr_opaque(xdrs, fh, sizeof(fh))) {
+    return false;
+  }
+
+  memcpy(fileid, fh, sizeof(*fileid));
+
+  return true;
+}
+
+static bool xdr_name(XDR *xdrs, char *name)
+{
+  return xdr_string(xdrs, &name, NFS_MAXNAMLEN);
+}
+
+static bool xdr_u_ints(XDR *xdrs, u_int *val, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    if (!xdr_u_int(xdrs, &val[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static bool encode_status(XDR *xdrs, u_int status)
+{
+  return xdr_u_int(xdrs, &status);
+}
+
+static bool encode_fattr(XDR *xdrs, test_context *ctx, uint32_t fileid)
+{
+  server_file *file = get_file(ctx, fileid);
+  u_int fa[17];
+
+  memset(fa, 0, sizeof(fa));
+
+  if (file != NULL) {
+    fa[0] = NFREG;
+    fa[1] = S_IFREG | 0666;
+    fa[2] = 1;
+    fa[5] = file->size;
+    fa[8] = (file->size + 511) / 512;
+  } else {
+    fa[0] = NFDIR;
+    fa[1] = S_IFDIR | 0777;
+    fa[2] = 2;
+  }
+
+  fa[6] = NFS_MAXDATA;
+  fa[9] = 1;
+  fa[10] = fileid;
+
+  return xdr_u_ints(xdrs, fa, 17);
+}
+
+static bool encode_attrstat(XDR *xdrs, test_context *ctx, uint32_t fileid)
+{
+  return encode_status(xdrs, NFS_OK) && encode_fattr(xdrs, ctx, fileid);
+}
+
+static bool encode_diropres(XDR *xdrs, test_context *ctx, uint32_t fileid)
+{
+  return encode_status(xdrs, NFS_OK)
+    && xdr_fh(xdrs, &fileid)
+    && encode_fattr(xdrs, ctx, fileid);
+}
+
+static bool portmap_prog(
+  test_context *ctx,
+  XDR *in,
+  XDR *out,
+  rpcproc_t proc
+)
+{
+  struct pmap pm;
+  u_int port;
+
+  if (proc != PMAPPROC_GETPORT || !xdr_pmap(in, &pm)) {
+    return false;
+  }
+
+  /* All programs are served by the socket of the portmapper */
+  if (
+    (pm.pm_prog == NFS_PROGRAM && pm.pm_vers == NFS_VERSION)
+      || (pm.pm_prog == MOUNT_PROGRAM && pm.pm_vers == MOUNT_VERSION)
+  ) {
+    port = PMAPPORT;
+  } else {
+    port = 0;
+  }
+
+  return xdr_u_int(out, &port);
+}
+
+static bool mount_prog(
+  test_context *ctx,
+  XDR *in,
+  XDR *out,
+  rpcproc_t proc
+)
+{
+  char path[MOUNT_MAXPATHLEN + 1];
+  char *p = path;
+  uint32_t fileid = ROOT_FILEID;
+
+  if (!xdr_string(in, &p, MOUNT_MAXPATHLEN)) {
+    return false;
+  }
+
+  switch (proc) {
+    case MOUNTPROC_MNT:
+      return encode_status(out, NFS_OK) && xdr_fh(out, &fileid);
+    case MOUNTPROC_UMNT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool nfs_lookup(test_context *ctx, XDR *in, XDR *out)
+{
+  char name[NFS_MAXNAMLEN + 1];
+  uint32_t dir;
+  server_file *file;
+
+  if (!xdr_fh(in, &dir) || !xdr_name(in, name)) {
+    return false;
+  }
+
+  file = find_file(ctx, name);
+
+  if (dir != ROOT_FILEID || file == NULL) {
+    return encode_status(out, NFSERR_NOENT);
+  }
+
+  return encode_diropres(out, ctx, get_fileid(ctx, file));
+}
+
+static bool nfs_create(test_context *ctx, XDR *in, XDR *out)
+{
+  char name[NFS_MAXNAMLEN + 1];
+  u_int sattr[8];
+  uint32_t dir;
+  server_file *file;
+  size_t i;
+
+  if (!xdr_fh(in, &dir) || !xdr_name(in, name) || !xdr_u_ints(in, sattr, 8)) {
+    return false;
+  }
+
+  file = find_file(ctx, name);
+
+  for (i = 0; file == NULL && i < FILE_COUNT; ++i) {
+    if (!ctx->files[i].used) {
+      file = &ctx->files[i];
+      file->used = true;
+      strcpy(file->name, name);
+    }
+  }
+
+  if (file == NULL) {
+    return encode_status(out, NFSERR_NOSPC);
+  }
+
+  file->size = 0;
+
+  return encode_diropres(out, ctx, get_fileid(ctx, file));
+}
+
+static bool nfs_remove(test_context *ctx, XDR *in, XDR *out)
+{
+  char name[NFS_MAXNAMLEN + 1];
+  uint32_t dir;
+  server_file *file;
+
+  if (!xdr_fh(in, &dir) || !xdr_name(in, name)) {
+    return false;
+  }
+
+  file = find_file(ctx, name);
+
+  if (file == NULL) {
+    return encode_status(out, NFSERR_NOENT);
+  }
+
+  file->used = false;
+
+  return encode_status(out, NFS_OK);
+}
+
+static bool nfs_getattr(test_context *ctx, XDR *in, XDR *out)
+{
+  uint32_t fileid;
+
+  return xdr_fh(in, &fileid) && encode_attrstat(out, ctx, fileid);
+}
+
+static bool nfs_setattr(test_context *ctx, XDR *in, XDR *out)
+{
+  u_int sattr[8];
+  uint32_t fileid;
+  server_file *file;
+
+  if (!xdr_fh(in, &fileid) || !xdr_u_ints(in, sattr, 8)) {
+    return false;
+  }
+
+  file = get_file(ctx, fileid);
+
+  if (file != NULL && sattr[3] != UINT32_MAX) {
+    if (sattr[3] > FILE_SIZE_MAX) {
+      return encode_status(out, NFSERR_FBIG);
+    }
+
+    if (sattr[3] > file->size) {
+      memset(&file->data[file->size], 0, sattr[3] - file->size);
+    }
+
+    file->size = sattr[3];
+  }
+
+  return encode_attrstat(out, ctx, fileid);
+}
+
+static bool nfs_read(test_context *ctx, XDR *in, XDR *out)
+{
+  u_int args[3];
+  uint32_t fileid;
+  server_file *file;
+  char *data;
+  u_int n;
+
+  if (!xdr_fh(in, &fileid) || !xdr_u_ints(in, args, 3)) {
+    return false;
+  }
+
+  file = get_file(ctx, fileid);
+
+  if (file == NULL) {
+    return encode_status(out, NFSERR_NOENT);
+  }
+
+  ++ctx->read_count;
+  ctx->read_offset = args[0];
+  ctx->read_len = args[1];
+
+  if (args[0] < file->size) {
+    n = file->size - args[0];
+  } else {
+    n = 0;
+  }
+
+  if (n > args[1]) {
+    n = args[1];
+  }
+
+  data = (char *) &file->data[args[0] < file->size ? args[0] : 0];
+
+  return encode_attrstat(out, ctx, fileid)
+    && xdr_bytes(out, &data, &n, NFS_MAXDATA);
+}
+
+static bool nfs_write(test_context *ctx, XDR *in, XDR *out)
+{
+  u_int args[3];
+  uint32_t fileid;
+  server_file *file;
+  char *data = ctx->data;
+  u_int n;
+
+  if (
+    !xdr_fh(in, &fileid)
+      || !xdr_u_ints(in, args, 3)
+      || !xdr_bytes(in, &data, &n, NFS_MAXDATA)
+  ) {
+    return false;
+  }
+
+  file = get_file(ctx, fileid);
+
+  if (file == NULL) {
+    return encode_status(out, NFSERR_NOENT);
+  }
+
+  ++ctx->write_count;
+
+  if (ctx->write_error != NFS_OK) {
+    return encode_status(out, ctx->write_error);
+  }
+
+  if (args[1] > FILE_SIZE_MAX || n > FILE_SIZE_MAX - args[1]) {
+    return encode_status(out, NFSERR_FBIG);
+  }
+
+  if (args[1] > file->size) {
+    memset(&file->data[file->size], 0, args[1] - file->size);
+  }
+
+  memcpy(&file->data[args[1]], data, n);
+  ctx->write_bytes += n;
+
+  if (args[1] + n > file->size) {
+    file->size = args[1] + n;
+  }
+
+  return encode_attrstat(out, ctx, fileid);
+}
+
+static bool nfs_prog(
+  test_context *ctx,
+  XDR *in,
+  XDR *out,
+  rpcproc_t proc,
+  server_msg *msg
+)
+{
+  switch (proc) {
+    case NFSPROC_NULL:
+      return true;
+    case NFSPROC_GETATTR:
+      return nfs_getattr(ctx, in, out);
+    case NFSPROC_SETATTR:
+      return nfs_setattr(ctx, in, out);
+    case NFSPROC_LOOKUP:
+      return nfs_lookup(ctx, in, out);
+    case NFSPROC_READ:
+      msg->io = true;
+      return nfs_read(ctx, in, out);
+    case NFSPROC_WRITE:
+      msg->io = true;
+      return nfs_write(ctx, in, out);
+    case NFSPROC_CREATE:
+      return nfs_create(ctx, in, out);
+    case NFSPROC_REMOVE:
+      return nfs_remove(ctx, in, out);
+    default:
+      return false;
+  }
+}
+
+/*
+ * Decodes the call of the message and encodes the reply.  A call which is not
+ * expected by the test gets a PROC_UNAVAIL reply and is counted.
+ */
+static void serve(test_context *ctx, server_msg *msg)
+{
+  struct rpc_msg call;
+  struct rpc_msg reply;
+  XDR in;
+  XDR out;
+  bool ok;
+
+  msg->io = false;
+  msg->reply_len = 0;
+
+  memset(&call, 0, sizeof(call));
+  call.rm_call.cb_cred.oa_base = &ctx->cred_area[0];
+  call.rm_call.cb_verf.oa_base = &ctx->cred_area[MAX_AUTH_BYTES];
+
+  xdrmem_create(&in, msg->call, msg->call_len, XDR_DECODE);
+
+  if (!xdr_callmsg(&in, &call) || call.rm_direction != CALL) {
+    ++ctx->unexpected_count;
+    return;
+  }
+
+  memset(&reply, 0, sizeof(reply));
+  reply.rm_xid = call.rm_xid;
+  reply.rm_direction = REPLY;
+  reply.rm_reply.rp_stat = MSG_ACCEPTED;
+  reply.acpted_rply.ar_verf.oa_flavor = AUTH_NONE;
+  reply.acpted_rply.ar_stat = SUCCESS;
+  reply.acpted_rply.ar_results.where = NULL;
+  reply.acpted_rply.ar_results.proc = (xdrproc_t) xdr_void;
+
+  xdrmem_create(&out, msg->reply, sizeof(msg->reply), XDR_ENCODE);
+  ok = xdr_replymsg(&out, &reply);
+  rtems_test_assert(ok);
+
+  if (
+    call.rm_call.cb_prog == PMAPPROG && call.rm_call.cb_vers == PMAPVERS
+  ) {
+    ok = portmap_prog(ctx, &in, &out, call.rm_call.cb_proc);
+  } else if (
+    call.rm_call.cb_prog == MOUNT_PROGRAM
+      && call.rm_call.cb_vers == MOUNT_VERSION
+  ) {
+    ok = mount_prog(ctx, &in, &out, call.rm_call.cb_proc);
+  } else if (
+    call.rm_call.cb_prog == NFS_PROGRAM
+      && call.rm_call.cb_vers == NFS_VERSION
+  ) {
+    ok = nfs_prog(ctx, &in, &out, call.rm_call.cb_proc, msg);
+  } else {
+    ok = false;
+  }
+
+  if (!ok) {
+    ++ctx->unexpected_count;
+
+    reply.acpted_rply.ar_stat = PROC_UNAVAIL;
+    xdr_setpos(&out, 0);
+    ok = xdr_replymsg(&out, &reply);
+    rtems_test_assert(ok);
+  }
+
+  msg->reply_len = xdr_getpos(&out);
+}
+
+/*
+ * The responder has a lower priority than the client and the network tasks.
+ * So, all calls which the client sent before it waits for the first reply are
+ * queued in the socket once the responder runs.  It receives all of them and
+ * counts the READ and WRITE calls before it sends the replies.
+ */
+static void responder(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    size_t count = 0;
+    uint32_t io = 0;
+    size_t i;
+
+    while (count < BATCH_MAX) {
+      server_msg *msg = &ctx->batch[count];
+      socklen_t addr_len = sizeof(msg->addr);
+      ssize_t n;
+
+      n = recvfrom(
+        ctx->sock,
+        msg->call,
+        sizeof(msg->call),
+        count == 0 ? 0 : MSG_DONTWAIT,
+        (struct sockaddr *) &msg->addr,
+        &addr_len
+      );
+
+      if (n < 0) {
+        rtems_test_assert(count > 0 && errno == EWOULDBLOCK);
+        break;
+      }
+
+      msg->call_len = (size_t) n;
+      ++count;
+    }
+
+    for (i = 0; i < count; ++i) {
+      server_msg *msg = &ctx->batch[i];
+
+      serve(ctx, msg);
+
+      if (msg->io) {
+        ++io;
+      }
+    }
+
+    if (io > ctx->in_flight_max) {
+      ctx->in_flight_max = io;
+    }
+
+    for (i = 0; i < count; ++i) {
+      server_msg *msg = &ctx->batch[i];
+      ssize_t n;
+
+      if (msg->reply_len > 0) {
+        n = sendto(
+          ctx->sock,
+          msg->reply,
+          msg->reply_len,
+          0,
+          (struct sockaddr *) &msg->addr,
+          sizeof(msg->addr)
+        );
+        rtems_test_assert(n == (ssize_t) msg->reply_len);
+      }
+    }
+  }
+}
+
+static void start_responder(test_context *ctx)
+{
+  rtems_status_code sc;
+  struct sockaddr_in addr;
+  rtems_id id;
+  int rv;
+
+  ctx->sock = socket(AF_INET, SOCK_DGRAM, 0);
+  rtems_test_assert(ctx->sock >= 0);
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(PMAPPORT);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+  rv = bind(ctx->sock, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  sc = rtems_task_create(
+    rtems_build_name('N', 'F', 'S', 'R'),
+    RESPONDER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE + 4096,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, responder, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void reset_counters(test_context *ctx)
+{
+  ctx->read_count = 0;
+  ctx->write_count = 0;
+  ctx->write_bytes = 0;
+  ctx->in_flight_max = 0;
+}
+
+static void write_chunk(int fd, uint32_t offset)
+{
+  ssize_t n;
+  size_t i;
+
+  for (i = 0; i < sizeof(chunk); ++i) {
+    chunk[i] = (char) pattern(offset + i);
+  }
+
+  n = write(fd, chunk, sizeof(chunk));
+  rtems_test_assert(n == (ssize_t) sizeof(chunk));
+}
+
+static void check_read(int fd, uint32_t offset, size_t len)
+{
+  ssize_t n;
+  size_t i;
+
+  rtems_test_assert(len <= sizeof(chunk));
+
+  n = read(fd, chunk, len);
+  rtems_test_assert(n == (ssize_t) len);
+
+  for (i = 0; i < len; ++i) {
+    rtems_test_assert((uint8_t) chunk[i] == pattern(offset + i));
+  }
+}
+
+static void check_server_file(test_context *ctx, uint32_t size)
+{
+  server_file *file = &ctx->files[0];
+  uint32_t i;
+
+  rtems_test_assert(file->used);
+  rtems_test_assert(strcmp(file->name, "file") == 0);
+  rtems_test_assert(file->size == size);
+
+  for (i = 0; i < size; ++i) {
+    rtems_test_assert(file->data[i] == pattern(i));
+  }
+}
+
+/*
+ * Sequential writes are collected in the write-behind buffer and sent with
+ * DEPTH concurrent WRITE calls of NFS_MAXDATA bytes once it is full.  The
+ * fstat() and close() flush the rest.
+ */
+static void test_write_behind(test_context *ctx)
+{
+  struct stat st;
+  uint32_t offset;
+  int fd;
+  int rv;
+
+  fd = open(file_path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+  rtems_test_assert(fd >= 0);
+
+  reset_counters(ctx);
+
+  for (offset = 0; offset < BUFFER_SIZE - CHUNK_SIZE; offset += CHUNK_SIZE) {
+    write_chunk(fd, offset);
+  }
+
+  rtems_test_assert(ctx->write_count == 0);
+
+  write_chunk(fd, offset);
+  offset += CHUNK_SIZE;
+  rtems_test_assert(ctx->write_count == DEPTH);
+  rtems_test_assert(ctx->write_bytes == BUFFER_SIZE);
+  rtems_test_assert(ctx->in_flight_max == DEPTH);
+  check_server_file(ctx, BUFFER_SIZE);
+
+  write_chunk(fd, offset);
+  offset += CHUNK_SIZE;
+  rtems_test_assert(ctx->write_count == DEPTH);
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == (off_t) offset);
+  rtems_test_assert(ctx->write_count == DEPTH + 1);
+  check_server_file(ctx, offset);
+
+  while (offset < TEST_FILE_SIZE) {
+    write_chunk(fd, offset);
+    offset += CHUNK_SIZE;
+  }
+
+  rtems_test_assert(ctx->write_count == DEPTH + 1);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(ctx->write_bytes == TEST_FILE_SIZE);
+  rtems_test_assert(
+    ctx->write_count == DEPTH + 1
+      + (TEST_FILE_SIZE - BUFFER_SIZE - CHUNK_SIZE + NFS_MAXDATA - 1)
+        / NFS_MAXDATA
+  );
+  check_server_file(ctx, TEST_FILE_SIZE);
+}
+
+/*
+ * A sequential read refills the read-ahead buffer with DEPTH concurrent READ
+ * calls.  A random read fetches only the NFS_MAXDATA bytes around it.
+ */
+static void test_read_ahead(test_context *ctx)
+{
+  uint32_t offset;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(file_path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  reset_counters(ctx);
+
+  for (offset = 0; offset < BUFFER_SIZE; offset += 1024) {
+    check_read(fd, offset, 1024);
+  }
+
+  rtems_test_assert(ctx->read_count == DEPTH);
+  rtems_test_assert(ctx->in_flight_max == DEPTH);
+
+  for (; offset < TEST_FILE_SIZE; offset += 1024) {
+    check_read(fd, offset, 1024);
+  }
+
+  rtems_test_assert(ctx->read_count == 2 * DEPTH);
+
+  n = read(fd, chunk, 1024);
+  rtems_test_assert(n == 0);
+
+  offset = 10000;
+  rtems_test_assert(lseek(fd, offset, SEEK_SET) == offset);
+  reset_counters(ctx);
+  check_read(fd, offset, 100);
+  rtems_test_assert(ctx->read_count == 1);
+  rtems_test_assert(ctx->read_offset == offset);
+  rtems_test_assert(ctx->read_len == NFS_MAXDATA);
+
+  check_read(fd, offset + 100, 100);
+  rtems_test_assert(ctx->read_count == 1);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * A read flushes the write-behind buffer, so it returns what was written
+ * before.
+ */
+static void test_read_after_write(test_context *ctx)
+{
+  int fd;
+  int rv;
+
+  fd = open(file_path, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  reset_counters(ctx);
+
+  write_chunk(fd, 0);
+  rtems_test_assert(ctx->write_count == 0);
+
+  rtems_test_assert(lseek(fd, 0, SEEK_SET) == 0);
+  check_read(fd, 0, CHUNK_SIZE);
+  rtems_test_assert(ctx->write_count == 1);
+  rtems_test_assert(ctx->read_count > 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(ctx->write_count == 1);
+
+  rv = unlink(file_path);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * The error of a deferred WRITE is reported by the fsync() or close() which
+ * flushes the write-behind buffer.
+ */
+static void test_error(test_context *ctx)
+{
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(file_path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+  rtems_test_assert(fd >= 0);
+
+  reset_counters(ctx);
+  ctx->write_error = NFSERR_NOSPC;
+
+  n = write(fd, chunk, sizeof(chunk));
+  rtems_test_assert(n == (ssize_t) sizeof(chunk));
+  rtems_test_assert(ctx->write_count == 0);
+
+  errno = 0;
+  rv = fsync(fd);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOSPC);
+  rtems_test_assert(ctx->write_count == 1);
+
+  rv = fsync(fd);
+  rtems_test_assert(rv == 0);
+
+  n = write(fd, chunk, sizeof(chunk));
+  rtems_test_assert(n == (ssize_t) sizeof(chunk));
+
+  errno = 0;
+  rv = close(fd);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOSPC);
+  rtems_test_assert(ctx->write_count == 2);
+
+  ctx->write_error = NFS_OK;
+
+  rv = unlink(file_path);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  int rv;
+
+  rv = rtems_bsdnet_initialize_network();
+  rtems_test_assert(rv == 0);
+
+  start_responder(ctx);
+
+  nfsPipelineDepth = DEPTH;
+
+  rv = mount_and_make_target_path(
+    "127.0.0.1:/export",
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_NFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  test_write_behind(ctx);
+  test_read_ahead(ctx);
+  test_read_after_write(ctx);
+  test_error(ctx);
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(ctx->unexpected_count == 0);
+}
+
+static rtems_task Init(rtems_task_argument argument)
+{
+  TEST_BEGIN();
+  test();
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_INIT
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 10000
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_FILESYSTEM_IMFS
+#define CONFIGURE_FILESYSTEM_NFS
+
+#define CONFIGURE_UNLIMITED_OBJECTS
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (16 * 1024)
+
+#include <rtems/confdefs.h>
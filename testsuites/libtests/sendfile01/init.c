@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/rtems_bsdnet.h>
+
+const char rtems_test_name[] = "SENDFILE 1";
+
+#define FILE_SIZE (256 * 1024)
+
+#define BUFFER_SIZE 4096
+
+#define SAMPLE_COUNT 8
+
+#define PORT 4100
+
+#define FILE_PATH "/file"
+
+struct rtems_bsdnet_config rtems_bsdnet_config;
+
+typedef struct {
+  rtems_id main_task;
+  rtems_id receiver_task;
+  int fd;
+  int listener;
+  int client;
+  int server;
+  size_t expected;
+  size_t received;
+  bool check;
+  unsigned char buffer[BUFFER_SIZE];
+  unsigned char rx[FILE_SIZE + 2 * BUFFER_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static unsigned char file_byte(size_t i)
+{
+  return (unsigned char) ((i * 7) ^ (i >> 8));
+}
+
+static void create_file(test_context *ctx)
+{
+  size_t i;
+  size_t j;
+  ssize_t n;
+
+  ctx->fd = open(FILE_PATH, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(ctx->fd >= 0);
+
+  for (i = 0; i < FILE_SIZE; i += BUFFER_SIZE) {
+    for (j = 0; j < BUFFER_SIZE; ++j) {
+      ctx->buffer[j] = file_byte(i + j);
+    }
+
+    n = write(ctx->fd, ctx->buffer, BUFFER_SIZE);
+    rtems_test_assert(n == BUFFER_SIZE);
+  }
+
+  rtems_test_assert(lseek(ctx->fd, 0, SEEK_SET) == 0);
+}
+
+static void receiver_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ctx->received = 0;
+
+    while (ctx->received < ctx->expected) {
+      unsigned char *buf;
+      size_t size;
+      ssize_t n;
+
+      if (ctx->check) {
+        buf = &ctx->rx[ctx->received];
+        size = ctx->expected - ctx->received;
+      } else {
+        buf = &ctx->rx[0];
+        size = sizeof(ctx->rx);
+      }
+
+      n = recv(ctx->server, buf, size, 0);
+      rtems_test_assert(n > 0);
+      ctx->received += (size_t) n;
+    }
+
+    sc = rtems_event_transient_send(ctx->main_task);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void start_receive(test_context *ctx, size_t expected, bool check)
+{
+  rtems_status_code sc;
+
+  ctx->expected = expected;
+  ctx->check = check;
+
+  sc = rtems_event_transient_send(ctx->receiver_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_receive(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->received == ctx->expected);
+}
+
+static void test_setup(test_context *ctx)
+{
+  struct sockaddr_in addr;
+  rtems_status_code sc;
+  int rv;
+
+  ctx->main_task = rtems_task_self();
+
+  create_file(ctx);
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_len = sizeof(addr);
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  ctx->listener = socket(PF_INET, SOCK_STREAM, 0);
+  rtems_test_assert(ctx->listener >= 0);
+
+  rv = bind(ctx->listener, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  rv = listen(ctx->listener, 1);
+  rtems_test_assert(rv == 0);
+
+  ctx->client = socket(PF_INET, SOCK_STREAM, 0);
+  rtems_test_assert(ctx->client >= 0);
+
+  rv = connect(ctx->client, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  ctx->server = accept(ctx->listener, NULL, NULL);
+  rtems_test_assert(ctx->server >= 0);
+
+  sc = rtems_task_create(
+    rtems_build_name('R', 'E', 'C', 'V'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->receiver_task
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(
+    ctx->receiver_task,
+    receiver_task,
+    (rtems_task_argument) ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void check_rx(
+  const test_context *ctx,
+  size_t rx_offset,
+  size_t file_offset,
+  size_t size
+)
+{
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    rtems_test_assert(ctx->rx[rx_offset + i] == file_byte(file_offset + i));
+  }
+}
+
+static void test_whole_file(test_context *ctx)
+{
+  off_t sbytes;
+  int rv;
+
+  start_receive(ctx, FILE_SIZE, true);
+  sbytes = -1;
+  rv = sendfile(ctx->fd, ctx->client, 0, 0, NULL, &sbytes, 0);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sbytes == FILE_SIZE);
+  wait_for_receive(ctx);
+  check_rx(ctx, 0, 0, FILE_SIZE);
+
+  /* The file offset of the descriptor is not changed */
+  rtems_test_assert(lseek(ctx->fd, 0, SEEK_CUR) == 0);
+}
+
+static void test_range_with_header_and_trailer(test_context *ctx)
+{
+  static char header[] = "HEADER";
+  static char trailer[] = "TRAILER";
+  struct iovec hv;
+  struct iovec tv;
+  struct sf_hdtr hdtr;
+  size_t hl;
+  size_t tl;
+  off_t offset;
+  size_t nbytes;
+  off_t sbytes;
+  int rv;
+
+  hl = strlen(header);
+  tl = strlen(trailer);
+  hv.iov_base = header;
+  hv.iov_len = hl;
+  tv.iov_base = trailer;
+  tv.iov_len = tl;
+  hdtr.headers = &hv;
+  hdtr.hdr_cnt = 1;
+  hdtr.trailers = &tv;
+  hdtr.trl_cnt = 1;
+  offset = 1234;
+  nbytes = 3 * BUFFER_SIZE + 5;
+
+  start_receive(ctx, hl + nbytes + tl, true);
+  rv = sendfile(ctx->fd, ctx->client, offset, nbytes, &hdtr, &sbytes, 0);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sbytes == (off_t) (hl + nbytes + tl));
+  wait_for_receive(ctx);
+  rtems_test_assert(memcmp(&ctx->rx[0], header, hl) == 0);
+  check_rx(ctx, hl, (size_t) offset, nbytes);
+  rtems_test_assert(memcmp(&ctx->rx[hl + nbytes], trailer, tl) == 0);
+
+  /* A range beyond the end of file is cut off */
+  offset = FILE_SIZE - 10;
+  start_receive(ctx, 10, true);
+  rv = sendfile(ctx->fd, ctx->client, offset, 100, NULL, &sbytes, 0);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sbytes == 10);
+  wait_for_receive(ctx);
+  check_rx(ctx, 0, (size_t) offset, 10);
+}
+
+static void test_errors(test_context *ctx)
+{
+  off_t sbytes;
+  int udp;
+  int rv;
+
+  errno = 0;
+  rv = sendfile(ctx->client, ctx->client, 0, 0, NULL, &sbytes, 0);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = sendfile(-1, ctx->client, 0, 0, NULL, &sbytes, 0);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBADF);
+
+  errno = 0;
+  rv = sendfile(ctx->fd, ctx->fd, 0, 0, NULL, &sbytes, 0);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOTSOCK);
+
+  errno = 0;
+  rv = sendfile(ctx->fd, ctx->client, -1, 0, NULL, &sbytes, 0);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  udp = socket(PF_INET, SOCK_DGRAM, 0);
+  rtems_test_assert(udp >= 0);
+
+  errno = 0;
+  sbytes = -1;
+  rv = sendfile(ctx->fd, udp, 0, 0, NULL, &sbytes, 0);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+  rtems_test_assert(sbytes == 0);
+
+  rv = close(udp);
+  rtems_test_assert(rv == 0);
+}
+
+static void send_with_copy(test_context *ctx)
+{
+  ssize_t n;
+
+  rtems_test_assert(lseek(ctx->fd, 0, SEEK_SET) == 0);
+
+  while ((n = read(ctx->fd, ctx->buffer, BUFFER_SIZE)) > 0) {
+    ssize_t m;
+
+    m = send(ctx->client, ctx->buffer, (size_t) n, 0);
+    rtems_test_assert(m == n);
+  }
+
+  rtems_test_assert(n == 0);
+}
+
+static void send_without_copy(test_context *ctx)
+{
+  off_t sbytes;
+  int rv;
+
+  rv = sendfile(ctx->fd, ctx->client, 0, 0, NULL, &sbytes, 0);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sbytes == FILE_SIZE);
+}
+
+static uint64_t measure(test_context *ctx, void (*send_file)(test_context *))
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  int i;
+
+  start_receive(ctx, SAMPLE_COUNT * FILE_SIZE, false);
+  a = rtems_counter_read();
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    (*send_file)(ctx);
+  }
+
+  wait_for_receive(ctx);
+  b = rtems_counter_read();
+
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+}
+
+static uint64_t throughput(uint64_t duration)
+{
+  if (duration == 0) {
+    duration = 1;
+  }
+
+  return (UINT64_C(1000000000) * SAMPLE_COUNT * FILE_SIZE) / duration;
+}
+
+static void test_measure(test_context *ctx)
+{
+  uint64_t copy_duration;
+  uint64_t sendfile_duration;
+
+  copy_duration = measure(ctx, send_with_copy);
+  sendfile_duration = measure(ctx, send_without_copy);
+
+  printf(
+    "<SendFile01 fileSize=\"%i\" sampleCount=\"%i\" bufferSize=\"%i\">\n"
+    "  <ReadSend>\n"
+    "    <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "    <Throughput unit=\"B/s\">%" PRIu64 "</Throughput>\n"
+    "  </ReadSend>\n"
+    "  <SendFile>\n"
+    "    <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "    <Throughput unit=\"B/s\">%" PRIu64 "</Throughput>\n"
+    "  </SendFile>\n"
+    "</SendFile01>\n",
+    FILE_SIZE,
+    SAMPLE_COUNT,
+    BUFFER_SIZE,
+    copy_duration,
+    throughput(copy_duration),
+    sendfile_duration,
+    throughput(sendfile_duration)
+  );
+}
+
+static void test_cleanup(test_context *ctx)
+{
+  rtems_status_code sc;
+  int rv;
+
+  sc = rtems_task_delete(ctx->receiver_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rv = close(ctx->server);
+  rtems_test_assert(rv == 0);
+
+  rv = close(ctx->client);
+  rtems_test_assert(rv == 0);
+
+  rv = close(ctx->listener);
+  rtems_test_assert(rv == 0);
+
+  rv = close(ctx->fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(FILE_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = rtems_bsdnet_initialize_network();
+  rtems_test_assert(rv == 0);
+
+  test_setup(ctx);
+  test_whole_file(ctx);
+  test_range_with_header_and_trailer(ctx);
+  test_errors(ctx);
+  test_measure(ctx);
+  test_cleanup(ctx);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
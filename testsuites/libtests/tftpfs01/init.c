@@ -0,0 +1,734 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/libio.h>
+#include <rtems/rtems_bsdnet.h>
+#include <rtems/tftp.h>
+
+const char rtems_test_name[] = "TFTPFS 1";
+
+#define FILE_SIZE (128 * 1024)
+
+#define CHUNK_SIZE 1000
+
+#define SERVER_BLOCKSIZE_MAX 2048
+
+#define SERVER_WINDOWSIZE_MAX 16
+
+#define PACKET_SIZE (4 + SERVER_BLOCKSIZE_MAX)
+
+#define OPCODE_RRQ 1
+
+#define OPCODE_DATA 3
+
+#define OPCODE_ACK 4
+
+#define OPCODE_ERROR 5
+
+#define OPCODE_OACK 6
+
+#define MOUNT_DIR "/TFTP"
+
+#define CLASSIC_MOUNT_DIR "/TFTP1350"
+
+#define ODD_MOUNT_DIR "/TFTPODD"
+
+#define FILE_PATH MOUNT_DIR "/file"
+
+#define CLASSIC_FILE_PATH CLASSIC_MOUNT_DIR "/file"
+
+#define ODD_FILE_PATH ODD_MOUNT_DIR "/file"
+
+struct rtems_bsdnet_config rtems_bsdnet_config;
+
+typedef enum {
+  SERVER_OPTIONS,
+  SERVER_TSIZE_ONLY,
+  SERVER_NO_WINDOWSIZE,
+  SERVER_IGNORE_OPTIONS,
+  SERVER_REJECT_OPTIONS
+} server_mode;
+
+typedef struct {
+  int fd;
+  struct sockaddr_in client;
+  int blocksize;
+  int windowsize;
+  size_t oack_size;
+  unsigned char oack[64];
+} transfer;
+
+typedef struct {
+  int server;
+  server_mode mode;
+  int drop_block;
+  int transfers;
+  int data_packets;
+  size_t written;
+  unsigned char packet[PACKET_SIZE];
+  unsigned char out[PACKET_SIZE];
+  unsigned char file[FILE_SIZE];
+  unsigned char rx[FILE_SIZE];
+  unsigned char buf[FILE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static char classic_options[] = "rfc1350";
+
+static char odd_options[] = "blocksize=1001";
+
+static char invalid_options[] = "blocksize=4";
+
+static void put16(unsigned char *p, int v)
+{
+  uint16_t w;
+
+  w = htons((uint16_t) v);
+  memcpy(p, &w, sizeof(w));
+}
+
+static int get16(const unsigned char *p)
+{
+  uint16_t w;
+
+  memcpy(&w, p, sizeof(w));
+
+  return ntohs(w);
+}
+
+static void server_send(test_context *ctx, transfer *t, size_t size)
+{
+  ssize_t n;
+
+  n = sendto(
+    t->fd,
+    ctx->out,
+    size,
+    0,
+    (const struct sockaddr *) &t->client,
+    sizeof(t->client)
+  );
+  rtems_test_assert(n == (ssize_t) size);
+}
+
+static void server_send_ack(test_context *ctx, transfer *t, int block)
+{
+  put16(&ctx->out[0], OPCODE_ACK);
+  put16(&ctx->out[2], block);
+  server_send(ctx, t, 4);
+}
+
+static void server_send_oack(test_context *ctx, transfer *t)
+{
+  put16(&ctx->out[0], OPCODE_OACK);
+  memcpy(&ctx->out[2], t->oack, t->oack_size);
+  server_send(ctx, t, 2 + t->oack_size);
+}
+
+static ssize_t server_receive(test_context *ctx, transfer *t)
+{
+  ssize_t n;
+
+  n = recv(t->fd, ctx->packet, sizeof(ctx->packet), 0);
+  rtems_test_assert(n < 0 || n >= 4);
+
+  return n;
+}
+
+static void server_send_file(test_context *ctx, transfer *t)
+{
+  int base;
+  int last;
+
+  if (t->oack_size > 0) {
+    ssize_t n;
+
+    do {
+      server_send_oack(ctx, t);
+      n = server_receive(ctx, t);
+    } while (
+      n < 0
+        || get16(&ctx->packet[0]) != OPCODE_ACK
+        || get16(&ctx->packet[2]) != 0
+    );
+  }
+
+  base = 1;
+  last = FILE_SIZE / t->blocksize + 1;
+
+  while (base <= last) {
+    ssize_t n;
+    int i;
+
+    for (i = 0; i < t->windowsize && base + i <= last; ++i) {
+      int block = base + i;
+      size_t offset = (size_t) (block - 1) * (size_t) t->blocksize;
+      size_t size = FILE_SIZE - offset;
+
+      if (size > (size_t) t->blocksize) {
+        size = (size_t) t->blocksize;
+      }
+
+      if (block == ctx->drop_block) {
+        ctx->drop_block = 0;
+        continue;
+      }
+
+      put16(&ctx->out[0], OPCODE_DATA);
+      put16(&ctx->out[2], block);
+      memcpy(&ctx->out[4], &ctx->file[offset], size);
+      server_send(ctx, t, 4 + size);
+      ++ctx->data_packets;
+    }
+
+    n = server_receive(ctx, t);
+
+    if (n >= 4 && get16(&ctx->packet[0]) == OPCODE_ACK) {
+      int acked = get16(&ctx->packet[2]);
+
+      if (acked >= base - 1 && acked <= last) {
+        base = acked + 1;
+      }
+    }
+  }
+}
+
+static void server_receive_file(test_context *ctx, transfer *t)
+{
+  size_t size;
+  int expected;
+  int count;
+  bool resync;
+  bool done;
+
+  if (t->oack_size > 0) {
+    server_send_oack(ctx, t);
+  } else {
+    server_send_ack(ctx, t, 0);
+  }
+
+  size = 0;
+  expected = 1;
+  count = 0;
+  resync = false;
+  done = false;
+
+  while (!done) {
+    ssize_t n;
+    int block;
+
+    n = server_receive(ctx, t);
+
+    if (n < 0) {
+      server_send_ack(ctx, t, expected - 1);
+      count = 0;
+      continue;
+    }
+
+    if (get16(&ctx->packet[0]) != OPCODE_DATA) {
+      continue;
+    }
+
+    block = get16(&ctx->packet[2]);
+    ++ctx->data_packets;
+
+    if (block == ctx->drop_block) {
+      ctx->drop_block = 0;
+      continue;
+    }
+
+    if (block == expected) {
+      size_t len = (size_t) n - 4;
+
+      rtems_test_assert(size + len <= sizeof(ctx->rx));
+      memcpy(&ctx->rx[size], &ctx->packet[4], len);
+      size += len;
+      ++expected;
+      resync = false;
+
+      if (++count == t->windowsize || len < (size_t) t->blocksize) {
+        server_send_ack(ctx, t, block);
+        count = 0;
+        done = len < (size_t) t->blocksize;
+      }
+    } else if (!resync) {
+      resync = true;
+      count = 0;
+      server_send_ack(ctx, t, expected - 1);
+    }
+  }
+
+  ctx->written = size;
+}
+
+static void add_option(transfer *t, const char *name, int value)
+{
+  int n;
+
+  n = snprintf(
+    (char *) &t->oack[t->oack_size],
+    sizeof(t->oack) - t->oack_size,
+    "%s%c%i",
+    name,
+    '\0',
+    value
+  );
+  rtems_test_assert(n > 0);
+  t->oack_size += (size_t) n + 1;
+  rtems_test_assert(t->oack_size <= sizeof(t->oack));
+}
+
+static void server_handle_request(
+  test_context *ctx,
+  const struct sockaddr_in *client,
+  size_t n
+)
+{
+  transfer t;
+  struct timeval tv;
+  const char *cp;
+  const char *end;
+  int opcode;
+  bool has_options;
+  int rv;
+
+  memset(&t, 0, sizeof(t));
+  t.client = *client;
+  t.blocksize = 512;
+  t.windowsize = 1;
+
+  opcode = get16(&ctx->packet[0]);
+  cp = (const char *) &ctx->packet[2];
+  end = (const char *) &ctx->packet[n];
+
+  /* File name and mode */
+  cp += strlen(cp) + 1;
+  cp += strlen(cp) + 1;
+  has_options = cp < end;
+
+  t.fd = socket(PF_INET, SOCK_DGRAM, 0);
+  rtems_test_assert(t.fd >= 0);
+
+  tv.tv_sec = 1;
+  tv.tv_usec = 0;
+  rv = setsockopt(t.fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  rtems_test_assert(rv == 0);
+
+  if (has_options && ctx->mode == SERVER_REJECT_OPTIONS) {
+    put16(&ctx->out[0], OPCODE_ERROR);
+    put16(&ctx->out[2], 8);
+    ctx->out[4] = '\0';
+    server_send(ctx, &t, 5);
+  } else {
+    if (
+      has_options
+        && ctx->mode != SERVER_IGNORE_OPTIONS
+    ) {
+      while (cp < end) {
+        const char *name = cp;
+        int value;
+
+        cp += strlen(cp) + 1;
+        value = atoi(cp);
+        cp += strlen(cp) + 1;
+
+        if (ctx->mode == SERVER_TSIZE_ONLY && strcmp(name, "tsize") != 0) {
+          continue;
+        }
+
+        if (
+          ctx->mode == SERVER_NO_WINDOWSIZE
+            && strcmp(name, "windowsize") == 0
+        ) {
+          continue;
+        }
+
+        if (strcmp(name, "blksize") == 0) {
+          if (value > SERVER_BLOCKSIZE_MAX) {
+            value = SERVER_BLOCKSIZE_MAX;
+          }
+
+          t.blocksize = value;
+          add_option(&t, name, value);
+        } else if (strcmp(name, "windowsize") == 0) {
+          if (value > SERVER_WINDOWSIZE_MAX) {
+            value = SERVER_WINDOWSIZE_MAX;
+          }
+
+          t.windowsize = value;
+          add_option(&t, name, value);
+        } else if (strcmp(name, "tsize") == 0) {
+          add_option(&t, name, FILE_SIZE);
+        }
+      }
+    }
+
+    if (opcode == OPCODE_RRQ) {
+      server_send_file(ctx, &t);
+    } else {
+      server_receive_file(ctx, &t);
+    }
+  }
+
+  rv = close(t.fd);
+  rtems_test_assert(rv == 0);
+
+  ++ctx->transfers;
+}
+
+static void server_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    struct sockaddr_in client;
+    socklen_t len;
+    ssize_t n;
+
+    len = sizeof(client);
+    n = recvfrom(
+      ctx->server,
+      ctx->packet,
+      sizeof(ctx->packet) - 1,
+      0,
+      (struct sockaddr *) &client,
+      &len
+    );
+    rtems_test_assert(n > 2);
+    ctx->packet[n] = '\0';
+    server_handle_request(ctx, &client, (size_t) n);
+  }
+}
+
+static void start_server(test_context *ctx)
+{
+  struct sockaddr_in addr;
+  rtems_status_code sc;
+  rtems_id id;
+  size_t i;
+  int rv;
+
+  for (i = 0; i < FILE_SIZE; ++i) {
+    ctx->file[i] = (unsigned char) ((i * 13) ^ (i >> 9));
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_len = sizeof(addr);
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(69);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  ctx->server = socket(PF_INET, SOCK_DGRAM, 0);
+  rtems_test_assert(ctx->server >= 0);
+
+  rv = bind(ctx->server, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'F', 'T', 'P'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE * 2,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, server_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void do_mount(const char *target, void *data)
+{
+  int rv;
+
+  rv = mount_and_make_target_path(
+    "127.0.0.1:",
+    target,
+    RTEMS_FILESYSTEM_TYPE_TFTPFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void read_file(test_context *ctx, const char *path, int expected_avail)
+{
+  size_t size;
+  ssize_t n;
+  int avail;
+  int fd;
+  int rv;
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  avail = -1;
+  rv = ioctl(fd, FIONREAD, &avail);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(avail == expected_avail);
+
+  size = 0;
+
+  do {
+    n = read(fd, &ctx->buf[size], CHUNK_SIZE);
+    rtems_test_assert(n >= 0);
+    size += (size_t) n;
+    rtems_test_assert(size <= sizeof(ctx->buf));
+  } while (n > 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(size == FILE_SIZE);
+  rtems_test_assert(memcmp(ctx->buf, ctx->file, FILE_SIZE) == 0);
+}
+
+static void write_file(test_context *ctx, const char *path)
+{
+  size_t size;
+  int fd;
+  int rv;
+
+  memset(ctx->rx, 0, sizeof(ctx->rx));
+  ctx->written = 0;
+
+  fd = open(path, O_WRONLY);
+  rtems_test_assert(fd >= 0);
+
+  size = 0;
+
+  while (size < FILE_SIZE) {
+    size_t chunk;
+    ssize_t n;
+
+    chunk = FILE_SIZE - size;
+    if (chunk > CHUNK_SIZE) {
+      chunk = CHUNK_SIZE;
+    }
+
+    n = write(fd, &ctx->file[size], chunk);
+    rtems_test_assert(n == (ssize_t) chunk);
+    size += chunk;
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(ctx->written == FILE_SIZE);
+  rtems_test_assert(memcmp(ctx->rx, ctx->file, FILE_SIZE) == 0);
+}
+
+static void test_invalid_options(void)
+{
+  int rv;
+
+  errno = 0;
+  rv = mount_and_make_target_path(
+    "127.0.0.1:",
+    "/TFTPINV",
+    RTEMS_FILESYSTEM_TYPE_TFTPFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    invalid_options
+  );
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+}
+
+static void test_options(test_context *ctx)
+{
+  int transfers;
+
+  ctx->mode = SERVER_OPTIONS;
+  transfers = ctx->transfers;
+
+  /* The transfer size option reports the file size */
+  read_file(ctx, FILE_PATH, FILE_SIZE);
+  write_file(ctx, FILE_PATH);
+
+  rtems_test_assert(ctx->transfers == transfers + 2);
+}
+
+static void test_lost_blocks(test_context *ctx)
+{
+  ctx->mode = SERVER_OPTIONS;
+
+  /* The receiver acknowledges the block before the gap */
+  ctx->drop_block = 3;
+  read_file(ctx, FILE_PATH, FILE_SIZE);
+  rtems_test_assert(ctx->drop_block == 0);
+
+  /* The sender refills the window after the partial acknowledgement */
+  ctx->drop_block = 3;
+  write_file(ctx, FILE_PATH);
+  rtems_test_assert(ctx->drop_block == 0);
+
+  /* The sender repeats the window if its first block is lost */
+  ctx->drop_block = 1;
+  write_file(ctx, FILE_PATH);
+  rtems_test_assert(ctx->drop_block == 0);
+}
+
+static void test_partial_options(test_context *ctx)
+{
+  /*
+   * The options missing in the acknowledgement are not in effect, so the
+   * RFC 1350 block and window sizes apply
+   */
+  ctx->mode = SERVER_TSIZE_ONLY;
+  read_file(ctx, FILE_PATH, FILE_SIZE);
+
+  ctx->mode = SERVER_NO_WINDOWSIZE;
+  read_file(ctx, FILE_PATH, FILE_SIZE);
+  write_file(ctx, FILE_PATH);
+}
+
+static void test_odd_blocksize(test_context *ctx)
+{
+  /* The DATA packets of the window stay aligned */
+  ctx->mode = SERVER_OPTIONS;
+  read_file(ctx, ODD_FILE_PATH, FILE_SIZE);
+  write_file(ctx, ODD_FILE_PATH);
+}
+
+static void test_fallback(test_context *ctx)
+{
+  int transfers;
+
+  /* Without the transfer size the first block is available */
+  ctx->mode = SERVER_IGNORE_OPTIONS;
+  read_file(ctx, FILE_PATH, 512);
+  write_file(ctx, FILE_PATH);
+
+  /* The rejected request is repeated without options */
+  ctx->mode = SERVER_REJECT_OPTIONS;
+  transfers = ctx->transfers;
+  read_file(ctx, FILE_PATH, 512);
+  rtems_test_assert(ctx->transfers == transfers + 2);
+  write_file(ctx, FILE_PATH);
+  rtems_test_assert(ctx->transfers == transfers + 4);
+}
+
+static uint64_t measure_read(test_context *ctx, const char *path, int *packets)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  int avail;
+
+  ctx->mode = SERVER_OPTIONS;
+  ctx->data_packets = 0;
+  avail = strcmp(path, FILE_PATH) == 0 ? FILE_SIZE : 512;
+
+  a = rtems_counter_read();
+  read_file(ctx, path, avail);
+  b = rtems_counter_read();
+
+  *packets = ctx->data_packets;
+
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+}
+
+static void test_measure(test_context *ctx)
+{
+  uint64_t classic_duration;
+  uint64_t window_duration;
+  int classic_packets;
+  int window_packets;
+
+  classic_duration = measure_read(ctx, CLASSIC_FILE_PATH, &classic_packets);
+  window_duration = measure_read(ctx, FILE_PATH, &window_packets);
+
+  rtems_test_assert(window_packets < classic_packets);
+
+  printf(
+    "<TFTPFS01 fileSize=\"%i\">\n"
+    "  <RFC1350 blockSize=\"512\" windowSize=\"1\">\n"
+    "    <DataPackets>%i</DataPackets>\n"
+    "    <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "  </RFC1350>\n"
+    "  <Options blockSize=\"1456\" windowSize=\"8\">\n"
+    "    <DataPackets>%i</DataPackets>\n"
+    "    <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "  </Options>\n"
+    "</TFTPFS01>\n",
+    FILE_SIZE,
+    classic_packets,
+    classic_duration,
+    window_packets,
+    window_duration
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = rtems_bsdnet_initialize_network();
+  rtems_test_assert(rv == 0);
+
+  start_server(ctx);
+  do_mount(MOUNT_DIR, NULL);
+  do_mount(CLASSIC_MOUNT_DIR, classic_options);
+  do_mount(ODD_MOUNT_DIR, odd_options);
+
+  test_invalid_options();
+  test_options(ctx);
+  test_lost_blocks(ctx);
+  test_partial_options(ctx);
+  test_odd_blocksize(ctx);
+  test_fallback(ctx);
+  test_measure(ctx);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_TFTPFS
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 4
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 4
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
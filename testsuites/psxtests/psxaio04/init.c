@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <aio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/posix/aio_misc.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "PSXAIO 4";
+
+#define REQUEST_SIZE 512
+
+#define REQUEST_COUNT 256
+
+#define BATCH_SIZE 16
+
+#define FILE_NAME "/aio"
+
+typedef struct {
+  int fd;
+  struct aiocb cb[ REQUEST_COUNT ];
+  struct aiocb *list[ BATCH_SIZE ];
+  unsigned char data[ REQUEST_COUNT ][ REQUEST_SIZE ];
+  unsigned char buf[ REQUEST_COUNT ][ REQUEST_SIZE ];
+} test_context;
+
+static test_context test_instance;
+
+static void prepare( test_context *ctx, int opcode )
+{
+  size_t i;
+
+  memset( &ctx->cb[ 0 ], 0, sizeof( ctx->cb ) );
+
+  for ( i = 0; i < REQUEST_COUNT; ++i ) {
+    struct aiocb *cb = &ctx->cb[ i ];
+
+    cb->aio_fildes = ctx->fd;
+    cb->aio_offset = (off_t) ( i * REQUEST_SIZE );
+    cb->aio_nbytes = REQUEST_SIZE;
+    cb->aio_lio_opcode = opcode;
+
+    if ( opcode == LIO_WRITE ) {
+      cb->aio_buf = &ctx->data[ i ][ 0 ];
+    } else {
+      cb->aio_buf = &ctx->buf[ i ][ 0 ];
+    }
+  }
+
+  memset( &ctx->buf[ 0 ][ 0 ], 0, sizeof( ctx->buf ) );
+}
+
+static void wait_for_completion( const struct aiocb *cb )
+{
+  while ( aio_error( cb ) == EINPROGRESS ) {
+    sched_yield();
+  }
+}
+
+static void check_results( const test_context *ctx )
+{
+  size_t i;
+
+  for ( i = 0; i < REQUEST_COUNT; ++i ) {
+    rtems_test_assert( aio_error( &ctx->cb[ i ] ) == 0 );
+    rtems_test_assert( aio_return( &ctx->cb[ i ] ) == REQUEST_SIZE );
+  }
+}
+
+static void check_file( test_context *ctx )
+{
+  ssize_t n;
+
+  n = pread( ctx->fd, &ctx->buf[ 0 ][ 0 ], sizeof( ctx->buf ), 0 );
+  rtems_test_assert( n == (ssize_t) sizeof( ctx->buf ) );
+  rtems_test_assert( memcmp( ctx->buf, ctx->data, sizeof( ctx->buf ) ) == 0 );
+}
+
+static void clear_file( test_context *ctx )
+{
+  int rv;
+
+  rv = ftruncate( ctx->fd, 0 );
+  rtems_test_assert( rv == 0 );
+}
+
+static void report( const char *name, uint64_t ns )
+{
+  uint64_t iops;
+
+  if ( ns == 0 ) {
+    ns = 1;
+  }
+
+  iops = ( (uint64_t) REQUEST_COUNT * 1000000000 ) / ns;
+  printf(
+    "  <%s requests=\"%i\" size=\"%i\">"
+      "<Duration unit=\"ns\">%" PRIu64 "</Duration>"
+      "<IOPS>%" PRIu64 "</IOPS></%s>\n",
+    name,
+    REQUEST_COUNT,
+    REQUEST_SIZE,
+    ns,
+    iops,
+    name
+  );
+}
+
+static void submit_single( test_context *ctx, int opcode )
+{
+  size_t i;
+  int    rv;
+
+  for ( i = 0; i < REQUEST_COUNT; ++i ) {
+    if ( opcode == LIO_WRITE ) {
+      rv = aio_write( &ctx->cb[ i ] );
+    } else {
+      rv = aio_read( &ctx->cb[ i ] );
+    }
+
+    rtems_test_assert( rv == 0 );
+  }
+
+  for ( i = 0; i < REQUEST_COUNT; ++i ) {
+    wait_for_completion( &ctx->cb[ i ] );
+  }
+}
+
+static void submit_batches( test_context *ctx )
+{
+  size_t i;
+  size_t j;
+  int    rv;
+
+  for ( i = 0; i < REQUEST_COUNT; i += BATCH_SIZE ) {
+    for ( j = 0; j < BATCH_SIZE; ++j ) {
+      ctx->list[ j ] = &ctx->cb[ i + j ];
+    }
+
+    rv = lio_listio( LIO_WAIT, ctx->list, BATCH_SIZE, NULL );
+    rtems_test_assert( rv == 0 );
+
+    /* All requests of the list are complete */
+    for ( j = 0; j < BATCH_SIZE; ++j ) {
+      rtems_test_assert( aio_error( ctx->list[ j ] ) == 0 );
+    }
+  }
+}
+
+static void run( test_context *ctx, int opcode, bool batch, const char *name )
+{
+  uint64_t begin;
+  uint64_t end;
+
+  prepare( ctx, opcode );
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  if ( batch ) {
+    submit_batches( ctx );
+  } else {
+    submit_single( ctx, opcode );
+  }
+
+  end = rtems_clock_get_uptime_nanoseconds();
+
+  check_results( ctx );
+
+  if ( opcode == LIO_WRITE ) {
+    check_file( ctx );
+  } else {
+    rtems_test_assert( memcmp( ctx->buf, ctx->data, sizeof( ctx->buf ) ) == 0 );
+  }
+
+  report( name, end - begin );
+}
+
+static void test_errors( test_context *ctx )
+{
+  struct aiocb *list[ 2 ];
+  int           rv;
+
+  errno = 0;
+  rv = lio_listio( LIO_WAIT + LIO_NOWAIT + 1, ctx->list, 1, NULL );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  errno = 0;
+  rv = lio_listio( LIO_WAIT, ctx->list, 0, NULL );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  /* A failed entry does not prevent the other entries */
+  prepare( ctx, LIO_WRITE );
+  ctx->cb[ 1 ].aio_offset = -1;
+  list[ 0 ] = &ctx->cb[ 0 ];
+  list[ 1 ] = &ctx->cb[ 1 ];
+
+  errno = 0;
+  rv = lio_listio( LIO_WAIT, list, 2, NULL );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EIO );
+  rtems_test_assert( aio_error( &ctx->cb[ 0 ] ) == 0 );
+  rtems_test_assert( aio_return( &ctx->cb[ 0 ] ) == REQUEST_SIZE );
+  rtems_test_assert( aio_error( &ctx->cb[ 1 ] ) == EINVAL );
+
+  /* A read beyond the end of file is short */
+  prepare( ctx, LIO_READ );
+  list[ 0 ] = &ctx->cb[ 0 ];
+  list[ 1 ] = &ctx->cb[ 1 ];
+
+  rv = lio_listio( LIO_WAIT, list, 2, NULL );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( aio_return( &ctx->cb[ 0 ] ) == REQUEST_SIZE );
+  rtems_test_assert( aio_return( &ctx->cb[ 1 ] ) == 0 );
+
+  clear_file( ctx );
+}
+
+void *POSIX_Init( void *arg )
+{
+  test_context *ctx = &test_instance;
+  size_t        i;
+  int           rv;
+
+  TEST_BEGIN();
+
+  for ( i = 0; i < REQUEST_COUNT; ++i ) {
+    memset( &ctx->data[ i ][ 0 ], (int) i, REQUEST_SIZE );
+  }
+
+  ctx->fd = open( FILE_NAME, O_RDWR | O_CREAT, S_IRWXU );
+  rtems_test_assert( ctx->fd >= 0 );
+
+  /* Nothing can be queued before the initialization */
+  rv = aio_cancel( ctx->fd, NULL );
+  rtems_test_assert( rv == AIO_ALLDONE );
+
+  rv = rtems_aio_init();
+  rtems_test_assert( rv == 0 );
+
+  test_errors( ctx );
+
+  printf( "<PSXAIO04>\n" );
+
+  run( ctx, LIO_WRITE, false, "AioWrite" );
+  run( ctx, LIO_READ, false, "AioRead" );
+  clear_file( ctx );
+
+  run( ctx, LIO_WRITE, true, "LioListioWrite" );
+  run( ctx, LIO_READ, true, "LioListioRead" );
+
+  printf( "</PSXAIO04>\n" );
+
+  rv = close( ctx->fd );
+  rtems_test_assert( rv == 0 );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS (1 + AIO_MAX_THREADS)
+
+#define CONFIGURE_MAXIMUM_POSIX_MUTEXES 4
+
+#define CONFIGURE_MAXIMUM_POSIX_CONDITION_VARIABLES 4
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -28,6 +28,7 @@
 #include <rtems/test.h>
 #include <tmacros.h>
 
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <inttypes.h>
@@ -38,6 +39,7 @@
 #include <stdio.h>
 #include <time.h>
 #include <limits.h>
+#include <unistd.h>
 
 #include <rtems/libcsupport.h>
 
@@ -67,6 +69,7 @@ const char rtems_test_name[] = "PSXCONFIG 1";
 #define CONFIGURE_MAXIMUM_POSIX_QUEUED_SIGNALS 7
 #define CONFIGURE_MAXIMUM_POSIX_RWLOCKS 31
 #define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES 41
+#define CONFIGURE_MAXIMUM_POSIX_SHMS 7
 #define CONFIGURE_MAXIMUM_POSIX_SPINLOCKS 17
 #define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
 
@@ -515,6 +518,22 @@ static rtems_task Init(rtems_task_argument argument)
   );
 #endif
 
+#ifdef CONFIGURE_MAXIMUM_POSIX_SHMS
+  for (i = 0; i < CONFIGURE_MAXIMUM_POSIX_SHMS; ++i) {
+    int oflag = O_RDWR | O_CREAT | O_EXCL;
+    mode_t mode = S_IRUSR | S_IWUSR;
+    char *path = get_posix_name('S', 'H', 'M', i);
+    int fd = shm_open(path, oflag, mode);
+    rtems_test_assert(fd >= 0);
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+  rtems_resource_snapshot_take(&snapshot);
+  rtems_test_assert(
+    snapshot.posix_api.active_shms == CONFIGURE_MAXIMUM_POSIX_SHMS
+  );
+#endif
+
 #ifdef CONFIGURE_MAXIMUM_POSIX_SPINLOCKS
   for (i = 0; i < CONFIGURE_MAXIMUM_POSIX_SPINLOCKS; ++i) {
     pthread_spinlock_t spinlock;
@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "PSXSHM 1";
+
+#define SHM_NAME "/shm"
+
+#define SHM_SIZE 256
+
+#define FILE_NAME "/file"
+
+static void fill( unsigned char *p, size_t n, unsigned char seed )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    p[ i ] = (unsigned char) ( seed + i );
+  }
+}
+
+static void test_shm_open_errors( void )
+{
+  int fd;
+  int rv;
+
+  errno = 0;
+  fd = shm_open( SHM_NAME, O_RDWR, 0 );
+  rtems_test_assert( fd == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  errno = 0;
+  fd = shm_open( SHM_NAME, O_WRONLY | O_CREAT, 0600 );
+  rtems_test_assert( fd == -1 );
+  rtems_test_assert( errno == EACCES );
+
+  fd = shm_open( SHM_NAME, O_RDWR | O_CREAT | O_EXCL, 0600 );
+  rtems_test_assert( fd >= 0 );
+
+  errno = 0;
+  rv = shm_open( SHM_NAME, O_RDWR | O_CREAT | O_EXCL, 0600 );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EEXIST );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = shm_unlink( SHM_NAME );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = shm_unlink( SHM_NAME );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+}
+
+static void test_shm_shared_mappings( void )
+{
+  unsigned char  buf[ SHM_SIZE ];
+  unsigned char *a;
+  unsigned char *b;
+  unsigned char *p;
+  struct stat    st;
+  ssize_t        n;
+  int            fd;
+  int            fd2;
+  int            rv;
+
+  fd = shm_open( SHM_NAME, O_RDWR | O_CREAT, 0600 );
+  rtems_test_assert( fd >= 0 );
+
+  rv = ftruncate( fd, SHM_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  rv = fstat( fd, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( S_ISREG( st.st_mode ) );
+  rtems_test_assert( st.st_size == SHM_SIZE );
+
+  a = mmap( NULL, SHM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  rtems_test_assert( a != MAP_FAILED );
+
+  fd2 = shm_open( SHM_NAME, O_RDWR, 0 );
+  rtems_test_assert( fd2 >= 0 );
+
+  b = mmap( NULL, SHM_SIZE, PROT_READ, MAP_SHARED, fd2, 0 );
+  rtems_test_assert( b == a );
+
+  /* Updates by the producer are visible to the consumer */
+  fill( a, SHM_SIZE, 1 );
+  rtems_test_assert( memcmp( a, b, SHM_SIZE ) == 0 );
+
+  n = read( fd2, buf, sizeof( buf ) );
+  rtems_test_assert( n == SHM_SIZE );
+  rtems_test_assert( memcmp( buf, a, SHM_SIZE ) == 0 );
+
+  /* The data cannot move while the object is mapped */
+  errno = 0;
+  rv = ftruncate( fd, 2 * SHM_SIZE );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EBUSY );
+
+  p = mmap( NULL, SHM_SIZE / 2, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 16 );
+  rtems_test_assert( p != MAP_FAILED );
+  rtems_test_assert( p != a + 16 );
+  rtems_test_assert( memcmp( p, a + 16, SHM_SIZE / 2 ) == 0 );
+
+  fill( p, SHM_SIZE / 2, 7 );
+  rtems_test_assert( memcmp( p, a + 16, SHM_SIZE / 2 ) != 0 );
+
+  rv = munmap( p, SHM_SIZE / 2 );
+  rtems_test_assert( rv == 0 );
+
+  rv = msync( a + 1, SHM_SIZE - 1, MS_SYNC );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = msync( a, SHM_SIZE, MS_SYNC | MS_ASYNC );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  errno = 0;
+  rv = msync( a, SHM_SIZE + 1, MS_ASYNC );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOMEM );
+
+  /* The object persists while it is open or mapped */
+  rv = shm_unlink( SHM_NAME );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd2 );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  fd = shm_open( SHM_NAME, O_RDWR, 0 );
+  rtems_test_assert( fd == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  /* Only one object is configured */
+  errno = 0;
+  fd = shm_open( SHM_NAME, O_RDWR | O_CREAT, 0600 );
+  rtems_test_assert( fd == -1 );
+  rtems_test_assert( errno == ENFILE );
+
+  rv = munmap( a, SHM_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = msync( a, SHM_SIZE, MS_ASYNC );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOMEM );
+
+  rv = munmap( b, SHM_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  /* Now the object is deleted */
+  fd = shm_open( SHM_NAME, O_RDWR | O_CREAT, 0600 );
+  rtems_test_assert( fd >= 0 );
+
+  rv = fstat( fd, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = shm_unlink( SHM_NAME );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_mmap_errors( void )
+{
+  void *p;
+  int   fd;
+  int   rv;
+
+  fd = shm_open( SHM_NAME, O_RDWR | O_CREAT, 0600 );
+  rtems_test_assert( fd >= 0 );
+
+  rv = ftruncate( fd, SHM_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  p = mmap( NULL, SHM_SIZE, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == ENOTSUP );
+
+  errno = 0;
+  p = mmap( NULL, SHM_SIZE, PROT_READ, 0, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EINVAL );
+
+  errno = 0;
+  p = mmap( NULL, 0, PROT_READ, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EINVAL );
+
+  errno = 0;
+  p = mmap( NULL, SHM_SIZE, PROT_READ, MAP_SHARED, -1, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EBADF );
+
+  errno = 0;
+  p = mmap( NULL, SHM_SIZE, PROT_READ, MAP_SHARED, fd, 1 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == ENXIO );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  fd = shm_open( SHM_NAME, O_RDONLY, 0 );
+  rtems_test_assert( fd >= 0 );
+
+  errno = 0;
+  p = mmap( NULL, SHM_SIZE, PROT_WRITE, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EACCES );
+
+  p = mmap( NULL, SHM_SIZE, PROT_WRITE, MAP_PRIVATE, fd, 0 );
+  rtems_test_assert( p != MAP_FAILED );
+
+  rv = munmap( p, SHM_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = shm_unlink( SHM_NAME );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = munmap( p, 0 );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+}
+
+static void test_mmap_anonymous( void )
+{
+  unsigned char zero[ SHM_SIZE ];
+  void         *p;
+  int           rv;
+
+  errno = 0;
+  p = mmap(
+    NULL,
+    SHM_SIZE,
+    PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANON,
+    0,
+    0
+  );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EINVAL );
+
+  p = mmap(
+    NULL,
+    SHM_SIZE,
+    PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANON,
+    -1,
+    0
+  );
+  rtems_test_assert( p != MAP_FAILED );
+
+  memset( zero, 0, sizeof( zero ) );
+  rtems_test_assert( memcmp( p, zero, SHM_SIZE ) == 0 );
+
+  /* Partial unmaps are rejected and the mapping stays intact */
+  errno = 0;
+  rv = munmap( (char *) p + 8, SHM_SIZE - 8 );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  errno = 0;
+  rv = munmap( p, SHM_SIZE - 8 );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  rtems_test_assert( memcmp( p, zero, SHM_SIZE ) == 0 );
+
+  rv = munmap( p, SHM_SIZE );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_mmap_file( void )
+{
+  unsigned char  buf[ SHM_SIZE ];
+  unsigned char *p;
+  ssize_t        n;
+  off_t          off;
+  int            fd;
+  int            rv;
+
+  fd = open( FILE_NAME, O_RDWR | O_CREAT, 0600 );
+  rtems_test_assert( fd >= 0 );
+
+  fill( buf, sizeof( buf ), 3 );
+  n = write( fd, buf, sizeof( buf ) );
+  rtems_test_assert( n == SHM_SIZE );
+
+  p = mmap( NULL, SHM_SIZE - 8, PROT_READ, MAP_PRIVATE, fd, 8 );
+  rtems_test_assert( p != MAP_FAILED );
+  rtems_test_assert( memcmp( p, &buf[ 8 ], SHM_SIZE - 8 ) == 0 );
+
+  /* The file offset is not changed by mmap() */
+  off = lseek( fd, 0, SEEK_CUR );
+  rtems_test_assert( off == SHM_SIZE );
+
+  rv = munmap( p, SHM_SIZE - 8 );
+  rtems_test_assert( rv == 0 );
+
+  /* The IMFS memory files have no contiguous data */
+  errno = 0;
+  p = mmap( NULL, SHM_SIZE, PROT_READ, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == ENOTSUP );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( FILE_NAME );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_shm_open_errors();
+  test_shm_shared_mappings();
+  test_mmap_errors();
+  test_mmap_anonymous();
+  test_mmap_file();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_POSIX_SHMS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdlib.h>
+
+#include <rtems.h>
+#include <rtems/libcsupport.h>
+#include <rtems/malloc.h>
+#include <rtems/score/threaddispatch.h>
+
+const char rtems_test_name[] = "SMPMALLOC 1";
+
+#define PROCESSOR_COUNT_MAX 32
+
+#define HIGH_WATERMARK 8
+
+#define AREA_COUNT HIGH_WATERMARK
+
+/* Size class of 128 bytes */
+#define SMALL_SIZE 100
+
+#define SMALL_CLASS 3
+
+/* Size class of 64 bytes */
+#define TINY_SIZE 50
+
+#define TINY_CLASS 2
+
+typedef struct {
+  rtems_id master;
+  rtems_id worker;
+} test_context;
+
+static test_context test_instance;
+
+/*
+ * Use a global array to prevent compiler optimizations due to the malloc()
+ * builtin.
+ */
+void *areas[AREA_COUNT];
+
+static rtems_malloc_cache get_class_stats(size_t class_index)
+{
+  rtems_malloc_cache stats[RTEMS_MALLOC_CACHE_CLASS_COUNT];
+  bool ok;
+
+  ok = rtems_malloc_cache_get_statistics(stats);
+  rtems_test_assert(ok);
+
+  return stats[class_index];
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  (void) arg;
+
+  while (true) {
+    rtems_status_code sc;
+    size_t i;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    for (i = 0; i < AREA_COUNT; ++i) {
+      free(areas[i]);
+    }
+
+    sc = rtems_event_transient_send(ctx->master);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void set_affinity(rtems_id id, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_ZERO(&cpuset);
+  CPU_SET((int) cpu_index, &cpuset);
+
+  sc = rtems_task_set_affinity(id, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void create_worker(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(ctx->worker, 1);
+
+  sc = rtems_task_start(ctx->worker, worker_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_remote_free(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_malloc_cache before;
+  rtems_malloc_cache after;
+  size_t i;
+
+  for (i = 0; i < AREA_COUNT; ++i) {
+    areas[i] = malloc(SMALL_SIZE);
+    rtems_test_assert(areas[i] != NULL);
+  }
+
+  before = get_class_stats(SMALL_CLASS);
+
+  /* The areas allocated on this processor are freed on the other one */
+  sc = rtems_event_transient_send(ctx->worker);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  after = get_class_stats(SMALL_CLASS);
+  rtems_test_assert(after.frees == before.frees + AREA_COUNT);
+  rtems_test_assert(after.count == before.count + AREA_COUNT);
+  rtems_test_assert(after.flushes == before.flushes);
+}
+
+static void test_no_drain_with_dispatch_disabled(void)
+{
+  Per_CPU_Control *cpu_self;
+  rtems_malloc_cache before;
+  rtems_malloc_cache after;
+  void *opaque;
+  void *p;
+
+  before = get_class_stats(SMALL_CLASS);
+  rtems_test_assert(before.count > 0);
+
+  opaque = rtems_heap_greedy_allocate(NULL, 0);
+
+  /* The caches must not be drained with thread dispatching disabled */
+  cpu_self = _Thread_Dispatch_disable();
+  p = malloc(TINY_SIZE);
+  _Thread_Dispatch_enable(cpu_self);
+
+  rtems_test_assert(p == NULL);
+
+  after = get_class_stats(SMALL_CLASS);
+  rtems_test_assert(after.count == before.count);
+  rtems_test_assert(after.flushes == before.flushes);
+
+  rtems_heap_greedy_free(opaque);
+}
+
+static void test_drain(void)
+{
+  rtems_malloc_cache before;
+  rtems_malloc_cache after;
+  void *opaque;
+  void *p;
+
+  before = get_class_stats(SMALL_CLASS);
+  rtems_test_assert(before.count >= AREA_COUNT);
+
+  after = get_class_stats(TINY_CLASS);
+  rtems_test_assert(after.count == 0);
+
+  opaque = rtems_heap_greedy_allocate(NULL, 0);
+
+  /*
+   * Only the areas cached for the small size class are left.  Most of them
+   * are held by the cache of the other processor.
+   */
+  p = malloc(TINY_SIZE);
+  rtems_test_assert(p != NULL);
+
+  after = get_class_stats(SMALL_CLASS);
+  rtems_test_assert(after.count == 0);
+  rtems_test_assert(after.flushes == before.flushes + before.count);
+
+  free(p);
+
+  rtems_heap_greedy_free(opaque);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  bool ok;
+
+  ctx->master = rtems_task_self();
+
+  if (rtems_get_processor_count() < 2) {
+    return;
+  }
+
+  set_affinity(ctx->master, 0);
+  create_worker(ctx);
+
+  test_remote_free(ctx);
+  test_no_drain_with_dispatch_disabled();
+  test_drain();
+
+  ok = malloc_walk(0, false);
+  rtems_test_assert(ok);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT_MAX
+
+#define CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+#define CONFIGURE_MALLOC_CACHE_HIGH_WATERMARK HIGH_WATERMARK
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "SMPPARTITION 1";
+
+#define PROCESSOR_COUNT_MAX 32
+
+#define BUFFER_SIZE 64
+
+#define BUFFER_COUNT 64
+
+#define NAME rtems_build_name('P', 'A', 'R', 'T')
+
+typedef struct {
+  rtems_id master;
+  rtems_id worker_ids[PROCESSOR_COUNT_MAX];
+  rtems_id part;
+  void *buffers[BUFFER_COUNT];
+  char area[BUFFER_SIZE * BUFFER_COUNT] RTEMS_ALIGNED(CPU_PARTITION_ALIGNMENT);
+} test_context;
+
+static test_context test_instance;
+
+static void create_part(test_context *ctx, rtems_attribute attr)
+{
+  rtems_status_code sc;
+
+  sc = rtems_partition_create(
+    NAME,
+    ctx->area,
+    sizeof(ctx->area),
+    BUFFER_SIZE,
+    attr,
+    &ctx->part
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_part(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_partition_delete(ctx->part);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void get_stats(
+  test_context *ctx,
+  uint32_t cpu_index,
+  rtems_partition_cache_statistics *stats
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_partition_get_cache_statistics(ctx->part, cpu_index, stats);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void get_all(test_context *ctx, size_t count)
+{
+  rtems_status_code sc;
+  void *buffer;
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    sc = rtems_partition_get_buffer(ctx->part, &ctx->buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_partition_get_buffer(ctx->part, &buffer);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+}
+
+static void return_all(test_context *ctx, size_t count)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    sc = rtems_partition_return_buffer(ctx->part, ctx->buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  (void) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    return_all(ctx, BUFFER_COUNT);
+
+    sc = rtems_event_transient_send(ctx->master);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void set_affinity(rtems_id id, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_ZERO(&cpuset);
+  CPU_SET((int) cpu_index, &cpuset);
+
+  sc = rtems_task_set_affinity(id, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void create_workers(test_context *ctx, uint32_t cpu_count)
+{
+  uint32_t i;
+
+  for (i = 1; i < cpu_count; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->worker_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    set_affinity(ctx->worker_ids[i], i);
+
+    sc = rtems_task_start(ctx->worker_ids[i], worker_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_errors(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_partition_cache_statistics stats;
+
+  create_part(ctx, RTEMS_DEFAULT_ATTRIBUTES);
+
+  sc = rtems_partition_get_cache_statistics(ctx->part, 0, &stats);
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  delete_part(ctx);
+  create_part(ctx, RTEMS_PARTITION_PER_PROCESSOR_CACHE);
+
+  sc = rtems_partition_get_cache_statistics(ctx->part, 0, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_partition_get_cache_statistics(0, 0, &stats);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_partition_get_cache_statistics(
+    ctx->part,
+    rtems_get_processor_count(),
+    &stats
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_partition_return_buffer(ctx->part, &ctx->area[1]);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_partition_return_buffer(ctx->part, ctx->buffers);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  delete_part(ctx);
+}
+
+static void test_local(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_partition_cache_statistics stats;
+  size_t i;
+
+  create_part(ctx, RTEMS_PARTITION_PER_PROCESSOR_CACHE);
+
+  get_stats(ctx, 0, &stats);
+  rtems_test_assert(stats.cached_buffers == 0);
+  rtems_test_assert(stats.get_hits == 0);
+  rtems_test_assert(stats.get_refills == 0);
+  rtems_test_assert(stats.return_hits == 0);
+  rtems_test_assert(stats.return_flushes == 0);
+
+  /* The first get refills the cache with half of its capacity */
+  sc = rtems_partition_get_buffer(ctx->part, &ctx->buffers[0]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  get_stats(ctx, 0, &stats);
+  rtems_test_assert(stats.cached_buffers == PARTITION_CACHE_CAPACITY / 2 - 1);
+  rtems_test_assert(stats.get_hits == 0);
+  rtems_test_assert(stats.get_refills == 1);
+
+  for (i = 1; i < PARTITION_CACHE_CAPACITY / 2; ++i) {
+    sc = rtems_partition_get_buffer(ctx->part, &ctx->buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  get_stats(ctx, 0, &stats);
+  rtems_test_assert(stats.cached_buffers == 0);
+  rtems_test_assert(stats.get_hits == PARTITION_CACHE_CAPACITY / 2 - 1);
+  rtems_test_assert(stats.get_refills == 1);
+
+  sc = rtems_partition_delete(ctx->part);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  /* Exhaust the partition, the cached buffers are available */
+  return_all(ctx, PARTITION_CACHE_CAPACITY / 2);
+  get_all(ctx, BUFFER_COUNT);
+
+  get_stats(ctx, 0, &stats);
+  rtems_test_assert(stats.cached_buffers == 0);
+  rtems_test_assert(
+    stats.get_hits + stats.get_refills
+      == PARTITION_CACHE_CAPACITY / 2 + BUFFER_COUNT
+  );
+
+  /* A full cache flushes half of its capacity */
+  return_all(ctx, BUFFER_COUNT);
+
+  get_stats(ctx, 0, &stats);
+  rtems_test_assert(stats.cached_buffers == PARTITION_CACHE_CAPACITY);
+  rtems_test_assert(
+    stats.return_flushes == (BUFFER_COUNT - PARTITION_CACHE_CAPACITY)
+      / (PARTITION_CACHE_CAPACITY / 2)
+  );
+  rtems_test_assert(
+    stats.return_hits + stats.return_flushes
+      == PARTITION_CACHE_CAPACITY / 2 + BUFFER_COUNT
+  );
+
+  /* The cached buffers do not prevent the partition deletion */
+  delete_part(ctx);
+}
+
+static void test_remote_return(test_context *ctx, uint32_t cpu_count)
+{
+  rtems_status_code sc;
+  rtems_partition_cache_statistics stats;
+  uint32_t cpu_index;
+  uint32_t cached;
+  void *buffer;
+  size_t i;
+
+  if (cpu_count < 2) {
+    return;
+  }
+
+  create_part(ctx, RTEMS_PARTITION_PER_PROCESSOR_CACHE);
+  get_all(ctx, BUFFER_COUNT);
+
+  sc = rtems_event_transient_send(ctx->worker_ids[1]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  get_stats(ctx, 1, &stats);
+  rtems_test_assert(stats.get_hits == 0);
+  rtems_test_assert(stats.get_refills == 0);
+  rtems_test_assert(stats.return_hits + stats.return_flushes == BUFFER_COUNT);
+  rtems_test_assert(stats.return_flushes > 0);
+
+  /*
+   * The buffers cached by the other processor are not available to this
+   * processor.
+   */
+  for (i = 0; i < BUFFER_COUNT - stats.cached_buffers; ++i) {
+    sc = rtems_partition_get_buffer(ctx->part, &ctx->buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_partition_get_buffer(ctx->part, &ctx->buffers[i]);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  /*
+   * A partition deletion flushes all caches to the partition, even if it
+   * fails.  Afterwards, the buffers previously cached by the other processor
+   * are available to this processor.
+   */
+  cached = stats.cached_buffers;
+  rtems_test_assert(cached > 0);
+
+  sc = rtems_partition_delete(ctx->part);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    get_stats(ctx, cpu_index, &stats);
+    rtems_test_assert(stats.cached_buffers == 0);
+  }
+
+  for (i = BUFFER_COUNT - cached; i < BUFFER_COUNT; ++i) {
+    sc = rtems_partition_get_buffer(ctx->part, &ctx->buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_partition_get_buffer(ctx->part, &buffer);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  return_all(ctx, BUFFER_COUNT);
+  delete_part(ctx);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count;
+
+  ctx->master = rtems_task_self();
+  cpu_count = rtems_get_processor_count();
+
+  set_affinity(ctx->master, 0);
+  create_workers(ctx, cpu_count);
+
+  test_errors(ctx);
+  test_local(ctx);
+  test_remote_return(ctx, cpu_count);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT_MAX
+
+#define CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
+
+#define CONFIGURE_MAXIMUM_TASKS PROCESSOR_COUNT_MAX
+
+#define CONFIGURE_MAXIMUM_PARTITIONS 1
+
+/* The per-processor buffer caches */
+#define CONFIGURE_MEMORY_OVERHEAD 16
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -19,6 +19,9 @@
 #include "tmacros.h"
 
 #include <rtems/score/threadimpl.h>
+#include <rtems/counter.h>
+
+#include <inttypes.h>
 
 const char rtems_test_name[] = "SMPSTRONGAPA 1";
 
@@ -30,10 +33,22 @@ const char rtems_test_name[] = "SMPSTRONGAPA 1";
 
 #define ALL ((UINT32_C(1) << CPU_COUNT) - 1)
 
+#define ONLY(cpu) (UINT32_C(1) << (cpu))
+
+#define A0 ONLY(0)
+
+#define A01 (ONLY(0) | ONLY(1))
+
+#define A12 (ONLY(1) | ONLY(2))
+
 #define IDLE UINT8_C(255)
 
 #define NAME rtems_build_name('S', 'A', 'P', 'A')
 
+#define SAMPLE_COUNT 1000
+
+#define NO_TASK SIZE_MAX
+
 typedef struct {
   enum {
     KIND_RESET,
@@ -58,6 +73,15 @@ typedef struct {
   rtems_id master_id;
   rtems_id task_ids[TASK_COUNT];
   size_t action_index;
+  size_t sample_index;
+  uint32_t random_state;
+  bool blocked[TASK_COUNT];
+  uint32_t affinity[TASK_COUNT];
+  uint64_t busy_count;
+  uint64_t optimal_count;
+  uint64_t operation_count;
+  rtems_counter_ticks operation_ticks;
+  rtems_counter_ticks operation_ticks_max;
 } test_context;
 
 #define RESET \
@@ -113,6 +137,28 @@ static const test_action test_actions[] = {
   SET_AFFINITY( 5,   ALL,    0,    1,    2,    3),
   RESET,
   UNBLOCK(      0,           0, IDLE, IDLE, IDLE),
+  RESET,
+  /* A freed processor is taken via a displacement chain */
+  SET_AFFINITY( 4,    A0, IDLE, IDLE, IDLE, IDLE),
+  UNBLOCK(      0,           0, IDLE, IDLE, IDLE),
+  UNBLOCK(      1,           0,    1, IDLE, IDLE),
+  UNBLOCK(      2,           0,    1,    2, IDLE),
+  UNBLOCK(      3,           0,    1,    2,    3),
+  UNBLOCK(      4,           0,    1,    2,    3),
+  BLOCK(        2,           4,    1,    0,    3),
+  UNBLOCK(      2,           2,    1,    0,    3),
+  BLOCK(        3,           4,    1,    0,    2),
+  RESET,
+  /* An unblocked node displaces an idle thread via a chain of two moves */
+  SET_AFFINITY( 4,    A0, IDLE, IDLE, IDLE, IDLE),
+  SET_AFFINITY( 5,   A01, IDLE, IDLE, IDLE, IDLE),
+  UNBLOCK(      0,           0, IDLE, IDLE, IDLE),
+  SET_AFFINITY( 0,   A01,    0, IDLE, IDLE, IDLE),
+  UNBLOCK(      1,           0,    1, IDLE, IDLE),
+  SET_AFFINITY( 1,   A12,    0,    1, IDLE, IDLE),
+  UNBLOCK(      4,           4,    0,    1, IDLE),
+  BLOCK(        0,           4, IDLE,    1, IDLE),
+  UNBLOCK(      5,           4,    5,    1, IDLE),
   RESET
 };
 
@@ -159,6 +205,7 @@ static void reset(test_context *ctx)
 
   for (i = 0; i < CPU_COUNT; ++i) {
     set_priority(ctx->task_ids[i], P(i));
+    set_affinity(ctx->task_ids[i], ALL);
 
     sc = rtems_task_resume(ctx->task_ids[i]);
     rtems_test_assert(sc == RTEMS_SUCCESSFUL || sc == RTEMS_INCORRECT_STATE);
@@ -198,6 +245,181 @@ static void check_cpu_allocations(test_context *ctx, const test_action *action)
   }
 }
 
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->random_state = ctx->random_state * UINT32_C(1103515245)
+    + UINT32_C(12345);
+
+  return ctx->random_state >> 16;
+}
+
+static size_t get_task_index(const test_context *ctx, const Thread_Control *t)
+{
+  size_t i;
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    if (t->Object.id == ctx->task_ids[i]) {
+      return i;
+    }
+  }
+
+  return NO_TASK;
+}
+
+static bool augment(
+  const test_context *ctx,
+  size_t task,
+  uint32_t *visited,
+  size_t *owner
+)
+{
+  size_t cpu;
+
+  for (cpu = 0; cpu < CPU_COUNT; ++cpu) {
+    if (
+      (ctx->affinity[task] & ONLY(cpu)) != 0
+        && (*visited & ONLY(cpu)) == 0
+    ) {
+      *visited |= ONLY(cpu);
+
+      if (
+        owner[cpu] == NO_TASK
+          || augment(ctx, owner[cpu], visited, owner)
+      ) {
+        owner[cpu] = task;
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Returns the maximum count of ready tasks which may execute at the same time
+ * with respect to their affinity (maximum bipartite matching).
+ */
+static uint32_t get_optimal_count(const test_context *ctx)
+{
+  size_t owner[CPU_COUNT];
+  uint32_t count;
+  size_t i;
+
+  for (i = 0; i < CPU_COUNT; ++i) {
+    owner[i] = NO_TASK;
+  }
+
+  count = 0;
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    uint32_t visited;
+
+    visited = 0;
+
+    if (!ctx->blocked[i] && augment(ctx, i, &visited, owner)) {
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+/*
+ * The Strong APA scheduler must not leave a processor idle in case a ready
+ * task could execute on it, even if this requires a displacement chain.  So
+ * the count of busy processors must be equal to the optimal count.
+ */
+static void check_utilization(test_context *ctx)
+{
+  uint32_t busy;
+  uint32_t optimal;
+  size_t i;
+
+  busy = 0;
+
+  for (i = 0; i < CPU_COUNT; ++i) {
+    const Per_CPU_Control *c;
+    const Thread_Control *h;
+
+    c = _Per_CPU_Get_by_index(i);
+    h = c->heir;
+
+    if (h->Start.Entry.adaptor != _Thread_Entry_adaptor_idle) {
+      size_t e;
+
+      e = get_task_index(ctx, h);
+      rtems_test_assert(e != NO_TASK);
+      rtems_test_assert(!ctx->blocked[e]);
+      rtems_test_assert((ctx->affinity[e] & ONLY(i)) != 0);
+      ++busy;
+    }
+  }
+
+  optimal = get_optimal_count(ctx);
+  rtems_test_assert(busy == optimal);
+
+  ctx->busy_count += busy;
+  ctx->optimal_count += optimal;
+}
+
+static void random_action(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  uint32_t r;
+  size_t i;
+  rtems_id task;
+
+  r = next_random(ctx);
+  i = r % TASK_COUNT;
+  task = ctx->task_ids[i];
+  r /= TASK_COUNT;
+
+  t0 = rtems_counter_read();
+
+  switch (r % 3) {
+    case 0:
+      set_priority(task, P(next_random(ctx) % TASK_COUNT));
+      break;
+    case 1:
+      ctx->affinity[i] = next_random(ctx) % ALL + 1;
+      set_affinity(task, ctx->affinity[i]);
+      break;
+    default:
+      if (ctx->blocked[i]) {
+        sc = rtems_task_resume(task);
+      } else {
+        sc = rtems_task_suspend(task);
+      }
+
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      ctx->blocked[i] = !ctx->blocked[i];
+      break;
+  }
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  ++ctx->operation_count;
+  ctx->operation_ticks += d;
+
+  if (d > ctx->operation_ticks_max) {
+    ctx->operation_ticks_max = d;
+  }
+}
+
+static void start_samples(test_context *ctx)
+{
+  size_t i;
+
+  /* The last action is a reset */
+  for (i = 0; i < TASK_COUNT; ++i) {
+    ctx->blocked[i] = true;
+    ctx->affinity[i] = ALL;
+  }
+
+  ctx->random_state = 1;
+}
+
 /*
  * Use a timer to execute the actions, since it runs with thread dispatching
  * disabled.  This is necessary to check the expected processor allocations.
@@ -247,6 +469,18 @@ static void timer(rtems_id id, void *arg)
 
     check_cpu_allocations(ctx, action);
 
+    if (ctx->action_index == RTEMS_ARRAY_SIZE(test_actions)) {
+      start_samples(ctx);
+    }
+
+    sc = rtems_timer_reset(id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else if (ctx->sample_index < SAMPLE_COUNT) {
+    ++ctx->sample_index;
+
+    random_action(ctx);
+    check_utilization(ctx);
+
     sc = rtems_timer_reset(id);
     rtems_test_assert(sc == RTEMS_SUCCESSFUL);
   } else {
@@ -267,6 +501,33 @@ static void do_nothing_task(rtems_task_argument arg)
   }
 }
 
+static void print_results(const test_context *ctx)
+{
+  printf(
+    "<SMPStrongAPA01>\n"
+    "  <Utilization samples=\"%zu\" processors=\"%i\" tasks=\"%i\">\n"
+    "    <BusyProcessors>%" PRIu64 "</BusyProcessors>\n"
+    "    <OptimalProcessors>%" PRIu64 "</OptimalProcessors>\n"
+    "    <Percent>%" PRIu64 "</Percent>\n"
+    "  </Utilization>\n"
+    "  <Operation count=\"%" PRIu64 "\" unit=\"ns\">\n"
+    "    <Average>%" PRIu64 "</Average>\n"
+    "    <Maximum>%" PRIu64 "</Maximum>\n"
+    "  </Operation>\n"
+    "</SMPStrongAPA01>\n",
+    ctx->sample_index,
+    CPU_COUNT,
+    TASK_COUNT,
+    ctx->busy_count,
+    ctx->optimal_count,
+    (100 * ctx->busy_count) / (SAMPLE_COUNT * CPU_COUNT),
+    ctx->operation_count,
+    rtems_counter_ticks_to_nanoseconds(ctx->operation_ticks)
+      / ctx->operation_count,
+    rtems_counter_ticks_to_nanoseconds(ctx->operation_ticks_max)
+  );
+}
+
 static void test(void)
 {
   test_context *ctx;
@@ -308,6 +569,8 @@ static void test(void)
 
   sc = rtems_timer_delete(ctx->timer_id);
   rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  print_results(ctx);
 }
 
 static void Init(rtems_task_argument arg)
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "SMPTIMERSERVER 1";
+
+#define PROCESSOR_COUNT_MAX 32
+
+#define TIMER_COUNT 16
+
+#define RUN_TICKS 100
+
+#define STOP_TICKS 10
+
+#define NAME rtems_build_name('T', 'S', 'R', 'V')
+
+typedef struct worker_context worker_context;
+
+typedef struct {
+  worker_context *worker;
+  rtems_id id;
+  rtems_counter_ticks armed;
+} timer_context;
+
+/*
+ * The statistics of a worker are only modified by the timer server of its
+ * processor.
+ */
+struct worker_context {
+  timer_context timers[TIMER_COUNT];
+  uint32_t cpu_index;
+  uint32_t active;
+  uint32_t wrong_processor_count;
+  uint32_t wrong_server_count;
+  rtems_id server_id;
+  uint64_t fire_count;
+  uint64_t round_trip_sum;
+  rtems_counter_ticks round_trip_max;
+};
+
+typedef struct {
+  rtems_id master_id;
+  rtems_id worker_ids[PROCESSOR_COUNT_MAX];
+  volatile bool stop;
+  worker_context workers[PROCESSOR_COUNT_MAX];
+} test_context;
+
+static test_context test_instance;
+
+static void timer_routine(rtems_id id, void *arg)
+{
+  timer_context *tc;
+  worker_context *w;
+  rtems_counter_ticks now;
+  rtems_counter_ticks d;
+  rtems_status_code sc;
+
+  now = rtems_counter_read();
+  tc = arg;
+  w = tc->worker;
+
+  if (rtems_get_current_processor() != w->cpu_index) {
+    ++w->wrong_processor_count;
+  }
+
+  if (w->server_id == 0) {
+    w->server_id = rtems_task_self();
+  } else if (w->server_id != rtems_task_self()) {
+    ++w->wrong_server_count;
+  }
+
+  d = rtems_counter_difference(now, tc->armed);
+  ++w->fire_count;
+  w->round_trip_sum += d;
+
+  if (d > w->round_trip_max) {
+    w->round_trip_max = d;
+  }
+
+  if (test_instance.stop) {
+    --w->active;
+    return;
+  }
+
+  tc->armed = now;
+  sc = rtems_timer_server_fire_after(id, 1, timer_routine, tc);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+  worker_context *w;
+  rtems_status_code sc;
+  size_t i;
+
+  ctx = &test_instance;
+  w = &ctx->workers[arg];
+
+  while (true) {
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    w->active = TIMER_COUNT;
+
+    for (i = 0; i < TIMER_COUNT; ++i) {
+      timer_context *tc;
+
+      tc = &w->timers[i];
+      tc->armed = rtems_counter_read();
+
+      sc = rtems_timer_server_fire_after(tc->id, 1, timer_routine, tc);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+}
+
+static void set_affinity(rtems_id id, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_ZERO(&cpuset);
+  CPU_SET((int) cpu_index, &cpuset);
+
+  sc = rtems_task_set_affinity(id, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void create_workers(test_context *ctx, uint32_t cpu_count)
+{
+  rtems_status_code sc;
+  uint32_t i;
+
+  for (i = 0; i < cpu_count; ++i) {
+    worker_context *w;
+    size_t j;
+
+    w = &ctx->workers[i];
+    w->cpu_index = i;
+
+    /*
+     * The timers are created by the master, so they move to the processor of
+     * the worker once it arms them.
+     */
+    for (j = 0; j < TIMER_COUNT; ++j) {
+      timer_context *tc;
+
+      tc = &w->timers[j];
+      tc->worker = w;
+
+      sc = rtems_timer_create(NAME, &tc->id);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    sc = rtems_task_create(
+      NAME,
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->worker_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    set_affinity(ctx->worker_ids[i], i);
+
+    sc = rtems_task_start(ctx->worker_ids[i], worker_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void check_server(const test_context *ctx, uint32_t worker_index)
+{
+  const worker_context *w;
+  rtems_status_code sc;
+  rtems_name name;
+  cpu_set_t cpuset;
+  cpu_set_t expected;
+  uint32_t i;
+
+  w = &ctx->workers[worker_index];
+  rtems_test_assert(w->wrong_server_count == 0);
+  rtems_test_assert(w->server_id != 0);
+
+  sc = rtems_object_get_classic_name(w->server_id, &name);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(name == rtems_build_name('T', 'I', 'M', 'E'));
+
+  /* The server of a processor is bound to it */
+  if (rtems_get_processor_count() > 1) {
+    sc = rtems_task_get_affinity(w->server_id, sizeof(cpuset), &cpuset);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    CPU_ZERO(&expected);
+    CPU_SET((int) w->cpu_index, &expected);
+    rtems_test_assert(CPU_EQUAL(&cpuset, &expected));
+  }
+
+  for (i = 0; i < worker_index; ++i) {
+    rtems_test_assert(ctx->workers[i].server_id != w->server_id);
+  }
+}
+
+static void run(test_context *ctx, uint32_t active_count)
+{
+  rtems_status_code sc;
+  uint64_t fire_count;
+  uint64_t round_trip_sum;
+  rtems_counter_ticks round_trip_max;
+  uint32_t i;
+
+  ctx->stop = false;
+
+  for (i = 0; i < active_count; ++i) {
+    worker_context *w;
+
+    w = &ctx->workers[i];
+    w->wrong_processor_count = 0;
+    w->wrong_server_count = 0;
+    w->server_id = 0;
+    w->fire_count = 0;
+    w->round_trip_sum = 0;
+    w->round_trip_max = 0;
+
+    sc = rtems_event_transient_send(ctx->worker_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_wake_after(RUN_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->stop = true;
+
+  sc = rtems_task_wake_after(STOP_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fire_count = 0;
+  round_trip_sum = 0;
+  round_trip_max = 0;
+
+  for (i = 0; i < active_count; ++i) {
+    const worker_context *w;
+
+    w = &ctx->workers[i];
+    rtems_test_assert(w->active == 0);
+    rtems_test_assert(w->wrong_processor_count == 0);
+    check_server(ctx, i);
+
+    fire_count += w->fire_count;
+    round_trip_sum += w->round_trip_sum;
+
+    if (w->round_trip_max > round_trip_max) {
+      round_trip_max = w->round_trip_max;
+    }
+  }
+
+  rtems_test_assert(fire_count > 0);
+
+  printf(
+    "  <Run processors=\"%" PRIu32 "\" timers=\"%" PRIu32 "\">\n"
+    "    <Fires unit=\"1/s\">%" PRIu64 "</Fires>\n"
+    "    <RoundTrip unit=\"ns\">\n"
+    "      <Average>%" PRIu64 "</Average>\n"
+    "      <Maximum>%" PRIu64 "</Maximum>\n"
+    "    </RoundTrip>\n"
+    "  </Run>\n",
+    active_count,
+    active_count * TIMER_COUNT,
+    (fire_count * rtems_clock_get_ticks_per_second()) / RUN_TICKS,
+    rtems_counter_ticks_to_nanoseconds(round_trip_sum / fire_count),
+    rtems_counter_ticks_to_nanoseconds(round_trip_max)
+  );
+}
+
+static void test(void)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  uint32_t cpu_count;
+  uint32_t active_count;
+
+  ctx = &test_instance;
+  ctx->master_id = rtems_task_self();
+  cpu_count = rtems_get_processor_count();
+
+  sc = rtems_timer_initiate_server(
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_TIMER_SERVER_PER_PROCESSOR
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_initiate_server(
+    RTEMS_TIMER_SERVER_DEFAULT_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_TIMER_SERVER_PER_PROCESSOR
+  );
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  create_workers(ctx, cpu_count);
+
+  printf("<SMPTimerServer01>\n");
+
+  active_count = 1;
+
+  while (true) {
+    run(ctx, active_count);
+
+    if (active_count == cpu_count) {
+      break;
+    }
+
+    active_count *= 2;
+
+    if (active_count > cpu_count) {
+      active_count = cpu_count;
+    }
+  }
+
+  printf("</SMPTimerServer01>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT_MAX
+
+#define CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
+
+/* The master, one worker and one timer server for each processor */
+#define CONFIGURE_MAXIMUM_TASKS (1 + 2 * PROCESSOR_COUNT_MAX)
+
+#define CONFIGURE_MAXIMUM_TIMERS (PROCESSOR_COUNT_MAX * TIMER_COUNT)
+
+/* The timer server control blocks */
+#define CONFIGURE_MEMORY_OVERHEAD 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#define TESTS_USE_PRINTF
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+const char rtems_test_name[] = "SMPWORKSTEALING 1";
+
+#define PROCESSOR_COUNT_MAX 28
+
+#define SCHEDULER_COUNT 6
+
+#define WORKER_COUNT_MAX 16
+
+#define PRIO_WORKER 3
+
+#define SCHED_PRI2 rtems_build_name('P', 'R', 'I', '2')
+#define SCHED_WST2 rtems_build_name('W', 'S', 'T', '2')
+#define SCHED_PRI4 rtems_build_name('P', 'R', 'I', '4')
+#define SCHED_WST4 rtems_build_name('W', 'S', 'T', '4')
+#define SCHED_PRI8 rtems_build_name('P', 'R', 'I', '8')
+#define SCHED_WST8 rtems_build_name('W', 'S', 'T', '8')
+
+typedef struct {
+  volatile uint32_t counter;
+  uint32_t unused_space_for_cache_line_alignment[7];
+} worker_counter;
+
+typedef struct {
+  worker_counter counters[WORKER_COUNT_MAX];
+  rtems_id worker_ids[WORKER_COUNT_MAX];
+  rtems_id scheduler_ids[SCHEDULER_COUNT];
+} test_context;
+
+CPU_STRUCTURE_ALIGNMENT static test_context test_instance;
+
+/*
+ * The scheduler instances in the order of their processors.  Each pair of
+ * instances uses the same processor count, so that the Deterministic Priority
+ * SMP Scheduler and the Work Stealing SMP Scheduler can be compared on 2, 4
+ * and 8 processors.
+ */
+static const struct {
+  rtems_name name;
+  const char *kind;
+} schedulers[SCHEDULER_COUNT] = {
+  { SCHED_PRI2, "PrioritySMP" },
+  { SCHED_WST2, "WorkStealingSMP" },
+  { SCHED_PRI4, "PrioritySMP" },
+  { SCHED_WST4, "WorkStealingSMP" },
+  { SCHED_PRI8, "PrioritySMP" },
+  { SCHED_WST8, "WorkStealingSMP" }
+};
+
+/*
+ * The workers form pairs which pass a token back and forth via transient
+ * events.  So, each worker blocks and unblocks all the time.
+ */
+static void worker(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_id partner = ctx->worker_ids[arg ^ 1];
+  worker_counter *counter = &ctx->counters[arg];
+  bool send_first = (arg & 1) == 0;
+
+  while (true) {
+    rtems_status_code sc;
+
+    if (send_first) {
+      sc = rtems_event_transient_send(partner);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++counter->counter;
+
+    if (!send_first) {
+      sc = rtems_event_transient_send(partner);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+}
+
+static void run(test_context *ctx, size_t scheduler_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+  uint32_t cpu_count;
+  size_t worker_count;
+  size_t i;
+  uint64_t total;
+
+  sc = rtems_scheduler_get_processor_set(
+    ctx->scheduler_ids[scheduler_index],
+    sizeof(cpuset),
+    &cpuset
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  cpu_count = (uint32_t) CPU_COUNT(&cpuset);
+  if (cpu_count == 0) {
+    return;
+  }
+
+  worker_count = 2 * cpu_count;
+  rtems_test_assert(worker_count <= WORKER_COUNT_MAX);
+
+  memset(&ctx->counters[0], 0, sizeof(ctx->counters));
+
+  for (i = 0; i < worker_count; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      PRIO_WORKER,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->worker_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_scheduler(
+      ctx->worker_ids[i],
+      ctx->scheduler_ids[scheduler_index],
+      PRIO_WORKER
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < worker_count; ++i) {
+    sc = rtems_task_start(ctx->worker_ids[i], worker, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_wake_after(rtems_clock_get_ticks_per_second());
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  total = 0;
+  for (i = 0; i < worker_count; ++i) {
+    total += ctx->counters[i].counter;
+  }
+
+  for (i = 0; i < worker_count; ++i) {
+    sc = rtems_task_delete(ctx->worker_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(total > 0);
+
+  printf(
+    "  <Run scheduler=\"%s\" processors=\"%" PRIu32 "\" workers=\"%zu\">"
+    "<Operations unit=\"1/s\">%" PRIu64 "</Operations></Run>\n",
+    schedulers[scheduler_index].kind,
+    cpu_count,
+    worker_count,
+    total
+  );
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    sc = rtems_scheduler_ident(schedulers[i].name, &ctx->scheduler_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  printf("<SMPWorkStealing01>\n");
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    run(ctx, i);
+  }
+
+  printf("</SMPWorkStealing01>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT_MAX
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT_MAX)
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+#define CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_CONTEXT_PRIORITY_SMP(pri2, 64);
+
+RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP(wst2, 64);
+
+RTEMS_SCHEDULER_CONTEXT_PRIORITY_SMP(pri4, 64);
+
+RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP(wst4, 64);
+
+RTEMS_SCHEDULER_CONTEXT_PRIORITY_SMP(pri8, 64);
+
+RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP(wst8, 64);
+
+#define CONFIGURE_SCHEDULER_CONTROLS \
+  RTEMS_SCHEDULER_CONTROL_PRIORITY_SMP(pri2, SCHED_PRI2), \
+  RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP(wst2, SCHED_WST2), \
+  RTEMS_SCHEDULER_CONTROL_PRIORITY_SMP(pri4, SCHED_PRI4), \
+  RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP(wst4, SCHED_WST4), \
+  RTEMS_SCHEDULER_CONTROL_PRIORITY_SMP(pri8, SCHED_PRI8), \
+  RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP(wst8, SCHED_WST8)
+
+#define CONFIGURE_SMP_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(2, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(2, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(2, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(2, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(3, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(3, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(3, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(3, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/schedulerworkstealingsmp.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPWORKSTEALING 2";
+
+#define CPU_MAX 3
+
+#define TASK_COUNT 5
+
+#define NO_CPU 0xffffffff
+
+#define SETTLE_TICKS 2
+
+#define CPU(i) (1U << (i))
+
+typedef struct {
+  Scheduler_work_stealing_SMP_Context *scheduler;
+  rtems_id task_ids[TASK_COUNT];
+  volatile uint32_t cpu[TASK_COUNT];
+  volatile bool stop[TASK_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+/*
+ * A task records the processor executing it until it is told to stop.  Then
+ * it suspends itself, so that it is blocked.
+ */
+static void task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  while (!ctx->stop[arg]) {
+    ctx->cpu[arg] = rtems_get_current_processor();
+  }
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void set_affinity(rtems_id id, uint32_t cpus)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+  int cpu_index;
+
+  CPU_ZERO(&cpuset);
+
+  for (cpu_index = 0; cpu_index < CPU_MAX; ++cpu_index) {
+    if ((cpus & CPU(cpu_index)) != 0) {
+      CPU_SET(cpu_index, &cpuset);
+    }
+  }
+
+  sc = rtems_task_set_affinity(id, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void start_task(
+  test_context *ctx,
+  size_t i,
+  rtems_task_priority prio,
+  uint32_t cpus
+)
+{
+  rtems_status_code sc;
+
+  ctx->cpu[i] = NO_CPU;
+  ctx->stop[i] = false;
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    prio,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->task_ids[i]
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(ctx->task_ids[i], cpus);
+
+  sc = rtems_task_start(ctx->task_ids[i], task, i);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_tasks(test_context *ctx, size_t count)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    sc = rtems_task_delete(ctx->task_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void wait_ticks(rtems_interval ticks)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after(ticks);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+/*
+ * Waits until the scheduling decisions took effect on all processors and
+ * clears the recorded processors afterwards, so that only tasks executing
+ * right now record a processor in the following wait period.
+ */
+static void settle(test_context *ctx)
+{
+  size_t i;
+
+  wait_ticks(SETTLE_TICKS);
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    ctx->cpu[i] = NO_CPU;
+  }
+
+  wait_ticks(SETTLE_TICKS);
+}
+
+static Scheduler_work_stealing_SMP_Node *get_node(rtems_id id)
+{
+  ISR_lock_Context lock_context;
+  Thread_Control *thread;
+
+  thread = _Thread_Get(id, &lock_context);
+  rtems_test_assert(thread != NULL);
+  _ISR_lock_ISR_enable(&lock_context);
+
+  return (Scheduler_work_stealing_SMP_Node *)
+    _Scheduler_Thread_get_node(thread);
+}
+
+static uint32_t get_ready_count(const test_context *ctx, uint32_t cpu_index)
+{
+  return ctx->scheduler->Queues[cpu_index].ready_count;
+}
+
+/*
+ * A ready node waits in the ready queue of its home processor until another
+ * processor without a ready node of equal or higher priority steals it.
+ */
+static void test_stealing(test_context *ctx)
+{
+  enum { A, H, L };
+
+  start_task(ctx, A, 3, CPU(0));
+  start_task(ctx, H, 3, CPU(1));
+  start_task(ctx, L, 4, CPU(0) | CPU(1));
+  settle(ctx);
+
+  rtems_test_assert(ctx->cpu[A] == 0);
+  rtems_test_assert(ctx->cpu[H] == 1);
+  rtems_test_assert(ctx->cpu[L] == NO_CPU);
+  rtems_test_assert(get_node(ctx->task_ids[L])->home == 0);
+  rtems_test_assert(get_ready_count(ctx, 0) == 1);
+
+  ctx->stop[H] = true;
+  settle(ctx);
+
+  rtems_test_assert(ctx->cpu[A] == 0);
+  rtems_test_assert(ctx->cpu[H] == NO_CPU);
+  rtems_test_assert(ctx->cpu[L] == 1);
+  rtems_test_assert(get_node(ctx->task_ids[L])->home == 1);
+  rtems_test_assert(get_ready_count(ctx, 0) == 0);
+
+  delete_tasks(ctx, L + 1);
+}
+
+/*
+ * The periodic load balancing pulls one ready node from the busiest ready
+ * queue.  Nodes of equal priority are not stolen, so the pulled node is the
+ * only one which executes once its new home processor becomes available.
+ */
+static void test_balancing(test_context *ctx)
+{
+  enum { A, H, R0, R1, R2 };
+  size_t pulled;
+  size_t i;
+
+  start_task(ctx, A, 3, CPU(0));
+  start_task(ctx, H, 3, CPU(1));
+  start_task(ctx, R0, 5, CPU(0) | CPU(1));
+  start_task(ctx, R1, 5, CPU(0) | CPU(1));
+  start_task(ctx, R2, 5, CPU(0) | CPU(1));
+
+  wait_ticks(3 * SCHEDULER_WORK_STEALING_SMP_BALANCE_INTERVAL);
+
+  rtems_test_assert(get_ready_count(ctx, 0) == 2);
+  rtems_test_assert(get_ready_count(ctx, 1) == 1);
+  rtems_test_assert(get_ready_count(ctx, 2) == 0);
+
+  pulled = TASK_COUNT;
+
+  for (i = R0; i <= R2; ++i) {
+    if (get_node(ctx->task_ids[i])->home == 1) {
+      rtems_test_assert(pulled == TASK_COUNT);
+      pulled = i;
+    } else {
+      rtems_test_assert(get_node(ctx->task_ids[i])->home == 0);
+    }
+  }
+
+  rtems_test_assert(pulled != TASK_COUNT);
+
+  ctx->stop[H] = true;
+  settle(ctx);
+
+  for (i = R0; i <= R2; ++i) {
+    if (i == pulled) {
+      rtems_test_assert(ctx->cpu[i] == 1);
+    } else {
+      rtems_test_assert(ctx->cpu[i] == NO_CPU);
+    }
+  }
+
+  delete_tasks(ctx, R2 + 1);
+}
+
+/*
+ * A node is never stolen by a processor outside its affinity set, even if
+ * this processor is idle.  An affinity change moves the node to an allowed
+ * processor.
+ */
+static void test_affinity(test_context *ctx)
+{
+  enum { H, T };
+
+  start_task(ctx, H, 3, CPU(1));
+  start_task(ctx, T, 4, CPU(1));
+  settle(ctx);
+
+  rtems_test_assert(ctx->cpu[H] == 1);
+  rtems_test_assert(ctx->cpu[T] == NO_CPU);
+  rtems_test_assert(get_node(ctx->task_ids[T])->home == 1);
+
+  set_affinity(ctx->task_ids[T], CPU(0));
+  settle(ctx);
+
+  rtems_test_assert(ctx->cpu[H] == 1);
+  rtems_test_assert(ctx->cpu[T] == 0);
+  rtems_test_assert(get_node(ctx->task_ids[T])->home == 0);
+
+  delete_tasks(ctx, T + 1);
+}
+
+/*
+ * The node X may only execute on processor 0, so it preempts Y there.  The
+ * preempted node Y has a higher priority than Z executing on processor 1, so
+ * Y must migrate to processor 1.
+ */
+static void test_migration(test_context *ctx)
+{
+  enum { Z, Y, X };
+
+  start_task(ctx, Z, 7, CPU(1));
+  settle(ctx);
+  rtems_test_assert(ctx->cpu[Z] == 1);
+
+  start_task(ctx, Y, 5, CPU(0) | CPU(1));
+  settle(ctx);
+  rtems_test_assert(ctx->cpu[Z] == 1);
+  rtems_test_assert(ctx->cpu[Y] == 0);
+
+  start_task(ctx, X, 4, CPU(0));
+  settle(ctx);
+  rtems_test_assert(ctx->cpu[Z] == NO_CPU);
+  rtems_test_assert(ctx->cpu[Y] == 1);
+  rtems_test_assert(ctx->cpu[X] == 0);
+
+  delete_tasks(ctx, X + 1);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  if (rtems_get_processor_count() < CPU_MAX) {
+    return;
+  }
+
+  ctx->scheduler = (Scheduler_work_stealing_SMP_Context *)
+    _Scheduler_Get_context(&_Scheduler_Table[0]);
+
+  /* Keep the processors 0 and 1 for the test tasks */
+  set_affinity(RTEMS_SELF, CPU(2));
+
+  test_stealing(ctx);
+  test_balancing(ctx);
+  test_affinity(ctx);
+  test_migration(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_MAX
+
+#define CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + TASK_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPOBJNAMEHASH 1";
+
+#define SEMA_COUNT 20
+
+#define ALLOCATION_SIZE 4
+
+static rtems_id sema_ids[SEMA_COUNT];
+
+static rtems_name sema_name(int i)
+{
+  return rtems_build_name('S', 'E', 'M', 'A' + i);
+}
+
+static void create_sema(rtems_name name, rtems_id *id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_create(
+    name,
+    1,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_sema(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void check_ident(rtems_name name, rtems_id expected_id)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_semaphore_ident(name, RTEMS_SEARCH_LOCAL_NODE, &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == expected_id);
+}
+
+static void check_no_ident(rtems_name name)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_semaphore_ident(name, RTEMS_SEARCH_LOCAL_NODE, &id);
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+}
+
+static void test_extend(void)
+{
+  int i;
+
+  /* Each ALLOCATION_SIZE semaphores extend and rebuild the index */
+  for (i = 0; i < SEMA_COUNT; ++i) {
+    create_sema(sema_name(i), &sema_ids[i]);
+  }
+
+  for (i = 0; i < SEMA_COUNT; ++i) {
+    check_ident(sema_name(i), sema_ids[i]);
+  }
+
+  check_no_ident(rtems_build_name('N', 'O', 'N', 'E'));
+}
+
+static void test_duplicate(void)
+{
+  rtems_id id;
+
+  create_sema(sema_name(0), &id);
+  rtems_test_assert(id > sema_ids[0]);
+  check_ident(sema_name(0), sema_ids[0]);
+
+  delete_sema(sema_ids[0]);
+  check_ident(sema_name(0), id);
+  sema_ids[0] = id;
+}
+
+static void test_set_name(void)
+{
+  rtems_status_code sc;
+  rtems_name new_name;
+
+  new_name = rtems_build_name('N', 'E', 'W', ' ');
+
+  sc = rtems_object_set_name(sema_ids[1], "NEW");
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  check_no_ident(sema_name(1));
+  check_ident(new_name, sema_ids[1]);
+
+  delete_sema(sema_ids[1]);
+  check_no_ident(new_name);
+  create_sema(sema_name(1), &sema_ids[1]);
+}
+
+static void test_delete_all(void)
+{
+  int i;
+
+  for (i = 0; i < SEMA_COUNT; ++i) {
+    delete_sema(sema_ids[i]);
+    check_no_ident(sema_name(i));
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_extend();
+  test_duplicate();
+  test_set_name();
+  test_delete_all();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES rtems_resource_unlimited(ALLOCATION_SIZE)
+
+#define CONFIGURE_OBJECT_NAME_HASH
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -43,6 +43,7 @@
 #include <rtems/posix/pthreadimpl.h>
 #include <rtems/posix/rwlockimpl.h>
 #include <rtems/posix/semaphoreimpl.h>
+#include <rtems/posix/shmimpl.h>
 #include <rtems/posix/spinlockimpl.h>
 #include <rtems/posix/timerimpl.h>
 #endif /* RTEMS_POSIX_API */
@@ -125,6 +126,10 @@ typedef enum {
 #endif /* RTEMS_POSIX_API */
   POSIX_KEYS_PRE,
   POSIX_KEYS_POST,
+#ifdef RTEMS_POSIX_API
+  POSIX_SHM_PRE,
+  POSIX_SHM_POST,
+#endif /* RTEMS_POSIX_API */
   IDLE_THREADS_PRE,
   IDLE_THREADS_POST,
   LIBIO_PRE,
@@ -571,6 +576,22 @@ LAST(RTEMS_SYSINIT_POSIX_KEYS)
   next_step(POSIX_KEYS_POST);
 }
 
+#ifdef RTEMS_POSIX_API
+
+FIRST(RTEMS_SYSINIT_POSIX_SHM)
+{
+  assert(_POSIX_Shm_Information.maximum == 0);
+  next_step(POSIX_SHM_PRE);
+}
+
+LAST(RTEMS_SYSINIT_POSIX_SHM)
+{
+  assert(_POSIX_Shm_Information.maximum != 0);
+  next_step(POSIX_SHM_POST);
+}
+
+#endif /* RTEMS_POSIX_API */
+
 FIRST(RTEMS_SYSINIT_IDLE_THREADS)
 {
   assert(_System_state_Is_before_initialization(_System_state_Get()));
@@ -767,6 +788,8 @@ static void *POSIX_Init(void *arg)
 
 #define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES 1
 
+#define CONFIGURE_MAXIMUM_POSIX_SHMS 1
+
 #define CONFIGURE_MAXIMUM_POSIX_SPINLOCKS 1
 
 #define CONFIGURE_MAXIMUM_POSIX_TIMERS 1
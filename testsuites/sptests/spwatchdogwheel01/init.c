@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems/counter.h>
+#include <rtems/score/watchdogimpl.h>
+
+const char rtems_test_name[] = "SPWATCHDOGWHEEL 1";
+
+#define WATCHDOG_COUNT 1024
+
+#define TICK_COUNT 4096
+
+typedef struct {
+  Watchdog_Control Base;
+  uint64_t fired;
+} test_watchdog;
+
+typedef struct {
+  Watchdog_Header header;
+  Watchdog_Wheel wheel;
+  test_watchdog watchdogs[WATCHDOG_COUNT];
+  uint64_t expire[WATCHDOG_COUNT];
+  uint64_t now;
+  uint32_t seed;
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t test_random(test_context *ctx)
+{
+  ctx->seed = ctx->seed * 1103515245 + 12345;
+
+  return ctx->seed >> 8;
+}
+
+static void test_watchdog_routine(Watchdog_Control *base)
+{
+  test_watchdog *watchdog = (test_watchdog *) base;
+
+  watchdog->fired = test_instance.now;
+}
+
+static void test_init(test_context *ctx, bool use_wheel)
+{
+  size_t i;
+
+  ctx->now = 0;
+  ctx->seed = 12345;
+
+  if (use_wheel) {
+    _Watchdog_Header_initialize_wheel(&ctx->header, &ctx->wheel, ctx->now);
+  } else {
+    _Watchdog_Header_initialize(&ctx->header);
+  }
+
+  for (i = 0; i < WATCHDOG_COUNT; ++i) {
+    test_watchdog *watchdog = &ctx->watchdogs[i];
+
+    _Watchdog_Preinitialize(&watchdog->Base, _Per_CPU_Get_snapshot());
+    _Watchdog_Initialize(&watchdog->Base, test_watchdog_routine);
+    watchdog->fired = 0;
+  }
+}
+
+static void test_tick(test_context *ctx)
+{
+  ISR_LOCK_DEFINE(, lock, "Test")
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire(&lock, &lock_context);
+  ++ctx->now;
+  _Watchdog_Tickle(&ctx->header, ctx->now, &lock, &lock_context);
+  _ISR_lock_Destroy(&lock);
+}
+
+static uint64_t test_expire(test_context *ctx, uint32_t range)
+{
+  return ctx->now + 1 + test_random(ctx) % range;
+}
+
+static void test_expiration(void)
+{
+  test_context *ctx = &test_instance;
+  uint64_t *expire = ctx->expire;
+  size_t i;
+
+  test_init(ctx, true);
+  rtems_test_assert(ctx->header.wheel == &ctx->wheel);
+
+  /* Cover all levels with the expiration times */
+  for (i = 0; i < WATCHDOG_COUNT; ++i) {
+    test_watchdog *watchdog = &ctx->watchdogs[i];
+    uint32_t range = 1U << (i % (WATCHDOG_WHEEL_LEVEL_COUNT * 4));
+
+    expire[i] = test_expire(ctx, range);
+    _Watchdog_Insert(&ctx->header, &watchdog->Base, expire[i]);
+    rtems_test_assert(_Watchdog_Is_scheduled(&watchdog->Base));
+  }
+
+  /* Cancel every third watchdog */
+  for (i = 0; i < WATCHDOG_COUNT; i += 3) {
+    test_watchdog *watchdog = &ctx->watchdogs[i];
+
+    _Watchdog_Remove(&ctx->header, &watchdog->Base);
+    rtems_test_assert(!_Watchdog_Is_scheduled(&watchdog->Base));
+  }
+
+  while (ctx->now < (1U << 20)) {
+    test_tick(ctx);
+  }
+
+  for (i = 0; i < WATCHDOG_COUNT; ++i) {
+    test_watchdog *watchdog = &ctx->watchdogs[i];
+
+    rtems_test_assert(!_Watchdog_Is_scheduled(&watchdog->Base));
+
+    if (i % 3 == 0) {
+      rtems_test_assert(watchdog->fired == 0);
+    } else {
+      rtems_test_assert(watchdog->fired == expire[i]);
+    }
+  }
+
+  /* A watchdog in the past expires with the next tick */
+  _Watchdog_Insert(&ctx->header, &ctx->watchdogs[0].Base, ctx->now - 1);
+  test_tick(ctx);
+  rtems_test_assert(ctx->watchdogs[0].fired == ctx->now);
+}
+
+static uint64_t test_ns(rtems_counter_ticks a, rtems_counter_ticks b)
+{
+  return rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+}
+
+static void test_benchmark(bool use_wheel, const char *name)
+{
+  test_context *ctx = &test_instance;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint64_t insert;
+  uint64_t cancel;
+  uint64_t tick_max;
+  uint64_t tick_sum;
+  size_t i;
+
+  test_init(ctx, use_wheel);
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < WATCHDOG_COUNT; ++i) {
+    _Watchdog_Insert(
+      &ctx->header,
+      &ctx->watchdogs[i].Base,
+      test_expire(ctx, TICK_COUNT)
+    );
+  }
+
+  b = rtems_counter_read();
+  insert = test_ns(a, b);
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < WATCHDOG_COUNT; ++i) {
+    _Watchdog_Remove(&ctx->header, &ctx->watchdogs[i].Base);
+  }
+
+  b = rtems_counter_read();
+  cancel = test_ns(a, b);
+
+  for (i = 0; i < WATCHDOG_COUNT; ++i) {
+    _Watchdog_Insert(
+      &ctx->header,
+      &ctx->watchdogs[i].Base,
+      test_expire(ctx, TICK_COUNT)
+    );
+  }
+
+  tick_max = 0;
+  tick_sum = 0;
+
+  for (i = 0; i < TICK_COUNT; ++i) {
+    uint64_t d;
+
+    a = rtems_counter_read();
+    test_tick(ctx);
+    b = rtems_counter_read();
+
+    d = test_ns(a, b);
+    tick_sum += d;
+
+    if (d > tick_max) {
+      tick_max = d;
+    }
+  }
+
+  for (i = 0; i < WATCHDOG_COUNT; ++i) {
+    rtems_test_assert(!_Watchdog_Is_scheduled(&ctx->watchdogs[i].Base));
+  }
+
+  printf(
+    "  <%s>\n"
+    "    <InsertPerWatchdog unit=\"ns\">%" PRIu64 "</InsertPerWatchdog>\n"
+    "    <CancelPerWatchdog unit=\"ns\">%" PRIu64 "</CancelPerWatchdog>\n"
+    "    <TickMean unit=\"ns\">%" PRIu64 "</TickMean>\n"
+    "    <TickMax unit=\"ns\">%" PRIu64 "</TickMax>\n"
+    "  </%s>\n",
+    name,
+    insert / WATCHDOG_COUNT,
+    cancel / WATCHDOG_COUNT,
+    tick_sum / TICK_COUNT,
+    tick_max,
+    name
+  );
+}
+
+static void test_system_wheel(void)
+{
+  const Per_CPU_Control *cpu;
+  rtems_status_code sc;
+
+  cpu = _Per_CPU_Get_by_index(0);
+  rtems_test_assert(
+    cpu->Watchdog.Header[PER_CPU_WATCHDOG_RELATIVE].wheel != NULL
+  );
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_interrupt_level level;
+
+  TEST_BEGIN();
+
+  test_system_wheel();
+
+  rtems_interrupt_local_disable(level);
+  test_expiration();
+  rtems_interrupt_local_enable(level);
+
+  printf(
+    "<SPWatchdogWheel01 watchdogCount=\"%i\" tickCount=\"%i\">\n",
+    WATCHDOG_COUNT,
+    TICK_COUNT
+  );
+
+  rtems_interrupt_local_disable(level);
+  test_benchmark(false, "RedBlackTree");
+  test_benchmark(true, "TimerWheel");
+  rtems_interrupt_local_enable(level);
+
+  printf("</SPWatchdogWheel01>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_WATCHDOG_TIMER_WHEEL
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
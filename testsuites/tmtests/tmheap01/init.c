@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/heapimpl.h>
+
+const char rtems_test_name[] = "TMHEAP 1";
+
+#define AREA_SIZE (512 * 1024)
+
+#define SAMPLE_COUNT 1000
+
+#define BLOCK_COUNT 512
+
+typedef struct {
+  Heap_Control heap;
+  void *area;
+  void *blocks[BLOCK_COUNT];
+  uint32_t seed;
+} test_context;
+
+static test_context test_instance;
+
+static uintptr_t random_size(test_context *ctx)
+{
+  ctx->seed = ctx->seed * 1103515245 + 12345;
+
+  return 16 + ((ctx->seed >> 16) % 1009);
+}
+
+/*
+ * Fill about half of the heap with blocks of random sizes and free every
+ * second one.  This leaves a long list of small free blocks in front of the
+ * large free block at the end of the area.
+ */
+static uint32_t fragment(test_context *ctx)
+{
+  Heap_Information info;
+  size_t i;
+
+  for (i = 0; i < BLOCK_COUNT; ++i) {
+    ctx->blocks[i] = _Heap_Allocate(&ctx->heap, random_size(ctx));
+    rtems_test_assert(ctx->blocks[i] != NULL);
+  }
+
+  for (i = 0; i < BLOCK_COUNT; i += 2) {
+    _Heap_Free(&ctx->heap, ctx->blocks[i]);
+    ctx->blocks[i] = NULL;
+  }
+
+  _Heap_Get_free_information(&ctx->heap, &info);
+
+  return info.number;
+}
+
+static void print_value(const char *name, uint64_t ns)
+{
+  printf("<%s unit=\"ns\">%" PRIu64 "</%s>", name, ns, name);
+}
+
+static void measure(test_context *ctx, uintptr_t alignment)
+{
+  uint64_t alloc_max = 0;
+  uint64_t alloc_total = 0;
+  uint64_t free_max = 0;
+  uint64_t free_total = 0;
+  size_t i;
+
+  ctx->heap.stats.max_search = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_interrupt_level level;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks c;
+    uint64_t d;
+    uintptr_t size;
+    void *p;
+    bool ok;
+
+    size = random_size(ctx) + 1024;
+
+    rtems_interrupt_local_disable(level);
+    a = rtems_counter_read();
+    p = _Heap_Allocate_aligned_with_boundary(&ctx->heap, size, alignment, 0);
+    b = rtems_counter_read();
+    ok = _Heap_Free(&ctx->heap, p);
+    c = rtems_counter_read();
+    rtems_interrupt_local_enable(level);
+
+    rtems_test_assert(p != NULL);
+    rtems_test_assert(ok);
+
+    d = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+    alloc_total += d;
+    if (d > alloc_max) {
+      alloc_max = d;
+    }
+
+    d = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(c, b));
+    free_total += d;
+    if (d > free_max) {
+      free_max = d;
+    }
+  }
+
+  printf("    <Allocate alignment=\"%" PRIuPTR "\">", alignment);
+  print_value("Max", alloc_max);
+  print_value("Mean", alloc_total / SAMPLE_COUNT);
+  printf(
+    "<MaxSearch>%" PRIu32 "</MaxSearch></Allocate>\n",
+    ctx->heap.stats.max_search
+  );
+
+  printf("    <Free alignment=\"%" PRIuPTR "\">", alignment);
+  print_value("Max", free_max);
+  print_value("Mean", free_total / SAMPLE_COUNT);
+  printf("</Free>\n");
+}
+
+static void test_heap(
+  test_context *ctx,
+  Heap_Initialization_or_extend_handler init,
+  const char *method
+)
+{
+  uintptr_t space_available;
+  uint32_t free_blocks;
+
+  ctx->seed = 0;
+
+  space_available = (*init)(&ctx->heap, ctx->area, AREA_SIZE, 0);
+  rtems_test_assert(space_available > 0);
+
+  free_blocks = fragment(ctx);
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+
+  printf(
+    "  <Heap method=\"%s\" freeBlocks=\"%" PRIu32 "\">\n",
+    method,
+    free_blocks
+  );
+
+  measure(ctx, 0);
+  measure(ctx, 64);
+
+  printf("  </Heap>\n");
+
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  ctx->area = malloc(AREA_SIZE);
+  rtems_test_assert(ctx->area != NULL);
+
+  printf(
+    "<TMHeap01 areaSize=\"%u\" sampleCount=\"%u\">\n",
+    AREA_SIZE,
+    SAMPLE_COUNT
+  );
+
+  test_heap(ctx, _Heap_Initialize, "FirstFit");
+  test_heap(ctx, _Heap_Initialize_TLSF, "TLSF");
+
+  printf("</TMHeap01>\n");
+
+  free(ctx->area);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MALLOC_TLSF
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * The license and distribution terms for this file may be
+ * found in the file LICENSE in this distribution or at
+ * http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMMSGQ 1";
+
+#define MAXIMUM_MESSAGE_SIZE (64 * 1024)
+
+#define MESSAGE_COUNT 2
+
+#define SAMPLE_COUNT 16
+
+typedef struct {
+  rtems_id queue;
+  rtems_id worker;
+  rtems_id master;
+  bool receive_ref;
+  void *received_buffer;
+  size_t received_size;
+  uint8_t send_buffer[MAXIMUM_MESSAGE_SIZE];
+  uint8_t receive_buffer[MAXIMUM_MESSAGE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static void create_queue(test_context *ctx, size_t size)
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('M', 'S', 'G', 'Q'),
+    MESSAGE_COUNT,
+    size,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_queue(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void fill(void *buffer, size_t size, uint8_t seed)
+{
+  uint8_t *b = buffer;
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    b[i] = (uint8_t) (seed + i);
+  }
+}
+
+static bool check(const void *buffer, size_t size, uint8_t seed)
+{
+  const uint8_t *b = buffer;
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    if (b[i] != (uint8_t) (seed + i)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    if (ctx->receive_ref) {
+      sc = rtems_message_queue_receive_ref(
+        ctx->queue,
+        &ctx->received_buffer,
+        &ctx->received_size,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+    } else {
+      ctx->received_buffer = ctx->receive_buffer;
+      sc = rtems_message_queue_receive(
+        ctx->queue,
+        ctx->receive_buffer,
+        &ctx->received_size,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+    }
+
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_transient_send(ctx->master);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_loan_and_return(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffers[MESSAGE_COUNT];
+  void *buffer;
+  size_t size;
+  int i;
+
+  create_queue(ctx, 16);
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_get_buffer(0, &buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    sc = rtems_message_queue_get_buffer(ctx->queue, &buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_message_queue_send(ctx->queue, ctx->send_buffer, 1);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, ctx->send_buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_return_buffer(
+    ctx->queue,
+    (char *) buffers[0] + 1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_ref(ctx->queue, ctx->send_buffer, 1);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_ref(ctx->queue, buffers[0], 17);
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  fill(buffers[0], 16, 1);
+  sc = rtems_message_queue_send_ref(ctx->queue, buffers[0], 16);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* A pending message buffer is not on loan */
+  sc = rtems_message_queue_send_ref(ctx->queue, buffers[0], 16);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, buffers[0]);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  /* No deletion while a message buffer is on loan */
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, buffers[1]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* An inactive message buffer is not on loan */
+  sc = rtems_message_queue_return_buffer(ctx->queue, buffers[1]);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_ref(ctx->queue, buffers[1], 16);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  /* Receive by reference a message sent by copy */
+  fill(ctx->send_buffer, 15, 2);
+  sc = rtems_message_queue_send(ctx->queue, ctx->send_buffer, 15);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The message sent by reference is the first one in the queue */
+  sc = rtems_message_queue_receive_ref(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(buffer == buffers[0]);
+  rtems_test_assert(size == 16);
+  rtems_test_assert(check(buffer, size, 1));
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_receive_ref(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(size == 15);
+  rtems_test_assert(check(buffer, size, 2));
+
+  /* Send the received message again without a copy */
+  sc = rtems_message_queue_send_ref(ctx->queue, buffer, size);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(ctx->receive_buffer, 0, sizeof(ctx->receive_buffer));
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    ctx->receive_buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(size == 15);
+  rtems_test_assert(check(ctx->receive_buffer, size, 2));
+
+  sc = rtems_message_queue_receive_ref(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_message_queue_receive_ref(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_WAIT,
+    1
+  );
+  rtems_test_assert(sc == RTEMS_TIMEOUT);
+
+  delete_queue(ctx);
+}
+
+static void test_waiting_receiver(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffers[MESSAGE_COUNT];
+  void *buffer;
+
+  create_queue(ctx, 16);
+
+  /* Waiting receiver by reference, send by copy */
+  ctx->receive_ref = true;
+  sc = rtems_task_start(ctx->worker, worker_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fill(ctx->send_buffer, 14, 3);
+  sc = rtems_message_queue_send(ctx->queue, ctx->send_buffer, 14);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->received_size == 14);
+  rtems_test_assert(check(ctx->received_buffer, 14, 3));
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, ctx->received_buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Waiting receiver by reference, send by reference */
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fill(buffer, 13, 4);
+  sc = rtems_message_queue_send_ref(ctx->queue, buffer, 13);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->received_buffer == buffer);
+  rtems_test_assert(ctx->received_size == 13);
+  rtems_test_assert(check(ctx->received_buffer, 13, 4));
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, ctx->received_buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Waiting receiver by copy, send by reference */
+  ctx->receive_ref = false;
+  sc = rtems_task_restart(ctx->worker, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fill(buffer, 12, 5);
+  sc = rtems_message_queue_send_ref(ctx->queue, buffer, 12);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->received_buffer == ctx->receive_buffer);
+  rtems_test_assert(ctx->received_size == 12);
+  rtems_test_assert(check(ctx->received_buffer, 12, 5));
+
+  /* The message buffer returned to the queue */
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffers[0]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffers[1]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, buffers[0]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_return_buffer(ctx->queue, buffers[1]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(ctx->worker);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  delete_queue(ctx);
+}
+
+static rtems_counter_ticks measure_copy(test_context *ctx, size_t size)
+{
+  rtems_status_code sc;
+  rtems_status_code sc2;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  size_t received_size;
+
+  a = rtems_counter_read();
+  sc = rtems_message_queue_send(ctx->queue, ctx->send_buffer, size);
+  sc2 = rtems_message_queue_receive(
+    ctx->queue,
+    ctx->receive_buffer,
+    &received_size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  b = rtems_counter_read();
+
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(sc2 == RTEMS_SUCCESSFUL);
+  rtems_test_assert(received_size == size);
+
+  return rtems_counter_difference(b, a);
+}
+
+static rtems_counter_ticks measure_ref(test_context *ctx, size_t size)
+{
+  rtems_status_code sc;
+  rtems_status_code sc2;
+  rtems_status_code sc3;
+  rtems_status_code sc4;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  void *buffer;
+  void *received_buffer;
+  size_t received_size;
+
+  a = rtems_counter_read();
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  sc2 = rtems_message_queue_send_ref(ctx->queue, buffer, size);
+  sc3 = rtems_message_queue_receive_ref(
+    ctx->queue,
+    &received_buffer,
+    &received_size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  sc4 = rtems_message_queue_return_buffer(ctx->queue, received_buffer);
+  b = rtems_counter_read();
+
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(sc2 == RTEMS_SUCCESSFUL);
+  rtems_test_assert(sc3 == RTEMS_SUCCESSFUL);
+  rtems_test_assert(sc4 == RTEMS_SUCCESSFUL);
+  rtems_test_assert(received_buffer == buffer);
+  rtems_test_assert(received_size == size);
+
+  return rtems_counter_difference(b, a);
+}
+
+static void print_min(
+  const char *name,
+  test_context *ctx,
+  size_t size,
+  rtems_counter_ticks (*measure)(test_context *, size_t)
+)
+{
+  rtems_counter_ticks min;
+  int i;
+
+  min = (*measure)(ctx, size);
+
+  for (i = 1; i < SAMPLE_COUNT; ++i) {
+    rtems_counter_ticks d;
+
+    d = (*measure)(ctx, size);
+    if (d < min) {
+      min = d;
+    }
+  }
+
+  printf(
+    "<%s unit=\"ns\">%" PRIu64 "</%s>",
+    name,
+    rtems_counter_ticks_to_nanoseconds(min),
+    name
+  );
+}
+
+static void test_latency(test_context *ctx)
+{
+  size_t size;
+
+  printf("<TMMsgQ01 sampleCount=\"%i\">\n", SAMPLE_COUNT);
+
+  fill(ctx->send_buffer, sizeof(ctx->send_buffer), 6);
+
+  for (size = 16; size <= MAXIMUM_MESSAGE_SIZE; size *= 4) {
+    create_queue(ctx, size);
+
+    printf("  <Sample>\n    <MessageSize>%zu</MessageSize>", size);
+    print_min("Copy", ctx, size, measure_copy);
+    print_min("Reference", ctx, size, measure_ref);
+    printf("\n  </Sample>\n");
+
+    delete_queue(ctx);
+  }
+
+  printf("</TMMsgQ01>\n");
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  ctx->master = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_loan_and_return(ctx);
+  test_waiting_receiver(ctx);
+  test_latency(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT, MAXIMUM_MESSAGE_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>